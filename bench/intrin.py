@@ -0,0 +1,106 @@
+# indent size: 2
+# encoding: utf-8
+
+# builds bench/intrin.yw under several optimization settings and checks that every *_wrap kernel
+# compiles to the same code as its *_raw twin: no calls into the intrin namespace, no more vector spills
+# and no slower than noise (usage: python bench/intrin.py, from the repository root)
+
+import os
+import re
+import sys
+import json
+import subprocess
+
+yw_file = "bench/intrin.yw"
+asm_file = yw_file.replace(".yw", ".asm")
+exe_file = yw_file.replace(".yw", ".exe")
+json_file = yw_file.replace(".yw", ".bench.json")
+
+# (name, flags, checked): /Od alone ignores __forceinline and is only reported, /Ob1 makes it inline again
+configs = [
+  ("debug", "/Od", False),
+  ("debug-inline", "/Od /Ob1", True),
+  ("O1", "/O1 /DNDEBUG", True),
+  ("O2", "/O2 /DNDEBUG", True),
+  ("bench", "/O2 /Ob3 /Oi /GS- /DNDEBUG", True),
+]
+
+# a call into intrin:: shows up as a call to a symbol mangled with "@intrin@@"
+call_re = re.compile(r"^\s+call\s+(\S+)", re.IGNORECASE)
+# a vector register stored to or loaded from the stack frame
+spill_re = re.compile(r"[xyz]mmword ptr \[r[sb]p", re.IGNORECASE)
+proc_re = re.compile(r"^(\S+)\s+PROC\b.*;\s*(\w+)")
+
+def kernels(path):
+  """returns {kernel: (intrin calls, other calls, spills)} for every *_raw and *_wrap function in the listing"""
+  result = {}
+  name = None
+  with open(path, "r", encoding="utf-8", errors="replace") as f:
+    for line in f:
+      m = proc_re.match(line)
+      if m:
+        name = m.group(2) if re.search(r"_(raw|wrap)$", m.group(2)) else None
+        if name:
+          result[name] = [0, 0, 0]
+        continue
+      if name is None:
+        continue
+      if re.match(r"^\S+\s+ENDP\b", line):
+        name = None
+        continue
+      m = call_re.match(line)
+      if m:
+        result[name][0 if "@intrin@@" in m.group(1) else 1] += 1
+      if spill_re.search(line):
+        result[name][2] += 1
+  return result
+
+def timings():
+  """returns {benchmark name: (median ns, mad ns)} from the last run"""
+  with open(json_file, "r", encoding="utf-8") as f:
+    return {b["name"]: (b["median_ns"], b["mad_ns"]) for b in json.load(f)["benchmarks"]}
+
+failed = False
+for config, flags, checked in configs:
+  print(f"\n== {config}: {flags}")
+  for file in (asm_file, exe_file, json_file):
+    if os.path.exists(file):
+      os.remove(file)
+  subprocess.run([sys.executable, "ywlang.py", yw_file, f"--flags={flags}", "--asm"])
+  if not os.path.exists(asm_file) or not os.path.exists(exe_file):
+    print(f"Error: {yw_file} did not build with {flags}")
+    failed = True
+    continue
+  code = kernels(asm_file)
+  if subprocess.run([os.path.normpath(exe_file), "--json", json_file, "--min-time", "0.2"]).returncode != 0:
+    print("Error: wrapped and raw kernels differ")
+    failed = True
+    continue
+  times = timings()
+  print(f"\n{'kernel':<10}{'calls':>12}{'spills':>14}{'raw ns':>12}{'wrap ns':>12}{'change':>10}")
+  for kernel in sorted({k.rsplit("_", 1)[0] for k in code}):
+    raw, wrap = code.get(f"{kernel}_raw"), code.get(f"{kernel}_wrap")
+    if raw is None or wrap is None:
+      print(f"{kernel:<10}  not found in {asm_file}")
+      failed |= checked
+      continue
+    (t_raw, mad_raw), (t_wrap, mad_wrap) = times[f"{kernel} raw"], times[f"{kernel} wrap"]
+    change = t_wrap / t_raw - 1
+    slower = change > max(3 * max(mad_raw, mad_wrap) / t_raw, 0.02)
+    problems = []
+    if wrap[0] > 0:
+      problems.append(f"{wrap[0]} intrin calls")
+    # unoptimized code spills everything and runs at the whim of the spills, so only calls count there
+    if wrap[2] > raw[2] and not flags.startswith("/Od"):
+      problems.append("more spills")
+    if slower and not flags.startswith("/Od"):
+      problems.append("slower")
+    verdict = ", ".join(problems) if checked else ("(" + ", ".join(problems) + ")" if problems else "")
+    print(f"{kernel:<10}{raw[1]:>5} /{wrap[0] + wrap[1]:>5}{raw[2]:>7} /{wrap[2]:>5}{t_raw:>12.1f}{t_wrap:>12.1f}{change * 100:>+9.1f}%  {verdict}")
+    failed |= checked and bool(problems)
+
+for file in (asm_file, json_file):
+  if os.path.exists(file):
+    os.remove(file)
+print("\nintrin wrappers: " + ("FAILED" if failed else "ok"))
+sys.exit(1 if failed else 0)
@@ -6,6 +6,7 @@ import re
 import sys
 import glob
 import json
+import shutil
 import subprocess
 
 env_json = {}
@@ -37,10 +38,16 @@ if not os.path.exists('ywlib.ifc') or not os.path.exists('ywlib.obj'):
   sys.exit(1)
 
 # translates .yw file to .cpp file
+# (the first *.yw argument, or the first *.yw file in the current directory)
 yw_file = None
-for file in glob.glob("*.yw"):
-  yw_file = file
-  break
+for arg in sys.argv[1:]:
+  if arg.endswith(".yw"):
+    yw_file = arg
+    break
+if yw_file is None:
+  for file in glob.glob("*.yw"):
+    yw_file = file
+    break
 if yw_file is None:
   print("*.yw file not found")
   sys.exit(1)
@@ -61,31 +68,104 @@ if yw is None:
 # convert "..." to literal_string("...")
 # yw = re.sub(r"\"(.*?)\"", r'literal_string("\1")', yw)
 
+# "--trace" puts a yw::trace::scope at the top of every function defined at the start of a line
+# (constexpr ones and those marked "// notrace" aside) and after every "{" followed by "// trace: <name>", on the same line so
+# that line numbers stay put, and writes *.trace.json at exit; a function whose "{" is so marked gets only the named scope
+trace = "--trace" in sys.argv
+function_re = re.compile(r"^(?![#/\s])(?!.*\bconst(?:expr|eval)\b)(?!.*//\s*(?:notrace|trace:))([^;{}=()]*\([^;{}]*\)[^;{}()]*?)\{", re.MULTILINE)
+annotated_re = re.compile(r"\{(\s*//\s*trace:\s*(.*?)\s*)$", re.MULTILINE)
+def instrument(source):
+  """returns the source with trace scopes inserted"""
+  def line_of(m):
+    return source.count("\n", 0, m.start()) + 1
+  source = annotated_re.sub(lambda m: f"{{ const yw::trace::scope yw_trace_{line_of(m)}({json.dumps(m.group(2) or f'line {line_of(m)}')});{m.group(1)}", source)
+  return function_re.sub(lambda m: f"{m.group(1)}{{ const yw::trace::scope yw_trace_{line_of(m)}(__FUNCTION__);", source)
+if trace:
+  yw = instrument(yw)
+
 with open(cpp_file, "w", encoding="utf-8") as f:
   f.write("#include \"ywstd.hpp\"\n")
   f.write("#include \"ywlib.hpp\"\n")
   f.write("using namespace yw;\n")
   f.write("#define nat size_t\n")
   f.write("#define fat double\n")
+  if trace:
+    trace_file = yw_file.replace(".yw", ".trace.json").replace("\\", "/")
+    f.write(f"static const bool yw_trace = (yw::trace::start(), yw::trace::write_at_exit({json.dumps(trace_file)}), true);\n")
   f.write(yw)
-  f.write("\nint main() {}\n")
+  # programs that define their own main are left as they are
+  if re.search(r"\bint\s+main\s*\(", yw) is None:
+    f.write("\nint main() {}\n")
 
 # compile the C++ file
-args = [cl_exe, cpp_file, "/std:c++latest", "/EHsc", "/nologo", "/W4", "/O2", "/Qpar", "/utf-8", "/DYWLIB_IMPORT=true", "/DYWSTD_IMPORT=true", ]
+obj_file = yw_file.replace(".yw", ".obj")
+bench = "--bench" in sys.argv
+# benchmarks build without the auto-parallelizer and with full inlining, intrinsics and no security checks
+opt_flags = ["/O2", "/Ob3", "/Oi", "/GS-", "/DNDEBUG", ] if bench else ["/O2", "/Qpar", ]
+# "--flags=/Od /Ob1" replaces the optimization flags, "--asm" also writes an assembly listing to *.asm
+for arg in sys.argv[1:]:
+  if arg.startswith("--flags="):
+    opt_flags = arg[len("--flags="):].split()
+if "--asm" in sys.argv:
+  opt_flags += ["/FAs", f"/Fa{yw_file.replace('.yw', '.asm')}", ]
+# "--track-allocations" compiles in the yw::alloc operator new/delete hooks, which report at exit
+if "--track-allocations" in sys.argv:
+  opt_flags += ["/DYW_TRACK_ALLOCATIONS=1", ]
+args = [cl_exe, cpp_file, "/std:c++latest", "/EHsc", "/nologo", "/W4", *opt_flags, "/utf-8", "/DYWLIB_IMPORT=true", "/DYWSTD_IMPORT=true", ]
+args += ["/I.", f"/Fe{exe_file}", f"/Fo{obj_file}", ]
 # args += [f"/I{msvc_inc}", f"/I{ucrt_inc}", f"/I{um_inc}", f"/I{shared_inc}", f"/I{winrt_inc}", f"/I{cppwinrt_inc}", ]
 args += ["/reference ywstd=ywstd.ifc", "/reference ywlib=ywlib.ifc", "ywstd.obj", "ywlib.obj", f"/link /LIBPATH:{msvc_lib} /LIBPATH:{ucrt_lib} /LIBPATH:{um_lib}", ]
 subprocess.run(args)
-obj_file = yw_file.replace(".yw", ".obj")
 if os.path.exists(obj_file):
   os.remove(obj_file)
 
 if "--run" in sys.argv:
   if os.path.exists(exe_file):
-    os.system(exe_file)
+    os.system(os.path.normpath(exe_file))
   else:
     print(f"Error: {exe_file} not found")
     sys.exit(1)
 
+# runs a yw::bench::suite program with "--json", then compares the results with the saved baseline
+# (arguments after "--" are passed to the program, "--save-baseline" replaces the baseline)
+if bench:
+  if not os.path.exists(exe_file):
+    print(f"Error: {exe_file} not found")
+    sys.exit(1)
+  json_file = yw_file.replace(".yw", ".bench.json")
+  baseline_file = yw_file.replace(".yw", ".baseline.json")
+  extra = sys.argv[sys.argv.index("--") + 1:] if "--" in sys.argv else []
+  subprocess.run([os.path.normpath(exe_file), "--json", json_file, *extra])
+  if not os.path.exists(json_file):
+    print(f"Error: {json_file} not written (does main construct yw::bench::suite from argc and argv?)")
+    sys.exit(1)
+  with open(json_file, "r", encoding="utf-8") as f:
+    results = json.load(f)["benchmarks"]
+  regressed = False
+  if os.path.exists(baseline_file):
+    with open(baseline_file, "r", encoding="utf-8") as f:
+      baseline = {(b["name"], b["size"]): b for b in json.load(f)["benchmarks"]}
+    print(f"\n{'benchmark':<36}{'baseline ns':>14}{'now ns':>14}{'change':>10}")
+    for r in results:
+      b = baseline.get((r["name"], r["size"]))
+      if b is None:
+        continue
+      label = f"{r['name']}/{r['size']}" if r["size"] else r["name"]
+      change = r["median_ns"] / b["median_ns"] - 1
+      # a change counts if it is beyond 3 MADs of either run and beyond 2%
+      noise = 3 * max(r["mad_ns"], b["mad_ns"]) / b["median_ns"]
+      verdict = ""
+      if abs(change) > max(noise, 0.02):
+        verdict = "slower" if change > 0 else "faster"
+        regressed |= change > 0
+      print(f"{label:<36}{b['median_ns']:>14.2f}{r['median_ns']:>14.2f}{change * 100:>+9.1f}%  {verdict}")
+  else:
+    print(f"No baseline {baseline_file}; run with --save-baseline to save one")
+  if "--save-baseline" in sys.argv:
+    shutil.copyfile(json_file, baseline_file)
+    print(f"Saved {baseline_file}")
+  sys.exit(1 if regressed else 0)
+
 
 #   f.write("#define fat double\n")
 #   f.write("#include <format>\n")
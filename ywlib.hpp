@@ -13,4 +13,7333 @@ inline const int number = 1234;
 
 }
 
+export namespace yw { // core
+
+using nat = std::size_t;
+using fat = double;
+
+inline constexpr nat npos = nat(-1);
+}
+
+export namespace yw { // cpu
+
+/// instruction set extensions usable at run time (AVX ones only if the OS saves their registers)
+struct cpu_features {
+  bool sse41, sse42, popcnt, aes, avx, fma, f16c, avx2, bmi2, erms, avx512f, avx512bw;
+};
+
+namespace cpu_impl {
+
+inline cpu_features detect() noexcept {
+  int r[4];
+  intrin::cpuid(r, 0);
+  const int leaves = r[0];
+  intrin::cpuid(r, 1);
+  const unsigned c1 = r[2];
+  unsigned b7 = 0;
+  if (leaves >= 7) intrin::cpuidex(r, 7, 0), b7 = r[1];
+  const auto xcr0 = c1 >> 27 & 1 ? intrin::xgetbv(0) : 0;
+  const bool ymm = (xcr0 & 0x06) == 0x06, zmm = (xcr0 & 0xe6) == 0xe6;
+  cpu_features f{};
+  f.sse41 = c1 >> 19 & 1, f.sse42 = c1 >> 20 & 1, f.popcnt = c1 >> 23 & 1, f.aes = c1 >> 25 & 1;
+  f.avx = ymm && c1 >> 28 & 1, f.fma = ymm && c1 >> 12 & 1, f.f16c = ymm && c1 >> 29 & 1;
+  f.avx2 = ymm && b7 >> 5 & 1, f.bmi2 = b7 >> 8 & 1, f.erms = b7 >> 9 & 1;
+  f.avx512f = zmm && b7 >> 16 & 1, f.avx512bw = zmm && b7 >> 30 & 1;
+  return f;
+}
+}
+
+/// features of the running CPU; SSE4.1 is assumed throughout, wider kernels check this
+inline const cpu_features cpu = cpu_impl::detect();
+}
+
+export namespace yw { // string
+
+using string_view = std::string_view;
+
+/// monotonic arena usable as the memory resource of `string`
+using arena = std::pmr::monotonic_buffer_resource;
+
+template<nat N> struct literal_string {
+  static constexpr nat count = N;
+  const char* string;
+  consteval literal_string(const char (&s)[N + 1]) noexcept : string(s) {}
+  constexpr operator string_view() const noexcept { return {string, N}; }
+  constexpr bool empty() const noexcept { return !count; }
+  constexpr nat size() const noexcept { return count; }
+  constexpr const char* data() const noexcept { return string; }
+  constexpr const char* begin() const noexcept { return string; }
+  constexpr const char* end() const noexcept { return string + count; }
+  constexpr char operator[](nat i) const noexcept { return string[i]; }
+  constexpr char front() const noexcept { return string[0]; }
+  constexpr char back() const noexcept { return string[count - 1]; }
+};
+template<nat N> literal_string(const char (&)[N]) -> literal_string<N - 1>;
+
+/// immutable-when-shared string with a 30-byte inline buffer
+///
+/// - up to 30 characters are stored inline without allocation
+/// - strings made from `literal_string` point at the literal without copying
+/// - longer strings live in a reference-counted block; copies share the block
+///   and the first mutation of a shared block copies it (copy-on-write)
+/// - blocks are allocated from a `std::pmr::memory_resource` (e.g. `arena`);
+///   strings growing out of the inline buffer use the default resource
+class string {
+  struct block {
+    std::atomic<nat> refs;
+    nat capacity;
+    std::pmr::memory_resource* resource;
+    char* data() noexcept { return reinterpret_cast<char*>(this + 1); }
+  };
+  struct far_t {
+    const char* ptr;
+    nat size;
+    block* blk;
+  };
+
+  static constexpr nat _local_capacity = 30;
+  static constexpr unsigned char _literal_tag = 0x40;
+  static constexpr unsigned char _shared_tag = 0x80;
+
+  /// inline characters, or a `far_t`; the last byte is the tag:
+  /// `0..30` for the inline size, `_literal_tag` or `_shared_tag` otherwise
+  alignas(far_t) char _raw[32];
+
+  unsigned char _tag() const noexcept { return static_cast<unsigned char>(_raw[31]); }
+  void _tag(unsigned char t) noexcept { _raw[31] = static_cast<char>(t); }
+  far_t _far() const noexcept { far_t f; std::memcpy(&f, _raw, sizeof(f)); return f; }
+  void _far(const far_t& f, unsigned char t) noexcept { std::memcpy(_raw, &f, sizeof(f)), _tag(t); }
+  bool _is_local() const noexcept { return _tag() <= _local_capacity; }
+  bool _is_shared() const noexcept { return _tag() == _shared_tag; }
+
+  static block* _allocate(nat capacity, std::pmr::memory_resource* mr) {
+    if (!mr) mr = std::pmr::get_default_resource();
+    auto p = static_cast<block*>(mr->allocate(sizeof(block) + capacity + 1, alignof(block)));
+    p->refs.store(1, std::memory_order_relaxed);
+    p->capacity = capacity;
+    p->resource = mr;
+    return p;
+  }
+
+  static void _release(block* p) noexcept {
+    if (p->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      p->resource->deallocate(p, sizeof(block) + p->capacity + 1, alignof(block));
+  }
+
+  void _reset() noexcept { _raw[0] = '\0', _tag(0); }
+
+  void _assign(string_view sv, std::pmr::memory_resource* mr) {
+    if (sv.size() <= _local_capacity) {
+      std::memcpy(_raw, sv.data(), sv.size());
+      _raw[sv.size()] = '\0';
+      _tag(static_cast<unsigned char>(sv.size()));
+    } else {
+      auto p = _allocate(sv.size(), mr);
+      std::memcpy(p->data(), sv.data(), sv.size());
+      p->data()[sv.size()] = '\0';
+      _far({p->data(), sv.size(), p}, _shared_tag);
+    }
+  }
+
+  /// returns writable storage with at least `n` bytes of capacity, or `nullptr`
+  char* _writable(nat n) noexcept {
+    if (_is_local()) return n <= _local_capacity ? _raw : nullptr;
+    if (!_is_shared()) return nullptr;
+    auto p = _far().blk;
+    return p->capacity >= n && p->refs.load(std::memory_order_acquire) == 1 ? p->data() : nullptr;
+  }
+
+  void _set_size(nat n) noexcept {
+    if (_is_local()) _raw[n] = '\0', _tag(static_cast<unsigned char>(n));
+    else {
+      auto f = _far();
+      f.blk->data()[n] = '\0', f.size = n;
+      _far(f, _shared_tag);
+    }
+  }
+
+  /// moves the contents into a fresh unshared block of capacity `n`
+  void _regrow(nat n) {
+    const auto s = size();
+    auto p = _allocate(n, _is_shared() ? _far().blk->resource : nullptr);
+    std::memcpy(p->data(), data(), s);
+    p->data()[s] = '\0';
+    if (_is_shared()) _release(_far().blk);
+    _far({p->data(), s, p}, _shared_tag);
+  }
+
+public:
+  static constexpr nat local_capacity = _local_capacity;
+
+  ~string() noexcept { if (_is_shared()) _release(_far().blk); }
+  string() noexcept { _reset(); }
+  string(const string& s) noexcept {
+    std::memcpy(_raw, s._raw, sizeof(_raw));
+    if (_is_shared()) _far().blk->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  string(string&& s) noexcept {
+    std::memcpy(_raw, s._raw, sizeof(_raw));
+    s._reset();
+  }
+  string& operator=(const string& s) noexcept { return *this = string(s); }
+  string& operator=(string&& s) noexcept {
+    if (this != &s) {
+      if (_is_shared()) _release(_far().blk);
+      std::memcpy(_raw, s._raw, sizeof(_raw));
+      s._reset();
+    }
+    return *this;
+  }
+
+  /// refers to the literal without copying
+  template<nat N> string(const literal_string<N>& s) noexcept { _far({s.string, N, nullptr}, _literal_tag); }
+  string(const char* s) : string(string_view(s)) {}
+  string(string_view sv, std::pmr::memory_resource* mr = nullptr) { _assign(sv, mr); }
+  explicit string(const std::string& s, std::pmr::memory_resource* mr = nullptr) : string(string_view(s), mr) {}
+
+  bool empty() const noexcept { return size() == 0; }
+  nat size() const noexcept { return _is_local() ? _tag() : _far().size; }
+  nat capacity() const noexcept {
+    return _is_local() ? _local_capacity : _is_shared() ? _far().blk->capacity : _far().size;
+  }
+  const char* data() const noexcept { return _is_local() ? _raw : _far().ptr; }
+  const char* c_str() const noexcept { return data(); }
+  const char* begin() const noexcept { return data(); }
+  const char* end() const noexcept { return data() + size(); }
+  char operator[](nat i) const noexcept { return data()[i]; }
+  char front() const noexcept { return data()[0]; }
+  char back() const noexcept { return data()[size() - 1]; }
+
+  /// checks if the contents point at a `literal_string`
+  bool is_literal() const noexcept { return _tag() == _literal_tag; }
+  /// checks if the contents live in a block shared with other strings
+  bool is_shared() const noexcept { return _is_shared() && _far().blk->refs.load(std::memory_order_relaxed) > 1; }
+
+  operator string_view() const noexcept { return {data(), size()}; }
+  explicit operator std::string() const { return {data(), size()}; }
+
+  void clear() noexcept {
+    if (_is_shared()) _release(_far().blk);
+    _reset();
+  }
+
+  void reserve(nat n) {
+    if (n > capacity() || !_writable(size())) _regrow(n > size() ? n : size());
+  }
+
+  string& append(string_view sv) {
+    const auto n = size(), m = n + sv.size();
+    if (auto p = _writable(m)) {
+      std::memmove(p + n, sv.data(), sv.size());
+      _set_size(m);
+      return *this;
+    }
+    auto p = _allocate(m > 2 * n ? m : 2 * n, _is_shared() ? _far().blk->resource : nullptr);
+    std::memcpy(p->data(), data(), n);
+    std::memcpy(p->data() + n, sv.data(), sv.size());
+    p->data()[m] = '\0';
+    if (_is_shared()) _release(_far().blk);
+    _far({p->data(), m, p}, _shared_tag);
+    return *this;
+  }
+
+  void push_back(char c) { append(string_view(&c, 1)); }
+
+  void resize(nat n, char c = '\0') {
+    const auto s = size();
+    if (!_writable(n)) _regrow(n > s ? n : s);
+    if (n > s) std::memset(_writable(n) + s, c, n - s);
+    _set_size(n);
+  }
+
+  /// lets `op(p, n)` write up to `n` characters at `p` and resizes to the count it returns
+  template<typename F> void resize_and_overwrite(nat n, F op) {
+    const auto s = size();
+    if (!_writable(n)) _regrow(n > s ? n : s);
+    _set_size(static_cast<nat>(op(_writable(n), n)));
+  }
+
+  string& operator+=(string_view sv) { return append(sv); }
+  string& operator+=(char c) { push_back(c); return *this; }
+
+  friend string operator+(string a, string_view b) { a.append(b); return a; }
+
+  friend bool operator==(const string& a, const string& b) noexcept { return string_view(a) == string_view(b); }
+  friend bool operator==(const string& a, string_view b) noexcept { return string_view(a) == b; }
+  friend std::strong_ordering operator<=>(const string& a, const string& b) noexcept { return string_view(a) <=> string_view(b); }
+  friend std::strong_ordering operator<=>(const string& a, string_view b) noexcept { return string_view(a) <=> b; }
+  friend bool operator==(const string& a, const char* b) noexcept { return string_view(a) == string_view(b); }
+  friend std::strong_ordering operator<=>(const string& a, const char* b) noexcept { return string_view(a) <=> string_view(b); }
+};
+
+static_assert(sizeof(string) == 32);
+}
+
+export namespace yw { // text
+
+namespace text_impl {
+
+inline constexpr char digit_pairs[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+inline constexpr unsigned long long powers_of_10[] = {
+  1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+  10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+  1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull};
+
+/// returns the number of decimal digits of `v`
+constexpr int count_digits(unsigned long long v) noexcept {
+  const int t = (64 - std::countl_zero(v | 1)) * 1233 >> 12;
+  return t - ((v | 1) < powers_of_10[t]) + 1;
+}
+
+/// writes the decimal digits of `v` two at a time
+constexpr char* write_digits(char* p, unsigned long long v) noexcept {
+  char* const e = p + count_digits(v);
+  char* q = e;
+  for (; v >= 100; v /= 100) q -= 2, q[0] = digit_pairs[v % 100 * 2], q[1] = digit_pairs[v % 100 * 2 + 1];
+  if (v >= 10) q[-2] = digit_pairs[v * 2], q[-1] = digit_pairs[v * 2 + 1];
+  else q[-1] = char('0' + v);
+  return e;
+}
+
+/// `floor(log10(2^q))`, `floor(log10(3/4 * 2^q))` and `floor(log2(10^e))` for |q|, |e| within the double range
+constexpr int flog10pow2(int q) noexcept { return int(q * 661971961083ll >> 41); }
+constexpr int flog10_three_quarters_pow2(int q) noexcept { return int((q * 661971961083ll - 274743187321ll) >> 41); }
+constexpr int flog2pow10(int e) noexcept { return int(e * 913124641741ll >> 38); }
+
+/// `floor(10^-k * 2^(125 - flog2pow10(-k))) + 1` for k in [-324, 292], as `g >> 63` and the low 63 bits of `g`
+inline constexpr unsigned long long pow10_table[][2] = {
+  {0x4f0cedc95a718dd4ull, 0x5b01e8b09aa0d1b5ull}, {0x7e7b160ef71c1621ull, 0x119ca780f767b5eeull}, {0x652f44d8c5b011b4ull, 0x0e16ec672c52f7f2ull},
+  {0x50f29d7a37c00e29ull, 0x581256b8f0425ff5ull}, {0x40c21794f96671baull, 0x79a84560c0351991ull}, {0x679cf287f570b5f7ull, 0x75da089acd21c281ull},
+  {0x52e3f5399126f7f9ull, 0x44ae6d48a41b0201ull}, {0x424ff76140ebf994ull, 0x36f1f106e9af34cdull}, {0x6a198bcece465c20ull, 0x57e981a4a918547bull},
+  {0x54e13ca571d1e34dull, 0x2cbace1d541376c9ull}, {0x43e763b78e4182a4ull, 0x23c8a4e44342c56eull}, {0x6ca56c58e39c043aull, 0x060dd4a06b9e08b0ull},
+  {0x56eabd13e9499cfbull, 0x1e7176e6bc7e6d59ull}, {0x458897432107b0c8ull, 0x7ec12bebc9febde1ull}, {0x6f40f20501a5e7a7ull, 0x7e01dfdfa9979635ull},
+  {0x5900c19d9aeb1fb9ull, 0x4b34b319547944f7ull}, {0x4733ce17af227fc7ull, 0x55c3c27aa9fa9d93ull}, {0x71ec7cf2b1d0cc72ull, 0x560603f7765dc8eaull},
+  {0x5b2397288e40a38eull, 0x7804cff92b7e3a55ull}, {0x48e945ba0b66e93full, 0x13370cc755fe9511ull}, {0x74a86f90123e41feull, 0x51f1ae0bbcca881bull},
+  {0x5d538c7341cb67feull, 0x74c1580963d539afull}, {0x4aa93d29016f8665ull, 0x43cde0078310faf3ull}, {0x77752ea8024c0a3cull, 0x0616333f381b2b1eull},
+  {0x5f90f22001d66e96ull, 0x3811c298f9af55b1ull}, {0x4c73f4e667debedeull, 0x600e35472e25de28ull}, {0x7a532170a6313164ull, 0x3349eed849d6303full},
+  {0x61dc1ac084f42783ull, 0x42a18be03b11c033ull}, {0x4e49af006a5cec69ull, 0x1bb46fe695a7ccf5ull}, {0x7d42b19a43c7e0a8ull, 0x2c53e63dbc3fae55ull},
+  {0x64355ae1cfd31a20ull, 0x237651cafcffbeaaull}, {0x502aaf1b0ca8e1b3ull, 0x35f8416f30cc9888ull}, {0x402225af3d53e7c2ull, 0x5e603458f3d6e06dull},
+  {0x669d0918621fd937ull, 0x4a3386f4b957cd7bull}, {0x52173a79e8197a92ull, 0x6e8f9f2a2ddfd796ull}, {0x41ac2ec7ece12edbull, 0x720c7f54f17fdfabull},
+  {0x69137e0cae3517c6ull, 0x1ce0cbbb1bffcc45ull}, {0x540f980a24f74638ull, 0x171a3c95afffd69eull}, {0x433facd4ea5f6b60ull, 0x127b63aaf3331218ull},
+  {0x6b991487dd657899ull, 0x6a5f05de51eb5026ull}, {0x5614106cb11dfa14ull, 0x5518d17ea7ef7352ull}, {0x44dcd9f08db194ddull, 0x2a7a41321ff2c2a8ull},
+  {0x6e2e2980e2b5bafbull, 0x5d906850331e043full}, {0x5824ee00b55e2f2full, 0x647386a68f4b3699ull}, {0x4683f19a2ab1bf59ull, 0x36c2d21ed908f87bull},
+  {0x70d31c29dde93228ull, 0x579e1cfe280e5a5dull}, {0x5a427cee4b20f4edull, 0x2c7e7d98200b7b7eull}, {0x483530bea280c3f1ull, 0x09fecae019a2c932ull},
+  {0x73884dfdd0ce064eull, 0x43314499c29e0eb6ull}, {0x5c6d0b3173d8050bull, 0x4f5a9d47cee4d891ull}, {0x49f0d5c129799da2ull, 0x72aee4397250ad41ull},
+  {0x764e22cea8c295d1ull, 0x377e39f583b44868ull}, {0x5ea4e8a553cede41ull, 0x12cb61913629d387ull}, {0x4bb72084430be500ull, 0x756f8140f8217605ull},
+  {0x792500d39e796e67ull, 0x6f18cece59cf233cull}, {0x60ea670fb1fabeb9ull, 0x3f470bd847d8e8fdull}, {0x4d885272f4c89894ull, 0x329f3cad064720caull},
+  {0x7c0d50b7ee0dc0edull, 0x37652de1a3a50143ull}, {0x633dda2cbe716724ull, 0x2c50f1814fb73436ull}, {0x4f64ae8a31f45283ull, 0x3d0d8e010c92902bull},
+  {0x7f077da9e986ea6bull, 0x7b48e334e0ea8045ull}, {0x659f97bb2138bb89ull, 0x49071c2a4d88669dull}, {0x514c796280fa2fa1ull, 0x20d27ceea46d1ee4ull},
+  {0x4109fab533fb594dull, 0x670eca58838a7f1dull}, {0x680ff788532bc216ull, 0x0b4add5a6c10cb62ull}, {0x533ff939dc2301abull, 0x22a24aaebcda3c4eull},
+  {0x4299942e49b59aefull, 0x354ea22563e1c9d8ull}, {0x6a8f537d42bc2b18ull, 0x554a9d089fcfa95aull}, {0x553f75fdcefcef46ull, 0x776ee406e63fbaaeull},
+  {0x4432c4cb0bfd8c38ull, 0x5f8be99f1e996225ull}, {0x6d1e07ab466279f4ull, 0x327975cb64289d08ull}, {0x574b3955d1e86190ull, 0x28612b091ced4a6dull},
+  {0x45d5c777db204e0dull, 0x06b4226db0bdd524ull}, {0x6fbc72595e9a167bull, 0x24536a491ac95506ull}, {0x59638eade54811fcull, 0x1d0f883a7bd44405ull},
+  {0x4782d88b1dd34196ull, 0x4a72d361fca9d004ull}, {0x726af411c952028aull, 0x43eaebcffaa94cd3ull}, {0x5b88c3416ddb353bull, 0x4fef230cc88770a9ull},
+  {0x493a35cdf17c2a96ull, 0x0cbf4f3d6d3926eeull}, {0x7529efafe8c6aa89ull, 0x61321862485b717cull}, {0x5dbb262653d22207ull, 0x675b46b506af8dfdull},
+  {0x4afc1e850fdb4e6cull, 0x52af6bc405593e64ull}, {0x77f9ca6e7fc54a47ull, 0x377f12d33bc1fd6dull}, {0x5ffb085866376e9full, 0x45ff42429634cabdull},
+  {0x4cc8d379eb5f8bb2ull, 0x6b329b68782a3bcbull}, {0x7adaebf64565ac51ull, 0x2b842bda59dd2c77ull}, {0x6248bcc5045156a7ull, 0x3c69bcaeae4a89f9ull},
+  {0x4ea0970403744552ull, 0x6387ca25583ba194ull}, {0x7dcdbe6cd253a21eull, 0x05a6103bc05f68edull}, {0x64a498570ea94e7eull, 0x37b80cfc99e5ed8aull},
+  {0x5083ad1272210b98ull, 0x2c933d96e184be08ull}, {0x40695741f4e73c79ull, 0x7075cadf1ad09807ull}, {0x670ef2032171fa5cull, 0x4d8944982ae759a4ull},
+  {0x52725b35b45b2eb0ull, 0x3e076a135585e150ull}, {0x41f515c49048f226ull, 0x64d2bb42aad1810dull}, {0x698822d41a0e503eull, 0x07b7920444826815ull},
+  {0x546ce8a9ae71d9cbull, 0x1fc60e69d0685344ull}, {0x438a53baf1f4ae3cull, 0x196b3ebb0d20429dull}, {0x6c1085f7e9877d2dull, 0x0f11fdf815006a94ull},
+  {0x56739e5fee05fdbdull, 0x58db319344005543ull}, {0x45294b7ff19e6497ull, 0x60af5adc3666aa9cull}, {0x6ea878ccb5ca3a8cull, 0x344bc4938a3dddc7ull},
+  {0x5886c70a2b082ed6ull, 0x5d096a0fa1cb17d2ull}, {0x46d238d4ef39bf12ull, 0x173abb3fb4a27975ull}, {0x71505aee4b8f981dull, 0x0b912b992103f588ull},
+  {0x5aa6af25093face4ull, 0x0940efadb4032ad3ull}, {0x488558ea6dcc8a50ull, 0x07672624900288a9ull}, {0x74088e43e2e0dd4cull, 0x723ea36db337410eull},
+  {0x5cd3a5031be71770ull, 0x5b654f8af5c5cda5ull}, {0x4a42ea68e31f45f3ull, 0x62b772d5916b0aebull}, {0x76d1770e38320986ull, 0x0458b7bc1bde77ddull},
+  {0x5f0df8d82cf4d46bull, 0x1d13c630164b9318ull}, {0x4c0b2d79bd90a9efull, 0x30dc9e8cdea2dc13ull}, {0x79ab7bf5fc1aa97full, 0x0160fdae31049351ull},
+  {0x6155fcc4c9aeedffull, 0x1ab3fe24f403a90eull}, {0x4dde63d0a158be65ull, 0x6229981d9002eda5ull}, {0x7c97061a9bc130a2ull, 0x69dc2695b337e2a1ull},
+  {0x63ac04e2163426e8ull, 0x54b01ede28f9821bull}, {0x4fbcd0b4de901f20ull, 0x43c018b1ba6134e2ull}, {0x7f9481216419cb67ull, 0x1f99c11c5d68549dull},
+  {0x6610674de9ae3c52ull, 0x4c7b00e37ded107eull}, {0x51a6b90b21583042ull, 0x09fc00b5fe574065ull}, {0x41522da2811359ceull, 0x3b3000919845cd1dull},
+  {0x68837c3734ebc2e3ull, 0x784ccdb5c06fae95ull}, {0x539c635f5d8968b6ull, 0x2d0a3e2b00595877ull}, {0x42e382b2b13aba2bull, 0x3da1cb5599e11393ull},
+  {0x6b059deab52ac378ull, 0x629c7888f634ec1eull}, {0x559e17eef755692dull, 0x3549fa072b5d89b1ull}, {0x447e798bf91120f1ull, 0x1107fb38ef7e07c1ull},
+  {0x6d9728dff4e834b5ull, 0x01a65ec17f300c68ull}, {0x57ac20b32a535d5dull, 0x4e1eb23465c009edull}, {0x46234d5c21dc4ab1ull, 0x24e55b5d1e333b24ull},
+  {0x70387bc69c93aab5ull, 0x216ef894fd1ec506ull}, {0x59c6c96bb076222aull, 0x4df2607730e56a6cull}, {0x47d23abc8d2b4e88ull, 0x3e5b805f5a5121f0ull},
+  {0x72e9f79415121740ull, 0x63c59a322a1b697full}, {0x5bee5fa9aa74df67ull, 0x03047b5b54e2baccull}, {0x498b7fbaeec3e5ecull, 0x0269fc4910b5623dull},
+  {0x75abff917e063cacull, 0x6a432d41b45569fbull}, {0x5e2332dacb38308aull, 0x21cf5767c37787fcull}, {0x4b4f5be23c2cf3a1ull, 0x67d912b9692c6ccaull},
+  {0x787ef969f9e185cfull, 0x595b5128a8471476ull}, {0x60659454c7e79e3full, 0x6115da86ed05a9f8ull}, {0x4d1e1043d31fb1ccull, 0x4dab1538bd9e2193ull},
+  {0x7b634d3951cc4fadull, 0x62ab552795c9cf52ull}, {0x62b5d7610e3d0c8bull, 0x0222aa86116e3f75ull}, {0x4ef7df80d830d6d5ull, 0x4e822204dabe992aull},
+  {0x7e59659af38157bcull, 0x17369cd49130f510ull}, {0x65145148c2cddfc9ull, 0x5f5ee3dd40f3f740ull}, {0x50dd0dd3cf0b196eull, 0x1918b64a9a5cc5cdull},
+  {0x40b0d7dca5a27abeull, 0x4746f83baeb09e3eull}, {0x678159610903f797ull, 0x253e59f91780fd2full}, {0x52cde11a6d9cc612ull, 0x50feae60df9a6426ull},
+  {0x423e4daebe1704dbull, 0x5a65584d7faeb685ull}, {0x69fd4917968b3af9ull, 0x10a226e265e4573bull}, {0x54caa0dfaba29594ull, 0x0d4e8581eb1d1295ull},
+  {0x43d54d7fbc821143ull, 0x243ed134bc174211ull}, {0x6c887bff94034ed2ull, 0x06cae85460253682ull}, {0x56d396661002a574ull, 0x6bd586a9e6842b9bull},
+  {0x457611eb40021df7ull, 0x09779eee52035616ull}, {0x6f234fdeccd02ff1ull, 0x5bf297e3b66bbcefull}, {0x58e90cb23d73598eull, 0x165bacb62b8963f3ull},
+  {0x4720d6f4fdf5e13eull, 0x451623c4efa11cc2ull}, {0x71ce24bb2fefcecaull, 0x3b569fa17f682e03ull}, {0x5b0b5095bff30bd5ull, 0x15dee61acc535803ull},
+  {0x48d5da11665c0977ull, 0x2b18b8157042accfull}, {0x74895ce8a3c6758bull, 0x5e8df355806aae18ull}, {0x5d3ab0ba1c9ec46full, 0x653e5c4466bbbe7aull},
+  {0x4a955a2e7d4bd059ull, 0x3765169d1efc9861ull}, {0x77555d172edfb3c2ull, 0x256e8a94fe60f3cfull}, {0x5f777dac257fc301ull, 0x6abed543feb3f63full},
+  {0x4c5f97bceacc9c01ull, 0x3bcbddcffef65e99ull}, {0x7a328c6177adc668ull, 0x5fac961997f0975bull}, {0x61c209e792f16b86ull, 0x7fbd44e1465a12afull},
+  {0x4e34d4b9425abc6bull, 0x7fca9d810514dbbfull}, {0x7d21545b9d5dfa46ull, 0x32ddc8ce6e87c5ffull}, {0x641aa9e2e44b2e9eull, 0x5be4a0a525396b32ull},
+  {0x501554b5836f587eull, 0x7cb6e6ea842def5cull}, {0x4011109135f2ad32ull, 0x30925255368b25e3ull}, {0x6681b41b89844850ull, 0x4db6ea21f0dea304ull},
+  {0x52015ce2d469d373ull, 0x57c5881b2718826aull}, {0x419ab0b576bb0f8full, 0x5fd139af527a01efull}, {0x68f781225791b27full, 0x4c81f5e550c3364aull},
+  {0x53f9341b79415b99ull, 0x239b2b1dda35c508ull}, {0x432dc3492dcde2e1ull, 0x02e288e4ae916a6dull}, {0x6b7c6ba849496b01ull, 0x516a74a1174f10aeull},
+  {0x55fd22ed076def34ull, 0x4121f6e745d8da25ull}, {0x44ca82573924bf5dull, 0x1a8192529e4714ebull}, {0x6e10d08b8ea1322eull, 0x5d9c1d50fd3e87ddull},
+  {0x580d73a2d880f4f2ull, 0x17b01773fdcb9fe4ull}, {0x4671294f139a5d8eull, 0x4626792997d61984ull}, {0x70b50ee4ec2a2f4aull, 0x3d0a5b75bfbcf59full},
+  {0x5a2a7250bcee8c3bull, 0x4a6eaf916630c47full}, {0x4821f50d63f209c9ull, 0x21f2260deb5a36ccull}, {0x736988156cb6760eull, 0x69837016455d247aull},
+  {0x5c546cddf091f80bull, 0x6e02c011d1175062ull}, {0x49dd23e4c074c66full, 0x719bccdb0dac404eull}, {0x762e9fd467213d7full, 0x68f947c4e2ad33b0ull},
+  {0x5e8bb3105280fdffull, 0x6d94396a4ef0f627ull}, {0x4ba2f5a6a8673199ull, 0x3e102deea58d91b9ull}, {0x7904bc3dda3eb5c2ull, 0x3019e3176f48e927ull},
+  {0x60d09697e1cbc49bull, 0x4014b5ac590720ecull}, {0x4d73abacb4a303afull, 0x4cdd5e237a6c1a57ull}, {0x7bec45e12104d2b2ull, 0x47c8969f2a46908aull},
+  {0x63236b1a80d0a88eull, 0x6ca0787f5505406full}, {0x4f4f88e200a6ed3full, 0x0a19f9ff773766bfull}, {0x7ee5a7d0010b1531ull, 0x5cf65ccbf1f23dfeull},
+  {0x6584864000d5aa8eull, 0x172b7d6ff4c1cb32ull}, {0x5136d1cccd77bba4ull, 0x78ef978cc3ce3c28ull}, {0x40f8a7d70ac62fb7ull, 0x13f2dfa3cfd83020ull},
+  {0x67f43fbe77a37f8bull, 0x398499061959e699ull}, {0x5329cc985fb5ffa2ull, 0x6136e0d1ade18548ull}, {0x4287d6e04c91994full, 0x00f8b3daf181376dull},
+  {0x6a72f166e0e8f54bull, 0x1b27862b1c01f247ull}, {0x5528c11f1a53f76full, 0x2f52d1bc1667f506ull}, {0x44209a7f48432c59ull, 0x0c424163451ff738ull},
+  {0x6d00f7320d3846f4ull, 0x7a039bd208332526ull}, {0x5733f8f4d76038c3ull, 0x7b361641a028ea85ull}, {0x45c32d90ac4cfa36ull, 0x2f5e78348020bb9eull},
+  {0x6f9eaf4de07b29f0ull, 0x4bca59ed99cdf8fcull}, {0x594bbf71806287f3ull, 0x563b7b247b0b2d96ull}, {0x476fcc5acd1b9ff6ull, 0x11c92f50626f57acull},
+  {0x724c7a2ae1c5ccbdull, 0x02db7ee703e55912ull}, {0x5b7061bbe7d17097ull, 0x1be2cbec031de0dcull}, {0x4926b496530df3acull, 0x164f09899c17e716ull},
+  {0x750aba8a1e7cb913ull, 0x3d4b4275c68ca4f0ull}, {0x5da22ed4e530940full, 0x4aa29b916ba3b726ull}, {0x4ae825771dc07672ull, 0x6ee87c74561c9285ull},
+  {0x77d9d58b62cd8a51ull, 0x3173fa53bcfa8408ull}, {0x5fe177a2b5713b74ull, 0x278ffb7630c869a0ull}, {0x4cb45fb55df42f90ull, 0x1fa662c4f3d387b3ull},
+  {0x7aba32bbc986b280ull, 0x32a3d13b1fb8d91full}, {0x622e8efca1388ecdull, 0x0ee9742f4c93e0e6ull}, {0x4e8ba596e760723dull, 0x58bac3590a0fe71eull},
+  {0x7dac3c24a5671d2full, 0x412ad228101971c9ull}, {0x6489c9b6eab8e426ull, 0x00ef0e8673478e3bull}, {0x506e3af8bbc71cebull, 0x1a58d86b8f6c71c9ull},
+  {0x40582f2d6305b0bcull, 0x1513e0560c56c16eull}, {0x66f37eaf04d5e793ull, 0x3b530089ad579be2ull}, {0x525c6558d0ab1fa9ull, 0x15dc006e2446164full},
+  {0x41e384470d55b2edull, 0x5e4999f1b69e783full}, {0x696c06d81555eb15ull, 0x7d428fe92430c065ull}, {0x54566be0111188deull, 0x31020cba835a3384ull},
+  {0x4378564cda746d7eull, 0x5a680a2ecf7b5c69ull}, {0x6bf3bd47c3ed7bfdull, 0x770cdd17b25efa42ull}, {0x565c976c9cbdfccbull, 0x1270b0dfc1e59502ull},
+  {0x4516df8a16fe63d5ull, 0x5b8d5a4c9b1e10ceull}, {0x6e8aff4357fd6c89ull, 0x127bc3adc4fce7b0ull}, {0x586f329c466456d4ull, 0x0ec96957d0ca52f3ull},
+  {0x46bf5bb038504576ull, 0x3f07877973d50f29ull}, {0x71322c4d26e6d58aull, 0x31a5a58f1fbb4b75ull}, {0x5a8e89d75252446eull, 0x5aeaead8e62f6f91ull},
+  {0x487207df750e9d25ull, 0x2f22557a51bf8c74ull}, {0x73e9a63254e42ea2ull, 0x1836ef2a1c65ad86ull}, {0x5cbaeb5b771cf21bull, 0x2cf8bf54e3848ad2ull},
+  {0x4a2f22af927d8e7cull, 0x23fa32aa4f9d3bdbull}, {0x76b1d118ea627d93ull, 0x5329eaaa18fb92f8ull}, {0x5ef4a74721e86476ull, 0x0f54bbbb472fa8c6ull},
+  {0x4bf6ec38e7ed1d2bull, 0x25dd62fc38f2ed6cull}, {0x798b138e3fe1c845ull, 0x22fbd1938e517bdfull}, {0x613c0fa4ffe7d36aull, 0x4f2fdadc71dac97full},
+  {0x4dc9a61d998642bbull, 0x58f3157d27e23accull}, {0x7c75d695c2706ac5ull, 0x74b82261d969f7adull}, {0x63917877cec0556bull, 0x10934eb4adee5fbeull},
+  {0x4fa793930bcd1122ull, 0x4075d8908b251965ull}, {0x7f7285b812e1b504ull, 0x00bc8db411d4f56eull}, {0x65f537c675815d9cull, 0x66fd3e29a7dd9125ull},
+  {0x5190f96b91344ae3ull, 0x6bfdcb54864ada84ull}, {0x4140c78940f6a24full, 0x6ffe3c439ea2486aull}, {0x6867a5a867f103b2ull, 0x7ffd2d38fdd073dcull},
+  {0x53861e2053273628ull, 0x6664242d97d9f64aull}, {0x42d1b1b375b8f820ull, 0x51e9b68adfe191d5ull}, {0x6ae91c5255f4c034ull, 0x1ca924116635b621ull},
+  {0x558749db77f70029ull, 0x63ba83411e915e81ull}, {0x446c3b15f9926687ull, 0x6962029a7edab201ull}, {0x6d79f82328ea3da6ull, 0x0f03375d97c45001ull},
+  {0x5794c6828721caebull, 0x259c2c4adfd04001ull}, {0x46109eced2816f22ull, 0x5149bd08b30d0001ull}, {0x701a97b150cf1837ull, 0x3542c80deb480001ull},
+  {0x59aedfc10d7279c5ull, 0x7768a00b22a00001ull}, {0x47bf19673df52e37ull, 0x79208008e8800001ull}, {0x72cb5bd86321e38cull, 0x5b67334174000001ull},
+  {0x5bd5e313828182d6ull, 0x7c528f6790000001ull}, {0x4977e8dc68679bdfull, 0x16a872b940000001ull}, {0x758ca7c70d7292feull, 0x5773eac200000001ull},
+  {0x5e0a1fd271287598ull, 0x45f6556800000001ull}, {0x4b3b4ca85a86c47aull, 0x04c5112000000001ull}, {0x785ee10d5da46d90ull, 0x07a1b50000000001ull},
+  {0x604be73de4838ad9ull, 0x52e7c40000000001ull}, {0x4d0985cb1d3608aeull, 0x0f1fd00000000001ull}, {0x7b426fab61f00de3ull, 0x31cc800000000001ull},
+  {0x629b8c891b267182ull, 0x5b0a000000000001ull}, {0x4ee2d6d415b85aceull, 0x7c08000000000001ull}, {0x7e37be2022c0914bull, 0x1340000000000001ull},
+  {0x64f964e68233a76full, 0x2900000000000001ull}, {0x50c783eb9b5c85f2ull, 0x5400000000000001ull}, {0x409f9cbc7c4a04c2ull, 0x1000000000000001ull},
+  {0x6765c793fa10079dull, 0x0000000000000001ull}, {0x52b7d2dcc80cd2e4ull, 0x0000000000000001ull}, {0x422ca8b0a00a4250ull, 0x0000000000000001ull},
+  {0x69e10de76676d080ull, 0x0000000000000001ull}, {0x54b40b1f852bda00ull, 0x0000000000000001ull}, {0x43c33c1937564800ull, 0x0000000000000001ull},
+  {0x6c6b935b8bbd4000ull, 0x0000000000000001ull}, {0x56bc75e2d6310000ull, 0x0000000000000001ull}, {0x4563918244f40000ull, 0x0000000000000001ull},
+  {0x6f05b59d3b200000ull, 0x0000000000000001ull}, {0x58d15e1762800000ull, 0x0000000000000001ull}, {0x470de4df82000000ull, 0x0000000000000001ull},
+  {0x71afd498d0000000ull, 0x0000000000000001ull}, {0x5af3107a40000000ull, 0x0000000000000001ull}, {0x48c2739500000000ull, 0x0000000000000001ull},
+  {0x746a528800000000ull, 0x0000000000000001ull}, {0x5d21dba000000000ull, 0x0000000000000001ull}, {0x4a817c8000000000ull, 0x0000000000000001ull},
+  {0x7735940000000000ull, 0x0000000000000001ull}, {0x5f5e100000000000ull, 0x0000000000000001ull}, {0x4c4b400000000000ull, 0x0000000000000001ull},
+  {0x7a12000000000000ull, 0x0000000000000001ull}, {0x61a8000000000000ull, 0x0000000000000001ull}, {0x4e20000000000000ull, 0x0000000000000001ull},
+  {0x7d00000000000000ull, 0x0000000000000001ull}, {0x6400000000000000ull, 0x0000000000000001ull}, {0x5000000000000000ull, 0x0000000000000001ull},
+  {0x4000000000000000ull, 0x0000000000000001ull}, {0x6666666666666666ull, 0x3333333333333334ull}, {0x51eb851eb851eb85ull, 0x0f5c28f5c28f5c29ull},
+  {0x4189374bc6a7ef9dull, 0x5916872b020c49bbull}, {0x68db8bac710cb295ull, 0x74f0d844d013a92bull}, {0x53e2d6238da3c211ull, 0x43f3e0370cdc8755ull},
+  {0x431bde82d7b634daull, 0x698fe69270b06c44ull}, {0x6b5fca6af2bd215eull, 0x0f4ca41d811a46d4ull}, {0x55e63b88c230e77eull, 0x3f70834acdae9f10ull},
+  {0x44b82fa09b5a52cbull, 0x4c5a02a23e254c0dull}, {0x6df37f675ef6eadfull, 0x2d5cd10396a21347ull}, {0x57f5ff85e592557full, 0x3de3da69454e75d3ull},
+  {0x465e6604b7a84465ull, 0x7e4fe1edd10b9175ull}, {0x709709a125da0709ull, 0x4a19697c81ac1befull}, {0x5a126e1a84ae6c07ull, 0x54e1213067bce326ull},
+  {0x480ebe7b9d58566cull, 0x43e74dc052fd8285ull}, {0x734aca5f6226f0adull, 0x530baf9a1e626a6dull}, {0x5c3bd5191b525a24ull, 0x426fbfae7eb521f1ull},
+  {0x49c97747490eae83ull, 0x4ebfcc8b9890e7f4ull}, {0x760f253edb4ab0d2ull, 0x4acc7a78f41b0cbaull}, {0x5e72843249088d75ull, 0x223d2ec729af3d62ull},
+  {0x4b8ed0283a6d3df7ull, 0x34fdbf05baf29781ull}, {0x78e480405d7b9658ull, 0x54c931a2c4b758cfull}, {0x60b6cd004ac94513ull, 0x5d6dc14f03c5e0a5ull},
+  {0x4d5f0a66a23a9da9ull, 0x31249aa59c9e4d51ull}, {0x7bcb43d769f762a8ull, 0x4ea0f76f60fd4882ull}, {0x63090312bb2c4eedull, 0x254d92bf80caa068ull},
+  {0x4f3a68dbc8f03f24ull, 0x1dd7a89933d54d20ull}, {0x7ec3daf941806506ull, 0x62f2a75b86221500ull}, {0x65697bfa9acd1d9full, 0x025bb91604e810cdull},
+  {0x51212ffbaf0a7e18ull, 0x684960de6a5340a4ull}, {0x40e7599625a1fe7aull, 0x203ab3e521dc33b6ull}, {0x67d88f56a29cca5dull, 0x19f7863b696052bdull},
+  {0x5313a5dee87d6eb0ull, 0x7b2c6b62bab37564ull}, {0x42761e4bed31255aull, 0x2f56bc4efbc2c450ull}, {0x6a5696dfe1e83bc3ull, 0x655793b192d13a1aull},
+  {0x5512124cb4b9c969ull, 0x377942f475742e7bull}, {0x440e750a2a2e3abaull, 0x5f9435905df68b96ull}, {0x6ce3ee76a9e3912aull, 0x65b9ef4d63241289ull},
+  {0x571cbec554b60dbbull, 0x6afb25d782834207ull}, {0x45b0989ddd5e7163ull, 0x08c8eb12cecf6806ull}, {0x6f80f42fc8971bd1ull, 0x5adb11b7b14bd9a3ull},
+  {0x5933f68ca078e30eull, 0x157c0e2c8dd647b5ull}, {0x475cc53d4d2d8271ull, 0x5dfcd823a4ab6c91ull}, {0x722e086215159d82ull, 0x632e269f6ddf141bull},
+  {0x5b5806b4ddaae468ull, 0x4f581ee5f17f4349ull}, {0x49133890b1558386ull, 0x72ace584c1329c3bull}, {0x74eb8db44eef38d7ull, 0x6aae3c079b842d2aull},
+  {0x5d893e29d8bf60acull, 0x5558300616035755ull}, {0x4ad431bb13cc4d56ull, 0x7779c004de6912abull}, {0x77b9e92b52e07bbeull, 0x258f99a163db5111ull},
+  {0x5fc7edbc424d2fcbull, 0x37a614811caf740dull}, {0x4c9ff163683dbfd5ull, 0x7951aa00e3bf900bull}, {0x7a998238a6c932efull, 0x754f7667d2cc19abull},
+  {0x6214682d523a8f26ull, 0x2aa5f8530f09ae22ull}, {0x4e76b9bddb620c1eull, 0x55519375a5a1581bull}, {0x7d8ac2c95f034697ull, 0x3bb5b8bc3c3559c5ull},
+  {0x646f023ab2690545ull, 0x7c9160969691149eull}, {0x5058ce955b87376bull, 0x16dab3ababa743b2ull}, {0x40470baaaf9f5f88ull, 0x78aef622efb902f5ull},
+  {0x66d812aab29898dbull, 0x0de4bd04b2c19e54ull}, {0x524675555bad4715ull, 0x57ea30d08f014b76ull}, {0x41d1f7777c8a9f44ull, 0x4654f3da0c01092cull},
+  {0x694ff258c7443207ull, 0x23bb1fc346680eacull}, {0x543ff513d29cf4d2ull, 0x4fc8e635d1ecd88aull}, {0x43665da9754a5d75ull, 0x263a51c4a7f0ad3bull},
+  {0x6bd6fc425543c8bbull, 0x56c3b607731aaec4ull}, {0x5645969b77696d62ull, 0x789c919f8f488bd0ull}, {0x4504787c5f878ab5ull, 0x46e3a7b2d906d640ull},
+  {0x6e6d8d93cc0c1122ull, 0x3e390c515b3e239aull}, {0x5857a4763cd6741bull, 0x4b60d6a77c31b615ull}, {0x46ac8391ca4529afull, 0x55e7121f968e2b44ull},
+  {0x711405b6106ea919ull, 0x0971b698f0e3786dull}, {0x5a766af80d255414ull, 0x078e2bad8d82c6bdull}, {0x485ebbf9a41ddcdcull, 0x6c71bc8ad79bd231ull},
+  {0x73cac65c39c96161ull, 0x2d82c7448c2c8382ull}, {0x5ca23849c7d44de7ull, 0x3e023903a356cf9bull}, {0x4a1b603b06437185ull, 0x7e682d9c82abd949ull},
+  {0x76923391a39f1c09ull, 0x4a4048fa6aac8edbull}, {0x5edb5c7482e5b007ull, 0x55003a61eef07249ull}, {0x4be2b05d35848cd2ull, 0x773361e7f259f507ull},
+  {0x796ab3c855a0e151ull, 0x3eb89ca6508fee71ull}, {0x6122296d114d810dull, 0x7efa16eb73a6585bull}, {0x4db4edf0daa4673eull, 0x3261abef8fb846afull},
+  {0x7c54afe7c43a3ecaull, 0x1d691318e5f3a44bull}, {0x6376f31fd02e98a1ull, 0x64540f471e5c836full}, {0x4f925c1973587a1bull, 0x0376729f4b7d35f3ull},
+  {0x7f50935bebc0c35eull, 0x38bd84321261efebull}, {0x65da0f7cbc9a35e5ull, 0x13cad0280eb4bfefull}, {0x517b3f96fd482b1dull, 0x5ca240200bc3ccbfull},
+  {0x412f66126439bc17ull, 0x63b50019a3030a33ull}, {0x684bd683d38f9359ull, 0x1f88002904d1a9eaull}, {0x536fdecfdc72dc47ull, 0x32d3335403daee55ull},
+  {0x42bfe57316c249d2ull, 0x5bdc291003158b77ull}, {0x6acca251be03a951ull, 0x12f9db4cd1bc1258ull}, {0x557081dafe695440ull, 0x7594af70a7c9a847ull},
+  {0x445a017bfebaa9cdull, 0x4476f2c0863aed06ull}, {0x6d5ccf2ccac442e2ull, 0x3a57eacda3917b3cull}, {0x577d728a3bd03581ull, 0x7b7988a482dac8fdull},
+  {0x45fdf53b630cf79bull, 0x15fad3b6cf156d97ull}, {0x6ffcbb923814bf5eull, 0x565e1f8ae4ef15beull}, {0x5996fc74f9aa32b2ull, 0x11e4e608b725aaffull},
+  {0x47abfd2a6154f55bull, 0x27ea51a0928488ccull}, {0x72acc843ceee555eull, 0x7310829a84074146ull}, {0x5bbd6d030bf1dde5ull, 0x42739baed005cdd2ull},
+  {0x49645735a327e4b7ull, 0x4ec2e2f24004a4a8ull}, {0x756d5855d1d96df2ull, 0x4ad16b1d333aa10cull}, {0x5df11377db1457f5ull, 0x2241227dc2954da3ull},
+  {0x4b2742c648dd132aull, 0x4e9a81fe35443e1cull}, {0x783ed13d4161b844ull, 0x175d9cc9eed39694ull}, {0x603240fdcde7c69cull, 0x7917b0a18bdc7876ull},
+  {0x4cf500cb0b1fd217ull, 0x1412f3b46fe39392ull}, {0x7b219ade7832e9beull, 0x535185ed7fd285b6ull}, {0x628148b1f9c25498ull, 0x42a79e57997537c5ull},
+  {0x4ecdd3c1949b76e0ull, 0x3552e512e12a9304ull}, {0x7e161f9c20f8be33ull, 0x6eeb081e3510eb39ull}, {0x64de7fb01a609829ull, 0x3f226ce4f740bc2eull},
+  {0x50b1ffc0151a1354ull, 0x3281f0b72c33c9beull}, {0x408e66334414dc43ull, 0x42018d5f568fd498ull}, {0x674a3d1ed354939full, 0x1ccf48988a7fba8dull},
+  {0x52a1ca7f0f76dc7full, 0x30a5d3ad3b99620bull}, {0x421b0865a5f8b065ull, 0x73b7dc8a96144e6full}, {0x69c4da3c3cc11a3cull, 0x52bfc7442353b0b1ull},
+  {0x549d7b6363cdae96ull, 0x756639034f7626f4ull}, {0x43b12f82b63e2545ull, 0x4451c735d92b525dull}, {0x6c4eb26abd303ba2ull, 0x3a1c71efc1deea2eull},
+  {0x56a55b889759c94eull, 0x61b05b2634b254f2ull}, {0x45511606df7b0772ull, 0x1af37c1e908eaa5bull}, {0x6ee8233e325e7250ull, 0x2b1f2cfdb41776f8ull},
+  {0x58b9b5cb5b7ec1d9ull, 0x6f4c23fe29ac5f2dull}, {0x46faf7d5e2cbce47ull, 0x72a34ffe87bd18f1ull}, {0x71918c896adfb073ull, 0x04387ffda5fb5b1bull},
+  {0x5adad6d4557fc05cull, 0x0360666484c915afull}, {0x48af1243779966b0ull, 0x02b3851d3707448cull}, {0x744b506bf28f0ab3ull, 0x1dec082ebe720746ull},
+  {0x5d090d2328726ef5ull, 0x64bcd358985b3905ull}, {0x4a6da41c205b8bf7ull, 0x6a30a913ad15c738ull}, {0x7715d36033c5acbfull, 0x5d1aa81f7b560b8cull},
+  {0x5f44a919c3048a32ull, 0x7daeece5fc44d609ull}, {0x4c36edae359d3b5bull, 0x7e258a51969d7808ull}, {0x79f17c49ef61f893ull, 0x16a276e8f0fbf33full},
+  {0x618dfd07f2b4c6dcull, 0x121b9253f3fcc299ull}, {0x4e0b30d328909f16ull, 0x41afa84329970214ull}, {0x7cdeb4850db431bdull, 0x4f7f739ea8f19cedull},
+  {0x63e55d373e29c164ull, 0x3f99294bba5ae3f1ull}, {0x4feab0f8fe87cde9ull, 0x7fadbaa2fb7be98dull}, {0x7fdde7f4ca72e30full, 0x7f7c5dd1925fdc15ull},
+  {0x664b1ff7085be8d9ull, 0x4c637e4141e649abull}, {0x51d5b32c06afed7aull, 0x704f983434b83aefull}, {0x4177c2899ef32462ull, 0x26a6135cf6f9c8bfull},
+  {0x68bf9da8fe51d3d0ull, 0x3dd685618b294132ull}, {0x53cc7e20cb74a973ull, 0x4b12044e08edcdc2ull}, {0x4309fe80a2c3bac2ull, 0x6f419d0b3a57d7ceull},
+  {0x6b4330cdd1392ad1ull, 0x320294dec3bfbfb0ull}, {0x55cf5a3e40fa88a7ull, 0x419baa4bcfcc995aull}, {0x44a5e1cb672ed3b9ull, 0x1ae2eea30ca3ade1ull},
+  {0x6dd636123eb152c1ull, 0x77d17dd1add2afcfull}, {0x57de91a832277567ull, 0x797464a7be42263full}, {0x464ba7b9c1b92ab9ull, 0x4790508631ce84ffull},
+  {0x70790c5c6928445cull, 0x0c1a1a704fb0d4ccull}, {0x59fa7049edb9d049ull, 0x567b4859d95a43d6ull}, {0x47fb8d07f161736eull, 0x11fc39e17aae9cabull},
+  {0x732c14d98235857dull, 0x032d2968c44a9445ull}, {0x5c2343e134f79dfdull, 0x4f575453d03ba9d1ull}, {0x49b5cfe75d92e4caull, 0x72ac4376402fbb0eull},
+  {0x75efb30bc8eb07abull, 0x0446d256cd192b49ull}, {0x5e595c096d88d2efull, 0x1d0575123dadbc3aull}, {0x4b7ab0078ad3dbf2ull, 0x4a6ac40e97be302full},
+  {0x78c44cd8de1fc650ull, 0x771139b0f2c9e6b1ull}, {0x609d0a4718196b73ull, 0x78da948d8f07ebc1ull}, {0x4d4a6e9f467abc5cull, 0x60aedd3e0c065634ull},
+  {0x7baa4a9870c46094ull, 0x344afb9679a3bd20ull}, {0x62eea2138d69e6ddull, 0x103bfc78614fca80ull}, {0x4f254e760abb1f17ull, 0x26966393810ca200ull},
+  {0x7ea21723445e9825ull, 0x2423d2859b476999ull}, {0x654e78e9037ee01dull, 0x69b642047c392148ull}, {0x510b93ed9c658017ull, 0x6e2b680396941aa0ull},
+  {0x40d60ff149eaccdfull, 0x71bc53361210154dull}, {0x67bce64edcaae166ull, 0x1c6085235019bbaeull}, {0x52fd850be3bbe784ull, 0x7d1a041c40149625ull},
+  {0x42646a6fe9631f9dull, 0x4a7b367d0010781dull}, {0x6a3a43e642383295ull, 0x5d91f0c8001a59c8ull}, {0x54fb698501c68edeull, 0x17a7f3d3334847d4ull},
+  {0x43fc546a67d20be4ull, 0x79532975c2a03976ull}, {0x6cc6ed770c83463bull, 0x0eeb75893766c256ull}, {0x57058ac5a39c382full, 0x25892ad42c523512ull},
+  {0x459e089e1c7cf9bfull, 0x37a0ef102374f742ull}, {0x6f6340fcfa618f98ull, 0x59017e8038bb2536ull}, {0x591c33fd951ad946ull, 0x7a67986693c8ea91ull},
+  {0x4749c33144157a9full, 0x151fad1edca0bba8ull}, {0x720f9eb539bbf765ull, 0x0832ae97c76792a5ull}, {0x5b3fb22a94965f84ull, 0x068ef21305ec7551ull},
+  {0x48ffc1bbaa11e603ull, 0x1ed8c1a8d189f774ull}, {0x74cc692c434fd66bull, 0x4af4690e1c0ff253ull}, {0x5d705423690cab89ull, 0x225d20d816732843ull},
+  {0x4ac0434f873d5607ull, 0x35174d79ab8f5369ull}, {0x779a054c0b955672ull, 0x21bee25c45b21f0eull}, {0x5fae6aa33c77785bull, 0x3498b5169e2818d8ull},
+  {0x4c8b888296c5f9e2ull, 0x5d46f7454b534713ull}, {0x7a78da6a8ad65c9dull, 0x7ba4bed545520b52ull}, {0x61fa48553bdeb07eull, 0x2fb6ff110441a2a8ull},
+  {0x4e61d37763188d31ull, 0x72f8cc0d9d014eedull}, {0x7d6952589e8daeb6ull, 0x1e5ae015c80217e1ull}, {0x645441e07ed7bef8ull, 0x1848b344a001acb4ull},
+  {0x504367e6cbdfcbf9ull, 0x603a2903b3348a2aull}, {0x4035ecb8a3196ffbull, 0x002e873628f6d4eeull}, {0x66bcadf43828b32bull, 0x19e40b89db2487e3ull},
+  {0x52308b29c686f5bcull, 0x14b66fa17c1d3983ull}, {0x41c06f549ed25e30ull, 0x1091f2e7967dc79cull}, {0x6933e554315096b3ull, 0x341cb7d8f0c93f5full},
+  {0x542984435aa6def5ull, 0x767d5fe0c0a0ff80ull}, {0x435469cf7bb8b25eull, 0x2b977fe70080cc66ull}, {0x6bba42e592c11d63ull, 0x5f58cca4cd9ae0a3ull},
+  {0x562e9beadbcdb11cull, 0x4c470a1d7148b3b6ull}, {0x44f216557ca48db0ull, 0x3d05a1b1276d5c92ull}, {0x6e5023bbfaa0e2b3ull, 0x7b3c35e83f1560e9ull},
+  {0x58401c96621a4ef6ull, 0x2f635e5365aab3edull}, {0x4699b0784e7b725eull, 0x591c4b75eaeef658ull}, {0x70f5e726e3f8b6fdull, 0x74fa125644b18a26ull},
+  {0x5a5e5285832d5f31ull, 0x43fb41de9d5ad4ebull}, {0x484b75379c244c27ull, 0x4ffc34b2177bdd89ull}, {0x73abeebf603a1372ull, 0x4cc6bab68bf96274ull},
+  {0x5c898bcc4cfb42c2ull, 0x0a38955ed6611b90ull}, {0x4a07a309d72f689bull, 0x21c6dde5784dafa7ull}, {0x76729e762518a75eull, 0x693e2fd58d49190bull},
+  {0x5ec2185e8413b918ull, 0x5431bfde0aa0e0d5ull}, {0x4bce79e536762dadull, 0x29c1664b3bb3e711ull}, {0x794a5ca1f0bd15e2ull, 0x0f9bd6dec5eca4e8ull},
+  {0x61084a1b26fdab1bull, 0x2616457f04bd50baull}, {0x4da03b48ebfe227cull, 0x1e783798d09773c8ull}, {0x7c33920e46636a60ull, 0x30c058f480f252d9ull},
+  {0x635c74d8384f884dull, 0x0d66ad9067284247ull}, {0x4f7d2a469372d370ull, 0x711ef14052869b6cull}, {0x7f2eaa0a85848581ull, 0x34fe4ecd50d75f14ull},
+  {0x65beee6ed136d134ull, 0x2a650bd773df7f43ull}, {0x51658b8bda9240f6ull, 0x551da312c319329cull}, {0x411e093caedb672bull, 0x5db14f4235adc217ull},
+  {0x68300ec77e2bd845ull, 0x7c4ee536bc49368aull}, {0x5359a56c64efe037ull, 0x7d0bea92303a9208ull}, {0x42ae1df050bfe693ull, 0x173cbba8269541a0ull},
+  {0x6ab02fe6e79970ebull, 0x3ec792a6a422029aull}, {0x5559bfebec7ac0bcull, 0x3239421ee9b4cee1ull}, {0x4447ccbcbd2f0096ull, 0x5b6101b25490a581ull},
+  {0x6d3fadfac84b3424ull, 0x2bce691d541aa268ull}, {0x576624c8a03c29b6ull, 0x563eba7ddce21b87ull}, {0x45eb50a08030215eull, 0x78322ecb171b4939ull},
+  {0x6fdee76733803564ull, 0x59e9e47824f87527ull}, {0x597f1f85c2ccf783ull, 0x6187e9f9b72d2a86ull}, {0x4798e6049bd72c69ull, 0x346cbb2e2c242205ull},
+  {0x728e3cd42c8b7a42ull, 0x20adf849e039d007ull}, {0x5ba4fd768a092e9bull, 0x33be603b19c7d99full}, {0x4950cac53b3a8bafull, 0x42feb3627b0647b3ull},
+  {0x754e113b91f745e5ull, 0x5197856a5e7072b8ull}, {0x5dd80dc941929e51ull, 0x27ac6abb7ec05bc6ull}, {0x4b133e3a9adbb1daull, 0x52f05562cbcd1638ull},
+  {0x781ec9f75e2c4fc4ull, 0x1e4d556adfae89f3ull}, {0x6018a192b1bd0c9cull, 0x7ea444557fbed4c3ull}, {0x4ce0814227ca707dull, 0x4bb69d1132ff109cull},
+  {0x7b00ced03faa4d95ull, 0x5f8a94e851981a93ull}, {0x62670bd9cc883e11ull, 0x32d543ed0e134875ull}, {0x4eb8d647d6d364daull, 0x5bddcff0d80f6d2bull},
+  {0x7df48a0c8aebd491ull, 0x12fc7fe7c018aeabull}, {0x64c3a1a3a25643a7ull, 0x28c9ffec99ad5889ull}, {0x509c814fb511cfb9ull, 0x0707fff07af113a1ull},
+  {0x407d343fc40e3fc7ull, 0x1f39998d2f2742e7ull}, {0x672eb9ffa016cc71ull, 0x7ec28f484b7204a4ull}, {0x528bc7ffb345705bull, 0x189ba5d36f8e6a1dull},
+  {0x42096ccc8f6ac048ull, 0x7a161e42bfa521b1ull}, {0x69a8ae1418aacd41ull, 0x435696d132a1cf81ull}, {0x5486f1a9ad557101ull, 0x1c454574288172ceull},
+  {0x439f27baf1112734ull, 0x169dd129ba0128a5ull}, {0x6c31d92b1b4ea520ull, 0x242fb50f9001daa1ull}, {0x568e4755af721db3ull, 0x368c90d940017bb4ull},
+  {0x453e9f77bf8e7e29ull, 0x120a0d7a999ac95dull}, {0x6eca98bf98e3fd0eull, 0x50101590f5c47561ull}, {0x58a213cc7a4ffda5ull, 0x26734473f7d05de8ull},
+  {0x46e80fd6c83ffe1dull, 0x6b8f69f65fd9e4b9ull}, {0x71734c8ad9fffcfcull, 0x45b24323cc8fd45cull}, {0x5ac2a3a247fffd96ull, 0x6af502830a0ca9e3ull},
+  {0x489bb61b6ccccadfull, 0x08c402026e7087e9ull}, {0x742c569247ae1164ull, 0x746cd003e3e73fdbull}, {0x5cf04541d2f1a783ull, 0x76bd73364fec3315ull},
+  {0x4a59d101758e1f9cull, 0x5efdf5c50cbcf5abull}, {0x76f61b3588e365c7ull, 0x4b2fefa1adfb22abull}, {0x5f2b48f7a0b5eb06ull, 0x08f3261af195b555ull},
+  {0x4c22a0c61a2b226bull, 0x20c284e25ade2aabull}, {0x79d1013cf6ab6a45ull, 0x1ad0d49d5e304444ull}, {0x617400fd9222bb6aull, 0x48a7107de4f369d0ull},
+  {0x4df6673141b562bbull, 0x53b8d9fe50c2bb0dull}, {0x7cbd71e869223792ull, 0x52c15cca1ad12b48ull}, {0x63cac186ba81c60eull, 0x75677d6e7bda8906ull},
+  {0x4fd5679efb9b04d8ull, 0x5dec645863153a6cull}, {0x7fbbd8fe5f5e6e27ull, 0x497a3a2704eec3dfull},
+};
+
+/// high bits of `g * cp` rounded to odd, enough to compare the scaled interval bounds exactly
+inline unsigned long long round_to_odd(const unsigned long long (&g)[2], unsigned long long cp) noexcept {
+  constexpr unsigned long long mask63 = (1ull << 63) - 1;
+  const auto x1 = intrin::umulh(g[1], cp), y0 = g[0] * cp, y1 = intrin::umulh(g[0], cp);
+  const auto z = (y0 >> 1) + x1;
+  return (y1 + (z >> 63)) | (((z & mask63) + mask63) >> 63);
+}
+
+/// `f * 10^e`
+struct decimal {
+  unsigned long long f;
+  int e;
+};
+
+/// shortest decimal that rounds to `c * 2^q`, the closest one if there are several
+///
+/// This is Giulietti's Schubfach: the rounding interval is scaled by a 126-bit power of ten and
+/// the only candidates are the two multiples of ten and the two integers around its midpoint.
+inline decimal shortest_decimal(int q, unsigned long long c) noexcept {
+  constexpr unsigned long long c_min = 1ull << 52;
+  const unsigned long long out = c & 1, cb = c << 2, cbr = cb + 2;
+  const bool regular = c != c_min || q == -1074;
+  const auto cbl = regular ? cb - 2 : cb - 1;
+  const int k = regular ? flog10pow2(q) : flog10_three_quarters_pow2(q);
+  const int h = q + flog2pow10(-k) + 2;
+  const auto& g = pow10_table[k + 324];
+  const auto vb = round_to_odd(g, cb << h), vbl = round_to_odd(g, cbl << h), vbr = round_to_odd(g, cbr << h);
+  const auto s = vb >> 2;
+  const auto sp10 = 10 * intrin::umulh(s, 115292150460684698ull << 4), tp10 = sp10 + 10;
+  const bool upin = vbl + out <= sp10 << 2, wpin = (tp10 << 2) + out <= vbr;
+  if (upin != wpin) return {upin ? sp10 : tp10, k};
+  const auto t = s + 1;
+  const bool uin = vbl + out <= s << 2, win = (t << 2) + out <= vbr;
+  if (uin != win) return {uin ? s : t, k};
+  const auto cmp = static_cast<long long>(vb - ((s + t) << 1));
+  return {cmp < 0 || (cmp == 0 && (s & 1) == 0) ? s : t, k};
+}
+
+/// writes the integer `c * 2^q` (0 < q < 32, below 2^75) with all its digits
+inline char* write_exact(char* p, unsigned long long c, int q) noexcept {
+  const unsigned long long hi = c >> (64 - q), lo = c << q;
+  if (hi == 0) return write_digits(p, lo);
+  const unsigned long long m = hi << 32 | lo >> 32, l = m % 100000000 << 32 | (lo & 0xffffffff);
+  p = write_digits(p, m / 100000000 << 32 | l / 100000000);
+  auto r = l % 100000000;
+  for (int i = 8; i--; r /= 10) p[i] = char('0' + r % 10);
+  return p + 8;
+}
+
+/// writes `f * 10^e`, which rounds to `c * 2^q`, in the shorter of fixed and scientific notation
+///
+/// Fixed is chosen on a tie. Like `std::to_chars`, integers in fixed notation are written exactly
+/// rather than as the shortest digits followed by zeros.
+inline char* write_decimal(char* p, unsigned long long f, int e, unsigned long long c, int q) noexcept {
+  for (; f % 10 == 0; f /= 10) ++e;
+  const int n = count_digits(f), x = e + n - 1, ax = x < 0 ? -x : x;
+  const int scientific = n + (n > 1) + 2 + (ax >= 100 ? 3 : 2);
+  const int fixed = e >= 0 ? n + e : n + e > 0 ? n + 1 : 2 - e;
+  if (fixed <= scientific) {
+    if (e > 0 && q > 0) return write_exact(p, c, q);
+    if (e >= 0) return p = write_digits(p, f), std::memset(p, '0', e), p + e;
+    if (n + e > 0) return write_digits(p + 1, f), std::memmove(p, p + 1, n + e), p[n + e] = '.', p + n + 1;
+    p[0] = '0', p[1] = '.';
+    std::memset(p + 2, '0', -(n + e));
+    return write_digits(p + 2 - (n + e), f);
+  }
+  write_digits(p + 1, f);
+  p[0] = p[1];
+  p += n > 1 ? (p[1] = '.', n + 1) : 1;
+  *p++ = 'e', *p++ = x < 0 ? '-' : '+';
+  if (ax >= 100) *p++ = char('0' + ax / 100);
+  std::memcpy(p, digit_pairs + ax % 100 * 2, 2);
+  return p + 2;
+}
+
+/// same output as `std::to_chars(p, p + 32, v)`
+inline char* write_double(char* p, double v) noexcept {
+  const auto bits = std::bit_cast<unsigned long long>(v);
+  const int bq = int(bits >> 52) & 0x7ff;
+  const auto t = bits & ((1ull << 52) - 1);
+  if (bits >> 63) *p++ = '-';
+  if (bq == 0x7ff) return std::memcpy(p, t ? "nan" : "inf", 3), p + 3;
+  if (bq == 0) {
+    if (t == 0) return *p++ = '0', p;
+    const auto d = shortest_decimal(-1074, t);
+    return write_decimal(p, d.f, d.e, t, -1074);
+  }
+  const int mq = 1075 - bq;
+  const auto c = (1ull << 52) | t;
+  if (0 < mq && mq < 53 && (c >> mq << mq) == c) return write_decimal(p, c >> mq, 0, c >> mq, 0);
+  const auto d = shortest_decimal(-mq, c);
+  return write_decimal(p, d.f, d.e, c, -mq);
+}
+
+/// reads up to 16 leading digits with SSSE3 and returns how many there were
+///
+/// The digits are right-aligned in a register and combined pairwise: 2 digits with
+/// `maddubs_epi16`, 4 and 8 digits with `madd_epi16`, then the two 8-digit halves.
+inline int read_digits16(const char* p, const char* last, unsigned long long& v) noexcept {
+  __m128i x;
+  if (last - p >= 16) x = intrin::mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  else {
+    alignas(16) char b[16]{};
+    std::memcpy(b, p, last - p);
+    x = intrin::mm_load_si128(reinterpret_cast<const __m128i*>(b));
+  }
+  const auto nine = intrin::mm_set1_epi8(9);
+  const auto d = intrin::mm_sub_epi8(x, intrin::mm_set1_epi8('0'));
+  const auto is_digit = intrin::mm_cmpeq_epi8(intrin::mm_max_epu8(d, nine), nine);
+  const int n = std::countr_one(unsigned(intrin::mm_movemask_epi8(is_digit)));
+  if (n == 0) return 0;
+  const auto iota = intrin::mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  auto y = intrin::mm_shuffle_epi8(d, intrin::mm_add_epi8(iota, intrin::mm_set1_epi8(char(n - 16))));
+  y = intrin::mm_maddubs_epi16(y, intrin::mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+  y = intrin::mm_madd_epi16(y, intrin::mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+  y = intrin::mm_packus_epi32(y, y);
+  y = intrin::mm_madd_epi16(y, intrin::mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+  v = unsigned(intrin::mm_cvtsi128_si32(y)) * 100000000ull + unsigned(intrin::mm_extract_epi32<1>(y));
+  return n;
+}
+
+/// reads a run of digits into `m`; `count` grows past 19 once `m` can no longer hold them
+inline const char* read_digits(const char* p, const char* last, unsigned long long& m, int& count) noexcept {
+  for (unsigned long long v; p != last;) {
+    const int n = read_digits16(p, last, v);
+    if (n == 0) break;
+    if (count + n <= 19) m = m * powers_of_10[n] + v;
+    count += n, p += n;
+    if (n < 16) break;
+  }
+  return p;
+}
+
+/// reads an unsigned decimal; `overflow` is set if it exceeds 64 bits
+inline const char* read_unsigned(const char* p, const char* last, unsigned long long& v, bool& overflow) noexcept {
+  v = 0, overflow = false;
+  const int n = p == last ? 0 : read_digits16(p, last, v);
+  p += n;
+  if (n == 16)
+    for (; p != last && unsigned(*p - '0') < 10; ++p) {
+      const unsigned d = *p - '0';
+      overflow |= v > (~0ull - d) / 10;
+      v = v * 10 + d;
+    }
+  return p;
+}
+
+/// powers of ten that double represents exactly
+inline constexpr double exact_powers_of_10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/// `w * 10^e` correctly rounded, or `false` if it is subnormal, overflows or is too close to call
+///
+/// This is the Eisel-Lemire method. `pow10_table` supplies 10^e truncated to 126 bits, so the
+/// product can be 4w too small; results within that distance of a rounding boundary are rejected.
+inline bool eisel_lemire(unsigned long long w, int e, double& value) noexcept {
+  if (e < -292 || e > 308) return false;
+  const auto& g = pow10_table[324 - e];
+  unsigned long long tlo = g[0] << 63 | g[1], thi = g[0] >> 1;
+  thi -= tlo == 0, --tlo;
+  thi = thi << 2 | tlo >> 62, tlo <<= 2;
+  const int lz = std::countl_zero(w);
+  w <<= lz;
+  unsigned long long carry, hi;
+  intrin::umul128(w, tlo, &carry);
+  const auto mid = intrin::umul128(w, thi, &hi) + carry;
+  hi += mid < carry;
+  const int upper = int(hi >> 63), shift = 9 + upper;
+  auto m = hi >> shift;
+  const auto rest = hi & ((1ull << shift) - 1);
+  if (rest == (1ull << shift) - 1 && mid > ~0ull - 5) return false;
+  if ((m & 1) && rest == 0 && mid < 5) return false;
+  int exponent = 11 + upper - lz + flog2pow10(e) + 52 + 1023;
+  m = (m + 1) >> 1;
+  if (m >> 53) m >>= 1, ++exponent;
+  if (exponent <= 0 || exponent >= 2047) return false;
+  value = std::bit_cast<double>(static_cast<unsigned long long>(exponent) << 52 | (m & ((1ull << 52) - 1)));
+  return true;
+}
+
+/// parses `[-]digits[.digits][(e|E)[+|-]digits]`
+///
+/// Up to 19 significant digits are converted with one multiplication or division by an exact
+/// power of ten when both are exact (Clinger's fast path), and with `eisel_lemire` otherwise.
+/// Longer inputs, subnormals, rejected cases, `inf` and `nan` are handed to `std::from_chars`.
+inline std::from_chars_result read_double(const char* first, const char* last, double& value) noexcept {
+  const char* p = first;
+  const bool negative = p != last && *p == '-';
+  p += negative;
+  const char* const digits = p;
+  unsigned long long m = 0;
+  int count = 0, e = 0;
+  for (; p != last && *p == '0'; ++p);
+  p = read_digits(p, last, m, count);
+  if (p != last && *p == '.') {
+    const char* const fraction = ++p;
+    if (count == 0)
+      for (; p != last && *p == '0'; ++p);
+    p = read_digits(p, last, m, count);
+    e = int(fraction - p);
+    if (p - digits == 1) return std::from_chars(first, last, value);
+  } else if (p == digits) return std::from_chars(first, last, value);
+  if (p != last && (*p | 0x20) == 'e') {
+    const char* q = p + 1;
+    const bool minus = q != last && *q == '-';
+    q += q != last && (*q == '-' || *q == '+');
+    if (q != last && unsigned(*q - '0') < 10) {
+      int x = 0;
+      for (; q != last && unsigned(*q - '0') < 10; ++q) x = x < 100000 ? x * 10 + (*q - '0') : x;
+      e += minus ? -x : x, p = q;
+    }
+  }
+  double x;
+  if (m == 0) x = 0;
+  else if (count > 19) return std::from_chars(first, last, value);
+  else if (m <= (1ull << 53) && -22 <= e && e <= 22) x = e < 0 ? double(m) / exact_powers_of_10[-e] : double(m) * exact_powers_of_10[e];
+  else if (!eisel_lemire(m, e, x)) return std::from_chars(first, last, value);
+  value = negative ? -x : x;
+  return {p, std::errc{}};
+}
+}
+
+/// writes `v` in decimal and returns the end of the output (needs 20 characters, 21 if negative)
+template<std::integral T> requires (!std::same_as<T, bool>) constexpr char* to_chars(char* p, T v) noexcept {
+  if constexpr (std::is_signed_v<T>)
+    if (v < 0) return *p++ = '-', text_impl::write_digits(p, 0ull - static_cast<unsigned long long>(v));
+  return text_impl::write_digits(p, static_cast<unsigned long long>(v));
+}
+
+/// writes the shortest representation of `v` that reads back exactly (needs 32 characters)
+///
+/// The output matches `std::to_chars(first, last, v)`; NaNs are written as `nan` or `-nan`.
+/// `double` is converted with Schubfach, other widths use `std::to_chars`.
+template<std::floating_point T> char* to_chars(char* p, T v) noexcept {
+  if constexpr (std::numeric_limits<T>::digits == 53) return text_impl::write_double(p, static_cast<double>(v));
+  else return std::to_chars(p, p + 32, v).ptr;
+}
+
+/// parses a decimal number like `std::from_chars(first, last, v)`
+template<typename T> requires (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>
+std::from_chars_result from_chars(const char* first, const char* last, T& v) noexcept {
+  if constexpr (std::floating_point<T>) {
+    if constexpr (std::numeric_limits<T>::digits != 53) return std::from_chars(first, last, v);
+    else {
+      double d;
+      const auto r = text_impl::read_double(first, last, d);
+      if (r.ec == std::errc{}) v = static_cast<T>(d);
+      return r;
+    }
+  } else {
+    const bool negative = std::is_signed_v<T> && first != last && *first == '-';
+    unsigned long long u;
+    bool overflow;
+    const char* const p = text_impl::read_unsigned(first + negative, last, u, overflow);
+    if (p == first + negative) return {first, std::errc::invalid_argument};
+    using U = std::make_unsigned_t<T>;
+    const auto limit = static_cast<unsigned long long>(std::numeric_limits<T>::max()) + negative;
+    if (overflow || u > limit) return {p, std::errc::result_out_of_range};
+    v = negative ? static_cast<T>(U(0) - static_cast<U>(u)) : static_cast<T>(u);
+    return {p, std::errc{}};
+  }
+}
+
+/// result of `parse_column`: values stored, where parsing stopped and why
+struct parse_result {
+  nat count;
+  const char* ptr;
+  std::errc ec;
+};
+
+/// parses numbers separated by whitespace or `sep` into `out` until it is full or the text ends
+///
+/// `ec` is `std::errc{}` unless a field failed to parse, in which case `ptr` points at it.
+template<std::ranges::contiguous_range R> requires std::ranges::sized_range<R>
+parse_result parse_column(string_view text, R&& out, char sep = ',') noexcept {
+  auto* const data = std::ranges::data(out);
+  const nat size = std::ranges::size(out);
+  const char *p = text.data(), *const last = p + text.size();
+  nat n = 0;
+  for (; n < size; ++n) {
+    for (; p != last && (*p == sep || *p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'); ++p);
+    if (p == last) break;
+    const auto r = yw::from_chars(p, last, data[n]);
+    if (r.ec != std::errc{}) return {n, p, r.ec};
+    p = r.ptr;
+  }
+  return {n, p, std::errc{}};
+}
+}
+
+export namespace yw { // print
+
+namespace format_impl {
+
+/// a piece of a format string: literal text (`index < 0`) or a replacement field with its spec
+struct segment {
+  unsigned begin, size;
+  int index;
+};
+
+/// output buffer; `refill` makes room for at least one more character or returns `false`
+struct sink {
+  char* cur{};
+  char* end{};
+  bool (*refill)(sink&){};
+  nat dropped{};
+  void put(char c) {
+    if (cur != end || (refill && refill(*this))) *cur++ = c;
+    else ++dropped;
+  }
+  void put(string_view sv) {
+    while (!sv.empty()) {
+      if (cur == end && !(refill && refill(*this))) { dropped += sv.size(); return; }
+      const auto n = sv.size() < nat(end - cur) ? sv.size() : nat(end - cur);
+      std::memcpy(cur, sv.data(), n);
+      cur += n, sv.remove_prefix(n);
+    }
+  }
+};
+
+struct sink_iterator {
+  using difference_type = std::ptrdiff_t;
+  sink* s;
+  sink_iterator& operator=(char c) { s->put(c); return *this; }
+  sink_iterator& operator*() noexcept { return *this; }
+  sink_iterator& operator++() noexcept { return *this; }
+  sink_iterator operator++(int) noexcept { return *this; }
+};
+
+/// sink backed by a stack buffer that spills to the heap
+struct growable : sink {
+  char local[256];
+  std::unique_ptr<char[]> heap;
+  growable() noexcept : sink{local, local + sizeof(local), grow} {}
+  growable(const growable&) = delete;
+  char* begin() noexcept { return heap ? heap.get() : local; }
+  string_view view() noexcept { return {begin(), nat(cur - begin())}; }
+  static bool grow(sink& s) {
+    auto& g = static_cast<growable&>(s);
+    const nat n = g.cur - g.begin(), c = 2 * nat(g.end - g.begin());
+    auto p = std::make_unique<char[]>(c);
+    std::memcpy(p.get(), g.begin(), n);
+    g.heap = std::move(p);
+    g.cur = g.heap.get() + n, g.end = g.heap.get() + c;
+    return true;
+  }
+};
+
+/// nanoseconds a thread may keep printed text before it is flushed
+inline std::atomic<long long> flush_interval{50'000'000};
+
+inline void write_stdout(const char* p, nat n) {
+  static std::mutex m;
+  std::lock_guard lock(m);
+  std::cout.write(p, static_cast<std::streamsize>(n)).flush();
+}
+
+/// per-thread stdout buffer; one lock and one write per flush
+class stdout_buffer : public sink {
+  static constexpr nat capacity = 64 * 1024;
+  static inline thread_local bool _gone = false;
+  std::unique_ptr<char[]> _buffer = std::make_unique<char[]>(capacity);
+  std::chrono::steady_clock::time_point _last = std::chrono::steady_clock::now();
+  static bool _refill(sink& s) { static_cast<stdout_buffer&>(s).flush(); return true; }
+public:
+  stdout_buffer() { cur = _buffer.get(), end = cur + capacity, refill = _refill; }
+  ~stdout_buffer() { flush(), _gone = true; }
+  void flush() {
+    if (cur != _buffer.get()) write_stdout(_buffer.get(), cur - _buffer.get()), cur = _buffer.get();
+    _last = std::chrono::steady_clock::now();
+  }
+  /// flushes if the buffer is mostly full or its contents are older than `flush_interval`
+  void poll() {
+    if (nat(cur - _buffer.get()) > capacity / 4 * 3) return flush();
+    const auto age = std::chrono::steady_clock::now() - _last;
+    if (std::chrono::duration_cast<std::chrono::nanoseconds>(age).count() > flush_interval.load(std::memory_order_relaxed)) flush();
+  }
+  /// the calling thread's buffer, or null once it has been destroyed at thread exit (as when
+  /// printing from an `atexit` handler or a static destructor)
+  static stdout_buffer* local() {
+    if (_gone) return nullptr;
+    static thread_local stdout_buffer b;
+    return &b;
+  }
+};
+
+}
+
+/// format string parsed into segments at compile time
+///
+/// The string is validated by `std::format_string` and split into literal text and
+/// replacement fields, so formatting does not re-parse it. Fields without a spec of
+/// arithmetic, character or string type are written directly; other fields go through
+/// `std::formatter`. Strings with nested replacement fields fall back to `std::vformat_to`.
+template<typename... Ts> class basic_format_string {
+  static constexpr nat _capacity = 2 * sizeof...(Ts) + 2;
+  string_view _str;
+  format_impl::segment _segments[_capacity]{};
+  nat _count = 0;
+  bool _fallback = false;
+
+  consteval void _push(nat begin, nat size, int index) {
+    if (_count == _capacity) _fallback = true;
+    else _segments[_count++] = {unsigned(begin), unsigned(size), index};
+  }
+
+public:
+  template<typename S> requires std::convertible_to<const S&, string_view>
+  consteval basic_format_string(const S& s) : _str(s) {
+    [[maybe_unused]] std::format_string<Ts...> validated(_str);
+    nat lit = 0;
+    int auto_index = 0;
+    for (nat i = 0; i < _str.size(); ++i) {
+      if (_str[i] == '}' || (_str[i] == '{' && _str[i + 1] == '{')) {
+        _push(lit, i + 1 - lit, -1);
+        lit = ++i + 1;
+      } else if (_str[i] == '{') {
+        if (i > lit) _push(lit, i - lit, -1);
+        nat j = i + 1;
+        int index = 0;
+        if ('0' <= _str[j] && _str[j] <= '9')
+          for (; '0' <= _str[j] && _str[j] <= '9'; ++j) index = index * 10 + (_str[j] - '0');
+        else index = auto_index++;
+        nat spec = j;
+        if (_str[j] == ':')
+          for (spec = ++j; _str[j] != '}'; ++j) if (_str[j] == '{') _fallback = true;
+        _push(spec, j - spec, index);
+        lit = (i = j) + 1;
+      }
+    }
+    if (lit < _str.size()) _push(lit, _str.size() - lit, -1);
+  }
+  constexpr string_view get() const noexcept { return _str; }
+  constexpr bool fallback() const noexcept { return _fallback; }
+  constexpr std::span<const format_impl::segment> segments() const noexcept { return {_segments, _count}; }
+};
+template<typename... Ts> using format_string = basic_format_string<std::type_identity_t<Ts>...>;
+
+namespace format_impl {
+
+template<typename T> void format_field(sink& s, const T& v, string_view spec) {
+  using U = std::remove_cvref_t<T>;
+  if (!spec.empty()) {
+    char b[64] = "{:";
+    if (spec.size() > sizeof(b) - 3) return void(std::vformat_to(sink_iterator{&s}, "{:" + std::string(spec) + "}", std::make_format_args(v)));
+    std::memcpy(b + 2, spec.data(), spec.size());
+    b[spec.size() + 2] = '}';
+    std::vformat_to(sink_iterator{&s}, string_view(b, spec.size() + 3), std::make_format_args(v));
+  } else if constexpr (std::same_as<U, bool>) s.put(v ? string_view("true") : string_view("false"));
+  else if constexpr (std::same_as<U, char>) s.put(v);
+  else if constexpr (std::integral<U> || std::floating_point<U>) {
+    char b[32];
+    s.put(string_view(b, to_chars(b, v)));
+  } else if constexpr (std::convertible_to<const T&, string_view>) s.put(string_view(v));
+  else std::format_to(sink_iterator{&s}, "{}", v);
+}
+
+template<typename... Ts, typename... As> void vformat(sink& s, const basic_format_string<Ts...>& fmt, As&... args) {
+  if (fmt.fallback()) return void(std::vformat_to(sink_iterator{&s}, fmt.get(), std::make_format_args(args...)));
+  const auto str = fmt.get();
+  for (const auto& seg : fmt.segments()) {
+    const auto text = str.substr(seg.begin, seg.size);
+    if (seg.index < 0) s.put(text);
+    else {
+      int i = 0;
+      ((i++ == seg.index ? format_field(s, args, text) : void()), ...);
+    }
+  }
+}
+
+/// formats into the calling thread's buffer, or straight to stdout once it is gone
+template<typename... Ts> void print(bool newline, const auto& fmt, Ts&... args) {
+  if (auto out = stdout_buffer::local()) {
+    vformat(*out, fmt, args...);
+    if (newline) out->put('\n');
+    return out->poll();
+  }
+  growable g;
+  vformat(g, fmt, args...);
+  if (newline) g.put('\n');
+  const auto v = g.view();
+  write_stdout(v.data(), v.size());
+}
+}
+
+/// prints to stdout through a per-thread buffer
+///
+/// The buffer is written out when it is mostly full, on `flush()` and at thread exit, and by
+/// the next print once its contents are older than `print_flush_interval`; nothing is written
+/// while the thread prints nothing, so call `flush()` before blocking or before writing to
+/// stdout by other means. After the thread's buffer is destroyed, text goes straight to stdout.
+inline constexpr auto print = []<typename... Ts>(format_string<Ts...> fmt, Ts&&... args) { format_impl::print(false, fmt, args...); };
+
+/// prints to stdout through a per-thread buffer and appends a newline
+inline constexpr auto println = []<typename... Ts>(format_string<Ts...> fmt, Ts&&... args) { format_impl::print(true, fmt, args...); };
+
+/// writes the calling thread's buffered output to stdout
+inline void flush() {
+  if (auto out = format_impl::stdout_buffer::local()) out->flush();
+}
+
+/// sets how long printed text may stay buffered before it is flushed
+inline void print_flush_interval(std::chrono::nanoseconds d) noexcept { format_impl::flush_interval = d.count(); }
+
+/// formats into a caller buffer, a `string` or memory taken from a resource
+///
+/// - `std::span<char>`: returns the full length, which exceeds the span size if truncated
+/// - `string&`: appends and returns the string
+/// - `std::pmr::memory_resource&` (e.g. `arena`): returns a null-terminated view into the resource
+inline constexpr auto print_to = []<typename Out, typename... Ts>(Out&& out, format_string<Ts...> fmt, Ts&&... args) -> decltype(auto)
+  requires std::convertible_to<Out, std::span<char>> || std::same_as<Out, string&> || std::derived_from<std::remove_cvref_t<Out>, std::pmr::memory_resource> {
+  if constexpr (std::convertible_to<Out, std::span<char>>) {
+    const std::span<char> buf = out;
+    format_impl::sink s{buf.data(), buf.data() + buf.size()};
+    format_impl::vformat(s, fmt, args...);
+    return nat(s.cur - buf.data()) + s.dropped;
+  } else {
+    format_impl::growable g;
+    format_impl::vformat(g, fmt, args...);
+    const auto v = g.view();
+    if constexpr (std::same_as<Out, string&>) return out.append(v);
+    else {
+      auto p = static_cast<char*>(out.allocate(v.size() + 1, 1));
+      std::memcpy(p, v.data(), v.size());
+      p[v.size()] = '\0';
+      return string_view(p, v.size());
+    }
+  }
+};
+
+/// returns the formatted text as a `string`
+inline constexpr auto format = []<typename... Ts>(format_string<Ts...> fmt, Ts&&... args) {
+  format_impl::growable g;
+  format_impl::vformat(g, fmt, args...);
+  return string(g.view());
+};
+}
+
+export namespace yw { // codec
+
+/// base64 alphabet: `standard` (RFC 4648 section 4, `+/`) or `url` (section 5, `-_`)
+enum class base64_alphabet { standard, url };
+
+namespace codec_impl {
+
+/// `pshufb` tables for a byte set: `c` is a member iff `(lo[c & 15] & hi[c >> 4]) == 0`
+///
+/// High nibbles with the same members share one bit, so a set may have up to 8 distinct rows.
+struct nibble_set {
+  char lo[16]{}, hi[16]{};
+  constexpr bool contains(char c) const noexcept { return !(lo[c & 15] & hi[static_cast<unsigned char>(c) >> 4]); }
+};
+
+consteval nibble_set make_nibble_set(string_view members) {
+  unsigned rows[16]{}, distinct[8]{};
+  for (const char c : members) rows[static_cast<unsigned char>(c) >> 4] |= 1u << (c & 15);
+  nibble_set s;
+  for (int h = 0, n = 0; h < 16; ++h) {
+    int g = 0;
+    for (; g < n && distinct[g] != rows[h]; ++g);
+    if (g == n) {
+      if (n == 8) throw "more than 8 distinct rows";
+      distinct[n++] = rows[h];
+    }
+    s.hi[h] = char(1 << g);
+    for (int l = 0; l < 16; ++l)
+      if (!(rows[h] >> l & 1)) s.lo[l] = char(s.lo[l] | 1 << g);
+  }
+  return s;
+}
+
+/// lookup tables of a base64 alphabet
+struct base64_tables {
+  char chars[64];
+  signed char values[256];
+  nibble_set valid;
+  /// encoding: character minus index for each index class (see `base64_encode12`)
+  char offset[16];
+  /// decoding: index minus character for each high nibble; the last character uses row 1
+  char roll[16];
+  /// the last character and what moves its high nibble to row 1
+  char last, adjust;
+};
+
+/// builds the tables of an alphabet that keeps `A-Z`, `a-z` and `0-9` in RFC 4648 order
+consteval base64_tables make_base64_tables(const char (&chars)[65]) {
+  base64_tables t{};
+  for (auto& v : t.values) v = -1;
+  unsigned offsets = 0, rolls = 0;
+  for (int i = 0; i < 64; ++i) {
+    const int c = static_cast<unsigned char>(chars[i]);
+    t.chars[i] = chars[i], t.values[c] = static_cast<signed char>(i);
+    const int k = i < 26 ? 13 : i < 52 ? 0 : i - 51, r = i == 63 ? 1 : c >> 4;
+    if ((offsets >> k & 1) && t.offset[k] != char(c - i)) throw "unsupported alphabet";
+    if ((rolls >> r & 1) && t.roll[r] != char(i - c)) throw "unsupported alphabet";
+    if (i != 63 && r == 1) throw "unsupported alphabet";
+    t.offset[k] = char(c - i), offsets |= 1u << k;
+    t.roll[r] = char(i - c), rolls |= 1u << r;
+  }
+  t.valid = make_nibble_set(string_view(chars, 64));
+  t.last = chars[63], t.adjust = char(1 - (static_cast<unsigned char>(chars[63]) >> 4));
+  return t;
+}
+
+inline constexpr base64_tables base64_standard = make_base64_tables("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+inline constexpr base64_tables base64_url = make_base64_tables("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+
+inline const base64_tables& tables(base64_alphabet a) noexcept { return a == base64_alphabet::url ? base64_url : base64_standard; }
+
+/// RFC 3986 unreserved characters, which percent-encoding leaves as they are
+inline constexpr nibble_set unreserved = make_nibble_set("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~");
+
+inline constexpr char hex_digits[2][17] = {"0123456789abcdef", "0123456789ABCDEF"};
+
+constexpr int hex_value(char c) noexcept {
+  const unsigned d = unsigned(c - '0'), l = unsigned((c | 0x20) - 'a');
+  return d < 10 ? int(d) : l < 6 ? int(l) + 10 : -1;
+}
+
+inline __m128i load(const void* p) noexcept { return intrin::mm_loadu_si128(static_cast<const __m128i*>(p)); }
+inline __m256i load2(const void* p) noexcept { return intrin::mm256_broadcastsi128_si256(load(p)); }
+inline __m256i load256(const void* p) noexcept { return intrin::mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+inline void store(void* p, const __m128i& x) noexcept { intrin::mm_storeu_si128(static_cast<__m128i*>(p), x); }
+inline void store(void* p, const __m256i& x) noexcept { intrin::mm256_storeu_si256(static_cast<__m256i*>(p), x); }
+
+/// nonzero in the lanes of `x` that are not in `s`
+inline __m128i outside(const nibble_set& s, const __m128i& x) noexcept {
+  const auto mask = intrin::mm_set1_epi8(0x0f);
+  const auto lo = intrin::mm_shuffle_epi8(load(s.lo), intrin::mm_and_si128(x, mask));
+  return intrin::mm_and_si128(lo, intrin::mm_shuffle_epi8(load(s.hi), intrin::mm_and_si128(intrin::mm_srli_epi32<4>(x), mask)));
+}
+inline __m256i outside(const nibble_set& s, const __m256i& x) noexcept {
+  const auto mask = intrin::mm256_set1_epi8(0x0f);
+  const auto lo = intrin::mm256_shuffle_epi8(load2(s.lo), intrin::mm256_and_si256(x, mask));
+  return intrin::mm256_and_si256(lo, intrin::mm256_shuffle_epi8(load2(s.hi), intrin::mm256_and_si256(intrin::mm256_srli_epi32<4>(x), mask)));
+}
+
+/// encodes 12 bytes (16 readable) into 16 characters
+///
+/// Each 3-byte group is spread over 4 bytes and split into 6-bit indices with two multiplies.
+/// Indices are mapped to characters by adding `offset[k]`, where the class `k` is 13 for
+/// `0-25`, 0 for `26-51` and `index - 51` above.
+inline void base64_encode12(const base64_tables& t, const unsigned char* src, char* dst) noexcept {
+  const auto x = intrin::mm_shuffle_epi8(load(src), intrin::mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const auto a = intrin::mm_mulhi_epu16(intrin::mm_and_si128(x, intrin::mm_set1_epi32(0x0fc0fc00)), intrin::mm_set1_epi32(0x04000040));
+  const auto b = intrin::mm_mullo_epi16(intrin::mm_and_si128(x, intrin::mm_set1_epi32(0x003f03f0)), intrin::mm_set1_epi32(0x01000010));
+  const auto i = intrin::mm_or_si128(a, b);
+  const auto below26 = intrin::mm_and_si128(intrin::mm_cmpgt_epi8(intrin::mm_set1_epi8(26), i), intrin::mm_set1_epi8(13));
+  const auto k = intrin::mm_or_si128(intrin::mm_subs_epu8(i, intrin::mm_set1_epi8(51)), below26);
+  store(dst, intrin::mm_add_epi8(i, intrin::mm_shuffle_epi8(load(t.offset), k)));
+}
+
+/// encodes 24 bytes (28 readable) into 32 characters
+inline void base64_encode24(const base64_tables& t, const unsigned char* src, char* dst) noexcept {
+  auto x = intrin::mm256_loadu2_m128i(reinterpret_cast<const __m128i*>(src + 12), reinterpret_cast<const __m128i*>(src));
+  x = intrin::mm256_shuffle_epi8(x, intrin::mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const auto a = intrin::mm256_mulhi_epu16(intrin::mm256_and_si256(x, intrin::mm256_set1_epi32(0x0fc0fc00)), intrin::mm256_set1_epi32(0x04000040));
+  const auto b = intrin::mm256_mullo_epi16(intrin::mm256_and_si256(x, intrin::mm256_set1_epi32(0x003f03f0)), intrin::mm256_set1_epi32(0x01000010));
+  const auto i = intrin::mm256_or_si256(a, b);
+  const auto below26 = intrin::mm256_and_si256(intrin::mm256_cmpgt_epi8(intrin::mm256_set1_epi8(26), i), intrin::mm256_set1_epi8(13));
+  const auto k = intrin::mm256_or_si256(intrin::mm256_subs_epu8(i, intrin::mm256_set1_epi8(51)), below26);
+  store(dst, intrin::mm256_add_epi8(i, intrin::mm256_shuffle_epi8(load2(t.offset), k)));
+}
+
+inline char* base64_encode_tail(const base64_tables& t, const unsigned char* p, const unsigned char* last, char* dst, bool padding) noexcept {
+  for (; last - p >= 3; p += 3, dst += 4) {
+    const unsigned x = unsigned(p[0]) << 16 | unsigned(p[1]) << 8 | p[2];
+    dst[0] = t.chars[x >> 18], dst[1] = t.chars[x >> 12 & 63], dst[2] = t.chars[x >> 6 & 63], dst[3] = t.chars[x & 63];
+  }
+  if (p == last) return dst;
+  const unsigned x = unsigned(p[0]) << 16 | (last - p == 2 ? unsigned(p[1]) << 8 : 0);
+  *dst++ = t.chars[x >> 18], *dst++ = t.chars[x >> 12 & 63];
+  if (last - p == 2) *dst++ = t.chars[x >> 6 & 63];
+  else if (padding) *dst++ = '=';
+  if (padding) *dst++ = '=';
+  return dst;
+}
+
+/// decodes 16 characters into 12 bytes (16 writable); returns `false` without writing if any is not in the alphabet
+///
+/// Each character plus `roll[row]` is its index, where the row is the high nibble except for
+/// the last character of the alphabet. Indices are merged pairwise with `maddubs` and `madd`.
+inline bool base64_decode16(const base64_tables& t, const char* src, unsigned char* dst) noexcept {
+  const auto x = load(src);
+  if (const auto o = outside(t.valid, x); !intrin::mm_testz_si128(o, o)) return false;
+  const auto hi = intrin::mm_and_si128(intrin::mm_srli_epi32<4>(x), intrin::mm_set1_epi8(0x0f));
+  const auto row = intrin::mm_add_epi8(hi, intrin::mm_and_si128(intrin::mm_cmpeq_epi8(x, intrin::mm_set1_epi8(t.last)), intrin::mm_set1_epi8(t.adjust)));
+  auto v = intrin::mm_add_epi8(x, intrin::mm_shuffle_epi8(load(t.roll), row));
+  v = intrin::mm_madd_epi16(intrin::mm_maddubs_epi16(v, intrin::mm_set1_epi32(0x01400140)), intrin::mm_set1_epi32(0x00011000));
+  store(dst, intrin::mm_shuffle_epi8(v, intrin::mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+  return true;
+}
+
+/// decodes 32 characters into 24 bytes (32 writable); returns `false` without writing if any is not in the alphabet
+inline bool base64_decode32(const base64_tables& t, const char* src, unsigned char* dst) noexcept {
+  const auto x = load256(src);
+  if (const auto o = outside(t.valid, x); !intrin::mm256_testz_si256(o, o)) return false;
+  const auto hi = intrin::mm256_and_si256(intrin::mm256_srli_epi32<4>(x), intrin::mm256_set1_epi8(0x0f));
+  const auto row = intrin::mm256_add_epi8(hi, intrin::mm256_and_si256(intrin::mm256_cmpeq_epi8(x, intrin::mm256_set1_epi8(t.last)), intrin::mm256_set1_epi8(t.adjust)));
+  auto v = intrin::mm256_add_epi8(x, intrin::mm256_shuffle_epi8(load2(t.roll), row));
+  v = intrin::mm256_madd_epi16(intrin::mm256_maddubs_epi16(v, intrin::mm256_set1_epi32(0x01400140)), intrin::mm256_set1_epi32(0x00011000));
+  v = intrin::mm256_shuffle_epi8(v, intrin::mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  store(dst, intrin::mm256_permutevar8x32_epi32(v, intrin::mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+  return true;
+}
+
+inline parse_result base64_decode_tail(const base64_tables& t, const char* p, const char* last, unsigned char* dst, nat count, bool final) noexcept {
+  const auto value = [&](char c) -> int { return t.values[static_cast<unsigned char>(c)]; };
+  for (; last - p >= 4; p += 4, dst += 3, count += 3) {
+    const int a = value(p[0]), b = value(p[1]), c = value(p[2]), d = value(p[3]);
+    if ((a | b | c | d) < 0) break;
+    const unsigned x = unsigned(a) << 18 | unsigned(b) << 12 | unsigned(c) << 6 | unsigned(d);
+    dst[0] = static_cast<unsigned char>(x >> 16), dst[1] = static_cast<unsigned char>(x >> 8), dst[2] = static_cast<unsigned char>(x);
+  }
+  unsigned x = 0;
+  int n = 0, padding = 0;
+  const char* q = p;
+  for (; q != last && n < 4 && value(*q) >= 0; ++q, ++n) x |= unsigned(value(*q)) << (18 - 6 * n);
+  if (n >= 2)
+    for (; q != last && *q == '=' && n + padding < 4; ++q) ++padding;
+  if (q != last) return {count, q, std::errc::invalid_argument};
+  if (n == 0) return {count, q, std::errc{}};
+  if (!final && n + padding < 4) return {count, p, std::errc{}};
+  if (n == 1 || (padding && n + padding < 4)) return {count, p, std::errc::invalid_argument};
+  dst[0] = static_cast<unsigned char>(x >> 16);
+  if (n == 3) dst[1] = static_cast<unsigned char>(x >> 8);
+  return {count + n - 1, q, std::errc{}};
+}
+
+/// encodes 16 bytes into 32 hex digits
+inline void hex_encode16(const char* digits, const unsigned char* src, char* dst) noexcept {
+  const auto x = load(src), mask = intrin::mm_set1_epi8(0x0f), lut = load(digits);
+  const auto hi = intrin::mm_shuffle_epi8(lut, intrin::mm_and_si128(intrin::mm_srli_epi16<4>(x), mask));
+  const auto lo = intrin::mm_shuffle_epi8(lut, intrin::mm_and_si128(x, mask));
+  store(dst, intrin::mm_unpacklo_epi8(hi, lo)), store(dst + 16, intrin::mm_unpackhi_epi8(hi, lo));
+}
+
+/// encodes 32 bytes into 64 hex digits
+inline void hex_encode32(const char* digits, const unsigned char* src, char* dst) noexcept {
+  const auto x = intrin::mm256_permute4x64_epi64<0xd8>(load256(src)), mask = intrin::mm256_set1_epi8(0x0f), lut = load2(digits);
+  const auto hi = intrin::mm256_shuffle_epi8(lut, intrin::mm256_and_si256(intrin::mm256_srli_epi16<4>(x), mask));
+  const auto lo = intrin::mm256_shuffle_epi8(lut, intrin::mm256_and_si256(x, mask));
+  store(dst, intrin::mm256_unpacklo_epi8(hi, lo)), store(dst + 32, intrin::mm256_unpackhi_epi8(hi, lo));
+}
+
+/// values of 16 hex digits of either case, or `false` if any is not one
+inline bool hex_values(const __m128i& x, __m128i& v) noexcept {
+  const auto nine = intrin::mm_set1_epi8(9), five = intrin::mm_set1_epi8(5);
+  const auto d = intrin::mm_sub_epi8(x, intrin::mm_set1_epi8('0'));
+  const auto l = intrin::mm_sub_epi8(intrin::mm_or_si128(x, intrin::mm_set1_epi8(0x20)), intrin::mm_set1_epi8('a'));
+  const auto is_digit = intrin::mm_cmpeq_epi8(intrin::mm_max_epu8(d, nine), nine);
+  const auto is_letter = intrin::mm_cmpeq_epi8(intrin::mm_max_epu8(l, five), five);
+  if (intrin::mm_movemask_epi8(intrin::mm_or_si128(is_digit, is_letter)) != 0xffff) return false;
+  v = intrin::mm_blendv_epi8(intrin::mm_add_epi8(l, intrin::mm_set1_epi8(10)), d, is_digit);
+  return true;
+}
+inline bool hex_values(const __m256i& x, __m256i& v) noexcept {
+  const auto nine = intrin::mm256_set1_epi8(9), five = intrin::mm256_set1_epi8(5);
+  const auto d = intrin::mm256_sub_epi8(x, intrin::mm256_set1_epi8('0'));
+  const auto l = intrin::mm256_sub_epi8(intrin::mm256_or_si256(x, intrin::mm256_set1_epi8(0x20)), intrin::mm256_set1_epi8('a'));
+  const auto is_digit = intrin::mm256_cmpeq_epi8(intrin::mm256_max_epu8(d, nine), nine);
+  const auto is_letter = intrin::mm256_cmpeq_epi8(intrin::mm256_max_epu8(l, five), five);
+  if (intrin::mm256_movemask_epi8(intrin::mm256_or_si256(is_digit, is_letter)) != -1) return false;
+  v = intrin::mm256_blendv_epi8(intrin::mm256_add_epi8(l, intrin::mm256_set1_epi8(10)), d, is_digit);
+  return true;
+}
+
+/// decodes 32 hex digits into 16 bytes; returns `false` without writing if any is not a digit
+inline bool hex_decode16(const char* src, unsigned char* dst) noexcept {
+  __m128i a, b;
+  if (!hex_values(load(src), a) || !hex_values(load(src + 16), b)) return false;
+  const auto w = intrin::mm_set1_epi16(0x0110);
+  store(dst, intrin::mm_packus_epi16(intrin::mm_maddubs_epi16(a, w), intrin::mm_maddubs_epi16(b, w)));
+  return true;
+}
+
+/// decodes 64 hex digits into 32 bytes; returns `false` without writing if any is not a digit
+inline bool hex_decode32(const char* src, unsigned char* dst) noexcept {
+  __m256i a, b;
+  if (!hex_values(load256(src), a) || !hex_values(load256(src + 32), b)) return false;
+  const auto w = intrin::mm256_set1_epi16(0x0110);
+  const auto v = intrin::mm256_packus_epi16(intrin::mm256_maddubs_epi16(a, w), intrin::mm256_maddubs_epi16(b, w));
+  store(dst, intrin::mm256_permute4x64_epi64<0xd8>(v));
+  return true;
+}
+
+inline char* percent_escape(char* dst, char c) noexcept {
+  const auto u = static_cast<unsigned char>(c);
+  dst[0] = '%', dst[1] = hex_digits[1][u >> 4], dst[2] = hex_digits[1][u & 15];
+  return dst + 3;
+}
+}
+
+/// characters `base64_encode` writes for `n` bytes
+constexpr nat base64_encoded_size(nat n, bool padding = true) noexcept { return padding ? (n + 2) / 3 * 4 : n / 3 * 4 + (n % 3 ? n % 3 + 1 : 0); }
+
+/// bytes `base64_decode` writes at most for `n` characters
+constexpr nat base64_decoded_size(nat n) noexcept { return n / 4 * 3 + n % 4 * 3 / 4; }
+
+/// writes `n` bytes at `src` as base64 and returns the end of the output
+///
+/// Runs 24 bytes at a time with AVX2, 12 with SSE4.1 and the rest with a scalar loop. Chunks
+/// encode to the same text as one call if all but the last are multiples of 3 bytes; see
+/// `base64_encoder` for arbitrary chunks.
+inline char* base64_encode(const void* src, nat n, char* dst, base64_alphabet a = base64_alphabet::standard, bool padding = true) noexcept {
+  const auto& t = codec_impl::tables(a);
+  auto p = static_cast<const unsigned char*>(src);
+  const auto last = p + n;
+  if (cpu.avx2) {
+    for (; last - p >= 28; p += 24, dst += 32) codec_impl::base64_encode24(t, p, dst);
+    intrin::mm256_zeroupper();
+  }
+  for (; last - p >= 16; p += 12, dst += 16) codec_impl::base64_encode12(t, p, dst);
+  return codec_impl::base64_encode_tail(t, p, last, dst, padding);
+}
+
+/// returns `bytes` encoded as base64
+inline string base64_encode(string_view bytes, base64_alphabet a = base64_alphabet::standard, bool padding = true) {
+  string s;
+  s.resize_and_overwrite(base64_encoded_size(bytes.size(), padding), [&](char* p, nat) { return base64_encode(bytes.data(), bytes.size(), p, a, padding) - p; });
+  return s;
+}
+
+/// decodes base64 with or without padding into `dst`, which needs `base64_decoded_size(src.size())` bytes
+///
+/// `count` is the number of bytes written. On failure `ec` is `std::errc::invalid_argument`
+/// and `ptr` points at the offending character. With `final == false`, an unpadded group at
+/// the end is left at `ptr` so that it can be passed again in front of the next chunk.
+inline parse_result base64_decode(string_view src, void* dst, base64_alphabet a = base64_alphabet::standard, bool final = true) noexcept {
+  const auto& t = codec_impl::tables(a);
+  const char *p = src.data(), *const last = p + src.size();
+  auto out = static_cast<unsigned char*>(dst);
+  if (cpu.avx2) {
+    for (; last - p >= 48 && codec_impl::base64_decode32(t, p, out); p += 32) out += 24;
+    intrin::mm256_zeroupper();
+  }
+  for (; last - p >= 24 && codec_impl::base64_decode16(t, p, out); p += 16) out += 12;
+  return codec_impl::base64_decode_tail(t, p, last, out, nat(out - static_cast<unsigned char*>(dst)), final);
+}
+
+/// base64 encoder for data that arrives in chunks of any size
+class base64_encoder {
+  unsigned char _carry[2]{};
+  nat _size = 0;
+  base64_alphabet _alphabet;
+  bool _padding;
+public:
+  explicit base64_encoder(base64_alphabet a = base64_alphabet::standard, bool padding = true) noexcept : _alphabet(a), _padding(padding) {}
+
+  /// encodes `n` more bytes and returns the end of the output (at most `base64_encoded_size(n + 2)` characters)
+  char* update(const void* src, nat n, char* dst) noexcept {
+    auto p = static_cast<const unsigned char*>(src);
+    if (_size) {
+      if (_size + n < 3) return std::memcpy(_carry + _size, p, n), _size += n, dst;
+      unsigned char group[3];
+      std::memcpy(group, _carry, _size), std::memcpy(group + _size, p, 3 - _size);
+      p += 3 - _size, n -= 3 - _size, _size = 0;
+      dst = base64_encode(group, 3, dst, _alphabet);
+    }
+    const nat whole = n / 3 * 3;
+    dst = base64_encode(p, whole, dst, _alphabet);
+    std::memcpy(_carry, p + whole, _size = n - whole);
+    return dst;
+  }
+
+  /// encodes the remaining bytes with padding if enabled; the encoder can then be reused
+  char* finish(char* dst) noexcept {
+    dst = base64_encode(_carry, _size, dst, _alphabet, _padding);
+    _size = 0;
+    return dst;
+  }
+};
+
+/// writes `n` bytes at `src` as `2 * n` hex digits and returns the end of the output
+inline char* hex_encode(const void* src, nat n, char* dst, bool upper = false) noexcept {
+  const char* const digits = codec_impl::hex_digits[upper];
+  auto p = static_cast<const unsigned char*>(src);
+  const auto last = p + n;
+  if (cpu.avx2) {
+    for (; last - p >= 32; p += 32, dst += 64) codec_impl::hex_encode32(digits, p, dst);
+    intrin::mm256_zeroupper();
+  }
+  for (; last - p >= 16; p += 16, dst += 32) codec_impl::hex_encode16(digits, p, dst);
+  for (; p != last; ++p) *dst++ = digits[*p >> 4], *dst++ = digits[*p & 15];
+  return dst;
+}
+
+/// returns `bytes` as hex digits
+inline string hex_encode(string_view bytes, bool upper = false) {
+  string s;
+  s.resize_and_overwrite(2 * bytes.size(), [&](char* p, nat) { return hex_encode(bytes.data(), bytes.size(), p, upper) - p; });
+  return s;
+}
+
+/// decodes hex digits of either case into `dst`, which needs `src.size() / 2` bytes
+///
+/// Results are reported like `base64_decode`; with `final == false` an odd digit at the end is left at `ptr`.
+inline parse_result hex_decode(string_view src, void* dst, bool final = true) noexcept {
+  const char *p = src.data(), *const last = p + src.size();
+  auto out = static_cast<unsigned char*>(dst);
+  if (cpu.avx2) {
+    for (; last - p >= 64 && codec_impl::hex_decode32(p, out); p += 64) out += 32;
+    intrin::mm256_zeroupper();
+  }
+  for (; last - p >= 32 && codec_impl::hex_decode16(p, out); p += 32) out += 16;
+  const auto count = [&] { return nat(out - static_cast<unsigned char*>(dst)); };
+  for (; last - p >= 2; p += 2) {
+    const int h = codec_impl::hex_value(p[0]), l = codec_impl::hex_value(p[1]);
+    if (h < 0 || l < 0) return {count(), p + (h >= 0), std::errc::invalid_argument};
+    *out++ = static_cast<unsigned char>(h << 4 | l);
+  }
+  if (p != last && (final || codec_impl::hex_value(*p) < 0)) return {count(), p, std::errc::invalid_argument};
+  return {count(), p, std::errc{}};
+}
+
+/// percent-encodes all but RFC 3986 unreserved characters; `dst` needs `3 * src.size()` characters
+inline char* percent_encode(string_view src, char* dst) noexcept {
+  const auto& s = codec_impl::unreserved;
+  const char *p = src.data(), *const last = p + src.size();
+  if (cpu.avx2) {
+    while (last - p >= 32) {
+      const auto x = codec_impl::load256(p);
+      codec_impl::store(dst, x);
+      const auto m = ~unsigned(intrin::mm256_movemask_epi8(intrin::mm256_cmpeq_epi8(codec_impl::outside(s, x), intrin::mm256_setzero_si256())));
+      const int n = m ? std::countr_zero(m) : 32;
+      p += n, dst += n;
+      if (m) dst = codec_impl::percent_escape(dst, *p++);
+    }
+    intrin::mm256_zeroupper();
+  }
+  while (last - p >= 16) {
+    const auto x = codec_impl::load(p);
+    codec_impl::store(dst, x);
+    const auto m = ~unsigned(intrin::mm_movemask_epi8(intrin::mm_cmpeq_epi8(codec_impl::outside(s, x), intrin::mm_setzero_si128()))) & 0xffff;
+    const int n = m ? std::countr_zero(m) : 16;
+    p += n, dst += n;
+    if (m) dst = codec_impl::percent_escape(dst, *p++);
+  }
+  for (; p != last; ++p) dst = s.contains(*p) ? (*dst = *p, dst + 1) : codec_impl::percent_escape(dst, *p);
+  return dst;
+}
+
+/// returns `text` percent-encoded
+inline string percent_encode(string_view text) {
+  string s;
+  s.resize_and_overwrite(3 * text.size(), [&](char* p, nat) { return percent_encode(text, p) - p; });
+  return s;
+}
+
+/// decodes `%XX` escapes into `dst`, which needs `src.size()` bytes; `+` is left as it is
+///
+/// Results are reported like `base64_decode`; with `final == false` an incomplete escape at the end is left at `ptr`.
+inline parse_result percent_decode(string_view src, char* dst, bool final = true) noexcept {
+  const char *p = src.data(), *const last = p + src.size();
+  char* const begin = dst;
+  for (const auto percent = intrin::mm_set1_epi8('%');;) {
+    for (; last - p >= 16; p += 16, dst += 16) {
+      const auto x = codec_impl::load(p);
+      codec_impl::store(dst, x);
+      if (const auto m = unsigned(intrin::mm_movemask_epi8(intrin::mm_cmpeq_epi8(x, percent)))) {
+        const int n = std::countr_zero(m);
+        p += n, dst += n;
+        break;
+      }
+    }
+    for (; p != last && *p != '%'; ++p) *dst++ = *p;
+    if (p == last) return {nat(dst - begin), p, std::errc{}};
+    const int h = last - p > 1 ? codec_impl::hex_value(p[1]) : 0, l = last - p > 2 ? codec_impl::hex_value(p[2]) : 0;
+    if (h < 0 || l < 0) return {nat(dst - begin), p, std::errc::invalid_argument};
+    if (last - p < 3) return {nat(dst - begin), p, final ? std::errc::invalid_argument : std::errc{}};
+    *dst++ = static_cast<char>(h << 4 | l), p += 3;
+  }
+}
+}
+
+export namespace yw { // packed_column
+
+/// how `packed_column` compresses integers, in blocks of 256 values that decode on their own
+///
+/// - `bitpack`: every value of a block in as many bits as its largest one needs;
+/// - `frame_of_reference`: every value minus the smallest of its block, bit-packed; for values in a
+///   narrow range far from 0;
+/// - `delta`: every value minus the one a vector of lanes earlier (4 for 64-bit types, 8 for
+///   32-bit ones), zigzag-encoded if any is negative, bit-packed; for sorted ids and counters;
+///   decoding is one vector addition per vector, where a difference from the previous value
+///   would need a prefix sum across the lanes;
+/// - `stream_vbyte`: every value in 1 to 4 bytes (1, 2, 4 or 8 for 64-bit types), with the
+///   lengths in 2-bit codes apart from the data (Lemire, Kurz and Rupp), so that a `pshufb` from
+///   a table of the codes decodes 16 bytes at once; for values of widely varying size.
+enum class int_codec { bitpack, frame_of_reference, delta, stream_vbyte };
+
+namespace packed_impl {
+
+inline constexpr nat block = 256;
+
+/// the words and AVX2 operations on them for 4- and 8-byte integers
+template<nat Size> struct lanes;
+template<> struct lanes<8> {
+  using word = unsigned long long;
+  static constexpr nat count = 4;
+  static __m256i set1(word x) noexcept { return intrin::mm256_set1_epi64x((long long)x); }
+  static __m256i add(__m256i a, __m256i b) noexcept { return intrin::mm256_add_epi64(a, b); }
+  static __m256i srl(__m256i a, nat s) noexcept { return intrin::mm256_srlv_epi64(a, set1(s)); }
+  static __m256i sll(__m256i a, nat s) noexcept { return intrin::mm256_sllv_epi64(a, set1(s)); }
+  static __m256i unzigzag(__m256i x) noexcept {
+    const __m256i sign = intrin::mm256_sub_epi64(intrin::mm256_setzero_si256(), intrin::mm256_and_si256(x, set1(1)));
+    return intrin::mm256_xor_si256(intrin::mm256_srli_epi64<1>(x), sign);
+  }
+};
+template<> struct lanes<4> {
+  using word = unsigned;
+  static constexpr nat count = 8;
+  static __m256i set1(word x) noexcept { return intrin::mm256_set1_epi32(int(x)); }
+  static __m256i add(__m256i a, __m256i b) noexcept { return intrin::mm256_add_epi32(a, b); }
+  static __m256i srl(__m256i a, nat s) noexcept { return intrin::mm256_srlv_epi32(a, set1(word(s))); }
+  static __m256i sll(__m256i a, nat s) noexcept { return intrin::mm256_sllv_epi32(a, set1(word(s))); }
+  static __m256i unzigzag(__m256i x) noexcept {
+    const __m256i sign = intrin::mm256_sub_epi32(intrin::mm256_setzero_si256(), intrin::mm256_and_si256(x, set1(1)));
+    return intrin::mm256_xor_si256(intrin::mm256_srli_epi32<1>(x), sign);
+  }
+};
+
+template<typename U> U read(const unsigned char* p) noexcept {
+  U x;
+  std::memcpy(&x, p, sizeof(U));
+  return x;
+}
+template<typename U> void append(std::vector<unsigned char>& out, U x) {
+  const auto p = reinterpret_cast<const unsigned char*>(&x);
+  out.insert(out.end(), p, p + sizeof(U));
+}
+template<typename U> U zigzag(U x) noexcept { return x << 1 ^ U(std::make_signed_t<U>(x) >> (8 * sizeof(U) - 1)); }
+template<typename U> U unzigzag(U x) noexcept { return x >> 1 ^ (U(0) - (x & 1)); }
+
+/// appends 256 words in `b` bits each, `32 * b` bytes: word `L * m + l` at bits `m * b` of lane `l`,
+/// lane `l` being word `l` of every group of `L` (the words of one AVX2 register)
+template<typename U> void pack(std::vector<unsigned char>& out, const U* v, nat b) {
+  constexpr nat w = 8 * sizeof(U), L = lanes<sizeof(U)>::count;
+  U words[block]{};
+  if (b)
+    for (nat m = 0; m < block / L; ++m)
+      for (nat l = 0, k = m * b / w, s = m * b % w; l < L; ++l) {
+        words[k * L + l] |= v[L * m + l] << s;
+        if (s + b > w) words[(k + 1) * L + l] |= v[L * m + l] >> (w - s);
+      }
+  const auto p = reinterpret_cast<const unsigned char*>(words);
+  out.insert(out.end(), p, p + 32 * b);
+}
+
+/// `s = f(s, m, x)` with the register `x` of words `L * m` to `L * m + L - 1` packed by `pack` in `B` bits,
+/// for every `m`; returns `s` (state threaded through by value stays in registers, where state
+/// captured by reference would be stored at every call, since the loads may alias it)
+template<typename U, nat B, typename S, typename F> S unpack(const unsigned char* p, S s, F& f) noexcept {
+  using V = lanes<sizeof(U)>;
+  constexpr nat w = 8 * sizeof(U), L = V::count;
+  const auto load = [p](nat k) { return intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * k)); };
+  if constexpr (B == 0)
+    for (nat m = 0; m < block / L; ++m) s = f(s, m, intrin::mm256_setzero_si256());
+  else {
+    const __m256i mask = V::set1(B == w ? U(~U(0)) : U((U(1) << B % w) - 1));
+    for (nat m = 0; m < block / L; ++m) {
+      const nat k = m * B / w, r = m * B % w;
+      __m256i x = V::srl(load(k), r);
+      if (r + B > w) x = intrin::mm256_or_si256(x, V::sll(load(k + 1), w - r));
+      s = f(s, m, intrin::mm256_and_si256(x, mask));
+    }
+  }
+  return s;
+}
+
+/// `unpack` with the width `b` as a template argument, for shifts that are constants once the loop unrolls
+template<typename U, typename S, typename F> S unpack(const unsigned char* p, nat b, S s, F&& f) noexcept {
+  [&]<nat... B>(std::index_sequence<B...>) { (void)((b == B && (s = unpack<U, B>(p, s, f), true)) || ...); }(std::make_index_sequence<8 * sizeof(U) + 1>{});
+  return s;
+}
+
+/// word `i` of 256 packed by `pack`
+template<typename U> U unpack_one(const unsigned char* p, nat b, nat i) noexcept {
+  constexpr nat w = 8 * sizeof(U), L = lanes<sizeof(U)>::count;
+  if (b == 0) return 0;
+  const nat m = i / L, l = i % L, k = m * b / w, s = m * b % w;
+  U x = read<U>(p + sizeof(U) * (k * L + l)) >> s;
+  if (s + b > w) x |= read<U>(p + sizeof(U) * ((k + 1) * L + l)) << (w - s);
+  return b == w ? x : x & U((U(1) << b) - 1);
+}
+
+/// the bits that the largest of `n` words needs
+template<typename U> nat width(const U* v, nat n) noexcept {
+  U r = 0;
+  for (nat i = 0; i < n; ++i) r |= v[i];
+  return nat(std::bit_width(r));
+}
+
+/// the `pshufb` control and the data length of each stream VByte control byte (4 values of 1 to 4
+/// bytes) or, for 8-byte values, nibble (2 values of 1, 2, 4 or 8 bytes)
+struct vbyte_entry {
+  unsigned char shuffle[16];
+  unsigned char length;
+};
+template<nat Size> constexpr auto make_vbyte_table() noexcept {
+  constexpr nat values = 16 / Size, keys = nat(1) << 2 * values;
+  std::array<vbyte_entry, keys> t{};
+  for (nat key = 0; key < keys; ++key) {
+    nat offset = 0;
+    for (nat v = 0; v < values; ++v) {
+      const nat code = key >> 2 * v & 3, length = Size == 4 ? code + 1 : nat(1) << code;
+      for (nat j = 0; j < Size; ++j) t[key].shuffle[Size * v + j] = (unsigned char)(j < length ? offset + j : 0x80);
+      offset += length;
+    }
+    t[key].length = (unsigned char)offset;
+  }
+  return t;
+}
+template<nat Size> inline constexpr auto vbyte_table = make_vbyte_table<Size>();
+
+template<typename U> nat vbyte_code(U x) noexcept {
+  if constexpr (sizeof(U) == 4) return x < 1u << 8 ? 0 : x < 1u << 16 ? 1 : x < 1u << 24 ? 2 : 3;
+  else return x < 1ull << 8 ? 0 : x < 1ull << 16 ? 1 : x < 1ull << 32 ? 2 : 3;
+}
+template<typename U> nat vbyte_length(nat code) noexcept { return sizeof(U) == 4 ? code + 1 : nat(1) << code; }
+
+/// appends 256 words as 64 control bytes and their data
+template<typename U> void vbyte_encode(std::vector<unsigned char>& out, const U* v) {
+  const nat start = out.size();
+  out.resize(start + block / 4);
+  for (nat i = 0; i < block; ++i) {
+    const nat code = vbyte_code(v[i]);
+    out[start + i / 4] |= (unsigned char)(code << 2 * (i % 4));
+    const auto p = reinterpret_cast<const unsigned char*>(&v[i]);
+    out.insert(out.end(), p, p + vbyte_length<U>(code));
+  }
+}
+
+/// `s = f(s, i, x)` with the register `x` of 16 bytes of words from `i` decoded from `vbyte_encode`,
+/// for every `i` in steps of 16 bytes; returns `s` (the data may be read up to 15 bytes past its end)
+template<typename U, typename S, typename F> S vbyte_decode(const unsigned char* p, S s, F&& f) noexcept {
+  const unsigned char* data = p + block / 4;
+  const auto step = [&](nat i, const vbyte_entry& e) {
+    s = f(s, i, intrin::mm_shuffle_epi8(intrin::mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), intrin::mm_loadu_si128(reinterpret_cast<const __m128i*>(e.shuffle))));
+    data += e.length;
+  };
+  for (nat c = 0; c < block / 4; ++c)
+    if constexpr (sizeof(U) == 4) step(4 * c, vbyte_table<4>[p[c]]);
+    else step(4 * c, vbyte_table<8>[p[c] & 15]), step(4 * c + 2, vbyte_table<8>[p[c] >> 4]);
+  return s;
+}
+
+/// word `i` of 256 from `vbyte_encode`
+template<typename U> U vbyte_one(const unsigned char* p, nat i) noexcept {
+  const unsigned char* data = p + block / 4;
+  nat c = 0;
+  for (; c < i / 4; ++c) data += sizeof(U) == 4 ? vbyte_table<4>[p[c]].length : vbyte_table<8>[p[c] & 15].length + vbyte_table<8>[p[c] >> 4].length;
+  for (nat j = 0; j < i % 4; ++j) data += vbyte_length<U>(p[c] >> 2 * j & 3);
+  U x = 0;
+  std::memcpy(&x, data, vbyte_length<U>(p[c] >> 2 * (i % 4) & 3));
+  return x;
+}
+}
+
+/// a column of integers compressed with an `int_codec`, in blocks of 256 that decode on their own
+///
+/// `bytes()` is the whole column, to be written out and read back by the constructor from bytes;
+/// it starts with the codec, the element size and the count, then the offsets of the blocks.
+/// Decoding runs on AVX2 a register at a time (`pshufb` from a table for `stream_vbyte`, variable
+/// shifts of every lane for the others), and `sum` adds the registers up without storing them.
+template<typename T> requires std::integral<T> && (sizeof(T) == 4 || sizeof(T) == 8)
+class packed_column {
+  using U = typename packed_impl::lanes<sizeof(T)>::word;
+  using V = packed_impl::lanes<sizeof(T)>;
+  static constexpr nat block = packed_impl::block, L = V::count, header = 16;
+  std::vector<unsigned char> _bytes;
+
+  nat _blocks() const noexcept { return (size() + block - 1) / block; }
+  const unsigned char* _block(nat b) const noexcept {
+    return _bytes.data() + header + 8 * (_blocks() + 1) + packed_impl::read<nat>(_bytes.data() + header + 8 * b);
+  }
+
+  /// `s = f(s, i, x, k)` for the registers `x` of `k` values from value `i` of block `b`, or
+  /// `s = g(s, i, value)` for its values without AVX2; returns `s`
+  template<typename S, typename F, typename G> S _fold(nat b, S s, F f, G g) const noexcept {
+    using namespace packed_impl;
+    const unsigned char* p = _block(b);
+    const int_codec c = codec();
+    if (c == int_codec::stream_vbyte) {
+      if (cpu.avx2) return vbyte_decode<U>(p, s, [&](S s, nat i, __m128i x) { return f(s, i, intrin::mm256_zextsi128_si256(x), 16 / sizeof(T)); });
+      for (nat i = 0; i < block; ++i) s = g(s, i, vbyte_one<U>(p, i));
+      return s;
+    }
+    const U ref = c == int_codec::frame_of_reference ? read<U>(p) : 0;
+    const unsigned char* base = p;
+    p += c == int_codec::frame_of_reference ? sizeof(U) : c == int_codec::delta ? 32 : 0;
+    const nat b_ = *p & 0x7f;
+    const bool zig = *p++ & 0x80;
+    if (cpu.avx2) {
+      if (c == int_codec::delta) {
+        struct state {
+          __m256i prev;
+          S s;
+        };
+        const auto add = [&](state t, nat m, __m256i x) {
+          t.prev = V::add(t.prev, zig ? V::unzigzag(x) : x);
+          return state{t.prev, f(t.s, L * m, t.prev, L)};
+        };
+        return unpack<U>(p, b_, state{intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(base)), s}, add).s;
+      }
+      const __m256i r = V::set1(ref);
+      return unpack<U>(p, b_, s, [&](S s, nat m, __m256i x) { return f(s, L * m, V::add(x, r), L); });
+    }
+    U prev[L];
+    if (c == int_codec::delta) std::memcpy(prev, base, sizeof(prev));
+    for (nat i = 0; i < block; ++i) {
+      const U x = unpack_one<U>(p, b_, i);
+      s = g(s, i, c == int_codec::delta ? prev[i % L] += zig ? unzigzag(x) : x : U(x + ref));
+    }
+    return s;
+  }
+
+  /// the 256 values of block `b` into `out`, which has room for them
+  void _decode_block(nat b, T* out) const noexcept {
+    _fold(b, out, [](T* out, nat i, __m256i x, nat k) {
+      if (k == L) intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+      else intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), intrin::mm256_castsi256_si128(x));
+      return out;
+    }, [](T* out, nat i, U x) { return out[i] = T(x), out; });
+  }
+public:
+  packed_column() noexcept = default;
+
+  /// compresses `values` with `c`
+  packed_column(std::span<const T> values, int_codec c) {
+    using namespace packed_impl;
+    const nat n = values.size(), blocks = (n + block - 1) / block;
+    _bytes.resize(header + 8 * (blocks + 1));
+    _bytes[0] = (unsigned char)c, _bytes[1] = (unsigned char)sizeof(T);
+    std::memcpy(_bytes.data() + 8, &n, 8);
+    const nat start = _bytes.size();
+    U v[block], d[block];
+    for (nat b = 0; b < blocks; ++b) {
+      const nat offset = _bytes.size() - start;
+      std::memcpy(_bytes.data() + header + 8 * b, &offset, 8);
+      // a short last block is padded with its last value, which widens nothing
+      const nat k = std::min(block, n - b * block);
+      for (nat i = 0; i < block; ++i) v[i] = U(values[b * block + std::min(i, k - 1)]);
+      if (c == int_codec::bitpack) {
+        const nat w = width(v, block);
+        _bytes.push_back((unsigned char)w), pack(_bytes, v, w);
+      } else if (c == int_codec::frame_of_reference) {
+        const U ref = U(*std::min_element(values.begin() + b * block, values.begin() + b * block + k));
+        for (nat i = 0; i < block; ++i) d[i] = v[i] - ref;
+        const nat w = width(d, block);
+        append(_bytes, ref), _bytes.push_back((unsigned char)w), pack(_bytes, d, w);
+      } else if (c == int_codec::delta) {
+        bool negative = false;
+        for (nat i = 0; i < block; ++i) d[i] = i < L ? 0 : v[i] - v[i - L], negative |= std::make_signed_t<U>(d[i]) < 0;
+        if (negative)
+          for (auto& x : d) x = zigzag(x);
+        const nat w = width(d, block);
+        for (nat l = 0; l < L; ++l) append(_bytes, v[l]);
+        _bytes.push_back((unsigned char)(w | (negative ? 0x80 : 0))), pack(_bytes, d, w);
+      } else vbyte_encode(_bytes, v);
+    }
+    const nat end = _bytes.size() - start;
+    std::memcpy(_bytes.data() + header + 8 * blocks, &end, 8);
+    // room for the 16-byte loads of stream VByte and the 32-byte ones of the last packed word
+    _bytes.resize(_bytes.size() + 32);
+  }
+
+  /// a column from the `bytes()` of one with the same `T`, e.g. read back from a file
+  explicit packed_column(std::span<const std::byte> bytes) : _bytes(reinterpret_cast<const unsigned char*>(bytes.data()), reinterpret_cast<const unsigned char*>(bytes.data()) + bytes.size()) {
+    if (_bytes.size() < header + 8 + 32 || _bytes[0] > (unsigned char)int_codec::stream_vbyte || _bytes[1] != sizeof(T) ||
+        _bytes.size() < header + 8 * (_blocks() + 1) + 32 || packed_impl::read<nat>(_bytes.data() + header + 8 * _blocks()) + header + 8 * (_blocks() + 1) + 32 != _bytes.size())
+      throw std::invalid_argument("yw::packed_column: not a column of this type");
+  }
+
+  int_codec codec() const noexcept { return _bytes.empty() ? int_codec::bitpack : int_codec(_bytes[0]); }
+  nat size() const noexcept { return _bytes.empty() ? 0 : packed_impl::read<nat>(_bytes.data() + 8); }
+  bool empty() const noexcept { return size() == 0; }
+  std::span<const std::byte> bytes() const noexcept { return std::as_bytes(std::span(_bytes)); }
+  /// compressed bits per value, the header and block offsets included
+  fat bits_per_value() const noexcept { return empty() ? 0 : fat(8 * _bytes.size()) / fat(size()); }
+
+  /// value `i`, from its block alone: a shift and a mask for `bitpack` and `frame_of_reference`,
+  /// the lane's differences up to it for `delta`, the lengths before it for `stream_vbyte`
+  T operator[](nat i) const noexcept {
+    using namespace packed_impl;
+    const unsigned char* p = _block(i / block);
+    i %= block;
+    switch (codec()) {
+    case int_codec::bitpack: return T(unpack_one<U>(p + 1, *p, i));
+    case int_codec::frame_of_reference: return T(read<U>(p) + unpack_one<U>(p + sizeof(U) + 1, p[sizeof(U)], i));
+    case int_codec::delta: {
+      const nat b = p[32] & 0x7f;
+      const bool zig = p[32] & 0x80;
+      U x = read<U>(p + sizeof(U) * (i % L));
+      for (nat j = i % L + L; j <= i; j += L) x += zig ? unzigzag(unpack_one<U>(p + 33, b, j)) : unpack_one<U>(p + 33, b, j);
+      return T(x);
+    }
+    default: return T(vbyte_one<U>(p, i));
+    }
+  }
+
+  /// the values of blocks from `first`, as many as fit in `out` (rounded down to whole blocks
+  /// except at the end of the column), into `out`; returns how many
+  nat decode(std::span<T> out, nat first = 0) const noexcept {
+    const nat n = size(), last = std::min(_blocks(), first + out.size() / block + (first * block + out.size() >= n));
+    T* p = out.data();
+    for (nat b = first; b < last; ++b, p += block)
+      if ((b + 1) * block <= n) _decode_block(b, p);
+      else {
+        T t[block];
+        _decode_block(b, t);
+        std::copy_n(t, n - b * block, p);
+      }
+    if (cpu.avx2) intrin::mm256_zeroupper();
+    return std::min(n, last * block) - std::min(n, first * block);
+  }
+  /// all values
+  std::vector<T> decode() const {
+    std::vector<T> r(size());
+    decode(r);
+    return r;
+  }
+
+  /// the sum of all values (modulo 2^32 or 2^64), decoded into registers that are added up without being stored
+  T sum() const noexcept {
+    const nat n = size(), full = n / block;
+    __m256i s{};
+    U r = 0;
+    for (nat b = 0; b < full; ++b)
+      if (cpu.avx2) s = _fold(b, s, [](__m256i s, nat, __m256i x, nat) { return V::add(s, x); }, [](__m256i s, nat, U) { return s; });
+      else r = _fold(b, r, [](U r, nat, __m256i, nat) { return r; }, [](U r, nat, U x) { return r + x; });
+    if (n % block) {
+      T t[block];
+      _decode_block(full, t);
+      for (nat i = 0; i < n % block; ++i) r += U(t[i]);
+    }
+    if (cpu.avx2) {
+      U lanes[L];
+      intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), s);
+      intrin::mm256_zeroupper();
+      for (const U x : lanes) r += x;
+    }
+    return T(r);
+  }
+};
+}
+
+export namespace yw { // reduce
+
+/// how `sum`, `dot`, `norm` and `mean` add up their terms
+///
+/// With `n` terms whose absolute values add up to `a`, the error of the result is at most about
+/// - `fast`: (n / 16) ulp of `a`, from 16 running sums, one per lane of four AVX2 accumulators;
+///   the fastest, and good enough when `n` is small or the terms have one sign;
+/// - `pairwise`: (16 + log2(n / 256)) ulp of `a`, from `fast` over blocks of 256 terms added in a
+///   binary tree; within a few percent of `fast` in cache and as fast from memory;
+/// - `compensated`: 1 ulp of the result plus n² ulp² of `a`, as if added in twice the precision and
+///   rounded once, from the rounding error of every addition (and product) carried in a second
+///   sum (Ogita, Rump and Oishi's Sum2 and Dot2); about half the speed of `fast` in cache and as
+///   fast from memory, where every variant waits for the loads.
+///
+/// The bounds are for the worst case; random rounding errors mostly cancel, leaving about the
+/// square root of the ulp counts. `compensated` relies on the compiler not reassociating
+/// floating-point arithmetic, which `/fp:fast` would do.
+enum class summation { fast, pairwise, compensated };
+
+/// the smallest or largest value of an array and the first index it is at, or `npos` if there is none
+struct extremum {
+  fat value;
+  nat index;
+};
+
+namespace reduce_impl {
+
+inline constexpr nat block = 256;
+
+inline fat hsum(__m256d v) noexcept {
+  const __m128d h = intrin::mm_add_pd(intrin::mm256_castpd256_pd128(v), intrin::mm256_extractf128_pd<1>(v));
+  return intrin::mm_cvtsd_f64(intrin::mm_add_sd(h, intrin::mm_unpackhi_pd(h, h)));
+}
+
+/// the sum of `x[i]`, or of `x[i] * y[i]` if `Dot`, in 16 running sums
+template<bool Dot> fat fast(const fat* x, const fat* y, nat n) noexcept {
+  nat i = 0;
+  fat r = 0;
+  if (cpu.avx2 && cpu.fma) {
+    const auto term = [&](nat j, __m256d s) {
+      if constexpr (Dot) return intrin::mm256_fmadd_pd(intrin::mm256_loadu_pd(x + j), intrin::mm256_loadu_pd(y + j), s);
+      else return intrin::mm256_add_pd(s, intrin::mm256_loadu_pd(x + j));
+    };
+    __m256d s0 = intrin::mm256_setzero_pd(), s1 = s0, s2 = s0, s3 = s0;
+    for (; i + 16 <= n; i += 16) s0 = term(i, s0), s1 = term(i + 4, s1), s2 = term(i + 8, s2), s3 = term(i + 12, s3);
+    for (; i + 4 <= n; i += 4) s0 = term(i, s0);
+    r = hsum(intrin::mm256_add_pd(intrin::mm256_add_pd(s0, s1), intrin::mm256_add_pd(s2, s3)));
+    intrin::mm256_zeroupper();
+  }
+  fat s[4]{};
+  for (; i + 4 <= n; i += 4)
+    for (nat j = 0; j < 4; ++j) s[j] += Dot ? x[i + j] * y[i + j] : x[i + j];
+  for (; i < n; ++i) s[0] += Dot ? x[i] * y[i] : x[i];
+  return r + ((s[0] + s[1]) + (s[2] + s[3]));
+}
+
+/// `fast` over blocks, added in a binary tree: `partial[k]` holds 2^k blocks while bit `k` of the count is set
+template<bool Dot> fat pairwise(const fat* x, const fat* y, nat n) noexcept {
+  fat partial[64];
+  nat blocks = 0;
+  for (nat i = 0; i < n; i += block, ++blocks) {
+    fat s = fast<Dot>(x + i, Dot ? y + i : nullptr, std::min(block, n - i));
+    nat k = 0;
+    for (nat b = blocks; b & 1; b >>= 1, ++k) s = partial[k] + s;
+    partial[k] = s;
+  }
+  fat r = 0;
+  for (nat k = 0; blocks; blocks >>= 1, ++k)
+    if (blocks & 1) r += partial[k];
+  return r;
+}
+
+/// adds `x` to `s` and what the rounding lost to `c` (Knuth's TwoSum, exact without a branch)
+inline void two_sum(__m256d& s, __m256d& c, __m256d x) noexcept {
+  const __m256d t = intrin::mm256_add_pd(s, x), z = intrin::mm256_sub_pd(t, s);
+  c = intrin::mm256_add_pd(c, intrin::mm256_add_pd(intrin::mm256_sub_pd(s, intrin::mm256_sub_pd(t, z)), intrin::mm256_sub_pd(x, z)));
+  s = t;
+}
+inline void two_sum(fat& s, fat& c, fat x) noexcept {
+  const fat t = s + x, z = t - s;
+  c += (s - (t - z)) + (x - z), s = t;
+}
+
+/// Sum2, or Dot2 if `Dot`: the products' rounding errors come exactly from an FMA
+template<bool Dot> fat compensated(const fat* x, const fat* y, nat n) noexcept {
+  nat i = 0;
+  fat s = 0, c = 0;
+  if (cpu.avx2 && cpu.fma) {
+    const auto term = [&](nat j, __m256d& s, __m256d& c) {
+      if constexpr (Dot) {
+        const __m256d a = intrin::mm256_loadu_pd(x + j), b = intrin::mm256_loadu_pd(y + j), p = intrin::mm256_mul_pd(a, b);
+        c = intrin::mm256_add_pd(c, intrin::mm256_fmsub_pd(a, b, p));
+        two_sum(s, c, p);
+      } else two_sum(s, c, intrin::mm256_loadu_pd(x + j));
+    };
+    __m256d s0 = intrin::mm256_setzero_pd(), s1 = s0, c0 = s0, c1 = s0;
+    for (; i + 8 <= n; i += 8) term(i, s0, c0), term(i + 4, s1, c1);
+    for (; i + 4 <= n; i += 4) term(i, s0, c0);
+    alignas(32) fat ss[8], cs[8];
+    intrin::mm256_store_pd(ss, s0), intrin::mm256_store_pd(ss + 4, s1), intrin::mm256_store_pd(cs, c0), intrin::mm256_store_pd(cs + 4, c1);
+    intrin::mm256_zeroupper();
+    for (nat j = 0; j < 8; ++j) two_sum(s, c, ss[j]), c += cs[j];
+  }
+  for (; i < n; ++i)
+    if constexpr (Dot) {
+      const fat p = x[i] * y[i];
+      c += std::fma(x[i], y[i], -p);
+      two_sum(s, c, p);
+    } else two_sum(s, c, x[i]);
+  return s + c;
+}
+
+template<bool Dot> fat reduce(const fat* x, const fat* y, nat n, summation s) noexcept {
+  switch (s) {
+  case summation::fast: return fast<Dot>(x, y, n);
+  case summation::compensated: return compensated<Dot>(x, y, n);
+  default: return pairwise<Dot>(x, y, n);
+  }
+}
+
+/// the first smallest (or largest, if `Max`) value, skipping NaNs; each lane keeps its best value and
+/// its index, counted in doubles, which are exact up to 2^53
+template<bool Max> extremum arg(const fat* x, nat n) noexcept {
+  constexpr fat none = Max ? -std::numeric_limits<fat>::infinity() : std::numeric_limits<fat>::infinity();
+  extremum r{none, npos};
+  const auto better = [](fat a, fat b) { return Max ? a > b : a < b; };
+  nat i = 0;
+  if (cpu.avx2 && n >= 4) {
+    // _CMP_GT_OQ and _CMP_LT_OQ: false for NaNs
+    constexpr int better_than = Max ? 0x1e : 0x11;
+    __m256d best = intrin::mm256_set1_pd(none), at = intrin::mm256_set1_pd(-1), index = intrin::mm256_set_pd(3, 2, 1, 0);
+    const __m256d four = intrin::mm256_set1_pd(4);
+    for (; i + 4 <= n; i += 4) {
+      const __m256d v = intrin::mm256_loadu_pd(x + i), m = intrin::mm256_cmp_pd<better_than>(v, best);
+      best = intrin::mm256_blendv_pd(best, v, m), at = intrin::mm256_blendv_pd(at, index, m);
+      index = intrin::mm256_add_pd(index, four);
+    }
+    alignas(32) fat bs[4], as[4];
+    intrin::mm256_store_pd(bs, best), intrin::mm256_store_pd(as, at);
+    intrin::mm256_zeroupper();
+    for (nat j = 0; j < 4; ++j)
+      if (as[j] >= 0 && (better(bs[j], r.value) || (bs[j] == r.value && nat(as[j]) < r.index))) r = {bs[j], nat(as[j])};
+  }
+  for (; i < n; ++i)
+    if (better(x[i], r.value)) r = {x[i], i};
+  // nothing beats the starting infinity, though it may be there itself
+  if (r.index == npos)
+    for (i = 0; i < n; ++i)
+      if (x[i] == none) return {none, i};
+  return r;
+}
+
+template<bool Max> fat bound(const fat* x, nat n) noexcept {
+  fat r = Max ? -std::numeric_limits<fat>::infinity() : std::numeric_limits<fat>::infinity();
+  nat i = 0;
+  if (cpu.avx2) {
+    // `min_pd` and `max_pd` return their second operand if either is NaN, so that NaNs in `x` are skipped
+    const auto take = [](__m256d v, __m256d b) { return Max ? intrin::mm256_max_pd(v, b) : intrin::mm256_min_pd(v, b); };
+    __m256d b0 = intrin::mm256_set1_pd(r), b1 = b0, b2 = b0, b3 = b0;
+    for (; i + 16 <= n; i += 16) {
+      b0 = take(intrin::mm256_loadu_pd(x + i), b0), b1 = take(intrin::mm256_loadu_pd(x + i + 4), b1);
+      b2 = take(intrin::mm256_loadu_pd(x + i + 8), b2), b3 = take(intrin::mm256_loadu_pd(x + i + 12), b3);
+    }
+    for (; i + 4 <= n; i += 4) b0 = take(intrin::mm256_loadu_pd(x + i), b0);
+    alignas(32) fat bs[4];
+    intrin::mm256_store_pd(bs, take(take(b0, b1), take(b2, b3)));
+    intrin::mm256_zeroupper();
+    for (const fat b : bs) r = Max ? std::max(r, b) : std::min(r, b);
+  }
+  for (; i < n; ++i)
+    if (Max ? x[i] > r : x[i] < r) r = x[i];
+  return r;
+}
+}
+
+/// the sum of `x`; see `summation` for the accuracy and the speed of each variant
+inline fat sum(std::span<const fat> x, summation s = summation::pairwise) noexcept { return reduce_impl::reduce<false>(x.data(), nullptr, x.size(), s); }
+
+/// the sum of `x[i] * y[i]` over the shorter of the two
+inline fat dot(std::span<const fat> x, std::span<const fat> y, summation s = summation::pairwise) noexcept {
+  return reduce_impl::reduce<true>(x.data(), y.data(), std::min(x.size(), y.size()), s);
+}
+
+/// the Euclidean norm of `x`, without scaling: the squares must not overflow or underflow
+inline fat norm(std::span<const fat> x, summation s = summation::pairwise) noexcept { return std::sqrt(dot(x, x, s)); }
+
+/// the mean of `x`, NaN if it is empty
+inline fat mean(std::span<const fat> x, summation s = summation::pairwise) noexcept { return sum(x, s) / fat(x.size()); }
+
+/// the smallest and the largest value of `x`, skipping NaNs: +inf and -inf if there is none
+inline fat minimum(std::span<const fat> x) noexcept { return reduce_impl::bound<false>(x.data(), x.size()); }
+inline fat maximum(std::span<const fat> x) noexcept { return reduce_impl::bound<true>(x.data(), x.size()); }
+
+/// the smallest and the largest value of `x` with the first index it is at, skipping NaNs
+inline extremum argmin(std::span<const fat> x) noexcept { return reduce_impl::arg<false>(x.data(), x.size()); }
+inline extremum argmax(std::span<const fat> x) noexcept { return reduce_impl::arg<true>(x.data(), x.size()); }
+}
+
+export namespace yw { // scheduler
+
+class scheduler;
+class task_group;
+
+namespace scheduler_impl {
+
+/// unit of work; `run` calls it and frees it if it was allocated
+struct job {
+  void (*run)(job*) = nullptr;
+  task_group* group = nullptr;
+};
+
+template<typename F> struct heap_job : job {
+  F f;
+  template<typename G> explicit heap_job(G&& g) : job{invoke}, f(std::forward<G>(g)) {}
+  static void invoke(job* j) {
+    std::unique_ptr<heap_job> p(static_cast<heap_job*>(j));
+    p->f();
+  }
+};
+
+/// Chase–Lev work-stealing deque; the owner pushes and pops at the bottom, thieves steal from the top
+///
+/// Memory orders follow Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models".
+/// The ring does not grow: `push` fails when it is full and the caller runs the job itself,
+/// which fork/join code tolerates and which saves reclaiming retired rings.
+class deque {
+  static constexpr std::ptrdiff_t capacity = 4096;
+  alignas(64) std::atomic<std::ptrdiff_t> _top{0};
+  alignas(64) std::atomic<std::ptrdiff_t> _bottom{0};
+  std::atomic<job*> _slots[capacity]{};
+public:
+  /// owner only; returns `false` if the deque is full
+  bool push(job* j) noexcept {
+    const auto b = _bottom.load(std::memory_order_relaxed), t = _top.load(std::memory_order_acquire);
+    if (b - t >= capacity) return false;
+    _slots[b & (capacity - 1)].store(j, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// owner only; returns the most recently pushed job or `nullptr`
+  job* pop() noexcept {
+    const auto b = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = _top.load(std::memory_order_relaxed);
+    if (t > b) return _bottom.store(b + 1, std::memory_order_relaxed), nullptr;
+    auto j = _slots[b & (capacity - 1)].load(std::memory_order_relaxed);
+    if (t == b) {
+      if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) j = nullptr;
+      _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return j;
+  }
+
+  /// any thread; returns the oldest job, or `nullptr` if the deque is empty or another thief took it
+  job* steal() noexcept {
+    auto t = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto b = _bottom.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+    const auto j = _slots[t & (capacity - 1)].load(std::memory_order_relaxed);
+    return _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) ? j : nullptr;
+  }
+};
+
+/// scheduler and worker index of the calling thread
+struct context {
+  const scheduler* owner = nullptr;
+  nat index = 0;
+};
+inline thread_local context current;
+}
+
+/// jobs spawned with `scheduler::spawn` and waited for with `scheduler::sync`
+///
+/// A group must be synced before it is destroyed and can be reused afterwards. The first
+/// exception thrown by its jobs is rethrown by `sync`.
+class task_group {
+  friend class scheduler;
+  std::atomic<nat> _pending{0};
+  std::atomic<bool> _failed{false};
+  std::exception_ptr _error;
+
+  void _add() noexcept { _pending.fetch_add(1, std::memory_order_relaxed); }
+  /// the decrement and its wakeup are the last touches, so a waiter that sees no jobs
+  /// pending may destroy the group; the wakeup goes by address and reads nothing of it
+  void _finish() noexcept {
+    if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) _pending.notify_all();
+  }
+  void _fail() noexcept {
+    if (!_failed.exchange(true, std::memory_order_relaxed)) _error = std::current_exception();
+  }
+  void _wait() noexcept {
+    for (nat n; (n = _pending.load(std::memory_order_acquire));) _pending.wait(n, std::memory_order_acquire);
+  }
+  void _rethrow() {
+    if (!_failed.load(std::memory_order_relaxed)) return;
+    _failed.store(false, std::memory_order_relaxed);
+    std::rethrow_exception(std::exchange(_error, nullptr));
+  }
+public:
+  task_group() = default;
+  task_group(const task_group&) = delete;
+  task_group& operator=(const task_group&) = delete;
+
+  /// whether every job spawned so far has finished
+  bool done() const noexcept { return _pending.load(std::memory_order_acquire) == 0; }
+};
+
+/// work-stealing thread pool for fork/join parallelism
+///
+/// - each worker owns a Chase–Lev deque; jobs it spawns are pushed to the bottom and popped LIFO
+/// - idle workers steal FIFO from the top of random victims, then sleep until work is pushed
+/// - threads that are not workers submit through a shared queue and block in `sync`
+/// - a worker waiting in `sync` runs other jobs until the group is done
+class scheduler {
+  struct alignas(64) worker {
+    scheduler_impl::deque jobs;
+    std::thread thread;
+    unsigned seed = 0;
+  };
+
+  template<typename F> struct range_job : scheduler_impl::job {
+    scheduler* s;
+    nat first, last, grain;
+    F* f;
+    range_job(scheduler* s, nat first, nat last, nat grain, F& f) noexcept : job{invoke}, s(s), first(first), last(last), grain(grain), f(&f) {}
+    static void invoke(job* j) {
+      const auto r = static_cast<range_job*>(j);
+      r->s->_range(r->first, r->last, r->grain, *r->f);
+    }
+  };
+
+  nat _size;
+  std::unique_ptr<worker[]> _workers;
+  std::mutex _mutex;
+  std::deque<scheduler_impl::job*> _injected;
+  std::atomic<nat> _injected_count{0};
+  alignas(64) std::atomic<unsigned> _epoch{0};
+  std::atomic<nat> _sleeping{0};
+  std::atomic<bool> _stop{false};
+
+  worker* _self() noexcept {
+    const auto& c = scheduler_impl::current;
+    return c.owner == this ? &_workers[c.index] : nullptr;
+  }
+
+  /// runs `j`; jobs without a group terminate the program if they throw
+  static void _execute(scheduler_impl::job* j) noexcept {
+    const auto g = j->group;
+    if (!g) return j->run(j);
+    try {
+      j->run(j);
+    } catch (...) { g->_fail(); }
+    g->_finish();
+  }
+
+  /// wakes one sleeping worker; the fence pairs with the one in `_work` so that no push is missed
+  void _wake() noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!_sleeping.load(std::memory_order_relaxed)) return;
+    _epoch.fetch_add(1, std::memory_order_relaxed);
+    _epoch.notify_one();
+  }
+
+  void _submit(task_group* g, scheduler_impl::job* j) {
+    j->group = g;
+    if (g) g->_add();
+    if (_stop.load(std::memory_order_relaxed)) return _execute(j);
+    if (const auto w = _self()) {
+      if (!w->jobs.push(j)) return _execute(j);
+    } else {
+      std::lock_guard lock(_mutex);
+      _injected.push_back(j);
+      _injected_count.fetch_add(1, std::memory_order_release);
+    }
+    _wake();
+  }
+
+  scheduler_impl::job* _find(worker& w) noexcept {
+    if (const auto j = w.jobs.pop()) return j;
+    if (_injected_count.load(std::memory_order_acquire)) {
+      std::lock_guard lock(_mutex);
+      if (!_injected.empty()) {
+        const auto j = _injected.front();
+        _injected.pop_front();
+        _injected_count.fetch_sub(1, std::memory_order_relaxed);
+        return j;
+      }
+    }
+    w.seed = w.seed * 1664525 + 1013904223;
+    for (nat k = 0, v = (w.seed >> 8) % _size; k < _size; ++k, v = v + 1 == _size ? 0 : v + 1) {
+      if (&_workers[v] == &w) continue;
+      if (const auto j = _workers[v].jobs.steal()) {
+        if (_sleeping.load(std::memory_order_relaxed)) _wake();
+        return j;
+      }
+    }
+    return nullptr;
+  }
+
+  void _work(nat i) {
+    scheduler_impl::current = {this, i};
+    auto& w = _workers[i];
+    for (int idle = 0;;) {
+      if (const auto j = _find(w)) {
+        _execute(j), idle = 0;
+        continue;
+      }
+      if (_stop.load(std::memory_order_acquire)) return;
+      if (++idle < 64) intrin::mm_pause();
+      else if (idle < 80) std::this_thread::yield();
+      else {
+        _sleeping.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto e = _epoch.load(std::memory_order_relaxed);
+        const auto j = _find(w);
+        if (!j && !_stop.load(std::memory_order_acquire)) _epoch.wait(e, std::memory_order_relaxed);
+        _sleeping.fetch_sub(1, std::memory_order_relaxed);
+        if (j) _execute(j);
+        idle = 0;
+      }
+    }
+  }
+
+  /// waits for `g` without rethrowing, running other jobs meanwhile if called by a worker
+  void _join(task_group& g) noexcept {
+    const auto w = _self();
+    if (!w) return g._wait();
+    for (int idle = 0; !g.done();)
+      if (const auto j = _find(*w)) _execute(j), idle = 0;
+      else if (++idle < 64) intrin::mm_pause();
+      else std::this_thread::yield();
+  }
+
+  /// splits `[first, last)` in halves down to `grain`, spawning the right halves
+  template<typename F> void _range(nat first, nat last, nat grain, F& f) {
+    if (last - first <= grain) {
+      if constexpr (std::invocable<F&, nat, nat>) f(first, last);
+      else
+        for (; first != last; ++first) f(first);
+      return;
+    }
+    const nat mid = first + (last - first) / 2;
+    task_group g;
+    range_job<F> right(this, mid, last, grain, f);
+    _submit(&g, &right);
+    try {
+      _range(first, mid, grain, f);
+    } catch (...) {
+      _join(g);
+      throw;
+    }
+    sync(g);
+  }
+public:
+  /// starts `threads` workers (one per hardware thread if 0), each pinned to one logical processor if `pin`
+  explicit scheduler(nat threads = 0, bool pin = false)
+    : _size(threads ? threads : std::max(1u, std::thread::hardware_concurrency())), _workers(new worker[_size]) {
+    const nat cpus = std::max(1u, std::thread::hardware_concurrency());
+    for (nat i = 0; i < _size; ++i) {
+      _workers[i].seed = static_cast<unsigned>(i) * 0x9e3779b9u + 1;
+      _workers[i].thread = std::thread([this, i] { _work(i); });
+      if (pin) intrin::set_thread_affinity(_workers[i].thread.native_handle(), 1ull << (i % cpus % 64));
+    }
+  }
+  ~scheduler() { shutdown(); }
+  scheduler(const scheduler&) = delete;
+  scheduler& operator=(const scheduler&) = delete;
+
+  /// number of workers
+  nat size() const noexcept { return _size; }
+
+  /// index of the calling thread among the workers, or `npos` if it is not one
+  nat worker_index() const noexcept {
+    const auto& c = scheduler_impl::current;
+    return c.owner == this ? c.index : npos;
+  }
+
+  /// runs `f()` asynchronously as part of `g`
+  template<typename F> void spawn(task_group& g, F&& f) { _submit(&g, new scheduler_impl::heap_job<std::decay_t<F>>(std::forward<F>(f))); }
+
+  /// runs `f()` asynchronously with nothing to wait for; the program terminates if it throws
+  template<typename F> void post(F&& f) { _submit(nullptr, new scheduler_impl::heap_job<std::decay_t<F>>(std::forward<F>(f))); }
+
+  /// waits until the jobs of `g` are done and rethrows the first exception one of them threw
+  void sync(task_group& g) {
+    _join(g);
+    g._rethrow();
+  }
+
+  /// calls `f(i)` for each `i` in `[first, last)`, or `f(begin, end)` for subranges if it takes two indices
+  ///
+  /// The range is halved recursively until pieces are at most `grain` long; a `grain` of 0
+  /// aims at eight pieces per worker. Halves are stolen by idle workers, so the pieces run
+  /// on as many workers as are free.
+  template<typename F> void parallel_for(nat first, nat last, nat grain, F&& f) {
+    if (first >= last) return;
+    if (!grain) grain = std::max<nat>(1, (last - first) / (8 * _size));
+    if (_self() || _stop.load(std::memory_order_relaxed)) return _range(first, last, grain, f);
+    task_group g;
+    range_job<std::remove_reference_t<F>> root(this, first, last, grain, f);
+    _submit(&g, &root);
+    sync(g);
+  }
+  template<typename F> void parallel_for(nat first, nat last, F&& f) { parallel_for(first, last, 0, std::forward<F>(f)); }
+
+  /// stops and joins the workers; jobs submitted afterwards run on the submitting thread
+  ///
+  /// Every group must have been synced, and this must not be called by a worker.
+  void shutdown() noexcept {
+    if (_stop.exchange(true)) return;
+    _epoch.fetch_add(1);
+    _epoch.notify_all();
+    for (nat i = 0; i < _size; ++i) _workers[i].thread.join();
+  }
+
+  /// scheduler with one worker per hardware thread, started on first use
+  ///
+  /// It is never destroyed, so static destructors may still use it. Its workers are shut down
+  /// by an `atexit` handler, which lets their print buffers flush; jobs spawned after that run
+  /// on the spawning thread.
+  static scheduler& global() {
+    static scheduler* const s = [] {
+      const auto p = new scheduler;
+      std::atexit([] { global().shutdown(); });
+      return p;
+    }();
+    return *s;
+  }
+};
+}
+
+export namespace yw { // par
+
+namespace par {
+
+/// how `par` algorithms split their input and combine partial results
+struct options {
+  /// scheduler to run on; `scheduler::global()` if null
+  scheduler* sched = nullptr;
+  /// elements per chunk; 0 picks about 64 KiB of input per chunk
+  nat grain = 0;
+  /// combine per-chunk partial results in chunk order, so that floating-point reductions
+  /// give the same result on every run and on any number of workers
+  bool deterministic = false;
+};
+}
+
+namespace par_impl {
+
+/// input bytes per chunk, so that a chunk stays in L2 between the passes of `inclusive_scan` and `copy_if`
+inline constexpr nat chunk_bytes = 64 * 1024;
+
+template<typename R> auto first(R& r) {
+  if constexpr (std::ranges::contiguous_range<R>) return std::ranges::data(r);
+  else return std::ranges::begin(r);
+}
+
+struct chunks {
+  scheduler& s;
+  nat size, count;
+};
+
+template<typename T> chunks split(nat n, const par::options& o) {
+  const nat size = o.grain ? o.grain : std::max<nat>(1, chunk_bytes / sizeof(T));
+  return {o.sched ? *o.sched : scheduler::global(), size, (n + size - 1) / size};
+}
+
+/// calls `f(i, begin, end)` for each chunk, in parallel unless there is only one
+template<typename F> void each(const chunks& c, nat n, F&& f) {
+  if (c.count <= 1) {
+    if (c.count) f(nat(0), nat(0), std::min(n, c.size));
+    return;
+  }
+  c.s.parallel_for(0, c.count, 1, [&](nat i) { f(i, i * c.size, std::min(n, (i + 1) * c.size)); });
+}
+
+/// folds `f(p[0]), ..., f(p[n - 1])` into `init`
+///
+/// With more than one lane, lane `k` folds the elements at `k + lanes * j`, which lets the
+/// compiler keep the lanes in vector registers but requires a commutative `op`.
+template<nat lanes, typename It, typename T, typename Op, typename F> T fold(It p, nat n, T init, Op& op, F& f) {
+  nat i = 0;
+  if constexpr (lanes > 1)
+    if (n >= 2 * lanes) [&]<nat... k>(std::index_sequence<k...>) {
+        T acc[]{T(f(p[k]))...};
+        for (i = lanes; i + lanes <= n; i += lanes) ((acc[k] = op(std::move(acc[k]), f(p[i + k]))), ...);
+        for (nat w = lanes / 2; w; w /= 2)
+          for (nat j = 0; j < w; ++j) acc[j] = op(std::move(acc[j]), std::move(acc[j + w]));
+        init = op(std::move(init), std::move(acc[0]));
+      }(std::make_index_sequence<lanes>{});
+  for (; i < n; ++i) init = op(std::move(init), f(p[i]));
+  return init;
+}
+
+template<typename It, typename T, typename Op, typename F> T reduce(It p, nat n, T init, Op& op, F& f, const par::options& o) {
+  const auto c = split<std::iter_value_t<It>>(n, o);
+  if (c.count <= 1) return fold<8>(p, n, std::move(init), op, f);
+  const auto chunk = [&](nat b, nat e) { return fold<8>(p + b + 1, e - b - 1, T(f(p[b])), op, f); };
+  if (o.deterministic) {
+    std::vector<std::optional<T>> partials(c.count);
+    each(c, n, [&](nat i, nat b, nat e) { partials[i].emplace(chunk(b, e)); });
+    for (auto& v : partials) init = op(std::move(init), std::move(*v));
+    return init;
+  }
+  struct alignas(64) slot {
+    std::optional<T> value;
+  };
+  std::vector<slot> slots(c.s.size() + 1);
+  each(c, n, [&](nat, nat b, nat e) {
+    auto v = chunk(b, e);
+    auto& a = slots[std::min(c.s.worker_index(), c.s.size())].value;
+    if (a) *a = op(std::move(*a), std::move(v));
+    else a.emplace(std::move(v));
+  });
+  for (auto& x : slots)
+    if (x.value) init = op(std::move(init), std::move(*x.value));
+  return init;
+}
+
+/// output iterator that move-constructs what is assigned through it, for merging into raw memory
+template<typename T> struct constructing {
+  using difference_type = std::ptrdiff_t;
+  T* p;
+  constructing& operator*() noexcept { return *this; }
+  constructing& operator++() noexcept { return ++p, *this; }
+  constructing operator++(int) noexcept { return {p++}; }
+  constructing operator+(nat i) const noexcept { return {p + i}; }
+  constructing& operator=(T&& x) {
+    std::construct_at(p, std::move(x));
+    return *this;
+  }
+};
+
+/// storage for `n` elements of `T`, constructed by the caller and destroyed with `n` of them
+/// once `constructed` is set
+template<typename T> struct raw_buffer {
+  T* data;
+  nat n;
+  bool constructed = false;
+  explicit raw_buffer(nat n) : data(std::allocator<T>().allocate(n)), n(n) {}
+  raw_buffer(const raw_buffer&) = delete;
+  ~raw_buffer() {
+    if (constructed) std::destroy_n(data, n);
+    std::allocator<T>().deallocate(data, n);
+  }
+};
+
+/// index in `a` at which the first `d` elements of the stable merge of `a` and `b` split
+template<typename It, typename C> nat co_rank(nat d, It a, nat m, It b, nat n, C& comp) {
+  nat lo = d > n ? d - n : 0, hi = std::min(d, m);
+  while (lo < hi) {
+    const nat i = lo + (hi - lo) / 2;
+    if (!comp(b[d - i - 1], a[i])) lo = i + 1;
+    else hi = i;
+  }
+  return lo;
+}
+}
+
+namespace par {
+
+/// calls `f(x)` for each element `x` of `r`
+template<std::ranges::random_access_range R, typename F> requires std::ranges::sized_range<R>
+void for_each(R&& r, F f, const options& o = {}) {
+  const auto p = par_impl::first(r);
+  const nat n = std::ranges::size(r);
+  par_impl::each(par_impl::split<std::ranges::range_value_t<R>>(n, o), n, [&](nat, nat b, nat e) {
+    for (; b != e; ++b) f(p[b]);
+  });
+}
+
+/// writes `f(in[i])` to `out[i]` for each `i` below the smaller size; `out` may be `in`
+template<std::ranges::random_access_range R, std::ranges::random_access_range O, typename F>
+  requires std::ranges::sized_range<R> && std::ranges::sized_range<O>
+void transform(R&& in, O&& out, F f, const options& o = {}) {
+  const auto p = par_impl::first(in);
+  const auto q = par_impl::first(out);
+  const nat n = std::min<nat>(std::ranges::size(in), std::ranges::size(out));
+  par_impl::each(par_impl::split<std::ranges::range_value_t<R>>(n, o), n, [&](nat, nat b, nat e) {
+    for (; b != e; ++b) q[b] = f(p[b]);
+  });
+}
+
+/// folds `init` and the elements of `r` with `op`, which must be associative and commutative
+///
+/// Each chunk is folded in eight interleaved lanes. Without `options::deterministic` each
+/// worker combines the chunks it ran, so floating-point results may vary in the last bits.
+template<std::ranges::random_access_range R, typename T, typename Op = std::plus<>> requires std::ranges::sized_range<R>
+T reduce(R&& r, T init, Op op = {}, const options& o = {}) {
+  std::identity f;
+  return par_impl::reduce(par_impl::first(r), std::ranges::size(r), std::move(init), op, f, o);
+}
+
+/// folds `init` and `f(x)` for each element `x` of `r` with `op`, like `reduce`
+template<std::ranges::random_access_range R, typename T, typename Op, typename F> requires std::ranges::sized_range<R>
+T transform_reduce(R&& r, T init, Op op, F f, const options& o = {}) {
+  return par_impl::reduce(par_impl::first(r), std::ranges::size(r), std::move(init), op, f, o);
+}
+
+/// number of elements `x` of `r` for which `pred(x)` is true
+template<std::ranges::random_access_range R, typename P> requires std::ranges::sized_range<R>
+nat count_if(R&& r, P pred, const options& o = {}) {
+  std::plus<nat> op;
+  auto f = [&](auto&& x) -> nat { return pred(x) ? 1 : 0; };
+  return par_impl::reduce(par_impl::first(r), std::ranges::size(r), nat(0), op, f, o);
+}
+
+/// writes `in[0] op ... op in[i]` to `out[i]` for each `i` below the smaller size; `out` may be `in`
+///
+/// `op` must be associative. Chunk sums are taken in parallel, scanned in order and then
+/// added while each chunk is scanned in parallel, so results do not depend on the workers.
+template<std::ranges::random_access_range R, std::ranges::random_access_range O, typename Op = std::plus<>>
+  requires std::ranges::sized_range<R> && std::ranges::sized_range<O>
+void inclusive_scan(R&& in, O&& out, Op op = {}, const options& o = {}) {
+  using T = std::ranges::range_value_t<R>;
+  const auto p = par_impl::first(in);
+  const auto q = par_impl::first(out);
+  const nat n = std::min<nat>(std::ranges::size(in), std::ranges::size(out));
+  if (!n) return;
+  const auto c = par_impl::split<T>(n, o);
+  const auto scan = [&](nat b, nat e, T acc) {
+    for (; b != e; ++b) q[b] = acc = op(std::move(acc), p[b]);
+  };
+  if (c.count <= 1) return scan(1, n, q[0] = T(p[0]));
+  std::identity id;
+  std::vector<std::optional<T>> sums(c.count);
+  par_impl::each({c.s, c.size, c.count - 1}, n, [&](nat i, nat b, nat e) { sums[i].emplace(par_impl::fold<1>(p + b + 1, e - b - 1, T(p[b]), op, id)); });
+  for (nat i = 1; i + 1 < c.count; ++i) *sums[i] = op(*sums[i - 1], std::move(*sums[i]));
+  par_impl::each(c, n, [&](nat i, nat b, nat e) {
+    if (i) scan(b, e, *sums[i - 1]);
+    else scan(1, e, q[0] = T(p[0]));
+  });
+}
+
+/// sorts `r` by `comp` (not stably)
+///
+/// Runs of about `size / workers` elements are sorted with `std::sort` in parallel and then
+/// merged pairwise through a buffer; each merge is cut into chunks at merge-path splits so
+/// that every round uses all workers.
+template<std::ranges::random_access_range R, typename C = std::ranges::less>
+  requires std::ranges::sized_range<R> && std::sortable<std::ranges::iterator_t<R>, C>
+void sort(R&& r, C comp = {}, const options& o = {}) {
+  using T = std::ranges::range_value_t<R>;
+  const auto p = par_impl::first(r);
+  const nat n = std::ranges::size(r);
+  const auto c = par_impl::split<T>(n, o);
+  if (c.count <= 1) return std::sort(p, p + n, comp);
+  const nat run = (n / c.s.size() + c.size) / c.size * c.size;
+  par_impl::chunks runs{c.s, run, (n + run - 1) / run};
+  par_impl::each(runs, n, [&](nat, nat b, nat e) { std::sort(p + b, p + e, comp); });
+  if (runs.count == 1) return;
+  // raw until the first round merges into it, which move-constructs every element
+  par_impl::raw_buffer<T> buffer(n);
+  bool in_buffer = false;
+  for (nat width = run; width < n; width *= 2, in_buffer = !in_buffer) {
+    // the splits are all found before any chunk moves from `src`, which would change what they compare
+    std::vector<std::pair<nat, nat>> cuts(c.count);
+    const auto merge = [&](auto src, auto dst) {
+      par_impl::each(c, n, [&](nat k, nat b, nat e) {
+        const nat s = b / (2 * width) * (2 * width), m = std::min(n, s + width), t = std::min(n, s + 2 * width);
+        cuts[k] = {par_impl::co_rank(b - s, src + s, m - s, src + m, t - m, comp), par_impl::co_rank(e - s, src + s, m - s, src + m, t - m, comp)};
+      });
+      par_impl::each(c, n, [&](nat k, nat b, nat e) {
+        const nat s = b / (2 * width) * (2 * width), m = std::min(n, s + width);
+        const auto [i, j] = cuts[k];
+        std::merge(std::make_move_iterator(src + s + i), std::make_move_iterator(src + s + j),
+          std::make_move_iterator(src + m + (b - s - i)), std::make_move_iterator(src + m + (e - s - j)), dst + b, comp);
+      });
+    };
+    if (in_buffer) merge(buffer.data, p);
+    else if (buffer.constructed) merge(p, buffer.data);
+    else merge(p, par_impl::constructing<T>{buffer.data}), buffer.constructed = true;
+  }
+  if (in_buffer) par_impl::each(c, n, [&](nat, nat b, nat e) { std::move(buffer.data + b, buffer.data + e, p + b); });
+}
+
+/// copies the elements `x` of `in` for which `pred(x)` is true to `out` in order and returns their number
+///
+/// Elements beyond the size of `out` are dropped. `pred` is called once per element; the
+/// results are kept in a byte per element between counting and copying.
+template<std::ranges::random_access_range R, std::ranges::random_access_range O, typename P>
+  requires std::ranges::sized_range<R> && std::ranges::sized_range<O>
+nat copy_if(R&& in, O&& out, P pred, const options& o = {}) {
+  const auto p = par_impl::first(in);
+  const auto q = par_impl::first(out);
+  const nat n = std::ranges::size(in), capacity = std::ranges::size(out);
+  const auto c = par_impl::split<std::ranges::range_value_t<R>>(n, o);
+  if (c.count <= 1) {
+    nat k = 0;
+    for (nat i = 0; i != n && k != capacity; ++i)
+      if (pred(p[i])) q[k++] = p[i];
+    return k;
+  }
+  const auto keep = std::make_unique<bool[]>(n);
+  std::vector<nat> offsets(c.count + 1);
+  par_impl::each(c, n, [&](nat i, nat b, nat e) {
+    nat k = 0;
+    for (; b != e; ++b) k += keep[b] = bool(pred(p[b]));
+    offsets[i + 1] = k;
+  });
+  for (nat i = 0; i != c.count; ++i) offsets[i + 1] += offsets[i];
+  par_impl::each(c, n, [&](nat i, nat b, nat e) {
+    for (nat k = offsets[i]; b != e && k < capacity; ++b)
+      if (keep[b]) q[k++] = p[b];
+  });
+  return std::min(offsets[c.count], capacity);
+}
+}
+}
+
+export namespace yw { // dense
+
+/// a dense matrix of `T` that someone else owns: element (i, j) is at `data[i * row_stride + j * col_stride]`
+///
+/// Row-major storage has `col_stride == 1`; `t()` swaps the strides, which is how the functions
+/// below take transposed operands without copying them.
+template<typename T> struct matrix_view {
+  T* data = nullptr;
+  nat rows = 0, cols = 0, row_stride = 0, col_stride = 1;
+
+  constexpr matrix_view() noexcept = default;
+  /// `rows` by `cols` in row-major order
+  constexpr matrix_view(T* data, nat rows, nat cols) noexcept : data(data), rows(rows), cols(cols), row_stride(cols) {}
+  constexpr matrix_view(T* data, nat rows, nat cols, nat row_stride, nat col_stride) noexcept
+    : data(data), rows(rows), cols(cols), row_stride(row_stride), col_stride(col_stride) {}
+  template<typename U> requires std::is_same_v<const U, T>
+  constexpr matrix_view(const matrix_view<U>& m) noexcept : matrix_view(m.data, m.rows, m.cols, m.row_stride, m.col_stride) {}
+
+  constexpr T& operator()(nat i, nat j) const noexcept { return data[i * row_stride + j * col_stride]; }
+  constexpr matrix_view t() const noexcept { return {data, cols, rows, col_stride, row_stride}; }
+  /// the `rows` by `cols` block whose first element is (i, j)
+  constexpr matrix_view block(nat i, nat j, nat rows, nat cols) const noexcept { return {&(*this)(i, j), rows, cols, row_stride, col_stride}; }
+};
+
+namespace dense_impl {
+
+/// `U` is `T` or `const T`, for `T` one of the types the kernels take
+template<typename U, typename T> concept element = (std::is_same_v<T, float> || std::is_same_v<T, double>) && std::is_same_v<std::remove_const_t<U>, T>;
+
+/// what the kernels need of AVX2 for `float` and `double`
+template<typename T> struct simd;
+template<> struct simd<double> {
+  using v = __m256d;
+  static constexpr nat lanes = 4;
+  static v zero() noexcept { return intrin::mm256_setzero_pd(); }
+  static v load(const double* p) noexcept { return intrin::mm256_loadu_pd(p); }
+  static void store(double* p, v x) noexcept { intrin::mm256_storeu_pd(p, x); }
+  static v broadcast(const double* p) noexcept { return intrin::mm256_broadcast_sd(p); }
+  static v set1(double x) noexcept { return intrin::mm256_set1_pd(x); }
+  static v mul(v a, v b) noexcept { return intrin::mm256_mul_pd(a, b); }
+  static v fmadd(v a, v b, v c) noexcept { return intrin::mm256_fmadd_pd(a, b, c); }
+  static v sub(v a, v b) noexcept { return intrin::mm256_sub_pd(a, b); }
+  static v max(v a, v b) noexcept { return intrin::mm256_max_pd(a, b); }
+  /// bit `i` set where lane `i` of `a` is at most that of `b` (2 is _CMP_LE_OS)
+  static int le(v a, v b) noexcept { return intrin::mm256_movemask_pd(intrin::mm256_cmp_pd<2>(a, b)); }
+  static double hsum(v x) noexcept { return reduce_impl::hsum(x); }
+};
+template<> struct simd<float> {
+  using v = __m256;
+  static constexpr nat lanes = 8;
+  static v zero() noexcept { return intrin::mm256_setzero_ps(); }
+  static v load(const float* p) noexcept { return intrin::mm256_loadu_ps(p); }
+  static void store(float* p, v x) noexcept { intrin::mm256_storeu_ps(p, x); }
+  static v broadcast(const float* p) noexcept { return intrin::mm256_broadcast_ss(p); }
+  static v set1(float x) noexcept { return intrin::mm256_set1_ps(x); }
+  static v mul(v a, v b) noexcept { return intrin::mm256_mul_ps(a, b); }
+  static v fmadd(v a, v b, v c) noexcept { return intrin::mm256_fmadd_ps(a, b, c); }
+  static v sub(v a, v b) noexcept { return intrin::mm256_sub_ps(a, b); }
+  static v max(v a, v b) noexcept { return intrin::mm256_max_ps(a, b); }
+  /// bit `i` set where lane `i` of `a` is at most that of `b` (2 is _CMP_LE_OS)
+  static int le(v a, v b) noexcept { return intrin::mm256_movemask_ps(intrin::mm256_cmp_ps<2>(a, b)); }
+  static float hsum(v x) noexcept {
+    const __m128 h = intrin::mm_add_ps(intrin::mm256_castps256_ps128(x), intrin::mm256_extractf128_ps<1>(x));
+    const __m128 q = intrin::mm_add_ps(h, intrin::mm_movehl_ps(h, h));
+    return intrin::mm_cvtss_f32(intrin::mm_add_ss(q, intrin::mm_movehdup_ps(q)));
+  }
+};
+
+/// register tile `mr` by `nr` (12 accumulators, two loads of B and a broadcast of A fill the 16
+/// registers), and the blocks of A (`mc` by `kc`, in L2) and of B (`kc` by `nc`, in L3) packed for it
+template<typename T> struct blocking {
+  static constexpr nat mr = 6, nr = 2 * simd<T>::lanes, kc = 256, mc = sizeof(T) == 8 ? 96 : 192, nc = 2048;
+};
+
+/// below this many multiply-adds a product runs on the calling thread
+inline constexpr nat parallel_work = nat(1) << 21;
+
+/// copies rows `[i0, i0 + m)` and columns `[p0, p0 + k)` of `a` into slivers of `mr` rows, column by column, padding with zeros
+template<typename T> void pack_a(matrix_view<const T> a, nat i0, nat m, nat p0, nat k, T* dst) noexcept {
+  constexpr nat mr = blocking<T>::mr;
+  for (nat i = 0; i < m; i += mr)
+    for (nat p = 0; p < k; ++p)
+      for (nat r = 0; r < mr; ++r) *dst++ = i + r < m ? a(i0 + i + r, p0 + p) : T(0);
+}
+
+/// copies rows `[p0, p0 + k)` and columns `[j0, j0 + n)` of `b` into slivers of `nr` columns, row by row, padding with zeros
+template<typename T> void pack_b(matrix_view<const T> b, nat p0, nat k, nat j0, nat n, T* dst) noexcept {
+  constexpr nat nr = blocking<T>::nr;
+  for (nat j = 0; j < n; j += nr)
+    for (nat p = 0; p < k; ++p, dst += nr) {
+      const nat w = std::min(nr, n - j);
+      if (b.col_stride == 1) std::copy_n(&b(p0 + p, j0 + j), w, dst);
+      else
+        for (nat c = 0; c < w; ++c) dst[c] = b(p0 + p, j0 + j + c);
+      std::fill(dst + w, dst + nr, T(0));
+    }
+}
+
+/// adds `alpha` times the product of a packed sliver of A and one of B, `k` deep, to the `m` by `n` corner of `c`
+template<typename T> void kernel(nat k, const T* a, const T* b, matrix_view<T> c, nat m, nat n, T alpha) noexcept {
+  constexpr nat mr = blocking<T>::mr, nr = blocking<T>::nr, lanes = simd<T>::lanes;
+  using S = simd<T>;
+  typename S::v c00 = S::zero(), c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00;
+  typename S::v c30 = c00, c31 = c00, c40 = c00, c41 = c00, c50 = c00, c51 = c00;
+  for (nat p = 0; p < k; ++p, a += mr, b += nr) {
+    const auto b0 = S::load(b), b1 = S::load(b + lanes);
+    auto x = S::broadcast(a);
+    c00 = S::fmadd(x, b0, c00), c01 = S::fmadd(x, b1, c01), x = S::broadcast(a + 1);
+    c10 = S::fmadd(x, b0, c10), c11 = S::fmadd(x, b1, c11), x = S::broadcast(a + 2);
+    c20 = S::fmadd(x, b0, c20), c21 = S::fmadd(x, b1, c21), x = S::broadcast(a + 3);
+    c30 = S::fmadd(x, b0, c30), c31 = S::fmadd(x, b1, c31), x = S::broadcast(a + 4);
+    c40 = S::fmadd(x, b0, c40), c41 = S::fmadd(x, b1, c41), x = S::broadcast(a + 5);
+    c50 = S::fmadd(x, b0, c50), c51 = S::fmadd(x, b1, c51);
+  }
+  const typename S::v rows[mr][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+  const auto va = S::set1(alpha);
+  if (m == mr && n == nr && c.col_stride == 1) {
+    for (nat i = 0; i < mr; ++i) {
+      T* const r = &c(i, 0);
+      S::store(r, S::fmadd(va, rows[i][0], S::load(r))), S::store(r + lanes, S::fmadd(va, rows[i][1], S::load(r + lanes)));
+    }
+    return;
+  }
+  T tile[mr][nr];
+  for (nat i = 0; i < mr; ++i) S::store(tile[i], S::mul(va, rows[i][0])), S::store(tile[i] + lanes, S::mul(va, rows[i][1]));
+  for (nat i = 0; i < m; ++i)
+    for (nat j = 0; j < n; ++j) c(i, j) += tile[i][j];
+}
+
+/// the same without AVX2, on the same packing
+template<typename T> void kernel_scalar(nat k, const T* a, const T* b, matrix_view<T> c, nat m, nat n, T alpha) noexcept {
+  constexpr nat mr = blocking<T>::mr, nr = blocking<T>::nr;
+  T tile[mr][nr]{};
+  for (nat p = 0; p < k; ++p, a += mr, b += nr)
+    for (nat i = 0; i < mr; ++i)
+      for (nat j = 0; j < nr; ++j) tile[i][j] += a[i] * b[j];
+  for (nat i = 0; i < m; ++i)
+    for (nat j = 0; j < n; ++j) c(i, j) += alpha * tile[i][j];
+}
+
+/// `c = beta * c`, writing zeros rather than multiplying if `beta` is 0 so that NaNs in `c` go away
+template<typename T> void scale(matrix_view<T> c, T beta) noexcept {
+  if (beta == T(1)) return;
+  for (nat i = 0; i < c.rows; ++i)
+    for (nat j = 0; j < c.cols; ++j) c(i, j) = beta == T(0) ? T(0) : beta * c(i, j);
+}
+
+/// `c += alpha * a * b` for products small enough to skip the packing: rows of `c` at a time, `b` and `c` row-major
+template<typename T> void small(matrix_view<const T> a, matrix_view<const T> b, matrix_view<T> c, T alpha) noexcept {
+  using S = simd<T>;
+  constexpr nat lanes = S::lanes;
+  const nat n = c.cols, k = a.cols, wide = cpu.avx2 && cpu.fma ? n / lanes * lanes : 0;
+  for (nat i = 0; i < c.rows; ++i) {
+    T* const r = &c(i, 0);
+    for (nat j = 0; j < wide; j += lanes) {
+      auto s = S::zero();
+      for (nat p = 0; p < k; ++p) s = S::fmadd(S::set1(a(i, p)), S::load(&b(p, j)), s);
+      S::store(r + j, S::fmadd(S::set1(alpha), s, S::load(r + j)));
+    }
+    for (nat j = wide; j < n; ++j) {
+      T s = 0;
+      for (nat p = 0; p < k; ++p) s += a(i, p) * b(p, j);
+      r[j] += alpha * s;
+    }
+  }
+  if (wide) intrin::mm256_zeroupper();
+}
+
+/// `c += alpha * a * b` by blocks: B packed once per block and shared, A packed per block of rows by whichever worker takes it
+template<typename T> void blocked(matrix_view<const T> a, matrix_view<const T> b, matrix_view<T> c, T alpha, scheduler* pool) {
+  using B = blocking<T>;
+  const nat m = c.rows, n = c.cols, k = a.cols;
+  const bool avx = cpu.avx2 && cpu.fma;
+  // blocks of rows small enough that every worker gets two, when there are too few rows for that
+  const nat workers = pool ? pool->size() : 1;
+  const nat mc = std::clamp<nat>((m + 2 * workers - 1) / (2 * workers) + B::mr - 1, B::mr, B::mc) / B::mr * B::mr;
+  std::vector<T> packed_b(B::kc * std::min(B::nc, (n + B::nr - 1) / B::nr * B::nr));
+  for (nat jc = 0; jc < n; jc += B::nc) {
+    const nat nc = std::min(B::nc, n - jc);
+    for (nat pc = 0; pc < k; pc += B::kc) {
+      const nat kc = std::min(B::kc, k - pc);
+      const auto pack = [&](nat j0, nat j1) { pack_b(b, pc, kc, jc + j0 * B::nr, std::min(j1 * B::nr, nc) - j0 * B::nr, packed_b.data() + j0 * B::nr * kc); };
+      const nat slivers = (nc + B::nr - 1) / B::nr;
+      const auto rows = [&](nat ib) {
+        thread_local std::vector<T> packed_a;
+        const nat ic = ib * mc, mb = std::min(mc, m - ic);
+        packed_a.resize(B::mc * B::kc);
+        pack_a(a, ic, mb, pc, kc, packed_a.data());
+        for (nat jr = 0; jr < nc; jr += B::nr)
+          for (nat ir = 0; ir < mb; ir += B::mr) {
+            const auto cb = c.block(ic + ir, jc + jr, std::min(B::mr, mb - ir), std::min(B::nr, nc - jr));
+            const T *pa = packed_a.data() + ir * kc, *pb = packed_b.data() + jr * kc;
+            if (avx) kernel(kc, pa, pb, cb, cb.rows, cb.cols, alpha);
+            else kernel_scalar(kc, pa, pb, cb, cb.rows, cb.cols, alpha);
+          }
+        if (avx) intrin::mm256_zeroupper();
+      };
+      const nat blocks = (m + mc - 1) / mc;
+      if (pool) {
+        pool->parallel_for(0, slivers, 1, [&](nat j0, nat j1) { pack(j0, j1); });
+        pool->parallel_for(0, blocks, 1, rows);
+      } else {
+        pack(0, slivers);
+        for (nat ib = 0; ib < blocks; ++ib) rows(ib);
+      }
+    }
+  }
+}
+
+template<typename T> void gemm(matrix_view<const T> a, matrix_view<const T> b, matrix_view<T> c, T alpha, T beta, scheduler* pool) {
+  scale(c, beta);
+  if (c.rows == 0 || c.cols == 0 || a.cols == 0 || alpha == T(0)) return;
+  const nat work = c.rows * c.cols * a.cols;
+  if (work <= 64 * 64 * 64 && b.col_stride == 1 && c.col_stride == 1) return small(a, b, c, alpha);
+  blocked(a, b, c, alpha, work < parallel_work ? nullptr : pool);
+}
+
+/// `y[i] += alpha * (row i of a) . x` for rows `[i0, i1)`, four rows at a time, `a` row-major
+template<typename T> void gemv_rows(matrix_view<const T> a, const T* x, T* y, T alpha, nat i0, nat i1) noexcept {
+  using S = simd<T>;
+  constexpr nat lanes = S::lanes;
+  const nat n = a.cols, wide = cpu.avx2 && cpu.fma ? n / lanes * lanes : 0;
+  nat i = i0;
+  if (wide) {
+    for (; i + 4 <= i1; i += 4) {
+      const T *r0 = &a(i, 0), *r1 = &a(i + 1, 0), *r2 = &a(i + 2, 0), *r3 = &a(i + 3, 0);
+      auto s0 = S::zero(), s1 = s0, s2 = s0, s3 = s0;
+      for (nat j = 0; j < wide; j += lanes) {
+        const auto v = S::load(x + j);
+        s0 = S::fmadd(S::load(r0 + j), v, s0), s1 = S::fmadd(S::load(r1 + j), v, s1);
+        s2 = S::fmadd(S::load(r2 + j), v, s2), s3 = S::fmadd(S::load(r3 + j), v, s3);
+      }
+      T t[4] = {S::hsum(s0), S::hsum(s1), S::hsum(s2), S::hsum(s3)};
+      for (nat j = wide; j < n; ++j) t[0] += r0[j] * x[j], t[1] += r1[j] * x[j], t[2] += r2[j] * x[j], t[3] += r3[j] * x[j];
+      for (nat r = 0; r < 4; ++r) y[i + r] += alpha * t[r];
+    }
+    intrin::mm256_zeroupper();
+  }
+  for (; i < i1; ++i) {
+    T s = 0;
+    for (nat j = 0; j < n; ++j) s += a(i, j) * x[j];
+    y[i] += alpha * s;
+  }
+}
+
+/// `y[i] += alpha * x[j] * a(i, j)` for rows `[i0, i1)`, a column at a time, `a` column-major
+template<typename T> void gemv_cols(matrix_view<const T> a, const T* x, T* y, T alpha, nat i0, nat i1) noexcept {
+  using S = simd<T>;
+  constexpr nat lanes = S::lanes;
+  const nat wide = cpu.avx2 && cpu.fma ? i0 + (i1 - i0) / lanes * lanes : i0;
+  for (nat j = 0; j < a.cols; ++j) {
+    const T s = alpha * x[j];
+    const T* const col = &a(0, j);
+    const auto v = S::set1(s);
+    for (nat i = i0; i < wide; i += lanes) S::store(y + i, S::fmadd(v, S::load(col + i), S::load(y + i)));
+    for (nat i = wide; i < i1; ++i) y[i] += s * col[i];
+  }
+  if (wide != i0) intrin::mm256_zeroupper();
+}
+}
+
+/// `c = alpha * a * b + beta * c`, for `a` m by k, `b` k by n and `c` m by n, in `float` or `double`
+///
+/// Operands may have any strides, so `a.t()` multiplies by the transpose. Products of up to 64^3
+/// multiply-adds with row-major `b` and `c` run straight off the operands; larger ones are cut
+/// into 256-deep panels of B (packed once, shared by the workers) and blocks of A (packed by the
+/// worker that takes them) and multiplied in 6 by 2-vector register tiles with AVX2 FMA. Products
+/// above 2^21 multiply-adds split their blocks of rows across `pool`; the sums over `k` run in
+/// order, so results do not depend on the number of workers. `c` must not overlap `a` or `b`.
+template<typename A, typename B, typename T> requires dense_impl::element<A, T> && dense_impl::element<B, T>
+void gemm(matrix_view<A> a, matrix_view<B> b, matrix_view<T> c, std::type_identity_t<T> alpha = 1, std::type_identity_t<T> beta = 0,
+          scheduler& pool = scheduler::global()) {
+  dense_impl::gemm<T>(a, b, c, alpha, beta, &pool);
+}
+
+/// `y = alpha * a * x + beta * y`, for `a` m by n, `x` of n and `y` of m elements
+///
+/// Row-major `a` takes dot products four rows at a time, column-major `a` (a transposed row-major
+/// one) adds scaled columns; either way rows are split across `pool` above 2^21 multiply-adds.
+template<typename A, typename X, typename T> requires dense_impl::element<A, T> && dense_impl::element<X, T>
+void gemv(matrix_view<A> a, std::span<X> x, std::span<T> y, std::type_identity_t<T> alpha = 1, std::type_identity_t<T> beta = 0,
+          scheduler& pool = scheduler::global()) {
+  for (auto& v : y) v = beta == T(0) ? T(0) : beta * v;
+  if (alpha == T(0) || a.cols == 0) return;
+  const matrix_view<const T> m = a;
+  const auto part = [&](nat i0, nat i1) {
+    if (m.col_stride == 1) dense_impl::gemv_rows(m, x.data(), y.data(), alpha, i0, i1);
+    else if (m.row_stride == 1) dense_impl::gemv_cols(m, x.data(), y.data(), alpha, i0, i1);
+    else
+      for (nat i = i0; i < i1; ++i) {
+        T s = 0;
+        for (nat j = 0; j < m.cols; ++j) s += m(i, j) * x[j];
+        y[i] += alpha * s;
+      }
+  };
+  if (m.rows * m.cols < dense_impl::parallel_work) part(0, m.rows);
+  else pool.parallel_for(0, m.rows, std::max<nat>(64, m.rows / (8 * pool.size())), part);
+}
+
+/// `c[i] = alpha * a[i] * b[i] + beta * c[i]` for each `i`, the products spread across `pool` and each run on one worker
+///
+/// Meant for many small products, which gain nothing from splitting one across workers.
+template<typename T> requires dense_impl::element<T, T>
+void gemm_batched(std::span<const matrix_view<const T>> a, std::span<const matrix_view<const T>> b, std::span<const matrix_view<T>> c,
+                  std::type_identity_t<T> alpha = 1, std::type_identity_t<T> beta = 0, scheduler& pool = scheduler::global()) {
+  const nat n = std::min({a.size(), b.size(), c.size()});
+  pool.parallel_for(0, n, [&](nat i) { dense_impl::gemm<T>(a[i], b[i], c[i], alpha, beta, nullptr); });
+}
+}
+
+export namespace yw { // fft
+
+namespace fft_impl {
+
+using cplx = std::complex<fat>;
+
+/// points above which the passes are split across the workers
+inline constexpr nat parallel_points = nat(1) << 16;
+
+/// two complex numbers in a ymm register (needs AVX2 and FMA)
+struct c2 {
+  static constexpr nat width = 2;
+  __m256d v;
+  static c2 load(const cplx* p) noexcept { return {intrin::mm256_loadu_pd(reinterpret_cast<const fat*>(p))}; }
+  static c2 set(cplx w) noexcept { return {intrin::mm256_set_pd(w.imag(), w.real(), w.imag(), w.real())}; }
+  void store(cplx* p) const noexcept { intrin::mm256_storeu_pd(reinterpret_cast<fat*>(p), v); }
+  /// the first number to `lo` and the second to `hi`
+  void store(cplx* lo, cplx* hi) const noexcept { intrin::mm256_storeu2_m128d(reinterpret_cast<fat*>(hi), reinterpret_cast<fat*>(lo), v); }
+  friend c2 operator+(c2 a, c2 b) noexcept { return {intrin::mm256_add_pd(a.v, b.v)}; }
+  friend c2 operator-(c2 a, c2 b) noexcept { return {intrin::mm256_sub_pd(a.v, b.v)}; }
+  friend c2 operator*(c2 a, fat k) noexcept { return {intrin::mm256_mul_pd(a.v, intrin::mm256_set1_pd(k))}; }
+  friend c2 operator*(c2 a, c2 b) noexcept {
+    const __m256d t = intrin::mm256_mul_pd(intrin::mm256_permute_pd<0b0101>(a.v), intrin::mm256_unpackhi_pd(b.v, b.v));
+    return {intrin::mm256_fmaddsub_pd(a.v, intrin::mm256_movedup_pd(b.v), t)};
+  }
+  /// times -i, or i if `inverse`
+  friend c2 rot(c2 a, bool inverse) noexcept {
+    const __m256d sign = inverse ? intrin::mm256_set_pd(0.0, -0.0, 0.0, -0.0) : intrin::mm256_set_pd(-0.0, 0.0, -0.0, 0.0);
+    return {intrin::mm256_xor_pd(intrin::mm256_permute_pd<0b0101>(a.v), sign)};
+  }
+};
+
+/// one complex number in an xmm register
+struct c1 {
+  static constexpr nat width = 1;
+  __m128d v;
+  static c1 load(const cplx* p) noexcept { return {intrin::mm_loadu_pd(reinterpret_cast<const fat*>(p))}; }
+  static c1 set(cplx w) noexcept { return {intrin::mm_set_pd(w.imag(), w.real())}; }
+  void store(cplx* p) const noexcept { intrin::mm_storeu_pd(reinterpret_cast<fat*>(p), v); }
+  friend c1 operator+(c1 a, c1 b) noexcept { return {intrin::mm_add_pd(a.v, b.v)}; }
+  friend c1 operator-(c1 a, c1 b) noexcept { return {intrin::mm_sub_pd(a.v, b.v)}; }
+  friend c1 operator*(c1 a, fat k) noexcept { return {intrin::mm_mul_pd(a.v, intrin::mm_set1_pd(k))}; }
+  friend c1 operator*(c1 a, c1 b) noexcept {
+    const __m128d t = intrin::mm_mul_pd(intrin::mm_shuffle_pd<1>(a.v, a.v), intrin::mm_unpackhi_pd(b.v, b.v));
+    return {intrin::mm_addsub_pd(intrin::mm_mul_pd(a.v, intrin::mm_movedup_pd(b.v)), t)};
+  }
+  friend c1 rot(c1 a, bool inverse) noexcept {
+    const __m128d sign = inverse ? intrin::mm_set_pd(0.0, -0.0) : intrin::mm_set_pd(-0.0, 0.0);
+    return {intrin::mm_xor_pd(intrin::mm_shuffle_pd<1>(a.v, a.v), sign)};
+  }
+};
+
+/// the length-`R` DFT of `a` in place, with the roots of unity turning the other way if `inverse`
+template<nat R, typename V> void butterfly(V* a, bool inverse) noexcept {
+  if constexpr (R == 2) {
+    const V t = a[0];
+    a[0] = t + a[1], a[1] = t - a[1];
+  } else if constexpr (R == 3) {
+    const V t = a[1] + a[2], d = rot(a[1] - a[2], inverse) * 0.86602540378443864676, m = a[0] - t * 0.5;
+    a[0] = a[0] + t, a[1] = m + d, a[2] = m - d;
+  } else if constexpr (R == 4) {
+    const V t0 = a[0] + a[2], t1 = a[0] - a[2], t2 = a[1] + a[3], t3 = rot(a[1] - a[3], inverse);
+    a[0] = t0 + t2, a[1] = t1 + t3, a[2] = t0 - t2, a[3] = t1 - t3;
+  } else if constexpr (R == 5) {
+    constexpr fat c1 = 0.30901699437494742410, c2 = -0.80901699437494742410, s1 = 0.95105651629515357212, s2 = 0.58778525229247312917;
+    const V t1 = a[1] + a[4], t2 = a[2] + a[3], t3 = a[1] - a[4], t4 = a[2] - a[3];
+    const V b1 = a[0] + t1 * c1 + t2 * c2, b2 = a[0] + t1 * c2 + t2 * c1;
+    const V e1 = rot(t3 * s1 + t4 * s2, inverse), e2 = rot(t3 * s2 - t4 * s1, inverse);
+    a[0] = a[0] + t1 + t2, a[1] = b1 + e1, a[4] = b1 - e1, a[2] = b2 + e2, a[3] = b2 - e2;
+  } else if constexpr (R == 8) {
+    // two length-4 DFTs, of the sums and of the differences of the halves turned by the 8th roots
+    constexpr fat h = 0.70710678118654752440;
+    V b[4] = {a[0] + a[4], a[1] + a[5], a[2] + a[6], a[3] + a[7]};
+    const V d1 = a[1] - a[5], w1 = (d1 + rot(d1, inverse)) * h, d3 = a[3] - a[7], w3 = rot((d3 + rot(d3, inverse)) * h, inverse);
+    V c[4] = {a[0] - a[4], w1, rot(a[2] - a[6], inverse), w3};
+    butterfly<4>(b, inverse), butterfly<4>(c, inverse);
+    for (nat j = 0; j < 4; ++j) a[2 * j] = b[j], a[2 * j + 1] = c[j];
+  }
+}
+
+/// a pass of the Stockham autosort FFT: `x` holds `s` interleaved transforms of `radix * m` points,
+/// and `y` gets `s * radix` interleaved ones of `m` points: y[q + s(radix p + j)] = w^(jp) sum_k x[q + s(p + km)] r^(jk)
+struct stage {
+  nat radix, m, s;
+  /// where `w^(jp)` is for `j > 0`, at `(j - 1) * m + p`, and the `radix` roots `r^k` for the radices without a butterfly
+  nat twiddles, roots;
+};
+
+/// a transform of `n` points, with the twiddles of its passes
+struct plan {
+  nat n;
+  bool inverse;
+  std::vector<stage> stages;
+  std::vector<cplx> twiddles;
+  /// e^(-+2 pi i k / 2n) for k <= n / 2, for real transforms of `2n` points
+  std::vector<cplx> half;
+
+  plan(nat n, bool inverse) : n(n), inverse(inverse) {
+    const fat sign = inverse ? 2 * std::numbers::pi : -2 * std::numbers::pi;
+    const auto root = [&](nat k, nat of) { return std::polar(1.0, sign * fat(k % of) / fat(of)); };
+    std::vector<nat> radices;
+    nat rest = n;
+    for (const nat r : {8, 4, 2, 3, 5})
+      for (; rest % r == 0; rest /= r) radices.push_back(r);
+    for (nat r = 7; rest > 1; r += 2)
+      for (; rest % r == 0; rest /= r) radices.push_back(r);
+    nat length = n, s = 1;
+    for (const nat r : radices) {
+      const nat m = length / r;
+      stage st{r, m, s, twiddles.size(), 0};
+      for (nat j = 1; j < r; ++j)
+        for (nat p = 0; p < m; ++p) twiddles.push_back(root(j * p, length));
+      if (r == 7 || r > 8) {
+        st.roots = twiddles.size();
+        for (nat k = 0; k < r; ++k) twiddles.push_back(root(k, r));
+      }
+      stages.push_back(st);
+      length = m, s *= r;
+    }
+    for (nat k = 0; k <= n / 2; ++k) half.push_back(root(k, 2 * n));
+  }
+};
+
+/// the butterflies of `st` at `p` for `q` in [q0, q1), `V::width` at a time; returns where it stopped
+template<nat R, typename V> nat columns(const plan& pl, const stage& st, const cplx* x, cplx* y, nat p, nat q0, nat q1) noexcept {
+  const nat m = st.m, s = st.s;
+  V w[R];
+  for (nat j = 1; j < R; ++j) w[j] = V::set(pl.twiddles[st.twiddles + (j - 1) * m + p]);
+  nat q = q0;
+  for (; q + V::width <= q1; q += V::width) {
+    V a[R];
+    for (nat k = 0; k < R; ++k) a[k] = V::load(x + q + s * (p + k * m));
+    butterfly<R>(a, pl.inverse);
+    a[0].store(y + q + s * R * p);
+    for (nat j = 1; j < R; ++j) (a[j] * w[j]).store(y + q + s * (R * p + j));
+  }
+  return q;
+}
+
+/// the butterflies of a first pass (`s == 1`) for `p` in [p0, p1), two values of `p` at a time; returns where it stopped
+template<nat R> nat rows(const plan& pl, const stage& st, const cplx* x, cplx* y, nat p0, nat p1) noexcept {
+  const nat m = st.m;
+  nat p = p0;
+  for (; p + 2 <= p1; p += 2) {
+    c2 a[R];
+    for (nat k = 0; k < R; ++k) a[k] = c2::load(x + p + k * m);
+    butterfly<R>(a, pl.inverse);
+    a[0].store(y + R * p, y + R * (p + 1));
+    for (nat j = 1; j < R; ++j) (a[j] * c2::load(&pl.twiddles[st.twiddles + (j - 1) * m + p])).store(y + R * p + j, y + R * (p + 1) + j);
+  }
+  return p;
+}
+
+template<nat R> void pass(const plan& pl, const stage& st, const cplx* x, cplx* y, nat p0, nat p1, nat q0, nat q1, bool avx) noexcept {
+  if (avx && st.s == 1) p0 = rows<R>(pl, st, x, y, p0, p1);
+  for (nat p = p0; p < p1; ++p) columns<R, c1>(pl, st, x, y, p, avx ? columns<R, c2>(pl, st, x, y, p, q0, q1) : q0, q1);
+  if (avx) intrin::mm256_zeroupper();
+}
+
+/// a pass of a radix without a butterfly, in O(radix^2) per group
+inline void pass_any(const plan& pl, const stage& st, const cplx* x, cplx* y, nat p0, nat p1, nat q0, nat q1) {
+  const nat r = st.radix, m = st.m, s = st.s;
+  const cplx* const roots = &pl.twiddles[st.roots];
+  std::vector<c1> a(r);
+  for (nat p = p0; p < p1; ++p)
+    for (nat q = q0; q < q1; ++q) {
+      for (nat k = 0; k < r; ++k) a[k] = c1::load(x + q + s * (p + k * m));
+      for (nat j = 0; j < r; ++j) {
+        c1 t = a[0];
+        for (nat k = 1; k < r; ++k) t = t + a[k] * c1::set(roots[j * k % r]);
+        (j ? t * c1::set(pl.twiddles[st.twiddles + (j - 1) * m + p]) : t).store(y + q + s * (r * p + j));
+      }
+    }
+}
+
+inline void run(const plan& pl, const stage& st, const cplx* x, cplx* y, scheduler* pool) {
+  const bool avx = cpu.avx2 && cpu.fma;
+  const auto part = [&](nat p0, nat p1, nat q0, nat q1) {
+    switch (st.radix) {
+    case 2: return pass<2>(pl, st, x, y, p0, p1, q0, q1, avx);
+    case 3: return pass<3>(pl, st, x, y, p0, p1, q0, q1, avx);
+    case 4: return pass<4>(pl, st, x, y, p0, p1, q0, q1, avx);
+    case 5: return pass<5>(pl, st, x, y, p0, p1, q0, q1, avx);
+    case 8: return pass<8>(pl, st, x, y, p0, p1, q0, q1, avx);
+    default: return pass_any(pl, st, x, y, p0, p1, q0, q1);
+    }
+  };
+  // pieces of about 16K points, split by groups while there are enough of them and by columns after that
+  const nat grain = std::max<nat>(1, 16384 / (st.radix * st.s));
+  if (!pool || pl.n < parallel_points) part(0, st.m, 0, st.s);
+  else if (st.m >= 4 * pool->size()) pool->parallel_for(0, st.m, grain, [&](nat p0, nat p1) { part(p0, p1, 0, st.s); });
+  else pool->parallel_for(0, (st.s + 1) / 2, std::max<nat>(1, 8192 / (st.radix * st.m)), [&](nat a, nat b) { part(0, st.m, 2 * a, std::min(2 * b, st.s)); });
+}
+
+/// the transform of `in` into `out`, ping-ponging through `scratch` so that the last pass lands in `out`; `in` may be `out`
+inline void execute(const plan& pl, const cplx* in, cplx* out, scheduler* pool) {
+  const nat k = pl.stages.size();
+  if (k == 0) {
+    if (in != out) std::copy_n(in, pl.n, out);
+    return;
+  }
+  // the thread's spare buffer is taken for the call and given back after it, so that a transform
+  // run by this thread while it waits inside a parallel pass finds none and makes its own
+  thread_local std::vector<cplx> spare;
+  std::vector<cplx> scratch = std::move(spare);
+  scratch.resize(pl.n);
+  if (in == out && k % 2) std::copy_n(in, pl.n, scratch.data()), in = scratch.data();
+  for (nat i = 0; i < k; ++i) {
+    cplx* const dst = (k - 1 - i) % 2 ? scratch.data() : out;
+    run(pl, pl.stages[i], in, dst, pool);
+    in = dst;
+  }
+  spare = std::move(scratch);
+}
+
+/// the plan for `n` points, made on first use and kept for the rest of the program
+inline const plan& plan_for(nat n, bool inverse) {
+  static std::mutex mutex;
+  static std::map<std::pair<nat, bool>, std::unique_ptr<plan>> plans;
+  thread_local const plan* last[2] = {};
+  if (last[inverse] && last[inverse]->n == n) return *last[inverse];
+  std::lock_guard lock(mutex);
+  auto& p = plans[{n, inverse}];
+  if (!p) p = std::make_unique<plan>(n, inverse);
+  return *(last[inverse] = p.get());
+}
+
+inline void scale(cplx* x, nat n, fat k) noexcept {
+  for (nat i = 0; i < n; ++i) x[i] *= k;
+}
+}
+
+/// the discrete Fourier transform X[k] = sum_j x[j] e^(-2 pi i jk / n) of `in` into `out` (at least as long); `out` may be `in`
+///
+/// Sizes are factored into passes of radix 8, 4, 2, 3 and 5 with AVX2 butterflies on two complex
+/// numbers at a time, in a Stockham autosort that needs no bit reversal; other prime factors take
+/// O(p) per point, so sizes with a large one approach the cost of a plain DFT. Plans hold the
+/// twiddles and are made once per size and direction; passes over more than 2^16 points are split
+/// across `scheduler::global()`.
+inline void fft(std::span<const std::complex<fat>> in, std::span<std::complex<fat>> out) {
+  if (in.empty()) return;
+  fft_impl::execute(fft_impl::plan_for(in.size(), false), in.data(), out.data(), &scheduler::global());
+}
+inline void fft(std::span<std::complex<fat>> x) { fft(x, x); }
+
+/// the inverse transform, divided by n so that `ifft` undoes `fft`
+inline void ifft(std::span<const std::complex<fat>> in, std::span<std::complex<fat>> out) {
+  if (in.empty()) return;
+  fft_impl::execute(fft_impl::plan_for(in.size(), true), in.data(), out.data(), &scheduler::global());
+  fft_impl::scale(out.data(), in.size(), 1 / fat(in.size()));
+}
+inline void ifft(std::span<std::complex<fat>> x) { ifft(x, x); }
+
+/// the first n / 2 + 1 values of the transform of `in`, the rest being their conjugates, into `out`
+///
+/// Even sizes pack the real input into complex numbers of half the size and untangle the halves
+/// from the transform of that; odd ones take a complex transform of the full size.
+inline void rfft(std::span<const fat> in, std::span<std::complex<fat>> out) {
+  using fft_impl::cplx;
+  const nat n = in.size(), h = n / 2;
+  if (n % 2) {
+    std::vector<cplx> full(in.begin(), in.end());
+    fft(full);
+    std::copy_n(full.begin(), h + 1, out.begin());
+    return;
+  }
+  if (n == 0) return;
+  const auto& pl = fft_impl::plan_for(h, false);
+  fft_impl::execute(pl, reinterpret_cast<const cplx*>(in.data()), out.data(), &scheduler::global());
+  // X[k] = E[k] + w^k O[k] and X[h - k] = conj(E[k] - w^k O[k]), from z = even + i odd: E[k] = (Z[k] + conj(Z[h - k])) / 2, O[k] = (Z[k] - conj(Z[h - k])) / 2i
+  const cplx z0 = out[0];
+  out[0] = z0.real() + z0.imag(), out[h] = z0.real() - z0.imag();
+  for (nat k = 1; k <= h / 2; ++k) {
+    const cplx a = out[k], b = std::conj(out[h - k]), e = (a + b) * 0.5, o = (a - b) * cplx(0, -0.5) * pl.half[k];
+    out[k] = e + o, out[h - k] = std::conj(e - o);
+  }
+}
+
+/// the n real values whose `rfft` is the first n / 2 + 1 values of `in`, for n the size of `out`
+inline void irfft(std::span<const std::complex<fat>> in, std::span<fat> out) {
+  using fft_impl::cplx;
+  const nat n = out.size(), h = n / 2;
+  if (n % 2) {
+    std::vector<cplx> full(n);
+    std::copy_n(in.begin(), h + 1, full.begin());
+    for (nat k = h + 1; k < n; ++k) full[k] = std::conj(in[n - k]);
+    ifft(full);
+    for (nat k = 0; k < n; ++k) out[k] = full[k].real();
+    return;
+  }
+  if (n == 0) return;
+  // the reverse of `rfft`'s untangling: Z[k] = E[k] + i O[k], with O[k] = (X[k] - conj(X[h - k])) conj(w^k) / 2
+  const auto& pl = fft_impl::plan_for(h, true);
+  const auto z = reinterpret_cast<cplx*>(out.data());
+  z[0] = cplx(in[0].real() + in[h].real(), in[0].real() - in[h].real()) * 0.5;
+  for (nat k = 1; k <= h / 2; ++k) {
+    const cplx a = in[k], b = std::conj(in[h - k]), e = (a + b) * 0.5, o = (a - b) * 0.5 * pl.half[k];
+    z[k] = e + cplx(0, 1) * o, z[h - k] = std::conj(e) + cplx(0, 1) * std::conj(o);
+  }
+  fft_impl::execute(pl, z, z, &scheduler::global());
+  fft_impl::scale(z, h, 1 / fat(h));
+}
+}
+
+export namespace yw { // random
+
+namespace random_impl {
+
+/// bits consumed at a time by the distributions, from a buffer on the stack
+inline constexpr nat chunk = 256;
+
+inline nat splitmix(nat& x) noexcept {
+  nat z = x += 0x9e3779b97f4a7c15;
+  z = (z ^ z >> 30) * 0xbf58476d1ce4e5b9, z = (z ^ z >> 27) * 0x94d049bb133111eb;
+  return z ^ z >> 31;
+}
+
+template<int K> __m256i rotl(__m256i x) noexcept { return intrin::mm256_or_si256(intrin::mm256_slli_epi64<K>(x), intrin::mm256_srli_epi64<64 - K>(x)); }
+
+/// one xoshiro256++ stream, for seeding, jumping and the scalar path
+struct xoshiro256 {
+  nat s[4];
+  nat next() noexcept {
+    const nat r = std::rotl(s[0] + s[3], 23) + s[0], t = s[1] << 17;
+    s[2] ^= s[0], s[3] ^= s[1], s[1] ^= s[2], s[0] ^= s[3], s[2] ^= t, s[3] = std::rotl(s[3], 45);
+    return r;
+  }
+  /// advances by `2^128` steps with `jump` and by `2^192` with `long_jump` (the polynomials from xoshiro's authors)
+  void advance(const nat (&poly)[4]) noexcept {
+    nat t[4]{};
+    for (const nat p : poly)
+      for (int b = 0; b < 64; ++b) {
+        if (p >> b & 1)
+          for (int i = 0; i < 4; ++i) t[i] ^= s[i];
+        next();
+      }
+    std::copy_n(t, 4, s);
+  }
+  static constexpr nat jump[4] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+  static constexpr nat long_jump[4] = {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635};
+};
+
+/// 0x1p-52 times the high 52 bits of `x`: [0, 1) from the mantissa, which needs no integer conversion
+inline fat unit(nat x) noexcept { return std::bit_cast<fat>(x >> 12 | 0x3ff0000000000000) - 1; }
+inline __m256d unit(__m256i x) noexcept {
+  const __m256i m = intrin::mm256_or_si256(intrin::mm256_srli_epi64<12>(x), intrin::mm256_set1_epi64x(0x3ff0000000000000));
+  return intrin::mm256_sub_pd(intrin::mm256_castsi256_pd(m), intrin::mm256_set1_pd(1));
+}
+
+/// a buffer of bits that `operator()` hands out one at a time, refilled by `fill`
+template<typename E> class buffered {
+  nat _buffer[64];
+  nat _next = 64;
+public:
+  using result_type = nat;
+  static constexpr nat min() noexcept { return 0; }
+  static constexpr nat max() noexcept { return ~nat(0); }
+  nat operator()() noexcept {
+    if (_next == 64) static_cast<E*>(this)->fill(_buffer), _next = 0;
+    return _buffer[_next++];
+  }
+protected:
+  /// drops what is left in the buffer, after the stream moved
+  void _discard() noexcept { _next = 64; }
+};
+
+/// Philox4x32-10: ten rounds of two 32 by 32 bit multiplications and a Weyl sequence key
+inline void philox_block(unsigned (&c)[4], unsigned k0, unsigned k1) noexcept {
+  for (int r = 0; r < 10; ++r, k0 += 0x9e3779b9, k1 += 0xbb67ae85) {
+    const unsigned long long p0 = 0xd2511f53ull * c[0], p1 = 0xcd9e8d57ull * c[2];
+    const unsigned c1 = c[1], c3 = c[3];
+    c[0] = unsigned(p1 >> 32) ^ c1 ^ k0, c[1] = unsigned(p1), c[2] = unsigned(p0 >> 32) ^ c3 ^ k1, c[3] = unsigned(p0);
+  }
+}
+
+/// ARS-5: five AES rounds of a counter with a Weyl sequence key (Salmon et al.'s ARS, as in Random123)
+inline __m128i ars_block(__m128i counter, __m128i key) noexcept {
+  const __m128i weyl = intrin::mm_set_epi64x(0xbb67ae8584caa73b, 0x9e3779b97f4a7c15);
+  __m128i v = intrin::mm_xor_si128(counter, key);
+  for (int r = 0; r < 4; ++r) key = intrin::mm_add_epi64(key, weyl), v = intrin::mm_aesenc_si128(v, key);
+  return intrin::mm_aesenclast_si128(v, intrin::mm_add_epi64(key, weyl));
+}
+
+/// the AES S-box, from the inverses in GF(2^8) walked by powers of 3 and the affine map
+inline constexpr auto aes_sbox = [] {
+  std::array<unsigned char, 256> s{};
+  const auto rotl = [](unsigned x, int k) { return (x << k | x >> (8 - k)) & 0xff; };
+  unsigned p = 1, q = 1;
+  do {
+    p = (p ^ p << 1 ^ (p & 0x80 ? 0x1b : 0)) & 0xff;
+    q ^= q << 1, q ^= q << 2, q ^= q << 4, q &= 0xff;
+    if (q & 0x80) q ^= 0x09;
+    s[p] = (unsigned char)(q ^ rotl(q, 1) ^ rotl(q, 2) ^ rotl(q, 3) ^ rotl(q, 4) ^ 0x63);
+  } while (p != 1);
+  s[0] = 0x63;
+  return s;
+}();
+
+/// `aesenc` (or `aesenclast`, without MixColumns) of the 16 bytes `v` with round key `k`, in software
+inline void aes_round(unsigned char (&v)[16], const unsigned char (&k)[16], bool last) noexcept {
+  unsigned char t[16];
+  for (int c = 0; c < 4; ++c)
+    for (int r = 0; r < 4; ++r) t[r + 4 * c] = aes_sbox[v[r + 4 * ((c + r) % 4)]];
+  if (!last)
+    for (int c = 0; c < 4; ++c) {
+      unsigned char* a = t + 4 * c;
+      const auto x2 = [](unsigned char x) { return (unsigned char)(x << 1 ^ (x & 0x80 ? 0x1b : 0)); };
+      const unsigned char all = a[0] ^ a[1] ^ a[2] ^ a[3], a0 = a[0];
+      for (int r = 0; r < 4; ++r) a[r] ^= all ^ x2(a[r] ^ (r < 3 ? a[r + 1] : a0));
+    }
+  for (int i = 0; i < 16; ++i) v[i] = t[i] ^ k[i];
+}
+
+/// `ars_block` in software for CPUs without AES-NI: the same two values, written to `out`
+inline void ars_block(nat counter, nat stream, nat seed, nat (&out)[2]) noexcept {
+  constexpr nat weyl[2] = {0x9e3779b97f4a7c15, 0xbb67ae8584caa73b};
+  nat key[2] = {seed, 0}, w[2] = {counter ^ seed, stream};
+  unsigned char v[16], k[16];
+  std::memcpy(v, w, 16);
+  for (int r = 0; r < 5; ++r) {
+    key[0] += weyl[0], key[1] += weyl[1];
+    std::memcpy(k, key, 16);
+    aes_round(v, k, r == 4);
+  }
+  std::memcpy(out, v, 16);
+}
+}
+
+/// random number engines that fill arrays several values at a time, and distributions over them
+///
+/// Every engine is a `UniformRandomBitGenerator` of `nat`, so `<random>` distributions take it, but
+/// `fill` and the functions below are where the speed is. Streams for threads come from the
+/// `stream` argument: `xoshiro` jumps ahead by 2^192 steps per stream, and the counter-based
+/// `philox` and `ars` put it into their counter, so streams never overlap.
+namespace random {
+
+/// eight interleaved xoshiro256++ streams, run in two sets of four AVX2 lanes
+class xoshiro : public random_impl::buffered<xoshiro> {
+  alignas(32) nat _s[4][8];
+public:
+  explicit xoshiro(nat seed = 0, nat stream = 0) noexcept {
+    random_impl::xoshiro256 g;
+    for (auto& s : g.s) s = random_impl::splitmix(seed);
+    for (nat i = 0; i < stream; ++i) g.advance(g.long_jump);
+    for (nat lane = 0; lane < 8; ++lane, g.advance(g.jump))
+      for (nat i = 0; i < 4; ++i) _s[i][lane] = g.s[i];
+  }
+
+  /// writes the next `out.size()` values; lane `k` of the streams makes the values at `8j + k`
+  void fill(std::span<nat> out) noexcept {
+    nat* p = out.data();
+    const nat n = out.size();
+    nat i = 0;
+    if (cpu.avx2) {
+      const auto load = [&](nat k, nat h) { return intrin::mm256_load_si256(reinterpret_cast<const __m256i*>(&_s[k][4 * h])); };
+      __m256i a0 = load(0, 0), a1 = load(1, 0), a2 = load(2, 0), a3 = load(3, 0), b0 = load(0, 1), b1 = load(1, 1), b2 = load(2, 1), b3 = load(3, 1);
+      const auto step = [](__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3) {
+        const __m256i r = intrin::mm256_add_epi64(random_impl::rotl<23>(intrin::mm256_add_epi64(s0, s3)), s0), t = intrin::mm256_slli_epi64<17>(s1);
+        s2 = intrin::mm256_xor_si256(s2, s0), s3 = intrin::mm256_xor_si256(s3, s1), s1 = intrin::mm256_xor_si256(s1, s2), s0 = intrin::mm256_xor_si256(s0, s3);
+        s2 = intrin::mm256_xor_si256(s2, t), s3 = random_impl::rotl<45>(s3);
+        return r;
+      };
+      for (; i + 8 <= n; i += 8) {
+        intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), step(a0, a1, a2, a3));
+        intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i + 4), step(b0, b1, b2, b3));
+      }
+      const auto store = [&](nat k, nat h, __m256i v) { intrin::mm256_store_si256(reinterpret_cast<__m256i*>(&_s[k][4 * h]), v); };
+      store(0, 0, a0), store(1, 0, a1), store(2, 0, a2), store(3, 0, a3), store(0, 1, b0), store(1, 1, b1), store(2, 1, b2), store(3, 1, b3);
+      intrin::mm256_zeroupper();
+    }
+    // the rest, a lane at a time in the same order
+    for (; i < n; i += 8)
+      for (nat lane = 0; lane < 8; ++lane) {
+        random_impl::xoshiro256 g{{_s[0][lane], _s[1][lane], _s[2][lane], _s[3][lane]}};
+        const nat v = g.next();
+        if (i + lane < n) p[i + lane] = v;
+        for (nat k = 0; k < 4; ++k) _s[k][lane] = g.s[k];
+      }
+  }
+  template<nat N> void fill(nat (&out)[N]) noexcept { fill(std::span<nat>(out)); }
+};
+
+/// Philox4x32-10 (Salmon et al.): value `i` of a stream depends only on the seed, the stream and `i`,
+/// so a stream can start anywhere; four blocks of two values at a time in AVX2
+class philox : public random_impl::buffered<philox> {
+  unsigned _key[2], _stream[2];
+  nat _block = 0;
+public:
+  explicit philox(nat seed = 0, nat stream = 0) noexcept
+    : _key{unsigned(seed), unsigned(seed >> 32)}, _stream{unsigned(stream), unsigned(stream >> 32)} {}
+
+  /// the index of the next value `fill` writes, and a jump to any other (rounded down to an even one)
+  nat position() const noexcept { return 2 * _block; }
+  void seek(nat position) noexcept { _block = position / 2, _discard(); }
+
+  void fill(std::span<nat> out) noexcept {
+    nat* p = out.data();
+    const nat n = out.size();
+    nat i = 0;
+    if (cpu.avx2) {
+      // counter words and keys in the low halves of 64-bit lanes, a block per lane
+      const __m256i lo = intrin::mm256_set1_epi64x(0xffffffff), m0 = intrin::mm256_set1_epi64x(0xd2511f53), m1 = intrin::mm256_set1_epi64x(0xcd9e8d57);
+      const __m256i c2 = intrin::mm256_set1_epi64x(_stream[0]), c3 = intrin::mm256_set1_epi64x(_stream[1]);
+      __m256i keys[10][2];
+      for (unsigned r = 0; r < 10; ++r)
+        keys[r][0] = intrin::mm256_set1_epi64x(unsigned(_key[0] + r * 0x9e3779b9)), keys[r][1] = intrin::mm256_set1_epi64x(unsigned(_key[1] + r * 0xbb67ae85));
+      for (; i + 8 <= n; i += 8, _block += 4) {
+        __m256i x0 = intrin::mm256_set_epi64x(unsigned(_block + 3), unsigned(_block + 2), unsigned(_block + 1), unsigned(_block));
+        __m256i x1 = intrin::mm256_set_epi64x((_block + 3) >> 32, (_block + 2) >> 32, (_block + 1) >> 32, _block >> 32), x2 = c2, x3 = c3;
+        for (const auto& k : keys) {
+          const __m256i p0 = intrin::mm256_mul_epu32(x0, m0), p1 = intrin::mm256_mul_epu32(x2, m1);
+          const __m256i y0 = intrin::mm256_xor_si256(intrin::mm256_xor_si256(intrin::mm256_srli_epi64<32>(p1), x1), k[0]);
+          const __m256i y2 = intrin::mm256_xor_si256(intrin::mm256_xor_si256(intrin::mm256_srli_epi64<32>(p0), x3), k[1]);
+          x0 = y0, x1 = intrin::mm256_and_si256(p1, lo), x2 = y2, x3 = intrin::mm256_and_si256(p0, lo);
+        }
+        // value 2b is words 0 and 1 of block b, value 2b + 1 words 2 and 3
+        const __m256i v0 = intrin::mm256_or_si256(x0, intrin::mm256_slli_epi64<32>(x1)), v1 = intrin::mm256_or_si256(x2, intrin::mm256_slli_epi64<32>(x3));
+        const __m256i even = intrin::mm256_unpacklo_epi64(v0, v1), odd = intrin::mm256_unpackhi_epi64(v0, v1);
+        intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), intrin::mm256_permute2x128_si256<0x20>(even, odd));
+        intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i + 4), intrin::mm256_permute2x128_si256<0x31>(even, odd));
+      }
+      intrin::mm256_zeroupper();
+    }
+    for (; i < n; i += 2, ++_block) {
+      unsigned c[4] = {unsigned(_block), unsigned(_block >> 32), _stream[0], _stream[1]};
+      random_impl::philox_block(c, _key[0], _key[1]);
+      p[i] = c[0] | nat(c[1]) << 32;
+      if (i + 1 < n) p[i + 1] = c[2] | nat(c[3]) << 32;
+    }
+  }
+  template<nat N> void fill(nat (&out)[N]) noexcept { fill(std::span<nat>(out)); }
+};
+
+/// ARS-5 on AES-NI: counter-based like `philox`, a block of two values per five `aesenc`, four blocks in flight
+///
+/// Without AES-NI the rounds run in software from a table, with the same values but many times slower.
+class ars : public random_impl::buffered<ars> {
+  nat _seed, _stream, _block = 0;
+public:
+  explicit ars(nat seed = 0, nat stream = 0) noexcept : _seed(seed), _stream(stream) {}
+
+  nat position() const noexcept { return 2 * _block; }
+  void seek(nat position) noexcept { _block = position / 2, _discard(); }
+
+  void fill(std::span<nat> out) noexcept {
+    nat* p = out.data();
+    const nat n = out.size();
+    nat i = 0;
+    if (!cpu.aes) {
+      for (; i < n; i += 2, ++_block) {
+        nat v[2];
+        random_impl::ars_block(_block, _stream, _seed, v);
+        p[i] = v[0];
+        if (i + 1 < n) p[i + 1] = v[1];
+      }
+      return;
+    }
+    const __m128i key = intrin::mm_set_epi64x(0, _seed);
+    const auto block = [&](nat b) { return random_impl::ars_block(intrin::mm_set_epi64x(_stream, b), key); };
+    for (; i + 8 <= n; i += 8, _block += 4) {
+      const __m128i v0 = block(_block), v1 = block(_block + 1), v2 = block(_block + 2), v3 = block(_block + 3);
+      intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v0), intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(p + i + 2), v1);
+      intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(p + i + 4), v2), intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(p + i + 6), v3);
+    }
+    for (; i < n; i += 2, ++_block) {
+      alignas(16) nat v[2];
+      intrin::mm_store_si128(reinterpret_cast<__m128i*>(v), block(_block));
+      p[i] = v[0];
+      if (i + 1 < n) p[i + 1] = v[1];
+    }
+  }
+  template<nat N> void fill(nat (&out)[N]) noexcept { fill(std::span<nat>(out)); }
+};
+
+/// fills `out` with values uniform in [lo, hi), on a grid of 2^-52 of the width
+template<typename E> void uniform(E& e, std::span<fat> out, fat lo = 0, fat hi = 1) {
+  nat bits[random_impl::chunk];
+  const fat w = hi - lo;
+  for (nat i = 0; i < out.size(); i += random_impl::chunk) {
+    const nat n = std::min(random_impl::chunk, out.size() - i);
+    e.fill(std::span(bits, n));
+    nat j = 0;
+    if (cpu.avx2 && cpu.fma) {
+      const __m256d vl = intrin::mm256_set1_pd(lo), vw = intrin::mm256_set1_pd(w);
+      for (; j + 4 <= n; j += 4)
+        intrin::mm256_storeu_pd(&out[i + j], intrin::mm256_fmadd_pd(random_impl::unit(intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + j))), vw, vl));
+      intrin::mm256_zeroupper();
+    }
+    for (; j < n; ++j) out[i + j] = lo + w * random_impl::unit(bits[j]);
+  }
+}
+
+/// fills `out` with normally distributed values, by the Box-Muller transform of pairs of uniform values
+///
+/// Each pair costs a logarithm, a square root and a sine and cosine, four pairs at a time with the
+/// SVML functions behind `intrin::mm256_log_pd` and `mm256_sincos_pd`.
+template<typename E> void normal(E& e, std::span<fat> out, fat mean = 0, fat stddev = 1) {
+  nat bits[random_impl::chunk];
+  constexpr fat tau = 2 * std::numbers::pi;
+  for (nat i = 0; i < out.size(); i += random_impl::chunk) {
+    const nat n = std::min(random_impl::chunk, out.size() - i);
+    e.fill(std::span(bits, n + n % 2));
+    nat j = 0;
+    if (cpu.avx2 && cpu.fma) {
+      const __m256d one = intrin::mm256_set1_pd(1), m2 = intrin::mm256_set1_pd(-2), vt = intrin::mm256_set1_pd(tau);
+      const __m256d vm = intrin::mm256_set1_pd(mean), vs = intrin::mm256_set1_pd(stddev);
+      for (; j + 8 <= n; j += 8) {
+        // 1 - u is in (0, 1], so the logarithm is finite
+        const __m256d u1 = intrin::mm256_sub_pd(one, random_impl::unit(intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + j))));
+        const __m256d u2 = random_impl::unit(intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + j + 4)));
+        const __m256d r = intrin::mm256_mul_pd(intrin::mm256_sqrt_pd(intrin::mm256_mul_pd(m2, intrin::mm256_log_pd(u1))), vs);
+        __m256d c;
+        const __m256d s = intrin::mm256_sincos_pd(&c, intrin::mm256_mul_pd(vt, u2));
+        intrin::mm256_storeu_pd(&out[i + j], intrin::mm256_fmadd_pd(r, c, vm));
+        intrin::mm256_storeu_pd(&out[i + j + 4], intrin::mm256_fmadd_pd(r, s, vm));
+      }
+      intrin::mm256_zeroupper();
+    }
+    for (; j < n; j += 2) {
+      const fat r = stddev * std::sqrt(-2 * std::log(1 - random_impl::unit(bits[j]))), a = tau * random_impl::unit(bits[j + 1]);
+      out[i + j] = mean + r * std::cos(a);
+      if (j + 1 < n) out[i + j + 1] = mean + r * std::sin(a);
+    }
+  }
+}
+
+/// fills `out` with exponentially distributed values of the given rate, as -log(1 - u) / rate
+template<typename E> void exponential(E& e, std::span<fat> out, fat rate = 1) {
+  nat bits[random_impl::chunk];
+  const fat scale = -1 / rate;
+  for (nat i = 0; i < out.size(); i += random_impl::chunk) {
+    const nat n = std::min(random_impl::chunk, out.size() - i);
+    e.fill(std::span(bits, n));
+    nat j = 0;
+    if (cpu.avx2) {
+      const __m256d one = intrin::mm256_set1_pd(1), vs = intrin::mm256_set1_pd(scale);
+      for (; j + 4 <= n; j += 4) {
+        const __m256d u = intrin::mm256_sub_pd(one, random_impl::unit(intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits + j))));
+        intrin::mm256_storeu_pd(&out[i + j], intrin::mm256_mul_pd(intrin::mm256_log_pd(u), vs));
+      }
+      intrin::mm256_zeroupper();
+    }
+    for (; j < n; ++j) out[i + j] = scale * std::log(1 - random_impl::unit(bits[j]));
+  }
+}
+
+/// fills `out` with integers uniform in [0, bound), or with raw bits if `bound` is 0
+///
+/// The high half of a 128-bit product maps the bits to the range, and the few products whose low
+/// half falls short of `2^64 mod bound` are drawn again, so that every value is equally likely (Lemire).
+template<typename E> void uniform(E& e, std::span<nat> out, nat bound) {
+  e.fill(out);
+  if (bound == 0) return;
+  const nat threshold = (0 - bound) % bound;
+  for (auto& x : out) {
+    unsigned long long hi;
+    nat lo = intrin::umul128(x, bound, &hi);
+    while (lo < threshold) lo = intrin::umul128(e(), bound, &hi);
+    x = hi;
+  }
+}
+}
+}
+
+export namespace yw { // bitvector
+
+namespace bitvector_impl {
+
+/// a word with the low `n` bits set, for `n` in [1, 64]
+inline nat low(nat n) noexcept { return ~nat(0) >> (64 - n); }
+
+inline nat popcount(nat w) noexcept { return nat(intrin::mm_popcnt_u64(w)); }
+
+/// the ones in each quadword of `v`, from a table of the ones in each nibble
+inline __m256i popcount(__m256i v) noexcept {
+  const __m256i table = intrin::mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i mask = intrin::mm256_set1_epi8(0x0f);
+  const __m256i lo = intrin::mm256_shuffle_epi8(table, intrin::mm256_and_si256(v, mask));
+  const __m256i hi = intrin::mm256_shuffle_epi8(table, intrin::mm256_and_si256(intrin::mm256_srli_epi16<4>(v), mask));
+  return intrin::mm256_sad_epu8(intrin::mm256_add_epi8(lo, hi), intrin::mm256_setzero_si256());
+}
+
+/// a carry-save adder: `h` and `l` become the carry and the sum bits of `a + b + c`
+inline void csa(__m256i& h, __m256i& l, __m256i a, __m256i b, __m256i c) noexcept {
+  const __m256i u = intrin::mm256_xor_si256(a, b);
+  h = intrin::mm256_or_si256(intrin::mm256_and_si256(a, b), intrin::mm256_and_si256(u, c)), l = intrin::mm256_xor_si256(u, c);
+}
+
+/// the ones in `n` words, `word(i)` at a time or `vector(i)` for the four from `i`
+///
+/// The AVX2 path is Harley and Seal's (as vectorized by Muła, Kurz and Lemire): sixteen vectors go
+/// through a tree of carry-save adders, and only the vector of their sixteens is counted per step.
+template<typename Word, typename Vector> nat count(nat n, Word word, Vector vector) noexcept {
+  nat i = 0, total = 0;
+  if (cpu.avx2 && n >= 64) {
+    __m256i sum = intrin::mm256_setzero_si256(), ones = sum, twos = sum, fours = sum, eights = sum;
+    __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+    for (; i + 64 <= n; i += 64) {
+      const auto v = [&](nat k) { return vector(i + 4 * k); };
+      csa(twos_a, ones, ones, v(0), v(1)), csa(twos_b, ones, ones, v(2), v(3)), csa(fours_a, twos, twos, twos_a, twos_b);
+      csa(twos_a, ones, ones, v(4), v(5)), csa(twos_b, ones, ones, v(6), v(7)), csa(fours_b, twos, twos, twos_a, twos_b);
+      csa(eights_a, fours, fours, fours_a, fours_b);
+      csa(twos_a, ones, ones, v(8), v(9)), csa(twos_b, ones, ones, v(10), v(11)), csa(fours_a, twos, twos, twos_a, twos_b);
+      csa(twos_a, ones, ones, v(12), v(13)), csa(twos_b, ones, ones, v(14), v(15)), csa(fours_b, twos, twos, twos_a, twos_b);
+      csa(eights_b, fours, fours, fours_a, fours_b);
+      csa(sixteens, eights, eights, eights_a, eights_b);
+      sum = intrin::mm256_add_epi64(sum, popcount(sixteens));
+    }
+    sum = intrin::mm256_add_epi64(intrin::mm256_slli_epi64<4>(sum), intrin::mm256_slli_epi64<3>(popcount(eights)));
+    sum = intrin::mm256_add_epi64(sum, intrin::mm256_add_epi64(intrin::mm256_slli_epi64<2>(popcount(fours)), intrin::mm256_slli_epi64<1>(popcount(twos))));
+    sum = intrin::mm256_add_epi64(sum, popcount(ones));
+    alignas(32) nat s[4];
+    intrin::mm256_store_si256(reinterpret_cast<__m256i*>(s), sum);
+    intrin::mm256_zeroupper();
+    total = s[0] + s[1] + s[2] + s[3];
+  }
+  for (; i < n; ++i) total += popcount(word(i));
+  return total;
+}
+
+/// the position of the one of index `k` (from 0) in `x`, which has more than `k` ones
+inline nat select(nat x, nat k) noexcept {
+  if (cpu.bmi2) return nat(std::countr_zero(intrin::pdep_u64(nat(1) << k, x)));
+  nat s = 0;
+  for (nat c; (c = popcount(x & 0xff)) <= k; x >>= 8, s += 8) k -= c;
+  for (; k; --k) x &= x - 1;
+  return s + nat(std::countr_zero(x));
+}
+
+/// the word operations of `&=`, `|=`, `^=` and `and_not`, on words and on vectors of four
+struct and_op {
+  nat operator()(nat a, nat b) const noexcept { return a & b; }
+  __m256i operator()(__m256i a, __m256i b) const noexcept { return intrin::mm256_and_si256(a, b); }
+};
+struct or_op {
+  nat operator()(nat a, nat b) const noexcept { return a | b; }
+  __m256i operator()(__m256i a, __m256i b) const noexcept { return intrin::mm256_or_si256(a, b); }
+};
+struct xor_op {
+  nat operator()(nat a, nat b) const noexcept { return a ^ b; }
+  __m256i operator()(__m256i a, __m256i b) const noexcept { return intrin::mm256_xor_si256(a, b); }
+};
+struct and_not_op {
+  nat operator()(nat a, nat b) const noexcept { return a & ~b; }
+  __m256i operator()(__m256i a, __m256i b) const noexcept { return intrin::mm256_andnot_si256(b, a); }
+};
+
+/// `d[i] = op(d[i], b[i])` for `n` words
+template<typename Op> void apply(nat* d, const nat* b, nat n, Op op) noexcept {
+  nat i = 0;
+  if (cpu.avx2) {
+    const auto load = [](const nat* p) { return intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); };
+    for (; i + 16 <= n; i += 16)
+      for (nat k = i; k < i + 16; k += 4) intrin::mm256_storeu_si256(reinterpret_cast<__m256i*>(d + k), op(load(d + k), load(b + k)));
+    intrin::mm256_zeroupper();
+  }
+  for (; i < n; ++i) d[i] = op(d[i], b[i]);
+}
+
+/// the indices of the set bits of a `bitspan` or `bitvector`, in increasing order
+class ones {
+  const nat* _words = nullptr;
+  nat _count = 0, _tail = 0;
+public:
+  class iterator {
+    friend ones;
+    const nat* _words = nullptr;
+    nat _count = 0, _tail = 0, _i = 0, _x = 0;
+    nat _word(nat i) const noexcept { return i + 1 == _count ? _words[i] & _tail : _words[i]; }
+    void _skip() noexcept {
+      while (_x == 0 && ++_i < _count) _x = _word(_i);
+    }
+  public:
+    using value_type = nat;
+    using difference_type = std::ptrdiff_t;
+    nat operator*() const noexcept { return _i * 64 + nat(std::countr_zero(_x)); }
+    iterator& operator++() noexcept { return _x &= _x - 1, _skip(), *this; }
+    iterator operator++(int) noexcept { auto t = *this; return ++*this, t; }
+    bool operator==(std::default_sentinel_t) const noexcept { return _i >= _count; }
+  };
+  ones(const nat* words, nat size) noexcept : _words(words), _count((size + 63) / 64), _tail(size % 64 ? low(size % 64) : ~nat(0)) {}
+  iterator begin() const noexcept {
+    iterator it;
+    it._words = _words, it._count = _count, it._tail = _tail;
+    if (_count) it._x = it._word(0), it._skip();
+    return it;
+  }
+  std::default_sentinel_t end() const noexcept { return {}; }
+};
+
+/// the operations of `bitspan` and `bitvector` over `D::words()` and `D::size()`
+///
+/// The bits past the size in the last word are never read nor written, so a view may end
+/// in the middle of a word whose other bits belong to something else.
+template<typename D, bool Mutable> class bits {
+  std::span<const nat> _words() const noexcept { return static_cast<const D&>(*this).words(); }
+  std::span<nat> _mutable_words() noexcept requires Mutable { return static_cast<D&>(*this).words(); }
+  nat _size() const noexcept { return static_cast<const D&>(*this).size(); }
+  /// the bits of the last word that are in the range
+  nat _tail() const noexcept { return _size() % 64 ? low(_size() % 64) : ~nat(0); }
+
+  template<typename E, bool M, typename Op> D& _apply(const bits<E, M>& b, Op op) {
+    if (b._size() != _size()) throw std::length_error("yw::bitvector: sizes differ");
+    const auto d = _mutable_words();
+    if (d.empty()) return static_cast<D&>(*this);
+    const nat n = d.size() - 1, last = d[n], m = _tail();
+    apply(d.data(), b._words().data(), n, op);
+    d[n] = (last & ~m) | (op(last, b._words()[n]) & m);
+    return static_cast<D&>(*this);
+  }
+  template<typename E, bool M> friend class bits;
+public:
+  bool test(nat i) const noexcept { return _words()[i / 64] >> i % 64 & 1; }
+  bool operator[](nat i) const noexcept { return test(i); }
+  void set(nat i, bool value = true) noexcept requires Mutable {
+    nat& w = _mutable_words()[i / 64];
+    w = value ? w | nat(1) << i % 64 : w & ~(nat(1) << i % 64);
+  }
+  void reset(nat i) noexcept requires Mutable { set(i, false); }
+  void flip(nat i) noexcept requires Mutable { _mutable_words()[i / 64] ^= nat(1) << i % 64; }
+
+  /// sets every bit to `value`
+  void fill(bool value) noexcept requires Mutable {
+    const auto d = _mutable_words();
+    if (d.empty()) return;
+    std::fill(d.begin(), d.end() - 1, value ? ~nat(0) : 0);
+    d.back() = value ? d.back() | _tail() : d.back() & ~_tail();
+  }
+  /// flips every bit
+  void flip() noexcept requires Mutable {
+    const auto d = _mutable_words();
+    if (d.empty()) return;
+    for (nat i = 0; i + 1 < d.size(); ++i) d[i] = ~d[i];
+    d.back() ^= _tail();
+  }
+
+  /// the ones, by Harley-Seal in AVX2 and `popcnt` otherwise
+  nat count() const noexcept {
+    const auto w = _words();
+    if (w.empty()) return 0;
+    const nat* p = w.data();
+    return bitvector_impl::count(w.size() - 1, [p](nat i) { return p[i]; }, [p](nat i) { return intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)); }) +
+           popcount(w.back() & _tail());
+  }
+  /// the ones of `*this & b` without forming it
+  template<typename E, bool M> nat count_and(const bits<E, M>& b) const {
+    if (b._size() != _size()) throw std::length_error("yw::bitvector: sizes differ");
+    const auto w = _words();
+    if (w.empty()) return 0;
+    const nat *p = w.data(), *q = b._words().data();
+    const auto vector = [p, q](nat i) {
+      return intrin::mm256_and_si256(intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(q + i)));
+    };
+    return bitvector_impl::count(w.size() - 1, [p, q](nat i) { return p[i] & q[i]; }, vector) + popcount(w.back() & q[w.size() - 1] & _tail());
+  }
+  bool any() const noexcept { return find() != npos; }
+  bool none() const noexcept { return find() == npos; }
+
+  /// the index of the first set bit from `from`, or `npos`
+  nat find(nat from = 0) const noexcept {
+    const auto w = _words();
+    if (from >= _size()) return npos;
+    nat i = from / 64, x = w[i] & ~nat(0) << from % 64;
+    while (x == 0)
+      if (++i == w.size()) return npos;
+      else x = w[i];
+    const nat r = i * 64 + nat(std::countr_zero(x));
+    return r < _size() ? r : npos;
+  }
+  /// calls `f(i)` for the index `i` of every set bit in increasing order, a `tzcnt` per bit
+  template<typename F> void for_each(F&& f) const {
+    const auto w = _words();
+    for (nat i = 0; i < w.size(); ++i)
+      for (nat x = i + 1 == w.size() ? w[i] & _tail() : w[i]; x; x &= x - 1) f(i * 64 + nat(std::countr_zero(x)));
+  }
+  /// the indices of the set bits as a range, for `for (nat i : b.ones())`
+  bitvector_impl::ones ones() const noexcept { return {_words().data(), _size()}; }
+
+  template<typename E, bool M> D& operator&=(const bits<E, M>& b) requires Mutable { return _apply(b, and_op{}); }
+  template<typename E, bool M> D& operator|=(const bits<E, M>& b) requires Mutable { return _apply(b, or_op{}); }
+  template<typename E, bool M> D& operator^=(const bits<E, M>& b) requires Mutable { return _apply(b, xor_op{}); }
+  /// clears the bits set in `b`
+  template<typename E, bool M> D& and_not(const bits<E, M>& b) requires Mutable { return _apply(b, and_not_op{}); }
+
+  template<typename E, bool M> bool operator==(const bits<E, M>& b) const noexcept {
+    const auto w = _words(), v = b._words();
+    if (b._size() != _size()) return false;
+    return w.empty() || (std::equal(w.begin(), w.end() - 1, v.begin()) && ((w.back() ^ v.back()) & _tail()) == 0);
+  }
+};
+}
+
+/// bits in words of 64 that are not owned, e.g. `mapped_file::view<const nat>()` or an array
+/// from an `arena`; `W` is `nat`, or `const nat` for read-only bits
+///
+/// Bit `i` is bit `i % 64` of word `i / 64`, as in `bitvector`, so either can be written to a
+/// file and viewed again with `bitspan<const nat>(file.view<const nat>(), size)`.
+template<typename W = nat> class bitspan : public bitvector_impl::bits<bitspan<W>, !std::is_const_v<W>> {
+  W* _data = nullptr;
+  nat _size = 0;
+public:
+  bitspan() noexcept = default;
+  /// the first `size` bits of `words`, all of them by default
+  explicit bitspan(std::span<W> words, nat size = npos) noexcept : _data(words.data()), _size(std::min(size, words.size() * 64)) {}
+  bitspan(const bitspan<nat>& b) noexcept requires std::is_const_v<W> : _data(b.words().data()), _size(b.size()) {}
+
+  std::span<W> words() const noexcept { return {_data, (_size + 63) / 64}; }
+  nat size() const noexcept { return _size; }
+  bool empty() const noexcept { return _size == 0; }
+};
+
+/// a resizable array of bits in words of 64, for sets of small integers and filters over rows
+///
+/// Memory comes from a `std::pmr::memory_resource`, so an `arena` can hold many of them. The
+/// bulk operations and `count` run four words at a time in AVX2, set bits are visited with
+/// `tzcnt` rather than tested one by one, and `bitrank` adds rank and select.
+class bitvector : public bitvector_impl::bits<bitvector, true> {
+  std::pmr::vector<nat> _words;
+  nat _size = 0;
+  /// clears the bits past the size, so that growing reads zeros
+  void _trim() noexcept {
+    if (_size % 64) _words.back() &= bitvector_impl::low(_size % 64);
+  }
+public:
+  using allocator_type = std::pmr::polymorphic_allocator<nat>;
+
+  bitvector() noexcept = default;
+  explicit bitvector(allocator_type a) noexcept : _words(a) {}
+  explicit bitvector(nat size, bool value = false, allocator_type a = {}) : _words((size + 63) / 64, value ? ~nat(0) : 0, a), _size(size) { _trim(); }
+  /// a copy of `b`
+  template<typename W> explicit bitvector(const bitspan<W>& b, allocator_type a = {}) : _words(b.words().begin(), b.words().end(), a), _size(b.size()) { _trim(); }
+
+  std::span<nat> words() noexcept { return _words; }
+  std::span<const nat> words() const noexcept { return _words; }
+  nat size() const noexcept { return _size; }
+  bool empty() const noexcept { return _size == 0; }
+  operator bitspan<nat>() noexcept { return bitspan<nat>(words(), _size); }
+  operator bitspan<const nat>() const noexcept { return bitspan<const nat>(words(), _size); }
+
+  /// grows with `value` or shrinks to `size` bits
+  void resize(nat size, bool value = false) {
+    if (value && _size % 64 && size > _size) _words.back() |= ~bitvector_impl::low(_size % 64);
+    _words.resize((size + 63) / 64, value ? ~nat(0) : 0), _size = size, _trim();
+  }
+  void push_back(bool value) {
+    if (_size % 64 == 0) _words.push_back(0);
+    _words.back() |= nat(value) << _size++ % 64;
+  }
+  void clear() noexcept { _words.clear(), _size = 0; }
+  void reserve(nat size) { _words.reserve((size + 63) / 64); }
+};
+
+/// counts of the ones before every 512 bits of a `bitspan` or `bitvector`, which make `rank` a
+/// table lookup and at most eight `popcnt`, and `select` a short binary search and a `pdep`
+///
+/// The counts take an eighth of the memory of the bits, and a sample of every 4096th one a little
+/// more; the bits must outlive the index and not change while it is used.
+class bitrank {
+  static constexpr nat block = 8, sample = 4096;
+  bitspan<const nat> _bits;
+  std::vector<nat> _blocks, _samples;
+  nat _word(nat i) const noexcept {
+    const auto w = _bits.words();
+    return i + 1 == w.size() && _bits.size() % 64 ? w[i] & bitvector_impl::low(_bits.size() % 64) : w[i];
+  }
+public:
+  bitrank() noexcept = default;
+  explicit bitrank(bitspan<const nat> bits) : _bits(bits), _blocks((bits.words().size() + block - 1) / block + 1) {
+    const nat n = bits.words().size();
+    for (nat b = 0, total = 0; b + 1 < _blocks.size(); ++b) {
+      for (nat i = b * block; i < std::min(n, b * block + block); ++i) total += bitvector_impl::popcount(_word(i));
+      _blocks[b + 1] = total;
+      for (; _samples.size() * sample < total; _samples.push_back(b));
+    }
+  }
+
+  nat size() const noexcept { return _bits.size(); }
+  /// the ones in all
+  nat count() const noexcept { return _blocks.back(); }
+  /// the ones before bit `i`, for `i` up to `size()`
+  nat rank(nat i) const noexcept {
+    const nat* w = _bits.words().data();
+    nat r = _blocks[i / 64 / block];
+    for (nat k = i / 64 / block * block; k < i / 64; ++k) r += bitvector_impl::popcount(w[k]);
+    return i % 64 ? r + bitvector_impl::popcount(w[i / 64] & bitvector_impl::low(i % 64)) : r;
+  }
+  /// the index of the one of rank `k` (the first is 0), or `npos` if there are not so many
+  nat select(nat k) const noexcept {
+    if (k >= count()) return npos;
+    const nat s = k / sample, first = _samples[s], last = s + 1 < _samples.size() ? _samples[s + 1] + 1 : _blocks.size() - 1;
+    const nat b = nat(std::upper_bound(_blocks.begin() + first, _blocks.begin() + last, k) - _blocks.begin()) - 1;
+    k -= _blocks[b];
+    for (nat i = b * block;; ++i) {
+      const nat x = _word(i), c = bitvector_impl::popcount(x);
+      if (k < c) return i * 64 + bitvector_impl::select(x, k);
+      k -= c;
+    }
+  }
+};
+}
+
+export namespace yw { // half
+
+namespace half_impl {
+
+/// IEEE binary16 bits of `f`, rounded to nearest even, with overflow to infinity and NaN kept quiet
+inline unsigned short from_float(float f) noexcept {
+  const unsigned x = std::bit_cast<unsigned>(f), sign = x >> 16 & 0x8000;
+  unsigned a = x & 0x7fffffff;
+  if (a >= 0x7f800000) return (unsigned short)(sign | 0x7c00 | (a > 0x7f800000 ? 0x200 | (a >> 13 & 0x3ff) : 0));
+  // from 65520, halfway above the largest half 65504, everything rounds to infinity
+  if (a >= 0x477ff000) return (unsigned short)(sign | 0x7c00);
+  // below 2^-14 the result is subnormal: adding 0.5 rounds to a multiple of 2^-24 in the float unit
+  if (a < 0x38800000) return (unsigned short)(sign | (std::bit_cast<unsigned>(std::bit_cast<float>(a) + 0.5f) - 0x3f000000));
+  // rebias the exponent from 127 to 15 and round the 13 dropped bits to even
+  a += 0xc8000fff + (a >> 13 & 1);
+  return (unsigned short)(sign | a >> 13);
+}
+
+/// `float` of the binary16 bits `h`, exactly, with NaN made quiet as `vcvtph2ps` does
+inline float to_float(unsigned short h) noexcept {
+  const unsigned sign = unsigned(h & 0x8000) << 16, e = h >> 10 & 0x1f, m = h & 0x3ff;
+  if (e == 0x1f) return std::bit_cast<float>(sign | 0x7f800000 | m << 13 | (m ? 0x400000 : 0));
+  if (e == 0) return std::bit_cast<float>(sign | std::bit_cast<unsigned>(float(m) * 0x1p-24f));
+  return std::bit_cast<float>(sign | (e + 112) << 23 | m << 13);
+}
+
+/// the high 16 bits of `f`, rounded to nearest even, with NaN kept quiet
+inline unsigned short bfloat16_from_float(float f) noexcept {
+  const unsigned x = std::bit_cast<unsigned>(f);
+  if ((x & 0x7fffffff) > 0x7f800000) return (unsigned short)(x >> 16 | 0x40);
+  return (unsigned short)((x + 0x7fff + (x >> 16 & 1)) >> 16);
+}
+}
+
+/// IEEE binary16 (10-bit mantissa, 5-bit exponent, up to 65504) for storage, converted to and
+/// from `float` for arithmetic
+///
+/// A default-constructed value is left uninitialized, like `float`, so arrays of them cost
+/// nothing until written; `convert` moves whole arrays at a time.
+struct half {
+  unsigned short bits;
+  half() noexcept = default;
+  half(float f) noexcept : bits(half_impl::from_float(f)) {}
+  operator float() const noexcept { return half_impl::to_float(bits); }
+  static half from_bits(unsigned short b) noexcept { return std::bit_cast<half>(b); }
+};
+
+/// bfloat16 (the top half of a `float`: 7-bit mantissa, the full exponent range) for storage,
+/// converted to and from `float` for arithmetic
+struct bfloat16 {
+  unsigned short bits;
+  bfloat16() noexcept = default;
+  bfloat16(float f) noexcept : bits(half_impl::bfloat16_from_float(f)) {}
+  operator float() const noexcept { return std::bit_cast<float>(unsigned(bits) << 16); }
+  static bfloat16 from_bits(unsigned short b) noexcept { return std::bit_cast<bfloat16>(b); }
+};
+
+namespace half_impl {
+
+template<typename T> concept compact = std::same_as<T, half> || std::same_as<T, bfloat16>;
+
+/// whether the AVX2 kernels can load and store `T`: F16C converts `half`, plain AVX2 shifts `bfloat16`
+template<typename T> bool vectorized() noexcept { return cpu.avx2 && cpu.fma && (!std::same_as<T, half> || cpu.f16c); }
+
+/// eight values from `p` as floats
+template<typename T> __m256 load(const T* p) noexcept {
+  if constexpr (std::same_as<T, float>) return intrin::mm256_loadu_ps(p);
+  else {
+    const __m128i x = intrin::mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    if constexpr (std::same_as<T, half>) return intrin::mm256_cvtph_ps(x);
+    else return intrin::mm256_castsi256_ps(intrin::mm256_slli_epi32<16>(intrin::mm256_cvtepu16_epi32(x)));
+  }
+}
+
+/// `v` rounded to nearest even and stored as eight values at `p`
+template<typename T> void store(T* p, __m256 v) noexcept {
+  if constexpr (std::same_as<T, half>) intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(p), intrin::mm256_cvtps_ph<0>(v));
+  else {
+    const __m256i x = intrin::mm256_castps_si256(v), one = intrin::mm256_set1_epi32(1);
+    const __m256i lsb = intrin::mm256_and_si256(intrin::mm256_srli_epi32<16>(x), one);
+    const __m256i rounded = intrin::mm256_srli_epi32<16>(intrin::mm256_add_epi32(x, intrin::mm256_add_epi32(lsb, intrin::mm256_set1_epi32(0x7fff))));
+    const __m256i quiet = intrin::mm256_or_si256(intrin::mm256_srli_epi32<16>(x), intrin::mm256_set1_epi32(0x40));
+    // 3 is _CMP_UNORD_Q: NaNs keep their sign and payload and turn quiet instead of rounding to infinity
+    const __m256i r = intrin::mm256_blendv_epi8(rounded, quiet, intrin::mm256_castps_si256(intrin::mm256_cmp_ps<3>(v, v)));
+    // packus interleaves the 128-bit lanes of its operands, so the halves of `r` are packed with themselves and regathered
+    const __m256i packed = intrin::mm256_permute4x64_epi64<0x08>(intrin::mm256_packus_epi32(r, r));
+    intrin::mm_storeu_si128(reinterpret_cast<__m128i*>(p), intrin::mm256_castsi256_si128(packed));
+  }
+}
+
+template<typename From, typename To> void convert(std::span<const From> from, std::span<To> to) {
+  if (to.size() < from.size()) throw std::length_error("yw::convert: destination shorter than source");
+  const nat n = from.size();
+  nat i = 0;
+  if (vectorized<std::conditional_t<compact<From>, From, To>>()) {
+    for (; i + 8 <= n; i += 8)
+      if constexpr (compact<From>) intrin::mm256_storeu_ps(to.data() + i, load(from.data() + i));
+      else store(to.data() + i, load(from.data() + i));
+    intrin::mm256_zeroupper();
+  }
+  for (; i < n; ++i) to[i] = To(from[i]);
+}
+
+/// the sum of `x[i] * y[i]` in 32 running sums of `float`
+template<typename X, typename Y> float dot(std::span<const X> x, std::span<const Y> y) {
+  if (x.size() != y.size()) throw std::length_error("yw::dot: sizes differ");
+  const nat n = x.size();
+  nat i = 0;
+  float r = 0;
+  if (vectorized<X>() && vectorized<Y>()) {
+    const auto term = [&](nat j, __m256 s) { return intrin::mm256_fmadd_ps(load(x.data() + j), load(y.data() + j), s); };
+    __m256 s0 = intrin::mm256_setzero_ps(), s1 = s0, s2 = s0, s3 = s0;
+    for (; i + 32 <= n; i += 32) s0 = term(i, s0), s1 = term(i + 8, s1), s2 = term(i + 16, s2), s3 = term(i + 24, s3);
+    for (; i + 8 <= n; i += 8) s0 = term(i, s0);
+    r = dense_impl::simd<float>::hsum(intrin::mm256_add_ps(intrin::mm256_add_ps(s0, s1), intrin::mm256_add_ps(s2, s3)));
+    intrin::mm256_zeroupper();
+  }
+  for (; i < n; ++i) r += float(x[i]) * float(y[i]);
+  return r;
+}
+
+/// `y[i] += a * x[i]`
+template<typename X> void axpy(float a, std::span<const X> x, std::span<float> y) {
+  if (x.size() != y.size()) throw std::length_error("yw::axpy: sizes differ");
+  const nat n = x.size();
+  nat i = 0;
+  if (vectorized<X>()) {
+    const __m256 va = intrin::mm256_set1_ps(a);
+    for (; i + 8 <= n; i += 8) intrin::mm256_storeu_ps(y.data() + i, intrin::mm256_fmadd_ps(va, load(x.data() + i), intrin::mm256_loadu_ps(y.data() + i)));
+    intrin::mm256_zeroupper();
+  }
+  for (; i < n; ++i) y[i] += a * float(x[i]);
+}
+}
+
+/// converts `from` into the first `from.size()` elements of `to`, eight at a time with F16C for
+/// `half` and AVX2 for `bfloat16`; rounding to the compact formats is to nearest even
+inline void convert(std::span<const float> from, std::span<half> to) { half_impl::convert(from, to); }
+inline void convert(std::span<const float> from, std::span<bfloat16> to) { half_impl::convert(from, to); }
+inline void convert(std::span<const half> from, std::span<float> to) { half_impl::convert(from, to); }
+inline void convert(std::span<const bfloat16> from, std::span<float> to) { half_impl::convert(from, to); }
+
+/// the dot product of compact values with `float` or compact ones, widened as they are loaded, so
+/// that a product reads half the bytes of one in `float`; the sum is in 32 running sums of `float`
+inline float dot(std::span<const float> x, std::span<const float> y) { return half_impl::dot(x, y); }
+inline float dot(std::span<const half> x, std::span<const float> y) { return half_impl::dot(x, y); }
+inline float dot(std::span<const bfloat16> x, std::span<const float> y) { return half_impl::dot(x, y); }
+inline float dot(std::span<const half> x, std::span<const half> y) { return half_impl::dot(x, y); }
+inline float dot(std::span<const bfloat16> x, std::span<const bfloat16> y) { return half_impl::dot(x, y); }
+
+/// `y += a * x` for compact `x`, widened as it is loaded
+inline void axpy(float a, std::span<const half> x, std::span<float> y) { half_impl::axpy(a, x, y); }
+inline void axpy(float a, std::span<const bfloat16> x, std::span<float> y) { half_impl::axpy(a, x, y); }
+}
+
+export namespace yw { // memory
+
+/// how `memcpy_large` and `memset_large` move the bytes
+///
+/// - `library`: `std::memcpy` and `std::memset`, best below a few KiB;
+/// - `rep_movsb`: `rep movsb` and `rep stosb`, which fast-string microcode (ERMS) runs a line at a time;
+/// - `temporal`: AVX2 loads and stores through the caches, for data used again soon;
+/// - `streaming`: AVX2 non-temporal stores that bypass the caches, with the source prefetched
+///   ahead, so a copy larger than the last-level cache does not evict everything else;
+/// - `parallel`: `streaming` in parts on the threads of `scheduler::global()`, for copies that one
+///   core cannot saturate the memory bandwidth with;
+/// - `automatic`: by size, from the last-level cache size and the thread count.
+enum class copy_strategy { automatic, library, rep_movsb, temporal, streaming, parallel };
+
+namespace memory_impl {
+
+/// the largest data or unified cache, from CPUID leaf 4 (Intel) or 0x8000001d (AMD), 8 MiB if neither answers
+inline nat detect_llc() noexcept {
+  int r[4];
+  intrin::cpuid(r, 0x80000000);
+  const unsigned leaf = unsigned(r[0]) >= 0x8000001d ? 0x8000001d : 4;
+  nat best = 0;
+  for (int i = 0; i < 8; ++i) {
+    intrin::cpuidex(r, int(leaf), i);
+    if ((r[0] & 0x1f) == 0) break;
+    const nat ways = (unsigned(r[1]) >> 22) + 1, partitions = (unsigned(r[1]) >> 12 & 0x3ff) + 1, line = (unsigned(r[1]) & 0xfff) + 1, sets = unsigned(r[2]) + 1;
+    best = std::max(best, ways * partitions * line * sets);
+  }
+  return best ? best : nat(8) << 20;
+}
+inline const nat llc = detect_llc();
+
+/// below this the library functions win
+inline constexpr nat small = 4096;
+/// each thread of a parallel copy moves at least this much
+inline constexpr nat part = nat(8) << 20;
+
+inline copy_strategy choose(nat n) noexcept {
+  if (n < small) return copy_strategy::library;
+  // above half the LLC the destination would push the source out of it
+  if (n < llc / 2) return cpu.erms || !cpu.avx2 ? copy_strategy::rep_movsb : copy_strategy::temporal;
+  if (!cpu.avx2) return copy_strategy::rep_movsb;
+  return n >= 4 * part && scheduler::global().size() > 1 ? copy_strategy::parallel : copy_strategy::streaming;
+}
+
+/// `n` bytes from `s` to `d` in AVX2, 128 at a time to a destination aligned to 32 bytes
+template<bool Stream> void copy(char* d, const char* s, nat n) noexcept {
+  const nat head = std::min(n, (32 - nat(d) % 32) % 32);
+  std::memcpy(d, s, head), d += head, s += head, n -= head;
+  const auto load = [&](nat i) { return intrin::mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i)); };
+  nat i = 0;
+  for (; i + 128 <= n; i += 128) {
+    // 0 is _MM_HINT_NTA: the source comes into L1 without displacing the outer caches
+    if constexpr (Stream) intrin::mm_prefetch<0>(s + i + 1024);
+    const __m256i a = load(i), b = load(i + 32), c = load(i + 64), e = load(i + 96);
+    if constexpr (Stream) intrin::mm256_stream_si256(d + i, a), intrin::mm256_stream_si256(d + i + 32, b), intrin::mm256_stream_si256(d + i + 64, c), intrin::mm256_stream_si256(d + i + 96, e);
+    else {
+      intrin::mm256_store_si256(reinterpret_cast<__m256i*>(d + i), a), intrin::mm256_store_si256(reinterpret_cast<__m256i*>(d + i + 32), b);
+      intrin::mm256_store_si256(reinterpret_cast<__m256i*>(d + i + 64), c), intrin::mm256_store_si256(reinterpret_cast<__m256i*>(d + i + 96), e);
+    }
+  }
+  // non-temporal stores are weakly ordered: fence them before anything that publishes the data
+  if constexpr (Stream) intrin::mm_sfence();
+  intrin::mm256_zeroupper();
+  std::memcpy(d + i, s + i, n - i);
+}
+
+/// `n` bytes of `c` at `d` in AVX2, 128 at a time to a destination aligned to 32 bytes
+template<bool Stream> void fill(char* d, unsigned char c, nat n) noexcept {
+  const nat head = std::min(n, (32 - nat(d) % 32) % 32);
+  std::memset(d, c, head), d += head, n -= head;
+  const __m256i v = intrin::mm256_set1_epi8(char(c));
+  nat i = 0;
+  for (; i + 128 <= n; i += 128)
+    for (nat k = i; k < i + 128; k += 32)
+      if constexpr (Stream) intrin::mm256_stream_si256(d + k, v);
+      else intrin::mm256_store_si256(reinterpret_cast<__m256i*>(d + k), v);
+  if constexpr (Stream) intrin::mm_sfence();
+  intrin::mm256_zeroupper();
+  std::memset(d + i, c, n - i);
+}
+
+/// `f(begin, end)` on parts of `[0, n)` of at least `part` bytes that start on 4 KiB pages, on every thread
+template<typename F> void split(nat n, F&& f) {
+  auto& pool = scheduler::global();
+  const nat parts = std::max<nat>(1, std::min(n / part, 4 * pool.size())), size = (n / parts + 4095) / 4096 * 4096;
+  pool.parallel_for(0, parts, 1, [&](nat p) { f(std::min(n, p * size), p + 1 == parts ? n : std::min(n, (p + 1) * size)); });
+}
+}
+
+/// copies `n` bytes from `src` to `dst`, which must not overlap, with the strategy that suits `n`
+///
+/// Below 4 KiB this is `std::memcpy`; up to half the last-level cache `rep movsb` (or AVX2 where
+/// the CPU lacks ERMS), which leaves the copy in cache for what reads it next; beyond that AVX2
+/// non-temporal stores, split across the threads of `scheduler::global()` from 32 MiB.
+inline void memcpy_large(void* dst, const void* src, nat n, copy_strategy s = copy_strategy::automatic) {
+  char* d = static_cast<char*>(dst);
+  const char* p = static_cast<const char*>(src);
+  if (s == copy_strategy::automatic) s = memory_impl::choose(n);
+  if (!cpu.avx2 && (s == copy_strategy::temporal || s == copy_strategy::streaming || s == copy_strategy::parallel)) s = copy_strategy::rep_movsb;
+  switch (s) {
+  case copy_strategy::rep_movsb: return intrin::movsb(d, p, n);
+  case copy_strategy::temporal: return memory_impl::copy<false>(d, p, n);
+  case copy_strategy::streaming: return memory_impl::copy<true>(d, p, n);
+  case copy_strategy::parallel: return memory_impl::split(n, [&](nat a, nat b) { memory_impl::copy<true>(d + a, p + a, b - a); });
+  default: std::memcpy(d, p, n);
+  }
+}
+
+/// sets `n` bytes at `dst` to `c`, with the strategies and thresholds of `memcpy_large`
+inline void memset_large(void* dst, int c, nat n, copy_strategy s = copy_strategy::automatic) {
+  char* d = static_cast<char*>(dst);
+  const auto b = (unsigned char)c;
+  if (s == copy_strategy::automatic) s = memory_impl::choose(n);
+  if (!cpu.avx2 && (s == copy_strategy::temporal || s == copy_strategy::streaming || s == copy_strategy::parallel)) s = copy_strategy::rep_movsb;
+  switch (s) {
+  case copy_strategy::rep_movsb: return intrin::stosb(d, b, n);
+  case copy_strategy::temporal: return memory_impl::fill<false>(d, b, n);
+  case copy_strategy::streaming: return memory_impl::fill<true>(d, b, n);
+  case copy_strategy::parallel: return memory_impl::split(n, [&](nat x, nat y) { memory_impl::fill<true>(d + x, b, y - x); });
+  default: std::memset(d, b, n);
+  }
+}
+}
+
+export namespace yw { // vector
+
+/// point or direction in the plane
+template<typename T> struct vector2 {
+  using value_type = T;
+  static constexpr nat count = 2;
+  T x, y;
+  T& operator[](nat i) noexcept { return (&x)[i]; }
+  const T& operator[](nat i) const noexcept { return (&x)[i]; }
+  T* data() noexcept { return &x; }
+  const T* data() const noexcept { return &x; }
+  friend constexpr bool operator==(const vector2&, const vector2&) = default;
+  friend constexpr vector2 operator+(const vector2& a, const vector2& b) noexcept { return {a.x + b.x, a.y + b.y}; }
+  friend constexpr vector2 operator-(const vector2& a, const vector2& b) noexcept { return {a.x - b.x, a.y - b.y}; }
+  friend constexpr vector2 operator*(const vector2& a, T s) noexcept { return {a.x * s, a.y * s}; }
+};
+template<typename T> vector2(T, T) -> vector2<T>;
+
+/// point or direction in space
+template<typename T> struct vector3 {
+  using value_type = T;
+  static constexpr nat count = 3;
+  T x, y, z;
+  T& operator[](nat i) noexcept { return (&x)[i]; }
+  const T& operator[](nat i) const noexcept { return (&x)[i]; }
+  T* data() noexcept { return &x; }
+  const T* data() const noexcept { return &x; }
+  friend constexpr bool operator==(const vector3&, const vector3&) = default;
+  friend constexpr vector3 operator+(const vector3& a, const vector3& b) noexcept { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+  friend constexpr vector3 operator-(const vector3& a, const vector3& b) noexcept { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+  friend constexpr vector3 operator*(const vector3& a, T s) noexcept { return {a.x * s, a.y * s, a.z * s}; }
+};
+template<typename T> vector3(T, T, T) -> vector3<T>;
+}
+
+export namespace yw { // spatial
+
+namespace spatial_impl {
+
+template<typename P> concept point = (std::same_as<P, vector2<float>> || std::same_as<P, vector2<double>> ||
+                                      std::same_as<P, vector3<float>> || std::same_as<P, vector3<double>>);
+}
+
+namespace spatial {
+
+/// axis-aligned box, `lo` and `hi` included
+template<spatial_impl::point P> struct box {
+  P lo, hi;
+  bool contains(const P& p) const noexcept {
+    for (nat d = 0; d < P::count; ++d)
+      if (p[d] < lo[d] || hi[d] < p[d]) return false;
+    return true;
+  }
+};
+
+/// squared distance, rounded exactly as the queries of `bvh` and `grid` round it
+template<spatial_impl::point P> typename P::value_type distance2(const P& a, const P& b) noexcept {
+  typename P::value_type s = 0;
+  for (nat d = 0; d < P::count; ++d) s = std::fma(a[d] - b[d], a[d] - b[d], s);
+  return s;
+}
+}
+
+namespace spatial_impl {
+
+template<typename P> using box = spatial::box<P>;
+
+/// `W` children of a wide BVH node: their boxes in lanes, and for each a node or a leaf of `count[i]` points from `child[i]`
+template<typename T, nat D> struct node {
+  static constexpr nat W = dense_impl::simd<T>::lanes;
+  T lo[D][W], hi[D][W];
+  unsigned child[W];
+  unsigned char count[W];
+  unsigned char used;
+};
+
+/// the points of a `bvh` or a bucket of a `grid`, a coordinate per array with `W` values of padding
+template<typename T, nat D> using coordinates = std::array<std::vector<T>, D>;
+
+/// squared distances from `q` to the child boxes of `n` into `d2`; bit `i` set for used children within `limit`
+template<typename T, nat D> int boxes_within(const node<T, D>& n, const T* q, T limit, T* d2) noexcept {
+  using S = dense_impl::simd<T>;
+  if (cpu.avx2 && cpu.fma) {
+    auto s = S::zero();
+    for (nat d = 0; d < D; ++d) {
+      const auto x = S::set1(q[d]);
+      const auto t = S::max(S::max(S::sub(S::load(n.lo[d]), x), S::sub(x, S::load(n.hi[d]))), S::zero());
+      s = S::fmadd(t, t, s);
+    }
+    S::store(d2, s);
+    return S::le(s, S::set1(limit)) & n.used;
+  }
+  int m = 0;
+  for (nat i = 0; i < S::lanes; ++i) {
+    T s = 0;
+    for (nat d = 0; d < D; ++d) {
+      const T t = std::max({n.lo[d][i] - q[d], q[d] - n.hi[d][i], T(0)});
+      s = std::fma(t, t, s);
+    }
+    d2[i] = s, m |= int(s <= limit) << i;
+  }
+  return m & n.used;
+}
+
+/// bit `i` set for used children of `n` whose boxes meet `[lo, hi]`
+template<typename T, nat D> int boxes_meet(const node<T, D>& n, const T* lo, const T* hi) noexcept {
+  using S = dense_impl::simd<T>;
+  int m = n.used;
+  if (cpu.avx2)
+    for (nat d = 0; d < D; ++d) m &= S::le(S::load(n.lo[d]), S::set1(hi[d])) & S::le(S::set1(lo[d]), S::load(n.hi[d]));
+  else
+    for (nat i = 0; i < S::lanes; ++i)
+      for (nat d = 0; d < D; ++d)
+        if (!(n.lo[d][i] <= hi[d] && lo[d] <= n.hi[d][i])) m &= ~(1 << i);
+  return m;
+}
+
+/// squared distances from `q` to the `k` (at most `W`) points of `c` from `first` into `d2`; bit `i` set within `limit`
+template<typename T, nat D> int points_within(const coordinates<T, D>& c, nat first, nat k, const T* q, T limit, T* d2) noexcept {
+  using S = dense_impl::simd<T>;
+  if (cpu.avx2 && cpu.fma) {
+    auto s = S::zero();
+    for (nat d = 0; d < D; ++d) {
+      const auto t = S::sub(S::load(c[d].data() + first), S::set1(q[d]));
+      s = S::fmadd(t, t, s);
+    }
+    S::store(d2, s);
+    return S::le(s, S::set1(limit)) & int((1u << k) - 1);
+  }
+  int m = 0;
+  for (nat i = 0; i < k; ++i) {
+    T s = 0;
+    for (nat d = 0; d < D; ++d) s = std::fma(c[d][first + i] - q[d], c[d][first + i] - q[d], s);
+    d2[i] = s, m |= int(s <= limit) << i;
+  }
+  return m;
+}
+
+/// bit `i` set for the points of `c` from `first`, `k` of them, inside `[lo, hi]`
+template<typename T, nat D> int points_inside(const coordinates<T, D>& c, nat first, nat k, const T* lo, const T* hi) noexcept {
+  using S = dense_impl::simd<T>;
+  int m = int((1u << k) - 1);
+  if (cpu.avx2)
+    for (nat d = 0; d < D; ++d) {
+      const auto x = S::load(c[d].data() + first);
+      m &= S::le(S::set1(lo[d]), x) & S::le(x, S::set1(hi[d]));
+    }
+  else
+    for (nat i = 0; i < k; ++i)
+      for (nat d = 0; d < D; ++d)
+        if (!(lo[d] <= c[d][first + i] && c[d][first + i] <= hi[d])) m &= ~(1 << i);
+  return m;
+}
+
+/// traversal stack, on the stack of the caller up to 64 entries
+template<typename E> class stack {
+  E _inline[64];
+  std::vector<E> _more;
+  nat _size = 0;
+public:
+  bool empty() const noexcept { return _size == 0; }
+  nat size() const noexcept { return _size; }
+  E& operator[](nat i) noexcept { return i < 64 ? _inline[i] : _more[i - 64]; }
+  void push(const E& e) {
+    if (_size < 64) _inline[_size] = e;
+    else _more.push_back(e);
+    ++_size;
+  }
+  E pop() noexcept {
+    if (--_size < 64) return _inline[_size];
+    const E e = _more.back();
+    _more.pop_back();
+    return e;
+  }
+};
+
+template<typename P> box<P> empty_box() noexcept {
+  box<P> b;
+  for (nat d = 0; d < P::count; ++d) b.lo[d] = std::numeric_limits<typename P::value_type>::infinity(), b.hi[d] = -b.lo[d];
+  return b;
+}
+template<typename P> void grow(box<P>& b, const P& p) noexcept {
+  for (nat d = 0; d < P::count; ++d) b.lo[d] = std::min(b.lo[d], p[d]), b.hi[d] = std::max(b.hi[d], p[d]);
+}
+template<typename P> void grow(box<P>& b, const box<P>& c) noexcept { grow(b, c.lo), grow(b, c.hi); }
+
+/// half the surface area, or the perimeter in the plane: the SAH cost of a box
+template<typename P> typename P::value_type half_area(const box<P>& b) noexcept {
+  if (b.lo[0] > b.hi[0]) return 0;
+  const auto x = b.hi[0] - b.lo[0], y = b.hi[1] - b.lo[1];
+  if constexpr (P::count == 2) return x + y;
+  else {
+    const auto z = b.hi[2] - b.lo[2];
+    return x * y + y * z + z * x;
+  }
+}
+
+/// the bounds of `points`, in parallel
+template<typename P> box<P> bounds(std::span<const P> points) {
+  constexpr nat chunk = nat(1) << 16;
+  std::vector<box<P>> parts((points.size() + chunk - 1) / chunk, empty_box<P>());
+  scheduler::global().parallel_for(0, parts.size(), 1, [&](nat i) {
+    for (nat j = i * chunk; j < std::min(points.size(), (i + 1) * chunk); ++j) grow(parts[i], points[j]);
+  });
+  box<P> b = empty_box<P>();
+  for (const auto& p : parts) grow(b, p);
+  return b;
+}
+
+/// the order of `queries` along a Morton curve over `b`, in which a batch of queries finds the
+/// nodes or buckets of the one before in cache
+template<typename P> std::vector<unsigned> morton_order(std::span<const P> queries, const box<P>& b) {
+  constexpr nat D = P::count, bits = 64 / D;
+  // spreads the low `bits` bits of `x` to every `D`th bit
+  const auto spread = [](nat x) {
+    if constexpr (D == 2) {
+      x &= 0xffffffff;
+      x = (x | x << 16) & 0x0000ffff0000ffff, x = (x | x << 8) & 0x00ff00ff00ff00ff, x = (x | x << 4) & 0x0f0f0f0f0f0f0f0f;
+      return (x = (x | x << 2) & 0x3333333333333333, (x | x << 1) & 0x5555555555555555);
+    } else {
+      x &= 0x1fffff;
+      x = (x | x << 32) & 0x1f00000000ffff, x = (x | x << 16) & 0x1f0000ff0000ff, x = (x | x << 8) & 0x100f00f00f00f00f;
+      return (x = (x | x << 4) & 0x10c30c30c30c30c3, (x | x << 2) & 0x1249249249249249);
+    }
+  };
+  std::vector<std::pair<nat, unsigned>> keys(queries.size());
+  scheduler::global().parallel_for(0, queries.size(), nat(1) << 12, [&](nat i) {
+    nat key = 0;
+    for (nat d = 0; d < D; ++d) {
+      const double extent = double(b.hi[d]) - double(b.lo[d]), x = extent > 0 ? (double(queries[i][d]) - double(b.lo[d])) / extent : 0;
+      key |= spread(nat(std::clamp(x, 0.0, 1.0) * double((nat(1) << bits) - 1))) << d;
+    }
+    keys[i] = {key, unsigned(i)};
+  });
+  std::ranges::sort(keys);
+  std::vector<unsigned> order(keys.size());
+  for (nat i = 0; i < keys.size(); ++i) order[i] = keys[i].second;
+  return order;
+}
+
+template<typename P> struct item {
+  P p;
+  unsigned index;
+};
+
+/// points `[first, last)` of the items being built and their bounds
+template<typename P> struct piece {
+  nat first, last;
+  box<P> b;
+  nat size() const noexcept { return last - first; }
+};
+
+/// splits `r` in two: by the binned surface area heuristic over 16 bins along its longest axis, or
+/// at the median of that axis if this leaves less than a sixteenth on one side, which keeps the
+/// depth logarithmic on skewed inputs (parallel binning from 2^18 points)
+template<typename P> std::pair<piece<P>, piece<P>> split(std::span<item<P>> items, const piece<P>& r) {
+  using T = typename P::value_type;
+  constexpr nat D = P::count, bins = 16;
+  nat axis = 0;
+  for (nat d = 1; d < D; ++d)
+    if (r.b.hi[d] - r.b.lo[d] > r.b.hi[axis] - r.b.lo[axis]) axis = d;
+  const T lo = r.b.lo[axis], scale = r.b.hi[axis] > lo ? T(bins) / (r.b.hi[axis] - lo) : 0;
+  const auto bin = [&](const P& p) { return std::min(bins - 1, nat((p[axis] - lo) * scale)); };
+  struct binning {
+    box<P> b[bins];
+    nat n[bins]{};
+  };
+  const auto fill = [&](binning& g, nat first, nat last) {
+    std::ranges::fill(g.b, empty_box<P>());
+    for (nat i = first; i < last; ++i) {
+      const nat k = bin(items[i].p);
+      ++g.n[k], grow(g.b[k], items[i].p);
+    }
+  };
+  // the cheapest plane, ties going to the more even split (which matters for collinear points, whose areas are all 0)
+  struct choice {
+    T cost = std::numeric_limits<T>::infinity();
+    nat skew = npos, bin = 0, left = 0;
+    box<P> l{}, r{};
+  } best;
+  if (scale != 0) {
+    binning g;
+    constexpr nat chunk = nat(1) << 16;
+    if (r.size() < nat(1) << 18) fill(g, r.first, r.last);
+    else {
+      std::vector<binning> parts((r.size() + chunk - 1) / chunk);
+      scheduler::global().parallel_for(0, parts.size(), 1, [&](nat i) { fill(parts[i], r.first + i * chunk, std::min(r.last, r.first + (i + 1) * chunk)); });
+      fill(g, 0, 0);
+      for (const auto& p : parts)
+        for (nat k = 0; k < bins; ++k) g.n[k] += p.n[k], grow(g.b[k], p.b[k]);
+    }
+    box<P> right[bins];
+    nat after[bins];
+    right[bins - 1] = g.b[bins - 1], after[bins - 1] = g.n[bins - 1];
+    for (nat k = bins - 1; k-- > 0;) right[k] = right[k + 1], grow(right[k], g.b[k]), after[k] = after[k + 1] + g.n[k];
+    box<P> left = empty_box<P>();
+    nat before = 0;
+    for (nat k = 0; k + 1 < bins; ++k) {
+      grow(left, g.b[k]), before += g.n[k];
+      if (before == 0 || after[k + 1] == 0) continue;
+      const T cost = half_area(left) * T(before) + half_area(right[k + 1]) * T(after[k + 1]);
+      const nat skew = before > after[k + 1] ? before - after[k + 1] : after[k + 1] - before;
+      if (cost < best.cost || (cost == best.cost && skew < best.skew)) best = {cost, skew, k, before, left, right[k + 1]};
+    }
+  }
+  if (best.skew != npos && std::min(best.left, r.size() - best.left) >= r.size() / 16) {
+    std::partition(items.begin() + r.first, items.begin() + r.last, [&](const item<P>& e) { return bin(e.p) <= best.bin; });
+    const nat mid = r.first + best.left;
+    return {{r.first, mid, best.l}, {mid, r.last, best.r}};
+  }
+  const nat mid = r.first + r.size() / 2;
+  std::nth_element(items.begin() + r.first, items.begin() + mid, items.begin() + r.last, [&](const item<P>& a, const item<P>& b) { return a.p[axis] < b.p[axis]; });
+  piece<P> a{r.first, mid, empty_box<P>()}, b{mid, r.last, empty_box<P>()};
+  for (nat i = a.first; i < a.last; ++i) grow(a.b, items[i].p);
+  for (nat i = b.first; i < b.last; ++i) grow(b.b, items[i].p);
+  return {a, b};
+}
+
+/// a piece left for later below node `parent`, in child slot `slot`
+template<typename P> struct pending {
+  piece<P> r;
+  nat parent, slot;
+};
+
+/// builds the node of `r` and the nodes below it into `nodes` and returns its index; with `later`,
+/// pieces of at most `cutoff` points are left there instead
+///
+/// A node takes up to `W` pieces: `r` is split, then the piece with the largest area of those with
+/// more than `W` points, and so on. Pieces of at most `W` points become leaves.
+template<typename P> unsigned build(std::span<item<P>> items, const piece<P>& r, std::vector<node<typename P::value_type, P::count>>& nodes, nat cutoff, std::vector<pending<P>>* later) {
+  using N = node<typename P::value_type, P::count>;
+  constexpr nat W = N::W;
+  piece<P> pieces[W] = {r};
+  nat k = 1;
+  while (k < W) {
+    nat pick = npos;
+    for (nat i = 0; i < k; ++i)
+      if (pieces[i].size() > W && (pick == npos || std::pair(half_area(pieces[i].b), pieces[i].size()) > std::pair(half_area(pieces[pick].b), pieces[pick].size()))) pick = i;
+    if (pick == npos) break;
+    std::tie(pieces[pick], pieces[k]) = split(items, pieces[pick]);
+    ++k;
+  }
+  const auto id = unsigned(nodes.size());
+  N& n = nodes.emplace_back();
+  for (nat i = 0; i < k; ++i) {
+    for (nat d = 0; d < P::count; ++d) n.lo[d][i] = pieces[i].b.lo[d], n.hi[d][i] = pieces[i].b.hi[d];
+    if (pieces[i].size() <= W) n.child[i] = unsigned(pieces[i].first), n.count[i] = (unsigned char)pieces[i].size();
+    n.used |= (unsigned char)(1 << i);
+  }
+  for (nat i = 0; i < k; ++i) {
+    if (pieces[i].size() <= W) continue;
+    if (later && pieces[i].size() <= cutoff) later->push_back({pieces[i], id, i});
+    else {
+      const unsigned c = build(items, pieces[i], nodes, cutoff, later);
+      nodes[id].child[i] = c;
+    }
+  }
+  return id;
+}
+}
+
+namespace spatial {
+
+/// bounding volume hierarchy over points, for nearest-neighbour, radius and box queries
+///
+/// Nodes are `W` wide, `W` being the lanes of an AVX register of `T` (8 for `float`, 4 for
+/// `double`), so that one node test compares a query with all children at once; leaves hold up
+/// to `W` points, tested the same way. It is built top-down with the binned surface area
+/// heuristic, the top levels on the calling thread and the subtrees below them in parallel,
+/// into the same tree whatever the thread count. The points are copied, so the span can go.
+///
+/// Results are reported by index into the points given. Distances are `distance2`, and ties
+/// between equally distant points go to the lower index, so every query is exactly reproducible
+/// by brute force.
+template<spatial_impl::point P> class bvh {
+  using T = typename P::value_type;
+  static constexpr nat D = P::count;
+  using N = spatial_impl::node<T, D>;
+  static constexpr nat W = N::W;
+  struct entry {
+    T d2;
+    unsigned child, count;
+  };
+  std::vector<N> _nodes;
+  spatial_impl::coordinates<T, D> _coords;
+  std::vector<unsigned> _index;
+  box<P> _bounds = spatial_impl::empty_box<P>();
+public:
+  bvh() noexcept = default;
+
+  /// builds the tree over `points`; throws `std::length_error` from 2^32 points
+  explicit bvh(std::span<const P> points) {
+    using namespace spatial_impl;
+    const nat n = points.size();
+    if (n >> 32) throw std::length_error("yw::spatial::bvh: 2^32 points or more");
+    if (n == 0) return;
+    auto& pool = scheduler::global();
+    std::vector<item<P>> items(n);
+    pool.parallel_for(0, n, nat(1) << 14, [&](nat i) { items[i] = {points[i], unsigned(i)}; });
+    _bounds = spatial_impl::bounds(points);
+    // the top down to pieces a worker's share can balance, then the subtrees below them in parallel
+    std::vector<pending<P>> later;
+    build<P>(items, {0, n, _bounds}, _nodes, std::max(nat(1) << 12, n / (8 * pool.size())), &later);
+    std::vector<std::vector<N>> parts(later.size());
+    pool.parallel_for(0, later.size(), 1, [&](nat i) { build<P>(items, later[i].r, parts[i], 0, nullptr); });
+    std::vector<nat> base(later.size() + 1, _nodes.size());
+    for (nat i = 0; i < later.size(); ++i) base[i + 1] = base[i] + parts[i].size();
+    _nodes.resize(base.back());
+    pool.parallel_for(0, later.size(), 1, [&](nat i) {
+      for (nat j = 0; j < parts[i].size(); ++j) {
+        N& m = _nodes[base[i] + j] = parts[i][j];
+        for (nat c = 0; c < W; ++c)
+          if (m.used >> c & 1 && m.count[c] == 0) m.child[c] += unsigned(base[i]);
+      }
+      _nodes[later[i].parent].child[later[i].slot] = unsigned(base[i]);
+      std::vector<N>().swap(parts[i]);
+    });
+    // the points in leaf order, padded for the loads of the last leaf
+    for (auto& c : _coords) c.resize(n + W);
+    _index.resize(n);
+    pool.parallel_for(0, n, nat(1) << 14, [&](nat i) {
+      for (nat d = 0; d < D; ++d) _coords[d][i] = items[i].p[d];
+      _index[i] = items[i].index;
+    });
+  }
+
+  nat size() const noexcept { return _index.size(); }
+  bool empty() const noexcept { return _index.empty(); }
+  /// the bounds of the points
+  const box<P>& bounds() const noexcept { return _bounds; }
+  /// number of nodes, each of up to `W` children
+  nat nodes() const noexcept { return _nodes.size(); }
+
+  /// the indices of the `out.size()` points nearest to `q` (or of all, if fewer), nearest first; returns how many
+  nat nearest(const P& q, std::span<nat> out) const {
+    using namespace spatial_impl;
+    const nat k = std::min(out.size(), size());
+    if (k == 0) return 0;
+    // a max-heap of (squared distance, index), the worst of the best `k` on top
+    thread_local std::vector<std::pair<T, nat>> heap;
+    heap.clear();
+    const auto worst = [&] { return heap.size() < k ? std::numeric_limits<T>::infinity() : heap.front().first; };
+    stack<entry> todo;
+    todo.push({0, 0, 0});
+    alignas(32) T d2[W];
+    while (!todo.empty()) {
+      const entry e = todo.pop();
+      if (e.d2 > worst()) continue;
+      if (e.count) {
+        for (int m = points_within(_coords, e.child, e.count, q.data(), worst(), d2); m; m &= m - 1) {
+          const nat i = nat(std::countr_zero(unsigned(m)));
+          const std::pair<T, nat> h{d2[i], _index[e.child + i]};
+          if (heap.size() < k) heap.push_back(h), std::push_heap(heap.begin(), heap.end());
+          else if (h < heap.front()) std::pop_heap(heap.begin(), heap.end()), heap.back() = h, std::push_heap(heap.begin(), heap.end());
+        }
+        continue;
+      }
+      const N& n = _nodes[e.child];
+      const nat first = todo.size();
+      for (int m = boxes_within(n, q.data(), worst(), d2); m; m &= m - 1) {
+        const nat i = nat(std::countr_zero(unsigned(m)));
+        todo.push({d2[i], n.child[i], n.count[i]});
+      }
+      // the nearest child last, so that it is taken first
+      for (nat i = first + 1; i < todo.size(); ++i)
+        for (nat j = i; j > first && todo[j - 1].d2 < todo[j].d2; --j) std::swap(todo[j - 1], todo[j]);
+    }
+    if (cpu.avx2) intrin::mm256_zeroupper();
+    std::sort_heap(heap.begin(), heap.end());
+    for (nat i = 0; i < heap.size(); ++i) out[i] = heap[i].second;
+    return heap.size();
+  }
+  /// the index of the point nearest to `q`, or `npos` if there are none
+  nat nearest(const P& q) const {
+    nat i = npos;
+    nearest(q, std::span(&i, 1));
+    return i;
+  }
+  /// `out[i] = nearest(queries[i])`, in parallel and in the order of a Morton curve
+  void nearest(std::span<const P> queries, std::span<nat> out) const {
+    const auto order = spatial_impl::morton_order(queries, _bounds);
+    scheduler::global().parallel_for(0, queries.size(), 256, [&](nat k) { out[order[k]] = nearest(queries[order[k]]); });
+  }
+
+  /// calls `f(i)` for the index `i` of every point within `r` of `q`
+  template<typename F> void within(const P& q, T r, F&& f) const {
+    using namespace spatial_impl;
+    if (empty()) return;
+    stack<entry> todo;
+    todo.push({0, 0, 0});
+    alignas(32) T d2[W];
+    while (!todo.empty()) {
+      const entry e = todo.pop();
+      const int m = e.count ? points_within(_coords, e.child, e.count, q.data(), r * r, d2) : boxes_within(_nodes[e.child], q.data(), r * r, d2);
+      for (int b = m; b; b &= b - 1) {
+        const nat i = nat(std::countr_zero(unsigned(b)));
+        if (e.count) f(nat(_index[e.child + i]));
+        else todo.push({0, _nodes[e.child].child[i], _nodes[e.child].count[i]});
+      }
+    }
+    if (cpu.avx2) intrin::mm256_zeroupper();
+  }
+  /// the number of points within `r` of `q`
+  nat count_within(const P& q, T r) const {
+    nat c = 0;
+    within(q, r, [&](nat) { ++c; });
+    return c;
+  }
+  /// `out[i] = count_within(queries[i], r)`, in parallel and in the order of a Morton curve
+  void count_within(std::span<const P> queries, T r, std::span<nat> out) const {
+    const auto order = spatial_impl::morton_order(queries, _bounds);
+    scheduler::global().parallel_for(0, queries.size(), 256, [&](nat k) { out[order[k]] = count_within(queries[order[k]], r); });
+  }
+
+  /// calls `f(i)` for the index `i` of every point in `b`
+  template<typename F> void inside(const box<P>& b, F&& f) const {
+    using namespace spatial_impl;
+    if (empty()) return;
+    stack<entry> todo;
+    todo.push({0, 0, 0});
+    while (!todo.empty()) {
+      const entry e = todo.pop();
+      const int m = e.count ? points_inside(_coords, e.child, e.count, b.lo.data(), b.hi.data()) : boxes_meet(_nodes[e.child], b.lo.data(), b.hi.data());
+      for (int k = m; k; k &= k - 1) {
+        const nat i = nat(std::countr_zero(unsigned(k)));
+        if (e.count) f(nat(_index[e.child + i]));
+        else todo.push({0, _nodes[e.child].child[i], _nodes[e.child].count[i]});
+      }
+    }
+    if (cpu.avx2) intrin::mm256_zeroupper();
+  }
+  /// the number of points in `b`
+  nat count_inside(const box<P>& b) const {
+    nat c = 0;
+    inside(b, [&](nat) { ++c; });
+    return c;
+  }
+};
+
+/// uniform grid over points, hashed into about one bucket per two points, for radius, box and
+/// nearest-neighbour queries on evenly spread points
+///
+/// Cells are `cell` wide (by default about two points each, from the bounds); cells hash into
+/// buckets, whose points are kept together, a coordinate per array, and compared with a query
+/// `W` at a time. A bucket that several cells of a radius or box query hash into is scanned once. `nearest`
+/// searches the shells of growing blocks of cells around the query until no unseen cell can
+/// hold a nearer point.
+/// Construction (hashing, counting and scattering the points) runs on `scheduler::global()`.
+///
+/// Results are reported by index into the points given, with the same distances and ties as `bvh`.
+template<spatial_impl::point P> class grid {
+  using T = typename P::value_type;
+  static constexpr nat D = P::count, W = dense_impl::simd<T>::lanes;
+  using cell_t = std::array<long long, D>;
+  box<P> _bounds = spatial_impl::empty_box<P>();
+  double _origin[D]{}, _inverse = 1;
+  T _cell = 1;
+  long long _cells[D]{};
+  nat _mask = 0;
+  std::vector<unsigned> _start, _index;
+  spatial_impl::coordinates<T, D> _coords;
+
+  /// the cell of coordinate `x` along axis `d`, in `double` so that it stays exact for fine grids of
+  /// `float`s; clamped to one cell past either end (NaN to the one before), so that huge and
+  /// infinite coordinates are safe
+  long long _cell_of(double x, nat d) const noexcept {
+    const double c = std::floor((x - _origin[d]) * _inverse);
+    return c >= double(_cells[d]) ? _cells[d] : c >= 0 ? (long long)c : -1;
+  }
+  nat _bucket(const cell_t& c) const noexcept {
+    nat h = 0;
+    for (nat d = 0; d < D; ++d) h = (h + nat(c[d])) * 0x9e3779b97f4a7c15;
+    return (h ^ h >> 29) & _mask;
+  }
+  /// calls `f(bucket)` once for every bucket of the cells from `a` to `b`, clipped to the bounds
+  template<typename F> void _buckets(cell_t a, cell_t b, F&& f) const {
+    nat cells = 1;
+    for (nat d = 0; d < D; ++d) {
+      a[d] = std::max(a[d], 0ll), b[d] = std::min(b[d], _cells[d] - 1);
+      if (a[d] > b[d]) return;
+      const nat side = nat(b[d] - a[d] + 1);
+      cells = side > _mask ? _mask + 1 : std::min(cells * side, _mask + 1);
+    }
+    if (cells > _mask) {
+      for (nat k = 0; k <= _mask; ++k) f(k);
+      return;
+    }
+    nat small[64], n = 0;
+    std::vector<nat> many;
+    for (cell_t c = a;;) {
+      const nat k = _bucket(c);
+      if (cells > 64) many.push_back(k);
+      else if (std::find(small, small + n, k) == small + n) small[n++] = k;
+      nat d = 0;
+      for (; d < D && c[d] == b[d]; ++d) c[d] = a[d];
+      if (d == D) break;
+      ++c[d];
+    }
+    if (cells > 64) {
+      std::ranges::sort(many);
+      many.erase(std::unique(many.begin(), many.end()), many.end());
+      for (const nat k : many) f(k);
+    } else
+      for (nat i = 0; i < n; ++i) f(small[i]);
+  }
+  /// calls `f(j, d2)` for the points `j` of bucket `k` within squared distance `limit` of `q`
+  template<typename F> void _scan(nat k, const P& q, T limit, F&& f) const {
+    alignas(32) T d2[W];
+    for (nat j = _start[k]; j < _start[k + 1]; j += W)
+      for (int m = spatial_impl::points_within(_coords, j, std::min<nat>(W, _start[k + 1] - j), q.data(), limit, d2); m; m &= m - 1) {
+        const nat i = nat(std::countr_zero(unsigned(m)));
+        f(j + i, d2[i]);
+      }
+  }
+public:
+  grid() noexcept = default;
+
+  /// hashes `points` into cells `cell` wide, or about two points to a cell if `cell` is 0; throws
+  /// `std::length_error` from 2^32 points
+  explicit grid(std::span<const P> points, T cell = 0) {
+    using namespace spatial_impl;
+    const nat n = points.size();
+    if (n >> 32) throw std::length_error("yw::spatial::grid: 2^32 points or more");
+    auto& pool = scheduler::global();
+    _bounds = spatial_impl::bounds(points);
+    if (n) {
+      T widest = 0;
+      for (nat d = 0; d < D; ++d) widest = std::max(widest, _bounds.hi[d] - _bounds.lo[d]);
+      if (!(cell > 0) && widest > 0) {
+        // the cells of a box with thin sides clamped to a thousandth of the widest, at two points each
+        double volume = 1;
+        for (nat d = 0; d < D; ++d) volume *= std::max<double>(_bounds.hi[d] - _bounds.lo[d], widest / 1000.0);
+        cell = T(std::pow(2 * volume / double(n), 1.0 / D));
+      }
+      _cell = cell > 0 ? cell : 1, _inverse = 1 / double(_cell);
+      for (nat d = 0; d < D; ++d)
+        _origin[d] = _bounds.lo[d], _cells[d] = (long long)std::min(std::floor((double(_bounds.hi[d]) - _origin[d]) * _inverse), 0x1p52) + 1;
+    }
+    _mask = std::bit_ceil(std::max<nat>(n / 2, 1)) - 1;
+    // a counting sort by bucket, with each bucket in the order of the points so that the result does not depend on the threads
+    std::vector<unsigned> key(n);
+    _start.assign(_mask + 2, 0);
+    pool.parallel_for(0, n, nat(1) << 14, [&](nat i) {
+      cell_t c;
+      for (nat d = 0; d < D; ++d) c[d] = _cell_of(points[i][d], d);
+      key[i] = unsigned(_bucket(c));
+      std::atomic_ref(_start[key[i] + 1]).fetch_add(1, std::memory_order_relaxed);
+    });
+    std::partial_sum(_start.begin(), _start.end(), _start.begin());
+    std::vector<unsigned> next(_start.begin(), _start.end() - 1);
+    _index.resize(n);
+    pool.parallel_for(0, n, nat(1) << 14, [&](nat i) { _index[std::atomic_ref(next[key[i]]).fetch_add(1, std::memory_order_relaxed)] = unsigned(i); });
+    pool.parallel_for(0, _mask + 1, nat(1) << 12, [&](nat k) { std::sort(_index.begin() + _start[k], _index.begin() + _start[k + 1]); });
+    for (auto& c : _coords) c.resize(n + W);
+    pool.parallel_for(0, n, nat(1) << 14, [&](nat j) {
+      for (nat d = 0; d < D; ++d) _coords[d][j] = points[_index[j]][d];
+    });
+  }
+
+  nat size() const noexcept { return _index.size(); }
+  bool empty() const noexcept { return _index.empty(); }
+  /// the bounds of the points
+  const box<P>& bounds() const noexcept { return _bounds; }
+  /// the width of a cell
+  T cell() const noexcept { return _cell; }
+
+  /// the indices of the `out.size()` points nearest to `q` (or of all, if fewer), nearest first; returns how many
+  nat nearest(const P& q, std::span<nat> out) const {
+    const nat k = std::min(out.size(), size());
+    if (k == 0) return 0;
+    for (nat d = 0; d < D; ++d)
+      if (std::isnan(q[d])) return 0;
+    // a max-heap of (squared distance, index), the worst of the best `k` on top
+    thread_local std::vector<std::pair<T, nat>> heap;
+    heap.clear();
+    const auto worst = [&] { return heap.size() < k ? std::numeric_limits<T>::infinity() : heap.front().first; };
+    // a bucket that several cells hash into is scanned for each, so points already kept are skipped
+    const auto visit = [&](const cell_t& e) {
+      _scan(_bucket(e), q, worst(), [&](nat j, T d2) {
+        const std::pair<T, nat> h{d2, _index[j]};
+        if (std::ranges::find(heap, h) != heap.end()) return;
+        if (heap.size() < k) heap.push_back(h), std::push_heap(heap.begin(), heap.end());
+        else if (h < heap.front()) std::pop_heap(heap.begin(), heap.end()), heap.back() = h, std::push_heap(heap.begin(), heap.end());
+      });
+    };
+    // rings of cells around the cell of `q` clamped to the bounds, each visited as its shell only:
+    // whole rows along axis 0 where another axis is at the ring, and the two ends of the others
+    cell_t c;
+    for (nat d = 0; d < D; ++d) c[d] = std::clamp(_cell_of(q[d], d), 0ll, _cells[d] - 1);
+    for (long long r = 0;; ++r) {
+      cell_t a, b;
+      for (nat d = 0; d < D; ++d) a[d] = std::max(c[d] - r, 0ll), b[d] = std::min(c[d] + r, _cells[d] - 1);
+      for (cell_t e = a;;) {
+        bool row = false;
+        for (nat d = 1; d < D; ++d) row |= std::abs(e[d] - c[d]) == r;
+        if (row)
+          for (e[0] = a[0]; e[0] <= b[0]; ++e[0]) visit(e);
+        else {
+          if (c[0] - r >= 0) e[0] = c[0] - r, visit(e);
+          if (c[0] + r < _cells[0]) e[0] = c[0] + r, visit(e);
+        }
+        e[0] = a[0];
+        nat d = 1;
+        for (; d < D && e[d] == b[d]; ++d) e[d] = a[d];
+        if (d == D) break;
+        ++e[d];
+      }
+      // a point not yet seen lies in the bounds past a side of the block of cells seen that is not at
+      // the bounds, so no nearer to `q` than that side along its axis and the bounds along the others
+      // (with a margin for the rounding of the cells and the distances)
+      double outside[D], base = 0, least = std::numeric_limits<double>::infinity();
+      for (nat d = 0; d < D; ++d) {
+        outside[d] = std::max({double(_bounds.lo[d]) - double(q[d]), double(q[d]) - double(_bounds.hi[d]), 0.0});
+        base += outside[d] * outside[d];
+      }
+      const auto side = [&](nat d, double gap) {
+        gap = std::max(gap, outside[d]);
+        least = std::min(least, base - outside[d] * outside[d] + gap * gap);
+      };
+      for (nat d = 0; d < D; ++d) {
+        if (a[d] > 0) side(d, double(q[d]) - (_origin[d] + double(a[d]) * double(_cell)));
+        if (b[d] < _cells[d] - 1) side(d, _origin[d] + double(b[d] + 1) * double(_cell) - double(q[d]));
+      }
+      if (double(worst()) <= least * (1 - 1e-6)) break;
+    }
+    if (cpu.avx2) intrin::mm256_zeroupper();
+    std::sort_heap(heap.begin(), heap.end());
+    for (nat i = 0; i < heap.size(); ++i) out[i] = heap[i].second;
+    return heap.size();
+  }
+  /// the index of the point nearest to `q`, or `npos` if there are none
+  nat nearest(const P& q) const {
+    nat i = npos;
+    nearest(q, std::span(&i, 1));
+    return i;
+  }
+  /// `out[i] = nearest(queries[i])`, in parallel and in the order of a Morton curve
+  void nearest(std::span<const P> queries, std::span<nat> out) const {
+    const auto order = spatial_impl::morton_order(queries, _bounds);
+    scheduler::global().parallel_for(0, queries.size(), 256, [&](nat k) { out[order[k]] = nearest(queries[order[k]]); });
+  }
+
+  /// calls `f(i)` for the index `i` of every point within `r` of `q`
+  template<typename F> void within(const P& q, T r, F&& f) const {
+    if (empty()) return;
+    // cells a little past `r`, for points that rounding puts within it
+    const double reach = double(r) * (1 + 1e-6);
+    cell_t a, b;
+    for (nat d = 0; d < D; ++d) a[d] = _cell_of(q[d] - reach, d), b[d] = _cell_of(q[d] + reach, d);
+    _buckets(a, b, [&](nat k) { _scan(k, q, r * r, [&](nat j, T) { f(nat(_index[j])); }); });
+    if (cpu.avx2) intrin::mm256_zeroupper();
+  }
+  /// the number of points within `r` of `q`
+  nat count_within(const P& q, T r) const {
+    nat c = 0;
+    within(q, r, [&](nat) { ++c; });
+    return c;
+  }
+  /// `out[i] = count_within(queries[i], r)`, in parallel and in the order of a Morton curve
+  void count_within(std::span<const P> queries, T r, std::span<nat> out) const {
+    const auto order = spatial_impl::morton_order(queries, _bounds);
+    scheduler::global().parallel_for(0, queries.size(), 256, [&](nat k) { out[order[k]] = count_within(queries[order[k]], r); });
+  }
+
+  /// calls `f(i)` for the index `i` of every point in `b`
+  template<typename F> void inside(const box<P>& b, F&& f) const {
+    if (empty()) return;
+    cell_t lo, hi;
+    for (nat d = 0; d < D; ++d) lo[d] = _cell_of(b.lo[d], d), hi[d] = _cell_of(b.hi[d], d);
+    _buckets(lo, hi, [&](nat k) {
+      for (nat j = _start[k]; j < _start[k + 1]; j += W)
+        for (int m = spatial_impl::points_inside(_coords, j, std::min<nat>(W, _start[k + 1] - j), b.lo.data(), b.hi.data()); m; m &= m - 1)
+          f(nat(_index[j + nat(std::countr_zero(unsigned(m)))]));
+    });
+    if (cpu.avx2) intrin::mm256_zeroupper();
+  }
+  /// the number of points in `b`
+  nat count_inside(const box<P>& b) const {
+    nat c = 0;
+    inside(b, [&](nat) { ++c; });
+    return c;
+  }
+};
+}
+}
+
+export namespace yw { // channel
+
+namespace channel_impl {
+
+/// threads sleeping on one side of a channel
+///
+/// `notify` is called after publishing and `wait` re-checks readiness after announcing
+/// itself; the fences between them make sure a sleeper sees the change or gets woken. A
+/// notification wakes every sleeper and clears `count`, so a side that stays blocked costs
+/// one wake-up rather than one per element.
+struct alignas(64) waiters {
+  std::atomic<unsigned> epoch{0};
+  std::atomic<unsigned> count{0};
+
+  void notify() noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!count.load(std::memory_order_relaxed) || !count.exchange(0, std::memory_order_relaxed)) return;
+    epoch.fetch_add(1, std::memory_order_relaxed);
+    epoch.notify_all();
+  }
+
+  /// the epoch is read before announcing, so a notification that clears `count` in between
+  /// also moves the epoch on and the wait returns at once
+  template<typename F> void wait(F&& ready) noexcept {
+    const auto e = epoch.load(std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!ready()) epoch.wait(e, std::memory_order_relaxed);
+  }
+};
+
+/// calls `attempt` until it returns nonzero, spinning briefly and then sleeping on `w` until `ready()`
+///
+/// Once `closed` is set, pushes (`drain == false`) give up at once and pops take what is left.
+template<bool drain, typename A, typename R> auto retry(waiters& w, const std::atomic<bool>& closed, A&& attempt, R&& ready) {
+  for (int spin = 0;; ++spin) {
+    if (!drain && closed.load(std::memory_order_acquire)) return decltype(attempt()){};
+    if (const auto r = attempt()) return r;
+    if (drain && closed.load(std::memory_order_acquire)) return attempt();
+    if (spin < 64) intrin::mm_pause();
+    else if (spin < 80) std::this_thread::yield();
+    else w.wait([&] { return ready() || closed.load(std::memory_order_relaxed); });
+  }
+}
+
+template<typename T> struct storage {
+  alignas(T) unsigned char bytes[sizeof(T)];
+  T* get() noexcept { return std::launder(reinterpret_cast<T*>(bytes)); }
+};
+
+inline nat ring_size(nat capacity) noexcept { return std::bit_ceil(std::max<nat>(capacity, 2)); }
+}
+
+/// bounded lock-free channel for one producer thread and one consumer thread
+///
+/// - the ring holds a power of two of elements at least the requested capacity
+/// - each side keeps a cached copy of the other side's index and reloads it only when the
+///   ring looks full or empty, so the indices' cache lines move between cores rarely
+/// - batch operations publish several elements with one index store
+/// - blocking operations spin briefly and then sleep with `std::atomic::wait`
+/// - after `close`, blocking pushes fail and blocking pops drain what is left
+template<typename T> class spsc_channel {
+  alignas(64) std::atomic<nat> _head{0};
+  nat _tail_cache = 0;
+  alignas(64) std::atomic<nat> _tail{0};
+  nat _head_cache = 0;
+  alignas(64) nat _mask;
+  std::unique_ptr<channel_impl::storage<T>[]> _slots;
+  std::atomic<bool> _closed{false};
+  channel_impl::waiters _readers, _writers;
+
+  template<typename It> nat _push(It& first, nat n) {
+    const nat t = _tail.load(std::memory_order_relaxed);
+    if (_mask + 1 - (t - _head_cache) < n) _head_cache = _head.load(std::memory_order_acquire);
+    n = std::min(n, _mask + 1 - (t - _head_cache));
+    for (nat i = 0; i != n; ++i, ++first) ::new (_slots[(t + i) & _mask].bytes) T(*first);
+    if (n) _tail.store(t + n, std::memory_order_release), _readers.notify();
+    return n;
+  }
+
+  template<typename It> nat _pop(It& out, nat n) {
+    const nat h = _head.load(std::memory_order_relaxed);
+    if (_tail_cache - h < n) _tail_cache = _tail.load(std::memory_order_acquire);
+    n = std::min(n, _tail_cache - h);
+    for (nat i = 0; i != n; ++i, ++out) {
+      const auto p = _slots[(h + i) & _mask].get();
+      *out = std::move(*p);
+      p->~T();
+    }
+    if (n) _head.store(h + n, std::memory_order_release), _writers.notify();
+    return n;
+  }
+public:
+  explicit spsc_channel(nat capacity) : _mask(channel_impl::ring_size(capacity) - 1), _slots(new channel_impl::storage<T>[_mask + 1]) {}
+  ~spsc_channel() {
+    for (nat i = _head.load(std::memory_order_relaxed), t = _tail.load(std::memory_order_relaxed); i != t; ++i) _slots[i & _mask].get()->~T();
+  }
+  spsc_channel(const spsc_channel&) = delete;
+  spsc_channel& operator=(const spsc_channel&) = delete;
+
+  nat capacity() const noexcept { return _mask + 1; }
+  /// number of elements at the moment of the call
+  nat size() const noexcept { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+  bool empty() const noexcept { return size() == 0; }
+  bool closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+  /// wakes every blocked thread; blocking pushes fail from now on and blocking pops fail once the channel is empty
+  void close() noexcept {
+    _closed.store(true, std::memory_order_seq_cst);
+    _readers.notify(), _writers.notify();
+  }
+
+  /// producer only; constructs an element in place unless the channel is full
+  template<typename... As> bool try_emplace(As&&... as) {
+    const nat t = _tail.load(std::memory_order_relaxed);
+    if (t - _head_cache > _mask && t - (_head_cache = _head.load(std::memory_order_acquire)) > _mask) return false;
+    ::new (_slots[t & _mask].bytes) T(std::forward<As>(as)...);
+    _tail.store(t + 1, std::memory_order_release), _readers.notify();
+    return true;
+  }
+  bool try_push(const T& v) { return try_emplace(v); }
+  bool try_push(T&& v) { return try_emplace(std::move(v)); }
+  /// producer only; copies up to `n` elements starting at `first` and returns how many fit
+  template<std::input_iterator It> nat try_push(It first, nat n) { return _push(first, n); }
+
+  /// consumer only; moves the oldest element to `out` unless the channel is empty
+  bool try_pop(T& out) {
+    const nat h = _head.load(std::memory_order_relaxed);
+    if (_tail_cache == h && (_tail_cache = _tail.load(std::memory_order_acquire)) == h) return false;
+    const auto p = _slots[h & _mask].get();
+    out = std::move(*p);
+    p->~T();
+    _head.store(h + 1, std::memory_order_release), _writers.notify();
+    return true;
+  }
+  /// consumer only; moves up to `n` elements to `out` and returns how many there were
+  template<typename It> nat try_pop(It out, nat n) { return _pop(out, n); }
+
+  /// waits for room unless the channel is closed; returns `false` if it is
+  template<typename U = T> bool push(U&& v) {
+    return channel_impl::retry<false>(_writers, _closed, [&] { return try_emplace(std::forward<U>(v)); }, [&] { return size() <= _mask; });
+  }
+  /// pushes all `n` elements, waiting for room as needed; returns fewer if the channel is closed
+  template<std::input_iterator It> nat push(It first, nat n) {
+    nat done = 0;
+    while (done != n) {
+      const nat k = channel_impl::retry<false>(_writers, _closed, [&] { return _push(first, n - done); }, [&] { return size() <= _mask; });
+      if (!k) break;
+      done += k;
+    }
+    return done;
+  }
+
+  /// waits for an element and moves it to `out`; returns `false` if the channel is closed and empty
+  bool pop(T& out) {
+    return channel_impl::retry<true>(_readers, _closed, [&] { return try_pop(out); }, [&] { return !empty(); });
+  }
+  /// waits for at least one element and moves up to `n` to `out`; returns 0 if the channel is closed and empty
+  template<typename It> nat pop(It out, nat n) {
+    return channel_impl::retry<true>(_readers, _closed, [&] { return _pop(out, n); }, [&] { return !empty(); });
+  }
+};
+
+/// bounded lock-free channel for any number of producers and consumers
+///
+/// Slots carry sequence numbers as in Vyukov's bounded MPMC queue: a slot is free for the
+/// producer of position `i` when its number is `i` and full for the consumer of `i` when it
+/// is `i + 1`. Batch operations claim consecutive ready slots with one CAS. Otherwise it
+/// behaves like `spsc_channel`; element constructors should not throw once a slot is claimed.
+template<typename T> class mpmc_channel {
+  struct slot : channel_impl::storage<T> {
+    std::atomic<nat> seq;
+  };
+  alignas(64) std::atomic<nat> _tail{0};
+  alignas(64) std::atomic<nat> _head{0};
+  alignas(64) nat _mask;
+  std::unique_ptr<slot[]> _slots;
+  std::atomic<bool> _closed{false};
+  channel_impl::waiters _readers, _writers;
+
+  /// claims up to `n` consecutive slots at `index` whose numbers are `position + offset`
+  nat _claim(std::atomic<nat>& index, nat offset, nat n, nat& pos) noexcept {
+    pos = index.load(std::memory_order_relaxed);
+    for (;;) {
+      nat k = 0;
+      while (k != n && _slots[(pos + k) & _mask].seq.load(std::memory_order_acquire) == pos + k + offset) ++k;
+      if (k) {
+        if (index.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) return k;
+        continue;
+      }
+      if (std::ptrdiff_t(_slots[pos & _mask].seq.load(std::memory_order_acquire) - (pos + offset)) < 0) return 0;
+      pos = index.load(std::memory_order_relaxed);
+    }
+  }
+
+  template<typename It> nat _push(It& first, nat n) {
+    nat pos;
+    if (!n || !(n = _claim(_tail, 0, n, pos))) return 0;
+    for (nat i = 0; i != n; ++i, ++first) {
+      auto& s = _slots[(pos + i) & _mask];
+      ::new (s.bytes) T(*first);
+      s.seq.store(pos + i + 1, std::memory_order_release);
+    }
+    _readers.notify();
+    return n;
+  }
+
+  template<typename It> nat _pop(It& out, nat n) {
+    nat pos;
+    if (!n || !(n = _claim(_head, 1, n, pos))) return 0;
+    for (nat i = 0; i != n; ++i, ++out) {
+      auto& s = _slots[(pos + i) & _mask];
+      *out = std::move(*s.get());
+      s.get()->~T();
+      s.seq.store(pos + i + _mask + 1, std::memory_order_release);
+    }
+    _writers.notify();
+    return n;
+  }
+public:
+  explicit mpmc_channel(nat capacity) : _mask(channel_impl::ring_size(capacity) - 1), _slots(new slot[_mask + 1]) {
+    for (nat i = 0; i <= _mask; ++i) _slots[i].seq.store(i, std::memory_order_relaxed);
+  }
+  ~mpmc_channel() {
+    for (nat i = _head.load(std::memory_order_relaxed), t = _tail.load(std::memory_order_relaxed); i != t; ++i) _slots[i & _mask].get()->~T();
+  }
+  mpmc_channel(const mpmc_channel&) = delete;
+  mpmc_channel& operator=(const mpmc_channel&) = delete;
+
+  nat capacity() const noexcept { return _mask + 1; }
+  /// number of claimed elements at the moment of the call
+  nat size() const noexcept {
+    const nat h = _head.load(std::memory_order_acquire), t = _tail.load(std::memory_order_acquire);
+    return t > h ? t - h : 0;
+  }
+  bool empty() const noexcept { return size() == 0; }
+  bool closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+  /// wakes every blocked thread; blocking pushes fail from now on and blocking pops fail once the channel is empty
+  void close() noexcept {
+    _closed.store(true, std::memory_order_seq_cst);
+    _readers.notify(), _writers.notify();
+  }
+
+  /// constructs an element in place unless the channel is full
+  template<typename... As> bool try_emplace(As&&... as) {
+    nat pos;
+    if (!_claim(_tail, 0, 1, pos)) return false;
+    auto& s = _slots[pos & _mask];
+    ::new (s.bytes) T(std::forward<As>(as)...);
+    s.seq.store(pos + 1, std::memory_order_release);
+    _readers.notify();
+    return true;
+  }
+  bool try_push(const T& v) { return try_emplace(v); }
+  bool try_push(T&& v) { return try_emplace(std::move(v)); }
+  /// copies up to `n` elements starting at `first` and returns how many fit
+  template<std::input_iterator It> nat try_push(It first, nat n) { return _push(first, n); }
+
+  /// moves the oldest element to `out` unless the channel is empty
+  bool try_pop(T& out) {
+    auto p = &out;
+    return _pop(p, 1);
+  }
+  /// moves up to `n` elements to `out` and returns how many there were
+  template<typename It> nat try_pop(It out, nat n) { return _pop(out, n); }
+
+  /// waits for room unless the channel is closed; returns `false` if it is
+  template<typename U = T> bool push(U&& v) {
+    return channel_impl::retry<false>(_writers, _closed, [&] { return try_emplace(std::forward<U>(v)); }, [&] { return size() <= _mask; });
+  }
+  /// pushes all `n` elements, waiting for room as needed; returns fewer if the channel is closed
+  template<std::input_iterator It> nat push(It first, nat n) {
+    nat done = 0;
+    while (done != n) {
+      const nat k = channel_impl::retry<false>(_writers, _closed, [&] { return _push(first, n - done); }, [&] { return size() <= _mask; });
+      if (!k) break;
+      done += k;
+    }
+    return done;
+  }
+
+  /// waits for an element and moves it to `out`; returns `false` if the channel is closed and empty
+  bool pop(T& out) {
+    return channel_impl::retry<true>(_readers, _closed, [&] { return try_pop(out); }, [&] { return !empty(); });
+  }
+  /// waits for at least one element and moves up to `n` to `out`; returns 0 if the channel is closed and empty
+  template<typename It> nat pop(It out, nat n) {
+    return channel_impl::retry<true>(_readers, _closed, [&] { return _pop(out, n); }, [&] { return !empty(); });
+  }
+};
+}
+
+export namespace yw { // task
+
+template<typename T = void> class task;
+
+namespace task_impl {
+
+/// per-thread free lists of coroutine frames in 64-byte size classes up to 1 KiB
+///
+/// Frames freed on another thread than the one that allocated them go to the freeing
+/// thread's lists; each list keeps at most `limit` frames and frees the rest.
+class frame_pool {
+  static constexpr nat granularity = 64, classes = 16, limit = 256;
+  struct node {
+    node* next;
+  };
+  node* _heads[classes]{};
+  nat _counts[classes]{};
+public:
+  frame_pool() = default;
+  frame_pool(const frame_pool&) = delete;
+  ~frame_pool() {
+    for (auto head : _heads)
+      while (head) ::operator delete(std::exchange(head, head->next));
+  }
+
+  void* allocate(nat n) {
+    const nat c = (n - 1) / granularity;
+    if (c >= classes) return ::operator new(n);
+    if (const auto p = _heads[c]) return _heads[c] = p->next, --_counts[c], p;
+    return ::operator new((c + 1) * granularity);
+  }
+
+  void deallocate(void* p, nat n) noexcept {
+    const nat c = (n - 1) / granularity;
+    if (c >= classes || _counts[c] == limit) return ::operator delete(p);
+    _heads[c] = ::new (p) node{_heads[c]}, ++_counts[c];
+  }
+
+  static frame_pool& local() noexcept {
+    static thread_local frame_pool p;
+    return p;
+  }
+};
+
+/// promise base that takes coroutine frames from `frame_pool`
+struct pooled {
+  static void* operator new(nat n) { return frame_pool::local().allocate(n); }
+  static void operator delete(void* p, nat n) noexcept { frame_pool::local().deallocate(p, n); }
+};
+
+template<typename T> using result_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+/// resumes the awaiting coroutine by symmetric transfer
+struct final_awaiter {
+  bool await_ready() noexcept { return false; }
+  template<typename P> std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept {
+    const auto c = h.promise().continuation;
+    return c ? c : std::noop_coroutine();
+  }
+  void await_resume() noexcept {}
+};
+
+template<typename T> struct promise_base : pooled {
+  std::coroutine_handle<> continuation;
+  std::variant<std::monostate, result_t<T>, std::exception_ptr> result;
+  std::suspend_always initial_suspend() noexcept { return {}; }
+  final_awaiter final_suspend() noexcept { return {}; }
+  void unhandled_exception() noexcept { result.template emplace<2>(std::current_exception()); }
+  result_t<T> take() {
+    if (result.index() == 2) std::rethrow_exception(std::get<2>(result));
+    return std::move(std::get<1>(result));
+  }
+};
+
+template<typename T> struct promise : promise_base<T> {
+  task<T> get_return_object() noexcept;
+  template<typename U = T> void return_value(U&& v) { this->result.template emplace<1>(std::forward<U>(v)); }
+};
+
+template<> struct promise<void> : promise_base<void> {
+  task<void> get_return_object() noexcept;
+  void return_void() noexcept { result.emplace<1>(); }
+};
+
+/// eagerly started coroutine that destroys itself when it finishes
+struct detached {
+  struct promise_type : pooled {
+    detached get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+/// parent of `when_all`: resumed by the last of `count` children, or not suspended if they are all done
+struct join_counter {
+  std::atomic<nat> count;
+  std::coroutine_handle<> parent;
+  bool arrive() noexcept { return count.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+  bool await_ready() noexcept { return false; }
+  bool await_suspend(std::coroutine_handle<> h) noexcept { return parent = h, !arrive(); }
+  void await_resume() noexcept {}
+};
+}
+
+/// lazily started coroutine producing a `T`
+///
+/// Awaiting a task starts it, and its end resumes the awaiter; both are symmetric transfers,
+/// so chains of tasks do not grow the stack. Frames come from a per-thread pool rather than
+/// one heap allocation each. Exceptions are rethrown to the awaiter.
+template<typename T> class task {
+public:
+  using promise_type = task_impl::promise<T>;
+private:
+  std::coroutine_handle<promise_type> _h;
+public:
+  task() noexcept = default;
+  explicit task(std::coroutine_handle<promise_type> h) noexcept : _h(h) {}
+  task(task&& t) noexcept : _h(std::exchange(t._h, {})) {}
+  task& operator=(task t) noexcept { return std::swap(_h, t._h), *this; }
+  ~task() {
+    if (_h) _h.destroy();
+  }
+
+  /// whether the task has run to its end
+  bool done() const noexcept { return _h && _h.done(); }
+
+  auto operator co_await() noexcept {
+    struct awaiter {
+      std::coroutine_handle<promise_type> h;
+      bool await_ready() noexcept { return h.done(); }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) noexcept { return h.promise().continuation = c, h; }
+      T await_resume() {
+        if constexpr (std::is_void_v<T>) h.promise().take();
+        else return h.promise().take();
+      }
+    };
+    return awaiter{_h};
+  }
+};
+
+template<typename T> task<T> task_impl::promise<T>::get_return_object() noexcept { return task<T>(std::coroutine_handle<promise>::from_promise(*this)); }
+inline task<void> task_impl::promise<void>::get_return_object() noexcept { return task<void>(std::coroutine_handle<promise>::from_promise(*this)); }
+
+/// coroutine yielding a sequence of `T` lazily, as an input range of `const T&`
+template<typename T> class generator {
+public:
+  struct promise_type : task_impl::pooled {
+    const T* value = nullptr;
+    std::exception_ptr error;
+    generator get_return_object() noexcept { return generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    std::suspend_always yield_value(const T& v) noexcept { return value = std::addressof(v), std::suspend_always{}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+    template<typename U> void await_transform(U&&) = delete;
+  };
+
+  class iterator {
+    friend generator;
+    std::coroutine_handle<promise_type> _h;
+    void _next() {
+      _h.resume();
+      if (_h.promise().error) std::rethrow_exception(std::exchange(_h.promise().error, nullptr));
+    }
+  public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    iterator() noexcept = default;
+    const T& operator*() const noexcept { return *_h.promise().value; }
+    const T* operator->() const noexcept { return _h.promise().value; }
+    iterator& operator++() { return _next(), *this; }
+    void operator++(int) { _next(); }
+    bool operator==(std::default_sentinel_t) const noexcept { return _h.done(); }
+  };
+private:
+  std::coroutine_handle<promise_type> _h;
+public:
+  explicit generator(std::coroutine_handle<promise_type> h) noexcept : _h(h) {}
+  generator(generator&& g) noexcept : _h(std::exchange(g._h, {})) {}
+  generator& operator=(generator g) noexcept { return std::swap(_h, g._h), *this; }
+  ~generator() {
+    if (_h) _h.destroy();
+  }
+
+  /// runs the coroutine to its first `co_yield`; call once
+  iterator begin() {
+    iterator i;
+    i._h = _h;
+    i._next();
+    return i;
+  }
+  std::default_sentinel_t end() const noexcept { return {}; }
+};
+
+/// runs coroutines on a `scheduler` and wakes sleeping ones from a timer thread
+///
+/// A coroutine suspended on `schedule()` or a timer is resumed as a job on the pool, so any
+/// number of waiting coroutines cost no threads; thousands of I/O-bound tasks can share a
+/// few workers.
+class executor {
+  struct timer {
+    std::chrono::steady_clock::time_point at;
+    std::coroutine_handle<> h;
+    bool operator>(const timer& t) const noexcept { return at > t.at; }
+  };
+  scheduler& _pool;
+  std::mutex _mutex;
+  std::condition_variable _changed;
+  std::priority_queue<timer, std::vector<timer>, std::greater<>> _timers;
+  bool _stop = false;
+  std::thread _clock;
+
+  void _tick() {
+    std::unique_lock lock(_mutex);
+    while (!_stop) {
+      if (_timers.empty()) _changed.wait(lock);
+      else if (const auto t = _timers.top(); std::chrono::steady_clock::now() < t.at) _changed.wait_until(lock, t.at);
+      else {
+        _timers.pop();
+        lock.unlock();
+        post(t.h);
+        lock.lock();
+      }
+    }
+  }
+
+  void _halt() {
+    {
+      std::lock_guard lock(_mutex);
+      if (_stop) return;
+      _stop = true;
+    }
+    _changed.notify_one();
+    _clock.join();
+  }
+public:
+  explicit executor(scheduler& pool = scheduler::global()) : _pool(pool), _clock([this] { _tick(); }) {}
+  /// stops the timer thread; coroutines still sleeping are never resumed
+  ~executor() { _halt(); }
+  executor(const executor&) = delete;
+  executor& operator=(const executor&) = delete;
+
+  /// resumes `h` on the pool
+  void post(std::coroutine_handle<> h) {
+    _pool.post([h] { h.resume(); });
+  }
+
+  /// `co_await ex.schedule()` continues the coroutine on the pool
+  auto schedule() noexcept {
+    struct awaiter {
+      executor& e;
+      bool await_ready() noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> h) { e.post(h); }
+      void await_resume() noexcept {}
+    };
+    return awaiter{*this};
+  }
+
+  /// `co_await ex.sleep_until(t)` continues the coroutine on the pool at `t`
+  auto sleep_until(std::chrono::steady_clock::time_point t) noexcept {
+    struct awaiter {
+      executor& e;
+      std::chrono::steady_clock::time_point at;
+      bool await_ready() noexcept { return at <= std::chrono::steady_clock::now(); }
+      /// once the lock is released the timer thread may resume `h` and end the frame holding
+      /// this awaiter, so only locals are used after it
+      void await_suspend(std::coroutine_handle<> h) {
+        executor& ex = e;
+        bool first;
+        {
+          std::lock_guard lock(ex._mutex);
+          ex._timers.push({at, h});
+          first = ex._timers.top().h == h;
+        }
+        if (first) ex._changed.notify_one();
+      }
+      void await_resume() noexcept {}
+    };
+    return awaiter{*this, t};
+  }
+  template<typename R, typename P> auto sleep_for(std::chrono::duration<R, P> d) noexcept {
+    return sleep_until(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(d));
+  }
+
+  /// starts `t` on the pool without waiting for it; the program terminates if it throws
+  template<typename T> void spawn(task<T> t) {
+    [](executor& e, task<T> t) -> task_impl::detached {
+      co_await e.schedule();
+      co_await t;
+    }(*this, std::move(t));
+  }
+
+  /// runs `t` on the pool and blocks until it is done; must not be called by a pool worker
+  template<typename T> T run(task<T> t) {
+    struct state {
+      std::mutex m;
+      std::condition_variable cv;
+      bool done = false;
+      std::optional<task_impl::result_t<T>> value;
+      std::exception_ptr error;
+    } s;
+    [](executor& e, task<T>& t, state& s) -> task_impl::detached {
+      co_await e.schedule();
+      try {
+        if constexpr (std::is_void_v<T>) co_await t, s.value.emplace();
+        else s.value.emplace(co_await t);
+      } catch (...) { s.error = std::current_exception(); }
+      std::lock_guard lock(s.m);
+      s.done = true;
+      s.cv.notify_one();
+    }(*this, t, s);
+    std::unique_lock lock(s.m);
+    s.cv.wait(lock, [&] { return s.done; });
+    if (s.error) std::rethrow_exception(s.error);
+    if constexpr (!std::is_void_v<T>) return std::move(*s.value);
+  }
+
+  /// executor on `scheduler::global()`, never destroyed; its timer thread stops at exit
+  static executor& global() {
+    static executor* const e = [] {
+      const auto p = new executor;
+      std::atexit([] { global()._halt(); });
+      return p;
+    }();
+    return *e;
+  }
+};
+
+/// runs the tasks concurrently and returns their results, `std::monostate` for `void`
+///
+/// Each task is started in turn on the awaiting thread and runs until it first suspends;
+/// the last one to finish resumes the awaiter. The first exception is rethrown once all are done.
+template<typename... Ts> task<std::tuple<task_impl::result_t<Ts>...>> when_all(task<Ts>... ts) {
+  task_impl::join_counter join{sizeof...(Ts) + 1, {}};
+  std::tuple<std::optional<task_impl::result_t<Ts>>...> results;
+  std::exception_ptr error;
+  std::atomic<bool> failed{false};
+  const auto start = []<typename T>(task<T>& t, std::optional<task_impl::result_t<T>>& r, task_impl::join_counter& join, std::exception_ptr& error, std::atomic<bool>& failed) -> task_impl::detached {
+    try {
+      if constexpr (std::is_void_v<T>) co_await t, r.emplace();
+      else r.emplace(co_await t);
+    } catch (...) {
+      if (!failed.exchange(true)) error = std::current_exception();
+    }
+    if (join.arrive()) join.parent.resume();
+  };
+  [&]<nat... i>(std::index_sequence<i...>) { (start(ts, std::get<i>(results), join, error, failed), ...); }(std::index_sequence_for<Ts...>{});
+  co_await join;
+  if (error) std::rethrow_exception(error);
+  co_return std::apply([](auto&... r) { return std::tuple<task_impl::result_t<Ts>...>(std::move(*r)...); }, results);
+}
+
+/// runs the tasks concurrently like `when_all` and returns their results in order
+template<typename T> task<std::vector<task_impl::result_t<T>>> when_all(std::vector<task<T>> ts) {
+  task_impl::join_counter join{ts.size() + 1, {}};
+  std::vector<std::optional<task_impl::result_t<T>>> results(ts.size());
+  std::exception_ptr error;
+  std::atomic<bool> failed{false};
+  const auto start = [](task<T>& t, std::optional<task_impl::result_t<T>>& r, task_impl::join_counter& join, std::exception_ptr& error, std::atomic<bool>& failed) -> task_impl::detached {
+    try {
+      if constexpr (std::is_void_v<T>) co_await t, r.emplace();
+      else r.emplace(co_await t);
+    } catch (...) {
+      if (!failed.exchange(true)) error = std::current_exception();
+    }
+    if (join.arrive()) join.parent.resume();
+  };
+  for (nat i = 0; i != ts.size(); ++i) start(ts[i], results[i], join, error, failed);
+  co_await join;
+  if (error) std::rethrow_exception(error);
+  std::vector<task_impl::result_t<T>> out;
+  out.reserve(results.size());
+  for (auto& r : results) out.push_back(std::move(*r));
+  co_return out;
+}
+
+/// runs the tasks concurrently and returns the result of the first to finish, as the
+/// alternative with its index; `std::monostate` stands for `void`
+///
+/// The others keep running to their end in the background and their results are dropped,
+/// so they must not refer to anything the awaiter destroys. An exception from the first to
+/// finish is rethrown.
+template<typename... Ts> task<std::variant<task_impl::result_t<Ts>...>> when_any(task<Ts>... ts) {
+  using result = std::variant<task_impl::result_t<Ts>...>;
+  struct state {
+    std::atomic<bool> won{false};
+    std::atomic<int> gate{0};
+    std::coroutine_handle<> parent;
+    std::optional<result> value;
+    std::exception_ptr error;
+    /// the winner and the suspending parent both pass; the second one resumes or continues the parent
+    bool pass() noexcept { return gate.fetch_add(1, std::memory_order_acq_rel) == 1; }
+  };
+  const auto s = std::make_shared<state>();
+  const auto start = []<nat i, typename T>(std::integral_constant<nat, i>, task<T> t, std::shared_ptr<state> s) -> task_impl::detached {
+    std::optional<result> r;
+    std::exception_ptr error;
+    try {
+      if constexpr (std::is_void_v<T>) co_await t, r.emplace(std::in_place_index<i>);
+      else r.emplace(std::in_place_index<i>, co_await t);
+    } catch (...) { error = std::current_exception(); }
+    if (s->won.exchange(true, std::memory_order_acq_rel)) co_return;
+    s->value = std::move(r), s->error = error;
+    if (s->pass()) s->parent.resume();
+  };
+  [&]<nat... i>(std::index_sequence<i...>) { (start(std::integral_constant<nat, i>{}, std::move(ts), s), ...); }(std::index_sequence_for<Ts...>{});
+  struct awaiter {
+    state& s;
+    bool await_ready() noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> h) noexcept { return s.parent = h, !s.pass(); }
+    void await_resume() noexcept {}
+  };
+  co_await awaiter{*s};
+  if (s->error) std::rethrow_exception(s->error);
+  co_return std::move(*s->value);
+}
+}
+
+export namespace yw { // io
+
+namespace io {
+class engine;
+class operation;
+class file;
+}
+
+namespace io_impl {
+
+constexpr unsigned long generic_read = 0x80000000, generic_write = 0x40000000, share_all = 7;
+constexpr unsigned long create_always = 2, open_existing = 3, open_always = 4;
+constexpr unsigned long attribute_normal = 0x80, flag_overlapped = 0x40000000, flag_no_buffering = 0x20000000;
+constexpr unsigned long flag_random_access = 0x10000000, flag_sequential_scan = 0x08000000;
+constexpr unsigned long error_handle_eof = 38, error_io_pending = 997;
+constexpr unsigned __int64 flush_key = 1, stop_key = 2;
+
+/// longest single `ReadFile`/`WriteFile`; longer buffers are split into several parts
+constexpr nat part_limit = nat(1) << 30;
+
+struct request;
+
+/// one `ReadFile`/`WriteFile`/`FlushFileBuffers` call of a request
+struct part : intrin::overlapped {
+  request* owner;
+  std::byte* data;
+  unsigned long size;
+};
+
+enum class kind : unsigned char { read, write, flush };
+
+/// a read, write or flush of one or more parts, done when the last part completes
+///
+/// `pending` starts at the number of parts plus one for the submitter, so the request cannot
+/// finish while it is still being submitted; `done` runs on the thread that takes it to zero.
+struct request {
+  scheduler* pool = nullptr;
+  void* handle = nullptr;
+  kind op = kind::read;
+  bool skip = false;
+  part one{};
+  std::vector<part> many;
+  part* parts = nullptr;
+  nat count = 0;
+  std::atomic<nat> pending{0}, bytes{0};
+  std::atomic<unsigned long> error{0};
+  void (*done)(request*) = nullptr;
+
+  request() = default;
+  request(const request&) = delete;
+  request& operator=(const request&) = delete;
+
+  /// splits `buffers`, which follow each other in the file from `offset`, into parts
+  template<typename B> void prepare(kind k, nat offset, std::span<const B> buffers) {
+    op = k, count = 0;
+    for (const auto& b : buffers) count += (b.size() + part_limit - 1) / part_limit;
+    if (k == kind::flush) count = 1;
+    if (count > 1) many.resize(count);
+    parts = count > 1 ? many.data() : &one;
+    pending.store(count + 1, std::memory_order_relaxed);
+    nat i = 0;
+    for (const auto& b : buffers)
+      for (nat at = 0; at < b.size(); at += part_limit, ++i) {
+        const auto n = static_cast<unsigned long>(std::min(b.size() - at, part_limit));
+        parts[i] = {{0, 0, offset, nullptr}, this, const_cast<std::byte*>(b.data()) + at, n};
+        offset += n;
+      }
+    if (k == kind::flush) one = {{}, this, nullptr, 0};
+  }
+
+  void finish(unsigned long e, nat n) noexcept {
+    if (n) bytes.fetch_add(n, std::memory_order_relaxed);
+    if (unsigned long none = 0; e && e != error_handle_eof) error.compare_exchange_strong(none, e, std::memory_order_relaxed);
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) done(this);
+  }
+
+  std::error_code status() const noexcept {
+    const auto e = error.load(std::memory_order_relaxed);
+    return e ? std::error_code(int(e), std::system_category()) : std::error_code();
+  }
+};
+
+/// a request that calls `f(std::error_code, nat)` on the pool and deletes itself
+template<typename F> struct callback : request {
+  F f;
+  explicit callback(F&& g) : f(std::move(g)) {
+    done = [](request* r) {
+      r->pool->post([c = static_cast<callback*>(r)] {
+        c->f(c->status(), c->bytes.load(std::memory_order_relaxed));
+        delete c;
+      });
+    };
+  }
+};
+}
+
+namespace io {
+
+/// how an `engine` performs requests
+///
+/// `completion_port` issues overlapped calls and reaps them from an I/O completion port, so a
+/// few threads keep any number of requests in flight. `thread_pool` makes blocking positional
+/// calls on its own threads; its queue depth is its thread count.
+enum class backend { completion_port, thread_pool };
+
+/// how a `file` is opened: `read` an existing file, `write` a new or truncated one, or
+/// `read_write` a new or existing one
+enum class mode { read, write, read_write };
+
+/// `direct` bypasses the page cache; offsets, sizes and addresses must then be multiples of the
+/// sector size, which `io::buffer` is. `sequential` and `random` hint the read-ahead.
+struct options {
+  bool direct = false;
+  bool sequential = false;
+  bool random = false;
+};
+
+/// page-aligned bytes, usable with `options::direct`
+class buffer {
+  static constexpr std::align_val_t alignment{4096};
+  std::byte* _data = nullptr;
+  nat _size = 0;
+public:
+  buffer() noexcept = default;
+  explicit buffer(nat size) : _data(static_cast<std::byte*>(::operator new(size, alignment))), _size(size) {}
+  buffer(buffer&& b) noexcept : _data(std::exchange(b._data, nullptr)), _size(std::exchange(b._size, 0)) {}
+  buffer& operator=(buffer&& b) noexcept {
+    std::swap(_data, b._data), std::swap(_size, b._size);
+    return *this;
+  }
+  ~buffer() {
+    if (_data) ::operator delete(_data, alignment);
+  }
+  std::byte* data() const noexcept { return _data; }
+  nat size() const noexcept { return _size; }
+  std::byte* begin() const noexcept { return _data; }
+  std::byte* end() const noexcept { return _data + _size; }
+  std::byte& operator[](nat i) const noexcept { return _data[i]; }
+  operator std::span<std::byte>() const noexcept { return {_data, _size}; }
+  operator std::span<const std::byte>() const noexcept { return {_data, _size}; }
+};
+
+/// performs the requests of `file`s and resumes their awaiters or callbacks on a `scheduler`
+class engine {
+  friend operation;
+  friend file;
+  scheduler& _pool;
+  void* _port = nullptr;
+  std::vector<std::thread> _threads;
+  std::mutex _mutex;
+  std::condition_variable _ready;
+  std::deque<io_impl::part*> _queue;
+  bool _stop = false;
+
+  static void _blocking(io_impl::part& p) noexcept {
+    auto& r = *p.owner;
+    unsigned long n = 0;
+    bool ok;
+    if (r.op == io_impl::kind::flush) ok = intrin::flush_file(r.handle);
+    else if (r.op == io_impl::kind::read) ok = intrin::read_file(r.handle, p.data, p.size, &n, &p);
+    else ok = intrin::write_file(r.handle, p.data, p.size, &n, &p);
+    r.finish(ok ? 0 : intrin::last_error(), n);
+  }
+
+  void _start(io_impl::part& p) noexcept {
+    auto& r = *p.owner;
+    if (r.op == io_impl::kind::flush) {
+      if (!intrin::post_completion(_port, 0, io_impl::flush_key, &p)) r.finish(intrin::last_error(), 0);
+      return;
+    }
+    unsigned long n = 0;
+    const bool ok = r.op == io_impl::kind::read ? intrin::read_file(r.handle, p.data, p.size, &n, &p)
+                                                : intrin::write_file(r.handle, p.data, p.size, &n, &p);
+    if (ok) {
+      if (r.skip) r.finish(0, n);
+    } else if (const auto e = intrin::last_error(); e != io_impl::error_io_pending) r.finish(e, 0);
+  }
+
+  void _reap() noexcept {
+    intrin::overlapped_entry entries[64];
+    for (bool stop = false; !stop;) {
+      unsigned long n = 0;
+      if (!intrin::dequeue_completions(_port, entries, 64, &n, ~0ul)) continue;
+      for (const auto& e : std::span(entries, n)) {
+        if (e.key == io_impl::stop_key) {
+          stop = true;
+          continue;
+        }
+        auto& p = static_cast<io_impl::part&>(*e.ov);
+        unsigned long bytes = 0;
+        if (e.key == io_impl::flush_key) _blocking(p);
+        else if (p.internal == 0) p.owner->finish(0, e.bytes);
+        else p.owner->finish(intrin::overlapped_result(p.owner->handle, &p, &bytes) ? 0 : intrin::last_error(), bytes);
+      }
+    }
+    intrin::post_completion(_port, 0, io_impl::stop_key, nullptr); // for the next thread
+  }
+
+  void _serve() noexcept {
+    for (std::unique_lock lock(_mutex);;) {
+      _ready.wait(lock, [&] { return _stop || !_queue.empty(); });
+      if (_queue.empty()) return;
+      const auto p = _queue.front();
+      _queue.pop_front();
+      lock.unlock();
+      _blocking(*p);
+      lock.lock();
+    }
+  }
+
+  /// starts every part of `r`; true if they have all finished already and `r.done` will not run
+  bool _submit(io_impl::request& r) {
+    r.pool = &_pool;
+    if (_port)
+      for (nat i = 0; i < r.count; ++i) _start(r.parts[i]);
+    else if (r.count) {
+      {
+        std::lock_guard lock(_mutex);
+        for (nat i = 0; i < r.count; ++i) _queue.push_back(r.parts + i);
+      }
+      r.count == 1 ? _ready.notify_one() : _ready.notify_all();
+    }
+    return r.pending.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  void _halt() {
+    if (_port) {
+      intrin::post_completion(_port, 0, io_impl::stop_key, nullptr);
+    } else {
+      std::lock_guard lock(_mutex);
+      _stop = true;
+    }
+    _ready.notify_all();
+    for (auto& t : _threads)
+      if (t.joinable()) t.join();
+    if (_port) intrin::close_handle(std::exchange(_port, nullptr));
+  }
+public:
+  /// `threads` reap completions, or perform the calls for `backend::thread_pool`; 0 picks 2 or 32
+  ///
+  /// Falls back to `backend::thread_pool` if a completion port cannot be created.
+  explicit engine(backend b = backend::completion_port, nat threads = 0, scheduler& pool = scheduler::global()) : _pool(pool) {
+    if (b == backend::completion_port) _port = intrin::new_completion_port();
+    if (!threads) threads = _port ? 2 : 32;
+    _threads.reserve(threads);
+    for (nat i = 0; i < threads; ++i) _threads.emplace_back([this] { _port ? _reap() : _serve(); });
+  }
+  /// every request must have finished
+  ~engine() { _halt(); }
+  engine(const engine&) = delete;
+  engine& operator=(const engine&) = delete;
+
+  backend kind() const noexcept { return _port ? backend::completion_port : backend::thread_pool; }
+
+  /// engine on `scheduler::global()`, never destroyed; its threads stop at exit
+  static engine& global() {
+    static engine* const e = [] {
+      const auto p = new engine;
+      std::atexit([] { global()._halt(); });
+      return p;
+    }();
+    return *e;
+  }
+};
+
+/// a request of `file`; `co_await` gives the number of bytes transferred or throws `std::system_error`
+///
+/// The awaiting coroutine continues on the engine's scheduler, or without suspending if the
+/// request completed synchronously, as reads from the page cache usually do.
+class operation : io_impl::request {
+  friend file;
+  engine& _engine;
+  std::coroutine_handle<> _awaiter;
+  template<typename B> operation(engine& e, void* h, bool skip, io_impl::kind k, nat offset, std::span<const B> buffers) : _engine(e) {
+    handle = h, this->skip = skip;
+    prepare(k, offset, buffers);
+    done = [](request* r) { r->pool->post([h = static_cast<operation*>(r)->_awaiter] { h.resume(); }); };
+  }
+public:
+  bool await_ready() const noexcept { return false; }
+  bool await_suspend(std::coroutine_handle<> h) { return _awaiter = h, !_engine._submit(*this); }
+  nat await_resume() const {
+    if (error.load(std::memory_order_relaxed)) throw std::system_error(status(), "yw::io");
+    return bytes.load(std::memory_order_relaxed);
+  }
+};
+
+/// a file read and written at explicit offsets through an `engine`
+///
+/// Reads and writes return an `operation` to `co_await`; the overloads taking `done` call
+/// `done(std::error_code, nat bytes)` on the scheduler instead. Reading past the end is not an
+/// error and transfers fewer bytes. Buffers must outlive their requests, and every request must
+/// have finished before the file is closed.
+class file {
+  engine* _engine = nullptr;
+  void* _handle = nullptr;
+  bool _skip = false;
+
+  template<typename B> operation _await(io_impl::kind k, nat offset, std::span<const B> buffers) {
+    return operation(*_engine, _handle, _skip, k, offset, buffers);
+  }
+
+  template<typename B, typename F> void _call(io_impl::kind k, nat offset, std::span<const B> buffers, F&& done) {
+    const auto c = new io_impl::callback<std::decay_t<F>>(std::decay_t<F>(std::forward<F>(done)));
+    c->handle = _handle, c->skip = _skip;
+    c->prepare(k, offset, buffers);
+    if (_engine->_submit(*c)) c->done(c);
+  }
+public:
+  file() noexcept = default;
+  file(engine& e, const std::filesystem::path& path, mode m = mode::read, options o = {}) : _engine(&e) {
+    using namespace io_impl;
+    const unsigned long access = m == mode::read ? generic_read : m == mode::write ? generic_write : generic_read | generic_write;
+    const unsigned long disposition = m == mode::read ? open_existing : m == mode::write ? create_always : open_always;
+    const unsigned long flags = attribute_normal | (e._port ? flag_overlapped : 0) | (o.direct ? flag_no_buffering : 0) |
+                                (o.sequential ? flag_sequential_scan : 0) | (o.random ? flag_random_access : 0);
+    _handle = intrin::create_file(path.c_str(), access, share_all, disposition, flags);
+    if (!_handle) throw std::system_error(int(intrin::last_error()), std::system_category(), "yw::io::file " + path.string());
+    if (e._port) {
+      if (!intrin::associate_completion_port(_handle, e._port, 0)) {
+        const auto error = intrin::last_error();
+        intrin::close_handle(std::exchange(_handle, nullptr));
+        throw std::system_error(int(error), std::system_category(), "yw::io::file " + path.string());
+      }
+      _skip = intrin::skip_completion_on_success(_handle);
+    }
+  }
+  explicit file(const std::filesystem::path& path, mode m = mode::read, options o = {}) : file(engine::global(), path, m, o) {}
+  file(file&& f) noexcept : _engine(f._engine), _handle(std::exchange(f._handle, nullptr)), _skip(f._skip) {}
+  file& operator=(file&& f) noexcept {
+    std::swap(_engine, f._engine), std::swap(_handle, f._handle), std::swap(_skip, f._skip);
+    return *this;
+  }
+  ~file() {
+    if (_handle) intrin::close_handle(_handle);
+  }
+
+  explicit operator bool() const noexcept { return _handle != nullptr; }
+
+  nat size() const {
+    __int64 n = 0;
+    if (!intrin::file_size(_handle, &n)) throw std::system_error(int(intrin::last_error()), std::system_category(), "yw::io::file::size");
+    return nat(n);
+  }
+
+  operation read(nat offset, std::span<std::byte> b) { return _await(io_impl::kind::read, offset, std::span<const std::span<std::byte>>(&b, 1)); }
+  operation write(nat offset, std::span<const std::byte> b) { return _await(io_impl::kind::write, offset, std::span<const std::span<const std::byte>>(&b, 1)); }
+  /// reads into `bs` in turn from `offset`, like `preadv`
+  operation readv(nat offset, std::span<const std::span<std::byte>> bs) { return _await(io_impl::kind::read, offset, bs); }
+  /// writes `bs` in turn from `offset`, like `pwritev`
+  operation writev(nat offset, std::span<const std::span<const std::byte>> bs) { return _await(io_impl::kind::write, offset, bs); }
+  /// flushes written data and metadata to the device
+  operation fsync() { return _await(io_impl::kind::flush, 0, std::span<const std::span<const std::byte>>()); }
+
+  template<typename F> void read(nat offset, std::span<std::byte> b, F&& done) { _call(io_impl::kind::read, offset, std::span<const std::span<std::byte>>(&b, 1), std::forward<F>(done)); }
+  template<typename F> void write(nat offset, std::span<const std::byte> b, F&& done) { _call(io_impl::kind::write, offset, std::span<const std::span<const std::byte>>(&b, 1), std::forward<F>(done)); }
+  template<typename F> void readv(nat offset, std::span<const std::span<std::byte>> bs, F&& done) { _call(io_impl::kind::read, offset, bs, std::forward<F>(done)); }
+  template<typename F> void writev(nat offset, std::span<const std::span<const std::byte>> bs, F&& done) { _call(io_impl::kind::write, offset, bs, std::forward<F>(done)); }
+  template<typename F> void fsync(F&& done) { _call(io_impl::kind::flush, 0, std::span<const std::span<const std::byte>>(), std::forward<F>(done)); }
+
+  /// locks the pages of `b` for I/O on this file, so requests into it skip probing and locking
+  /// them each time; needs the lock-pages privilege and `backend::completion_port`, false otherwise
+  bool register_buffer(std::span<const std::byte> b) noexcept {
+    return _engine->_port && b.size() <= ~0ul && intrin::lock_io_range(_handle, const_cast<std::byte*>(b.data()), static_cast<unsigned long>(b.size()));
+  }
+};
+}
+}
+
+export namespace yw { // mapped_file
+
+namespace mapped_impl {
+constexpr unsigned long page_readonly = 0x02, page_readwrite = 0x04, sec_commit = 0x8000000, sec_large_pages = 0x80000000;
+constexpr unsigned long file_map_write = 0x02, file_map_read = 0x04, file_map_large_pages = 0x20000000;
+/// `GetLargePageMinimum()` on x64
+constexpr nat large_page = nat(2) << 20;
+}
+
+/// `sequential` prefetches the whole mapping and keeps read-ahead on, `random` turns read-ahead off;
+/// `huge_pages` backs memory not backed by a file with large pages when the lock-pages privilege allows
+/// (Windows maps files with small pages only)
+struct map_options {
+  bool sequential = false;
+  bool random = false;
+  bool huge_pages = false;
+};
+
+/// a file mapped into memory as a contiguous range of `char`
+///
+/// The range works wherever a `string_view` or a contiguous range is taken, so the string and
+/// number kernels read page-cache memory directly instead of a copy.
+class mapped_file {
+  void* _file = nullptr;
+  void* _mapping = nullptr;
+  char* _data = nullptr;
+  nat _size = 0;
+  bool _writable = false;
+  bool _huge = false;
+
+  void _close() noexcept {
+    if (_data) intrin::unmap_view(std::exchange(_data, nullptr));
+    if (_mapping) intrin::close_handle(std::exchange(_mapping, nullptr));
+    if (_file) intrin::close_handle(std::exchange(_file, nullptr));
+    _size = 0;
+  }
+
+  [[noreturn]] void _fail(const std::string& what) {
+    const auto error = intrin::last_error();
+    _close();
+    throw std::system_error(int(error), std::system_category(), what);
+  }
+public:
+  mapped_file() noexcept = default;
+
+  /// maps `path` read-only for `io::mode::read`, otherwise read-write and grown to `size` bytes
+  /// if it is shorter; `io::mode::write` truncates the file first
+  explicit mapped_file(const std::filesystem::path& path, io::mode m = io::mode::read, nat size = 0, map_options o = {}) : _writable(m != io::mode::read) {
+    using namespace io_impl;
+    using namespace mapped_impl;
+    const unsigned long disposition = m == io::mode::read ? open_existing : m == io::mode::write ? create_always : open_always;
+    const unsigned long flags = attribute_normal | (o.sequential ? flag_sequential_scan : 0) | (o.random ? flag_random_access : 0);
+    _file = intrin::create_file(path.c_str(), _writable ? generic_read | generic_write : generic_read, share_all, disposition, flags);
+    if (!_file) _fail("yw::mapped_file " + path.string());
+    __int64 n = 0;
+    if (!intrin::file_size(_file, &n)) _fail("yw::mapped_file " + path.string());
+    _size = std::max(nat(n), _writable ? size : 0);
+    if (_size == 0) return;
+    _mapping = intrin::create_file_mapping(_file, _writable ? page_readwrite : page_readonly, _writable ? _size : 0);
+    if (!_mapping) _fail("yw::mapped_file " + path.string());
+    _data = static_cast<char*>(intrin::map_view(_mapping, _writable ? file_map_write : file_map_read, 0));
+    if (!_data) _fail("yw::mapped_file " + path.string());
+    if (o.sequential) prefetch();
+  }
+
+  /// maps `size` bytes of zeroed read-write memory backed by the page file
+  explicit mapped_file(nat size, map_options o = {}) : _size(size), _writable(true) {
+    using namespace mapped_impl;
+    if (_size == 0) return;
+    if (o.huge_pages) {
+      const nat rounded = (size + large_page - 1) / large_page * large_page;
+      if ((_mapping = intrin::create_file_mapping(nullptr, page_readwrite | sec_commit | sec_large_pages, rounded)))
+        _data = static_cast<char*>(intrin::map_view(_mapping, file_map_write | file_map_large_pages, rounded));
+      if ((_huge = _data != nullptr)) return;
+      if (_mapping) intrin::close_handle(std::exchange(_mapping, nullptr));
+    }
+    if (!(_mapping = intrin::create_file_mapping(nullptr, page_readwrite, size))) _fail("yw::mapped_file");
+    if (!(_data = static_cast<char*>(intrin::map_view(_mapping, file_map_write, 0)))) _fail("yw::mapped_file");
+  }
+
+  mapped_file(mapped_file&& m) noexcept
+    : _file(std::exchange(m._file, nullptr)), _mapping(std::exchange(m._mapping, nullptr)), _data(std::exchange(m._data, nullptr)),
+      _size(std::exchange(m._size, 0)), _writable(m._writable), _huge(m._huge) {}
+  mapped_file& operator=(mapped_file&& m) noexcept {
+    std::swap(_file, m._file), std::swap(_mapping, m._mapping), std::swap(_data, m._data);
+    std::swap(_size, m._size), std::swap(_writable, m._writable), std::swap(_huge, m._huge);
+    return *this;
+  }
+  ~mapped_file() { _close(); }
+
+  char* data() noexcept { return _data; }
+  const char* data() const noexcept { return _data; }
+  nat size() const noexcept { return _size; }
+  bool empty() const noexcept { return _size == 0; }
+  char* begin() noexcept { return _data; }
+  const char* begin() const noexcept { return _data; }
+  char* end() noexcept { return _data + _size; }
+  const char* end() const noexcept { return _data + _size; }
+  char& operator[](nat i) noexcept { return _data[i]; }
+  const char& operator[](nat i) const noexcept { return _data[i]; }
+  operator string_view() const noexcept { return {_data, _size}; }
+  std::span<std::byte> bytes() noexcept { return std::as_writable_bytes(std::span(_data, _size)); }
+  std::span<const std::byte> bytes() const noexcept { return std::as_bytes(std::span(_data, _size)); }
+
+  bool writable() const noexcept { return _writable; }
+  /// whether the memory is backed by large pages
+  bool huge() const noexcept { return _huge; }
+
+  /// `count` objects of type `T` from byte `offset`, at most as many as fit; `T` must be `const`
+  /// for a read-only mapping and `offset` a multiple of its alignment
+  template<typename T> requires std::is_trivially_copyable_v<std::remove_const_t<T>>
+  std::span<T> view(nat offset = 0, nat count = npos) const {
+    if (!std::is_const_v<T> && !_writable) throw std::logic_error("yw::mapped_file::view: read-only mapping");
+    if (offset > _size || offset % alignof(T)) throw std::out_of_range("yw::mapped_file::view");
+    return {reinterpret_cast<T*>(_data + offset), std::min(count, (_size - offset) / sizeof(T))};
+  }
+
+  /// starts reading `n` bytes from `offset` into memory without waiting
+  void prefetch(nat offset = 0, nat n = npos) const noexcept {
+    if (offset < _size) intrin::prefetch_memory(_data + offset, std::min(n, _size - offset));
+  }
+
+  /// lets the system reclaim the pages of `n` bytes from `offset` that have been read
+  void evict(nat offset = 0, nat n = npos) const noexcept {
+    if (offset < _size) intrin::evict_memory(_data + offset, std::min(n, _size - offset));
+  }
+
+  /// writes modified pages back to the file and flushes it to the device
+  void flush() {
+    if (!_data || !_file || !_writable) return;
+    if (!intrin::flush_view(_data, _size) || !intrin::flush_file(_file))
+      throw std::system_error(int(intrin::last_error()), std::system_category(), "yw::mapped_file::flush");
+  }
+};
+}
+
+export namespace yw { // perf
+
+namespace perf_impl {
+
+/// nanoseconds per tick of `now()`: the invariant TSC, measured against `steady_clock` on
+/// first use (which spins for 20 ms), or 0 for `steady_clock` itself on CPUs without one
+inline double tick() noexcept {
+  static const double t = [] {
+    int r[4];
+    intrin::cpuid(r, 0x80000000);
+    if (unsigned(r[0]) < 0x80000007) return 0.0;
+    intrin::cpuid(r, 0x80000007);
+    if (!(r[3] >> 8 & 1)) return 0.0;
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto c0 = intrin::rdtsc();
+    while (std::chrono::steady_clock::now() - t0 < std::chrono::milliseconds(20));
+    const auto c1 = intrin::rdtsc();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / double(c1 - c0);
+  }();
+  return t;
+}
+
+inline nat now() noexcept {
+  if (tick() == 0) return nat(std::chrono::steady_clock::now().time_since_epoch().count());
+  intrin::mm_lfence();
+  return intrin::rdtsc();
+}
+
+inline double elapsed(nat t0, nat t1) noexcept {
+  const double t = tick();
+  return t == 0 ? std::chrono::duration<double, std::nano>(std::chrono::steady_clock::duration(t1 - t0)).count() : double(t1 - t0) * t;
+}
+
+/// names of the configured hardware counters by slot, and their mask
+inline std::mutex mutex;
+inline std::vector<std::string> names;
+inline std::atomic<nat> mask = 0;
+inline std::atomic<nat> generation = 0;
+
+/// the calling thread's profiling handle, reopened when the counters are reconfigured
+struct thread_profile {
+  void* data = nullptr;
+  nat generation = ~nat(0);
+  ~thread_profile() {
+    if (data) intrin::disable_thread_profiling(data);
+  }
+  void* get() {
+    if (const nat g = perf_impl::generation.load(std::memory_order_acquire); g != generation) {
+      if (data) intrin::disable_thread_profiling(data);
+      data = intrin::enable_thread_profiling(mask.load(std::memory_order_relaxed)), generation = g;
+    }
+    return data;
+  }
+  static thread_profile& local() {
+    thread_local thread_profile p;
+    return p;
+  }
+};
+}
+
+namespace perf {
+
+inline constexpr nat max_counters = 16;
+
+/// what the calling thread did between two readings: nanoseconds, cycles it ran for, times it was
+/// switched out and the hardware counters by slot
+struct sample {
+  double ns = 0;
+  nat cycles = 0, switches = 0;
+  std::array<nat, max_counters> counters{};
+
+  sample& operator+=(const sample& s) noexcept {
+    ns += s.ns, cycles += s.cycles, switches += s.switches;
+    for (nat i = 0; i < max_counters; ++i) counters[i] += s.counters[i];
+    return *this;
+  }
+
+  /// cycles, IPC if a counter is called "instructions", every named counter and context switches, per call
+  std::vector<std::pair<std::string, double>> per_call(nat calls) const {
+    const double n = double(std::max<nat>(calls, 1));
+    std::vector<std::pair<std::string, double>> r{{"cycles", double(cycles) / n}};
+    std::lock_guard lock(perf_impl::mutex);
+    for (nat i = 0; i < perf_impl::names.size(); ++i)
+      if (perf_impl::names[i] == "instructions" && cycles) r.emplace_back("IPC", double(counters[i]) / double(cycles));
+    for (nat i = 0; i < perf_impl::names.size(); ++i)
+      if (!perf_impl::names[i].empty()) r.emplace_back(perf_impl::names[i], double(counters[i]) / n);
+    if (switches) r.emplace_back("switches", double(switches) / n);
+    return r;
+  }
+};
+
+/// names the hardware counters configured on this machine by slot, and reads them from now on
+///
+/// Windows counts hardware events for a thread in the slots an administrator has assigned,
+/// e.g. with `wpr -pmcsources InstructionRetired,CacheMisses,BranchMispredictions`; a slot that
+/// is not assigned reads 0, and without any only times, cycles and context switches are read.
+inline void configure(std::vector<std::string> names) {
+  std::lock_guard lock(perf_impl::mutex);
+  names.resize(std::min(names.size(), max_counters));
+  nat m = 0;
+  for (nat i = 0; i < names.size(); ++i) m |= nat(!names[i].empty()) << i;
+  perf_impl::names = std::move(names);
+  perf_impl::mask.store(m, std::memory_order_relaxed);
+  perf_impl::generation.fetch_add(1, std::memory_order_release);
+}
+
+/// whether the calling thread reads context switches and hardware counters, or only times and cycles
+inline bool hardware() { return perf_impl::thread_profile::local().get() != nullptr; }
+
+/// the calling thread's counters at construction; subtract two for a `sample`
+class counters {
+  nat _tick, _cycles, _switches = 0;
+  std::array<nat, max_counters> _counters{};
+public:
+  counters() {
+    if (const auto data = perf_impl::thread_profile::local().get()) {
+      intrin::performance_data d;
+      if (intrin::read_thread_profiling(data, &d)) {
+        _switches = d.context_switches;
+        for (nat i = 0; i < std::min<nat>(d.counter_count, max_counters); ++i) _counters[i] = d.counters[i].value;
+      }
+    }
+    _cycles = intrin::thread_cycles();
+    _tick = perf_impl::now();
+  }
+  sample operator-(const counters& earlier) const noexcept {
+    sample s{perf_impl::elapsed(earlier._tick, _tick), _cycles - earlier._cycles, _switches - earlier._switches};
+    for (nat i = 0; i < max_counters; ++i) s.counters[i] = _counters[i] - earlier._counters[i];
+    return s;
+  }
+  /// what happened since construction
+  sample elapsed() const { return counters() - *this; }
+};
+
+/// calls into a region and what they added up to
+struct region {
+  std::string name;
+  nat calls = 0;
+  sample total;
+};
+}
+
+namespace perf_impl {
+/// guarded by `mutex`
+inline std::map<std::string, perf::region, std::less<>> regions;
+}
+
+namespace perf {
+
+/// adds what happens from construction to destruction to the region called `name`
+class scope {
+  string_view _name;
+  counters _start;
+public:
+  explicit scope(string_view name) : _name(name) {}
+  scope(const scope&) = delete;
+  scope& operator=(const scope&) = delete;
+  ~scope() {
+    const auto s = _start.elapsed();
+    std::lock_guard lock(perf_impl::mutex);
+    auto it = perf_impl::regions.find(_name);
+    if (it == perf_impl::regions.end()) it = perf_impl::regions.emplace(std::string(_name), region{std::string(_name), 0, {}}).first;
+    ++it->second.calls, it->second.total += s;
+  }
+};
+
+/// the regions measured so far, by name
+inline std::vector<region> regions() {
+  std::lock_guard lock(perf_impl::mutex);
+  std::vector<region> r;
+  for (const auto& [_, g] : perf_impl::regions) r.push_back(g);
+  return r;
+}
+
+inline void reset() {
+  std::lock_guard lock(perf_impl::mutex);
+  perf_impl::regions.clear();
+}
+
+/// a line per region, the most time first, with its counters per call
+inline string report() {
+  auto rs = regions();
+  std::ranges::sort(rs, std::greater{}, [](const region& r) { return r.total.ns; });
+  string out;
+  print_to(out, "{:<32}{:>10}{:>12}{:>14}  {}\n", "region", "calls", "ms", "ns/call", "per call");
+  for (const auto& r : rs) {
+    string counts;
+    for (const auto& [name, v] : r.total.per_call(r.calls)) print_to(counts, "{} {:.2f}  ", name, v);
+    print_to(out, "{:<32}{:>10}{:>12.3f}{:>14.1f}  {}\n", string_view(r.name), r.calls, r.total.ns / 1e6, r.total.ns / double(r.calls), counts);
+  }
+  return out;
+}
+inline void print() {
+  flush();
+  const auto r = report();
+  format_impl::write_stdout(r.data(), r.size());
+}
+
+/// prints the regions when the program exits, after the per-thread print buffers are gone
+inline void print_at_exit() {
+  static const bool registered = (std::atexit([] {
+    const auto r = report();
+    std::fwrite(r.data(), 1, r.size(), stdout);
+  }), true);
+  (void)registered;
+}
+}
+}
+
+export namespace yw { // bench
+
+namespace bench_impl {
+
+inline const void* volatile sink = nullptr;
+
+using perf_impl::tick, perf_impl::now, perf_impl::elapsed;
+
+inline std::string json_string(string_view s) {
+  std::string r = "\"";
+  for (const char c : s)
+    if (c == '"' || c == '\\') r += '\\', r += c;
+    else if (static_cast<unsigned char>(c) < 0x20) r += format("\\u{:04x}", int(c)).c_str();
+    else r += c;
+  return r += '"';
+}
+}
+
+namespace bench {
+
+/// keeps the compiler from discarding `v` and the computation that produced it
+template<typename T> void do_not_optimize(T&& v) noexcept {
+  bench_impl::sink = std::addressof(v);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+/// keeps the compiler from discarding or moving memory writes across this point
+inline void clobber() noexcept { std::atomic_signal_fence(std::memory_order_seq_cst); }
+
+/// seconds spent warming up and measuring each benchmark, the number of samples it is split into
+/// and whether to read `perf` counters over them
+struct options {
+  double warmup = 0.05;
+  double min_time = 0.5;
+  nat samples = 31;
+  bool counters = false;
+};
+
+/// work done by one call, for throughput
+struct units {
+  double bytes = 0;
+  double items = 0;
+};
+
+/// timings of one benchmark in nanoseconds per call over `samples` samples of `iterations` calls
+struct result {
+  std::string name;
+  nat size = 0;
+  nat iterations = 0, samples = 0;
+  double median = 0, mad = 0, mean = 0, min = 0, max = 0, p10 = 0, p90 = 0, p99 = 0;
+  units per_call;
+  std::vector<std::pair<std::string, double>> counters; ///< `perf::sample::per_call`, if asked for
+  double bytes_per_second() const noexcept { return per_call.bytes * 1e9 / median; }
+  double items_per_second() const noexcept { return per_call.items * 1e9 / median; }
+};
+
+/// `n`, `n * factor`, ... up to `last`
+inline std::vector<nat> sizes(nat n, nat last, nat factor = 2) {
+  std::vector<nat> r;
+  for (; n <= last; n *= factor) r.push_back(n);
+  return r;
+}
+
+/// median, MAD, mean, extremes and percentiles of `ns`, which is sorted
+inline void summarize(result& r, std::vector<double>& ns) {
+  std::ranges::sort(ns);
+  const auto at = [&](double p) {
+    const double x = p * double(ns.size() - 1);
+    const nat i = nat(x);
+    return i + 1 < ns.size() ? ns[i] + (ns[i + 1] - ns[i]) * (x - double(i)) : ns[i];
+  };
+  r.samples = ns.size();
+  r.median = at(0.5), r.p10 = at(0.1), r.p90 = at(0.9), r.p99 = at(0.99);
+  r.min = ns.front(), r.max = ns.back();
+  r.mean = std::accumulate(ns.begin(), ns.end(), 0.0) / double(ns.size());
+  std::vector<double> deviations(ns.size());
+  std::ranges::transform(ns, deviations.begin(), [&](double x) { return std::abs(x - r.median); });
+  std::ranges::nth_element(deviations, deviations.begin() + deviations.size() / 2);
+  r.mad = deviations[deviations.size() / 2];
+}
+
+/// times calls of `f` after warming up, with the number of calls per sample calibrated so that
+/// each sample lasts `min_time / samples`
+template<typename F> result measure(F&& f, const options& o = {}) {
+  const auto batch = [&](nat n) {
+    const auto t0 = bench_impl::now();
+    for (nat i = 0; i < n; ++i) f(), clobber();
+    return bench_impl::elapsed(t0, bench_impl::now());
+  };
+  const auto warm = std::chrono::steady_clock::now() + std::chrono::duration<double>(o.warmup);
+  do batch(1);
+  while (std::chrono::steady_clock::now() < warm);
+  const double target = o.min_time * 1e9 / double(std::max<nat>(o.samples, 1));
+  nat n = 1;
+  for (double t; (t = batch(n)) < target && n < (nat(1) << 40);)
+    n = std::max(n * 2, std::min(n * 10, nat(double(n) * target / std::max(t, 1.0) * 1.2)));
+  std::vector<double> ns(std::max<nat>(o.samples, 1));
+  const auto c0 = o.counters ? std::optional<perf::counters>(std::in_place) : std::nullopt;
+  for (auto& x : ns) x = batch(n) / double(n);
+  result r;
+  r.iterations = n;
+  if (c0) r.counters = c0->elapsed().per_call(n * ns.size());
+  summarize(r, ns);
+  return r;
+}
+
+/// runs benchmarks, prints a line for each and writes them all as JSON if asked to
+///
+/// Constructed from `main`'s arguments it understands `--json <path>`, `--filter <substring>`,
+/// `--min-time <seconds>` and `--counters`; `ywlang.py --bench` passes `--json` and compares the
+/// file with a saved baseline.
+class suite {
+  options _options;
+  std::string _json, _filter;
+  std::vector<result> _results;
+  bool _header = false;
+public:
+  explicit suite(options o = {}) : _options(o) {}
+  suite(int argc, char** argv, options o = {}) : _options(o) {
+    for (int i = 1; i < argc; ++i) {
+      const string_view a = argv[i], v = i + 1 < argc ? argv[i + 1] : "";
+      if (a == "--counters") _options.counters = true;
+      else if (i + 1 == argc) break;
+      else if (a == "--json") _json = v, ++i;
+      else if (a == "--filter") _filter = v, ++i;
+      else if (a == "--min-time") yw::from_chars(v.data(), v.data() + v.size(), _options.min_time), ++i;
+    }
+  }
+  suite(const suite&) = delete;
+  suite& operator=(const suite&) = delete;
+  ~suite() {
+    if (!_json.empty()) write_json(_json);
+  }
+
+  const std::vector<result>& results() const noexcept { return _results; }
+
+  /// times `f()`, which does `per_call` work; `size` tells apart runs of one benchmark on several inputs
+  template<typename F> const result* run(string_view name, nat size, F&& f, units per_call = {}) {
+    if (!_filter.empty() && name.find(_filter) == npos) return nullptr;
+    if (!std::exchange(_header, true))
+      println("{:<36}{:>12}{:>10}{:>12}{:>12}{:>14}  {}", "benchmark", "median ns", "mad %", "p10 ns", "p90 ns", "iterations", "throughput");
+    auto& r = _results.emplace_back(measure(f, _options));
+    r.name = name, r.size = size, r.per_call = per_call;
+    const auto label = size ? format("{}/{}", name, size) : format("{}", name);
+    const auto rate = per_call.bytes ? format("{:.3f} GB/s", r.bytes_per_second() / 1e9)
+                    : per_call.items ? format("{:.3f} M/s", r.items_per_second() / 1e6)
+                                     : format("");
+    std::string counts;
+    for (const auto& [counter, v] : r.counters) counts += format("  {} {:.2f}", counter, v).c_str();
+    println("{:<36}{:>12.2f}{:>10.2f}{:>12.2f}{:>12.2f}{:>14}  {}{}", label, r.median, r.mad / r.median * 100, r.p10, r.p90, r.iterations, rate, string_view(counts));
+    return &r;
+  }
+  template<typename F> const result* run(string_view name, F&& f, units per_call = {}) { return run(name, 0, std::forward<F>(f), per_call); }
+
+  /// times `setup(n)()` for each of `ns`, which does `per_call(n)` work; `setup` is not timed
+  template<typename S, typename U> void run(string_view name, const std::vector<nat>& ns, S&& setup, U&& per_call) {
+    for (const nat n : ns) run(name, n, setup(n), per_call(n));
+  }
+
+  /// writes `{"context": {...}, "benchmarks": [...]}` with times in nanoseconds per call
+  void write_json(const std::filesystem::path& path) const {
+    std::ofstream out(path, std::ios::binary);
+    out << "{\n  \"context\": {\"clock\": \"" << (bench_impl::tick() ? "tsc" : "steady_clock") << "\", \"ns_per_tick\": "
+        << (bench_impl::tick() ? bench_impl::tick() : 1.0) << "},\n  \"benchmarks\": [";
+    for (nat i = 0; i < _results.size(); ++i) {
+      const auto& r = _results[i];
+      std::string counters;
+      for (const auto& [name, v] : r.counters) counters += format("{}{}: {}", counters.empty() ? ", \"counters\": {" : ", ", bench_impl::json_string(name), v).c_str();
+      if (!counters.empty()) counters += '}';
+      out << (i ? ",\n" : "\n") << format(
+        R"(    {{"name": {}, "size": {}, "iterations": {}, "samples": {}, "median_ns": {}, "mad_ns": {}, "mean_ns": {}, "min_ns": {}, "max_ns": {}, "p10_ns": {}, "p90_ns": {}, "p99_ns": {}, "bytes_per_second": {}, "items_per_second": {}{}}})",
+        bench_impl::json_string(r.name), r.size, r.iterations, r.samples, r.median, r.mad, r.mean, r.min, r.max, r.p10, r.p90, r.p99,
+        r.per_call.bytes ? r.bytes_per_second() : 0.0, r.per_call.items ? r.items_per_second() : 0.0, string_view(counters)).c_str();
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+}
+}
+
+export namespace yw { // profiler
+
+namespace profiler_impl {
+
+/// the sampled thread's id, then return addresses from the leaf outwards
+using stack = std::vector<void*>;
+
+struct stack_hash {
+  nat operator()(const stack& s) const noexcept {
+    nat h = 0xcbf29ce484222325;
+    for (const auto p : s) h = (h ^ reinterpret_cast<nat>(p)) * 0x100000001b3;
+    return h;
+  }
+};
+
+/// walks the stack of a suspended thread into `frames` without locking or allocating
+inline nat unwind(intrin::thread_context& c, void** frames, nat depth) noexcept {
+  nat n = 0;
+  for (nat sp = 0; n < depth && c.rip() != 0 && c.rsp() > sp;) {
+    const nat pc = c.rip();
+    sp = c.rsp();
+    frames[n++] = reinterpret_cast<void*>(pc);
+    unsigned __int64 base = 0;
+    if (const auto f = intrin::function_entry(pc, &base)) intrin::virtual_unwind(base, pc, f, &c);
+    else if (n == 1) c.rip() = *reinterpret_cast<const nat*>(sp), c.rsp() = sp + 8; // a leaf function keeps no frame
+    else break;
+  }
+  return n;
+}
+
+/// "module!function" of the code at `pc`, or the bare address if there are no symbols
+inline std::string symbol(void* pc) {
+  const nat a = reinterpret_cast<nat>(pc);
+  char name[1024], path[512];
+  const auto n = intrin::function_name(a, name, sizeof(name));
+  if (n == 0) return format("0x{:x}", a).c_str();
+  // the module's file name without its directory and extension
+  string_view m(path, intrin::module_path(a, path, sizeof(path)));
+  m.remove_prefix(m.find_last_of("\\/") + 1);
+  m = m.substr(0, m.rfind('.'));
+  std::string s = std::string(m) + '!' + std::string(name, n);
+  std::ranges::replace(s, ';', ':');
+  return s;
+}
+
+/// " (file:line)" of the code at `pc`, or nothing without line information
+inline std::string source(void* pc) {
+  char file[512];
+  const auto line = intrin::source_line(reinterpret_cast<nat>(pc), file, sizeof(file));
+  return line ? format(" ({}:{})", string_view(file), line).c_str() : std::string();
+}
+}
+
+/// samples the call stacks of every thread in the process on a timer, for flame graphs
+///
+/// Each tick suspends the threads one at a time, walks the stack into a buffer kept for that thread
+/// and resumes it before counting the stack: nothing locks or allocates while a thread is suspended,
+/// since it may hold the heap lock. Stacks are counted as raw addresses, so memory grows with the
+/// number of distinct stacks rather than with time, and are only named when they are written.
+class profiler {
+public:
+  struct options {
+    nat hz = 1000;                 ///< samples per second of each thread
+    nat depth = 64;                ///< frames kept from the leaf of each stack
+    bool threads = false;          ///< whether written stacks start with their thread id
+    std::filesystem::path output;  ///< written as collapsed stacks on destruction, if not empty
+  };
+
+private:
+  struct thread {
+    unsigned long id;
+    void* handle;
+    std::unique_ptr<void*[]> frames;
+    bool alive;
+  };
+  options _options;
+  std::vector<thread> _threads; // only touched by the sampler
+  mutable std::mutex _mutex;
+  std::unordered_map<profiler_impl::stack, nat, profiler_impl::stack_hash> _stacks;
+  std::atomic<nat> _samples = 0, _missed = 0;
+  std::atomic<bool> _stop = false;
+  std::thread _sampler;
+
+  /// opens the threads started since the last call and closes those that have exited
+  void _refresh(unsigned long self) {
+    for (auto& t : _threads) t.alive = false;
+    intrin::for_each_thread([&](unsigned long id) {
+      if (id == self) return;
+      if (const auto it = std::ranges::find(_threads, id, &thread::id); it != _threads.end()) it->alive = true;
+      else if (const auto h = intrin::open_thread(id)) _threads.push_back({id, h, std::make_unique<void*[]>(_options.depth), true});
+    });
+    std::erase_if(_threads, [](const thread& t) { return !t.alive && (intrin::close_handle(t.handle), true); });
+  }
+
+  void _run() {
+    const auto self = intrin::current_thread_id();
+    const auto timer = intrin::new_timer();
+    const auto period = static_cast<long long>(10'000'000 / std::max<nat>(_options.hz, 1));
+    const nat refresh = std::max<nat>(_options.hz / 10, 1);
+    profiler_impl::stack key;
+    for (nat tick = 0; !_stop.load(std::memory_order_acquire); ++tick) {
+      if (tick % refresh == 0) _refresh(self);
+      for (auto& t : _threads) {
+        intrin::thread_context c;
+        if (!intrin::suspend_thread(t.handle)) continue;
+        const nat n = intrin::get_thread_context(t.handle, &c) ? profiler_impl::unwind(c, t.frames.get(), _options.depth) : 0;
+        intrin::resume_thread(t.handle);
+        if (n == 0) {
+          _missed.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+        key.assign(1, reinterpret_cast<void*>(nat(t.id)));
+        key.insert(key.end(), t.frames.get(), t.frames.get() + n);
+        std::lock_guard lock(_mutex);
+        ++_stacks[key];
+        _samples.fetch_add(1, std::memory_order_relaxed);
+      }
+      intrin::wait_timer(timer, period);
+    }
+    for (const auto& t : _threads) intrin::close_handle(t.handle);
+    _threads.clear();
+    intrin::close_handle(timer);
+  }
+
+  /// calls `f(thread id, names from the root to the leaf, count)` for each stack counted so far
+  template<typename F> void _each(F&& f) const {
+    std::vector<std::pair<profiler_impl::stack, nat>> stacks;
+    {
+      std::lock_guard lock(_mutex);
+      stacks.assign(_stacks.begin(), _stacks.end());
+    }
+    std::unordered_map<void*, std::string> names;
+    std::vector<const std::string*> frames;
+    for (const auto& [s, count] : stacks) {
+      frames.clear();
+      for (nat i = s.size(); i-- > 1;) {
+        // return addresses are named by the call before them, which may be the last instruction of a function
+        void* pc = static_cast<char*>(s[i]) - (i > 1);
+        auto [it, fresh] = names.try_emplace(pc);
+        if (fresh) it->second = profiler_impl::symbol(pc);
+        frames.push_back(&it->second);
+      }
+      f(nat(s[0]), std::span<const std::string* const>(frames), count);
+    }
+  }
+
+public:
+  /// starts sampling
+  profiler() : profiler(options{}) {}
+  explicit profiler(options o) : _options(std::move(o)) { start(); }
+  profiler(const profiler&) = delete;
+  profiler& operator=(const profiler&) = delete;
+  ~profiler() {
+    stop();
+    if (!_options.output.empty()) write_collapsed(_options.output);
+  }
+
+  void start() {
+    if (_sampler.joinable()) return;
+    _stop.store(false, std::memory_order_relaxed);
+    _sampler = std::thread([this] { _run(); });
+  }
+  void stop() {
+    if (!_sampler.joinable()) return;
+    _stop.store(true, std::memory_order_release);
+    _sampler.join();
+  }
+  bool running() const noexcept { return _sampler.joinable(); }
+
+  /// stacks sampled so far, and samples lost to threads whose stack could not be read
+  nat samples() const noexcept { return _samples.load(std::memory_order_relaxed); }
+  nat missed() const noexcept { return _missed.load(std::memory_order_relaxed); }
+
+  void clear() {
+    std::lock_guard lock(_mutex);
+    _stacks.clear();
+    _samples = 0, _missed = 0;
+  }
+
+  /// writes `root;caller;function count` lines, the input of flamegraph.pl, speedscope and inferno
+  void write_collapsed(std::ostream& out) const {
+    std::map<std::string, nat> lines;
+    _each([&](nat id, std::span<const std::string* const> frames, nat count) {
+      std::string line = _options.threads ? format("thread {}", id).c_str() : "";
+      for (const auto f : frames) (line.empty() ? line : line += ';') += *f;
+      lines[line] += count;
+    });
+    for (const auto& [line, count] : lines) out << line << ' ' << count << '\n';
+  }
+  void write_collapsed(const std::filesystem::path& path) const {
+    std::ofstream out(path, std::ios::binary);
+    write_collapsed(out);
+  }
+
+  /// prints the `n` functions most often on top of the stack (self) with how often they are on it at all (total)
+  void print_top(nat n = 20) const {
+    std::unordered_map<std::string, std::pair<nat, nat>> functions;
+    std::vector<const std::string*> seen;
+    nat all = 0;
+    _each([&](nat, std::span<const std::string* const> frames, nat count) {
+      all += count;
+      functions[*frames.back()].first += count;
+      seen.clear();
+      for (const auto f : frames)
+        if (std::ranges::find(seen, f) == seen.end()) seen.push_back(f), functions[*f].second += count;
+    });
+    std::vector<std::pair<std::string, std::pair<nat, nat>>> top(functions.begin(), functions.end());
+    std::ranges::sort(top, std::greater{}, [](const auto& e) { return e.second; });
+    println("{:>8}{:>9}  {}", "self %", "total %", "function");
+    for (nat i = 0; i < std::min(n, top.size()); ++i)
+      println("{:>8.2f}{:>9.2f}  {}", top[i].second.first * 100.0 / all, top[i].second.second * 100.0 / all, string_view(top[i].first));
+  }
+};
+}
+
+export namespace yw { // alloc
+
+namespace alloc_impl {
+
+/// in front of every block handed out by the hooks: its size, its call site + 1 (0 if not counted)
+/// and the distance back to what `malloc` returned
+struct header {
+  nat size;
+  unsigned site, pad;
+};
+static_assert(sizeof(header) == 16);
+
+inline constexpr nat shards = 64, classes = 48, site_capacity = 4096, site_probes = 64;
+
+/// counters of the threads that map to it, so that threads rarely write the same cache line
+struct alignas(64) shard {
+  std::atomic<nat> allocations, frees, bytes, freed;
+  std::array<std::atomic<nat>, classes> sizes;
+};
+
+/// a call site: a return address, or a `source_location` from `alloc::site`; entry 0 takes whatever
+/// does not fit in the table
+struct site_entry {
+  std::atomic<nat> key;
+  const void* address;
+  const char* file;
+  const char* function;
+  unsigned line;
+  std::atomic<nat> allocations, bytes, live;
+};
+
+inline constinit std::atomic<bool> hooked = false, tracking = true;
+inline constinit std::atomic<nat> live = 0, peak = 0, blocks = 0, next_shard = 0;
+inline constinit shard shard_table[shards] = {};
+inline constinit site_entry sites[site_capacity] = {};
+
+inline shard& local_shard() noexcept {
+  thread_local nat i = npos;
+  if (i == npos) i = next_shard.fetch_add(1, std::memory_order_relaxed) % shards;
+  return shard_table[i];
+}
+
+inline const std::source_location*& current_site() noexcept {
+  thread_local const std::source_location* s = nullptr;
+  return s;
+}
+
+/// 0 for empty blocks, else `k` for sizes in (2^(k-2), 2^(k-1)]
+inline nat size_class(nat n) noexcept { return std::min<nat>(n ? std::bit_width(n - 1) + 1 : 0, classes - 1); }
+
+inline unsigned site_of(const void* caller) noexcept {
+  const auto loc = current_site();
+  nat key = reinterpret_cast<nat>(caller);
+  if (loc) key = (reinterpret_cast<nat>(loc->file_name()) * 0x100000001b3 ^ loc->line()) * 0x100000001b3 ^ reinterpret_cast<nat>(loc->function_name());
+  key |= 1;
+  for (nat i = (key * 0x9e3779b97f4a7c15) >> 52, n = 0; n < site_probes; i = (i + 1) % site_capacity, ++n) {
+    if (i == 0) continue;
+    auto& e = sites[i];
+    nat k = e.key.load(std::memory_order_acquire);
+    if (k == 0 && e.key.compare_exchange_strong(k, key, std::memory_order_acq_rel)) {
+      if (loc) e.file = loc->file_name(), e.function = loc->function_name(), e.line = loc->line();
+      else e.address = caller;
+      return unsigned(i);
+    }
+    if (k == key) return unsigned(i);
+  }
+  return 0;
+}
+
+/// counts an allocation of `n` bytes by `caller` and returns its site + 1
+inline unsigned record(nat n, const void* caller) noexcept {
+  auto& s = local_shard();
+  s.allocations.fetch_add(1, std::memory_order_relaxed);
+  s.bytes.fetch_add(n, std::memory_order_relaxed);
+  s.sizes[size_class(n)].fetch_add(1, std::memory_order_relaxed);
+  blocks.fetch_add(1, std::memory_order_relaxed);
+  const nat now = live.fetch_add(n, std::memory_order_relaxed) + n;
+  for (nat p = peak.load(std::memory_order_relaxed); now > p && !peak.compare_exchange_weak(p, now, std::memory_order_relaxed););
+  const auto i = site_of(caller);
+  sites[i].allocations.fetch_add(1, std::memory_order_relaxed);
+  sites[i].bytes.fetch_add(n, std::memory_order_relaxed);
+  sites[i].live.fetch_add(n, std::memory_order_relaxed);
+  return i + 1;
+}
+
+/// what the `operator new` hooks call
+inline void* allocate(nat n, nat align, const void* caller) noexcept {
+  // `malloc` returns 16-byte aligned memory, so `align` more bytes leave room for the header and the alignment
+  align = std::max(align, sizeof(header));
+  if (n > SIZE_MAX - align) return nullptr;
+  const auto base = static_cast<std::byte*>(std::malloc(n + align));
+  if (!base) return nullptr;
+  const nat pad = ((reinterpret_cast<nat>(base) + sizeof(header) + align - 1) & ~(align - 1)) - reinterpret_cast<nat>(base);
+  const auto p = base + pad;
+  auto& h = reinterpret_cast<header*>(p)[-1];
+  h.size = n, h.pad = unsigned(pad), h.site = tracking.load(std::memory_order_relaxed) ? record(n, caller) : 0;
+  return p;
+}
+
+/// what the `operator delete` hooks call
+inline void deallocate(void* p) noexcept {
+  if (!p) return;
+  const auto& h = static_cast<header*>(p)[-1];
+  if (h.site) {
+    auto& s = local_shard();
+    s.frees.fetch_add(1, std::memory_order_relaxed);
+    s.freed.fetch_add(h.size, std::memory_order_relaxed);
+    blocks.fetch_sub(1, std::memory_order_relaxed);
+    live.fetch_sub(h.size, std::memory_order_relaxed);
+    sites[h.site - 1].live.fetch_sub(h.size, std::memory_order_relaxed);
+  }
+  std::free(static_cast<std::byte*>(p) - h.pad);
+}
+}
+
+/// heap use counted by the `operator new` and `operator delete` hooks
+///
+/// The hooks are compiled into a program that defines `YW_TRACK_ALLOCATIONS`, which `ywlang.py
+/// --track-allocations` does; they then print a report at exit. Each allocation costs a 16-byte
+/// header and a few relaxed atomic additions, mostly on counters shared by few threads, so the mode
+/// can stay on in staging; `alloc::track(false)` stops the counting and keeps only the header.
+namespace alloc {
+
+/// totals since the start of the program, with allocations counted by size class: `sizes[0]` is
+/// the number of empty ones and `sizes[k]` that of sizes in (2^(k-2), 2^(k-1)]
+struct totals {
+  nat allocations = 0, frees = 0, bytes = 0, freed = 0;
+  nat live_bytes = 0, live_blocks = 0, peak_bytes = 0;
+  std::array<nat, alloc_impl::classes> sizes{};
+};
+
+/// what allocated through one call site: the code calling `operator new`, or the innermost `site`
+struct call_site {
+  std::string name;
+  nat allocations = 0, bytes = 0, live_bytes = 0;
+};
+
+/// whether the hooks are compiled into the program
+inline bool hooked() noexcept { return alloc_impl::hooked.load(std::memory_order_relaxed); }
+
+/// turns the counting on or off; blocks allocated while it is off are not counted when freed either
+inline void track(bool on) noexcept { alloc_impl::tracking.store(on, std::memory_order_relaxed); }
+
+/// counts the calling thread's allocations as made at this line, until destruction
+class site {
+  std::source_location _location;
+  const std::source_location* _previous;
+public:
+  explicit site(std::source_location loc = std::source_location::current()) noexcept
+    : _location(loc), _previous(std::exchange(alloc_impl::current_site(), &_location)) {}
+  site(const site&) = delete;
+  site& operator=(const site&) = delete;
+  ~site() { alloc_impl::current_site() = _previous; }
+};
+
+inline totals current() noexcept {
+  totals t;
+  for (const auto& s : alloc_impl::shard_table) {
+    t.allocations += s.allocations.load(std::memory_order_relaxed), t.frees += s.frees.load(std::memory_order_relaxed);
+    t.bytes += s.bytes.load(std::memory_order_relaxed), t.freed += s.freed.load(std::memory_order_relaxed);
+    for (nat k = 0; k < alloc_impl::classes; ++k) t.sizes[k] += s.sizes[k].load(std::memory_order_relaxed);
+  }
+  t.live_bytes = alloc_impl::live.load(std::memory_order_relaxed);
+  t.live_blocks = alloc_impl::blocks.load(std::memory_order_relaxed);
+  t.peak_bytes = alloc_impl::peak.load(std::memory_order_relaxed);
+  return t;
+}
+
+/// the `n` call sites that allocated most often, or most bytes
+inline std::vector<call_site> top(nat n, bool by_bytes = false) {
+  std::vector<std::pair<const alloc_impl::site_entry*, call_site>> all;
+  for (const auto& e : alloc_impl::sites)
+    if (const nat count = e.allocations.load(std::memory_order_relaxed))
+      all.push_back({&e, {{}, count, e.bytes.load(std::memory_order_relaxed), e.live.load(std::memory_order_relaxed)}});
+  const auto key = [&](const auto& p) { return by_bytes ? p.second.bytes : p.second.allocations; };
+  std::ranges::sort(all, std::greater{}, key);
+  all.resize(std::min(n, all.size()));
+  std::vector<call_site> r;
+  for (auto& [e, c] : all) {
+    if (e == alloc_impl::sites) c.name = "(other sites)";
+    else if (e->file) c.name = format("{}:{} {}", e->file, e->line, e->function).c_str();
+    else {
+      // a return address, whose line is that of the call before it
+      c.name = profiler_impl::symbol(const_cast<void*>(e->address));
+      c.name += profiler_impl::source(static_cast<char*>(const_cast<void*>(e->address)) - 1);
+    }
+    r.push_back(std::move(c));
+  }
+  return r;
+}
+
+/// the totals, the size classes and the top `n` call sites by count and by bytes
+inline string report(nat n = 10) {
+  string out;
+  if (!hooked()) return print_to(out, "alloc: no hooks (build with YW_TRACK_ALLOCATIONS)\n");
+  const auto t = current();
+  print_to(out, "allocations {}  frees {}  allocated {} bytes  live {} bytes in {} blocks  peak {} bytes\n",
+           t.allocations, t.frees, t.bytes, t.live_bytes, t.live_blocks, t.peak_bytes);
+  print_to(out, "{:>14}{:>14}\n", "size up to", "allocations");
+  for (nat k = 0; k < alloc_impl::classes; ++k)
+    if (t.sizes[k]) print_to(out, "{:>14}{:>14}\n", k ? nat(1) << (k - 1) : 0, t.sizes[k]);
+  for (const bool by_bytes : {false, true}) {
+    print_to(out, "{:>14}{:>16}{:>16}  {}\n", "allocations", "bytes", "live bytes", by_bytes ? "call site, by bytes" : "call site, by count");
+    for (const auto& c : top(n, by_bytes)) print_to(out, "{:>14}{:>16}{:>16}  {}\n", c.allocations, c.bytes, c.live_bytes, string_view(c.name));
+  }
+  return out;
+}
+inline void print(nat n = 10) {
+  flush();
+  const auto r = report(n);
+  format_impl::write_stdout(r.data(), r.size());
+}
+
+/// prints the report when the program exits, after the per-thread print buffers are gone
+inline void print_at_exit() {
+  static const bool registered = (std::atexit([] {
+    const auto r = report();
+    std::fwrite(r.data(), 1, r.size(), stdout);
+  }), true);
+  (void)registered;
+}
+}
+}
+
+export namespace yw { // trace
+
+namespace trace_impl {
+
+/// a finished scope: its name, which must outlive the program, and its ticks of `now()`
+struct event {
+  const char* name;
+  nat begin, end;
+};
+
+inline constexpr nat capacity = nat(1) << 16;
+
+/// a thread's last `capacity` events; only the thread writes it, and `count` publishes what it wrote
+struct buffer {
+  unsigned long thread;
+  std::unique_ptr<event[]> events = std::make_unique<event[]>(capacity);
+  std::atomic<nat> count = 0;
+};
+
+inline constinit std::atomic<bool> enabled = false;
+inline constinit std::atomic<nat> origin = 0;
+
+/// every thread's buffer, kept after the thread exits, guarded by `mutex`
+inline std::mutex mutex;
+inline std::vector<std::unique_ptr<buffer>> buffers;
+
+/// `perf_impl::now()` without the fence, which would cost more than the rest of a scope
+inline nat now() noexcept { return perf_impl::tick() == 0 ? perf_impl::now() : nat(intrin::rdtsc()); }
+
+inline buffer& local() {
+  thread_local buffer* b = nullptr;
+  if (!b) {
+    std::lock_guard lock(mutex);
+    b = buffers.emplace_back(std::make_unique<buffer>(intrin::current_thread_id())).get();
+  }
+  return *b;
+}
+
+inline void record(const char* name, nat begin, nat end) noexcept {
+  auto& b = local();
+  const nat n = b.count.load(std::memory_order_relaxed);
+  b.events[n % capacity] = {name, begin, end};
+  b.count.store(n + 1, std::memory_order_release);
+}
+}
+
+/// scopes recorded with timestamps into per-thread ring buffers, written as a Chrome trace
+///
+/// `ywlang.py --trace` puts a `scope` at the top of every function a `.yw` file defines at the start
+/// of a line, unless the line has a `// notrace` comment, and one after each `{` followed by a
+/// `// trace: <name>` comment; it starts the recording
+/// and writes `<file>.trace.json` and a latency summary at exit. The trace opens in `chrome://tracing`
+/// and in the Perfetto UI. A scope costs two reads of the time stamp counter and a store into the
+/// thread's buffer, which keeps the last 65536 events; with the recording off it costs a load.
+namespace trace {
+
+/// a recorded scope, in nanoseconds from `start()`
+struct span {
+  std::string name;
+  unsigned long thread;
+  double begin, ns;
+};
+
+/// the durations of every span called `name`, in nanoseconds
+struct summary {
+  std::string name;
+  nat count = 0;
+  double total = 0, p50 = 0, p90 = 0, p99 = 0, max = 0;
+};
+
+inline bool enabled() noexcept { return trace_impl::enabled.load(std::memory_order_relaxed); }
+
+/// starts recording; times in the trace count from the first call
+inline void start() noexcept {
+  nat zero = 0;
+  trace_impl::origin.compare_exchange_strong(zero, trace_impl::now(), std::memory_order_relaxed);
+  trace_impl::enabled.store(true, std::memory_order_relaxed);
+}
+inline void stop() noexcept { trace_impl::enabled.store(false, std::memory_order_relaxed); }
+
+/// records the time from construction to destruction as a span called `name`, if recording
+class scope {
+  const char* _name;
+  nat _begin;
+public:
+  explicit scope(const char* name) noexcept : _name(enabled() ? name : nullptr), _begin(_name ? trace_impl::now() : 0) {}
+  scope(const scope&) = delete;
+  scope& operator=(const scope&) = delete;
+  ~scope() {
+    if (_name) trace_impl::record(_name, _begin, trace_impl::now());
+  }
+};
+
+/// spans lost because a thread's buffer wrapped around
+inline nat dropped() {
+  std::lock_guard lock(trace_impl::mutex);
+  nat r = 0;
+  for (const auto& b : trace_impl::buffers) r += b->count.load(std::memory_order_acquire) - std::min(b->count.load(std::memory_order_acquire), trace_impl::capacity);
+  return r;
+}
+
+/// the spans still in the buffers, by thread and then by end
+///
+/// Spans that threads are recording meanwhile may be torn, so this is meant for after they finish.
+inline std::vector<span> spans() {
+  std::lock_guard lock(trace_impl::mutex);
+  const nat origin = trace_impl::origin.load(std::memory_order_relaxed);
+  std::vector<span> r;
+  for (const auto& b : trace_impl::buffers) {
+    const nat n = b->count.load(std::memory_order_acquire);
+    for (nat i = n - std::min(n, trace_impl::capacity); i < n; ++i) {
+      const auto& e = b->events[i % trace_impl::capacity];
+      r.push_back({e.name, b->thread, perf_impl::elapsed(origin, e.begin), perf_impl::elapsed(e.begin, e.end)});
+    }
+  }
+  return r;
+}
+
+/// the spans as Chrome trace events: a complete ("X") event each, with microsecond times
+inline void write_chrome(std::ostream& out) {
+  const auto all = spans();
+  out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+  std::set<unsigned long> threads;
+  const char* sep = "\n";
+  for (const auto& s : all) {
+    if (threads.insert(s.thread).second) {
+      out << sep << format(R"({{"ph": "M", "name": "thread_name", "pid": 1, "tid": {}, "args": {{"name": "thread {}"}}}})", s.thread, s.thread).c_str();
+      sep = ",\n";
+    }
+    out << sep << format(R"({{"ph": "X", "name": {}, "pid": 1, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}})",
+                         bench_impl::json_string(s.name), s.thread, s.begin / 1e3, s.ns / 1e3).c_str();
+  }
+  out << "\n]}\n";
+}
+inline void write_chrome(const std::filesystem::path& path) {
+  std::ofstream out(path, std::ios::binary);
+  write_chrome(out);
+}
+
+/// the latency distribution of each name, the most total time first
+inline std::vector<summary> summaries() {
+  std::map<std::string, std::vector<double>, std::less<>> by_name;
+  for (auto& s : spans()) by_name[std::move(s.name)].push_back(s.ns);
+  std::vector<summary> r;
+  for (auto& [name, ns] : by_name) {
+    std::ranges::sort(ns);
+    const auto at = [&](double q) { return ns[std::min(ns.size() - 1, nat(q * double(ns.size())))]; };
+    r.push_back({name, ns.size(), std::accumulate(ns.begin(), ns.end(), 0.0), at(0.5), at(0.9), at(0.99), ns.back()});
+  }
+  std::ranges::sort(r, std::greater{}, &summary::total);
+  return r;
+}
+
+inline string report() {
+  string out;
+  print_to(out, "{:<32}{:>10}{:>12}{:>12}{:>12}{:>12}{:>12}\n", "span", "count", "total ms", "p50 ns", "p90 ns", "p99 ns", "max ns");
+  for (const auto& s : summaries())
+    print_to(out, "{:<32}{:>10}{:>12.3f}{:>12.0f}{:>12.0f}{:>12.0f}{:>12.0f}\n", string_view(s.name), s.count, s.total / 1e6, s.p50, s.p90, s.p99, s.max);
+  if (const nat n = dropped()) print_to(out, "({} older spans were overwritten)\n", n);
+  return out;
+}
+inline void print() {
+  flush();
+  const auto r = report();
+  format_impl::write_stdout(r.data(), r.size());
+}
+
+/// writes the trace to `path` and prints the summary when the program exits, after the per-thread
+/// print buffers are gone
+inline void write_at_exit(std::filesystem::path path) {
+  static std::filesystem::path output;
+  static const bool registered = (std::atexit([] {
+    stop();
+    write_chrome(output);
+    const auto r = report() + format("trace written to {}\n", output.string()).c_str();
+    std::fwrite(r.data(), 1, r.size(), stdout);
+  }), true);
+  (void)registered;
+  output = std::move(path);
+}
+}
+}
+
+export namespace std {
+
+template<yw::nat N> struct formatter<yw::literal_string<N>> : formatter<string_view> {
+  auto format(yw::literal_string<N> s, auto& ctx) const { return formatter<string_view>::format(s, ctx); }
+};
+
+template<> struct formatter<yw::string> : formatter<string_view> {
+  auto format(const yw::string& s, auto& ctx) const { return formatter<string_view>::format(s, ctx); }
+};
+
+template<> struct hash<yw::string> {
+  size_t operator()(const yw::string& s) const noexcept { return hash<string_view>{}(s); }
+};
+}
+
+#endif
+
+// the allocation hooks, compiled into the program that asks for them (see `yw::alloc`)
+#if defined(YW_TRACK_ALLOCATIONS) && YW_TRACK_ALLOCATIONS && !(defined(YWLIB_COMPILE) && YWLIB_COMPILE)
+extern "C" void* _ReturnAddress();
+#pragma intrinsic(_ReturnAddress)
+void* operator new(std::size_t n) {
+  if (const auto p = yw::alloc_impl::allocate(n, 0, _ReturnAddress())) return p;
+  throw std::bad_alloc();
+}
+void* operator new[](std::size_t n) {
+  if (const auto p = yw::alloc_impl::allocate(n, 0, _ReturnAddress())) return p;
+  throw std::bad_alloc();
+}
+void* operator new(std::size_t n, std::align_val_t a) {
+  if (const auto p = yw::alloc_impl::allocate(n, std::size_t(a), _ReturnAddress())) return p;
+  throw std::bad_alloc();
+}
+void* operator new[](std::size_t n, std::align_val_t a) {
+  if (const auto p = yw::alloc_impl::allocate(n, std::size_t(a), _ReturnAddress())) return p;
+  throw std::bad_alloc();
+}
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept { return yw::alloc_impl::allocate(n, 0, _ReturnAddress()); }
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept { return yw::alloc_impl::allocate(n, 0, _ReturnAddress()); }
+void* operator new(std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return yw::alloc_impl::allocate(n, std::size_t(a), _ReturnAddress()); }
+void* operator new[](std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept { return yw::alloc_impl::allocate(n, std::size_t(a), _ReturnAddress()); }
+void operator delete(void* p) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete[](void* p) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { yw::alloc_impl::deallocate(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { yw::alloc_impl::deallocate(p); }
+inline const bool yw_alloc_hooks = (yw::alloc_impl::hooked.store(true), yw::alloc::print_at_exit(), true);
 #endif
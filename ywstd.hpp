@@ -111,6 +111,53 @@ import ywstd;
 #include <version>
 
 #include <immintrin.h>
+#include <intrin.h>
+
+extern "C" __declspec(dllimport) unsigned __int64 __stdcall SetThreadAffinityMask(void* thread, unsigned __int64 mask);
+extern "C" __declspec(dllimport) void* __stdcall CreateFileW(const wchar_t* name, unsigned long access, unsigned long share, void* security, unsigned long disposition, unsigned long flags, void* templ);
+extern "C" __declspec(dllimport) int __stdcall CloseHandle(void* handle);
+extern "C" __declspec(dllimport) int __stdcall ReadFile(void* file, void* buffer, unsigned long size, unsigned long* read, void* overlapped);
+extern "C" __declspec(dllimport) int __stdcall WriteFile(void* file, const void* buffer, unsigned long size, unsigned long* written, void* overlapped);
+extern "C" __declspec(dllimport) int __stdcall FlushFileBuffers(void* file);
+extern "C" __declspec(dllimport) int __stdcall GetFileSizeEx(void* file, __int64* size);
+extern "C" __declspec(dllimport) int __stdcall GetOverlappedResult(void* file, void* overlapped, unsigned long* bytes, int wait);
+extern "C" __declspec(dllimport) unsigned long __stdcall GetLastError();
+extern "C" __declspec(dllimport) void* __stdcall CreateIoCompletionPort(void* file, void* port, unsigned __int64 key, unsigned long threads);
+extern "C" __declspec(dllimport) int __stdcall GetQueuedCompletionStatusEx(void* port, void* entries, unsigned long count, unsigned long* removed, unsigned long ms, int alertable);
+extern "C" __declspec(dllimport) int __stdcall PostQueuedCompletionStatus(void* port, unsigned long bytes, unsigned __int64 key, void* overlapped);
+extern "C" __declspec(dllimport) int __stdcall SetFileCompletionNotificationModes(void* file, unsigned char flags);
+extern "C" __declspec(dllimport) int __stdcall SetFileIoOverlappedRange(void* file, unsigned char* start, unsigned long size);
+extern "C" __declspec(dllimport) void* __stdcall CreateFileMappingW(void* file, void* security, unsigned long protect, unsigned long size_high, unsigned long size_low, const wchar_t* name);
+extern "C" __declspec(dllimport) void* __stdcall MapViewOfFile(void* mapping, unsigned long access, unsigned long offset_high, unsigned long offset_low, unsigned __int64 size);
+extern "C" __declspec(dllimport) int __stdcall UnmapViewOfFile(const void* view);
+extern "C" __declspec(dllimport) int __stdcall FlushViewOfFile(const void* view, unsigned __int64 size);
+extern "C" __declspec(dllimport) int __stdcall PrefetchVirtualMemory(void* process, unsigned __int64 count, void* ranges, unsigned long flags);
+extern "C" __declspec(dllimport) int __stdcall VirtualUnlock(void* address, unsigned __int64 size);
+extern "C" __declspec(dllimport) unsigned long __stdcall GetCurrentThreadId();
+extern "C" __declspec(dllimport) void* __stdcall OpenThread(unsigned long access, int inherit, unsigned long id);
+extern "C" __declspec(dllimport) unsigned long __stdcall SuspendThread(void* thread);
+extern "C" __declspec(dllimport) unsigned long __stdcall ResumeThread(void* thread);
+extern "C" __declspec(dllimport) int __stdcall GetThreadContext(void* thread, void* context);
+extern "C" __declspec(dllimport) void* __stdcall CreateToolhelp32Snapshot(unsigned long flags, unsigned long process);
+extern "C" __declspec(dllimport) int __stdcall Thread32First(void* snapshot, void* entry);
+extern "C" __declspec(dllimport) int __stdcall Thread32Next(void* snapshot, void* entry);
+extern "C" __declspec(dllimport) unsigned long __stdcall GetCurrentProcessId();
+extern "C" __declspec(dllimport) void* __stdcall RtlLookupFunctionEntry(unsigned __int64 pc, unsigned __int64* image_base, void* history);
+extern "C" __declspec(dllimport) void* __stdcall RtlVirtualUnwind(unsigned long type, unsigned __int64 image_base, unsigned __int64 pc, void* function, void* context, void** handler_data, unsigned __int64* frame, void* pointers);
+extern "C" __declspec(dllimport) int __stdcall GetModuleHandleExA(unsigned long flags, const char* name, void** module);
+extern "C" __declspec(dllimport) unsigned long __stdcall GetModuleFileNameA(void* module, char* name, unsigned long size);
+extern "C" __declspec(dllimport) unsigned long __stdcall SymSetOptions(unsigned long options);
+extern "C" __declspec(dllimport) int __stdcall SymInitialize(void* process, const char* path, int invade);
+extern "C" __declspec(dllimport) int __stdcall SymFromAddr(void* process, unsigned __int64 address, unsigned __int64* displacement, void* symbol);
+extern "C" __declspec(dllimport) int __stdcall SymGetLineFromAddr64(void* process, unsigned __int64 address, unsigned long* displacement, void* line);
+#pragma comment(lib, "dbghelp")
+extern "C" __declspec(dllimport) void* __stdcall CreateWaitableTimerExW(void* security, const wchar_t* name, unsigned long flags, unsigned long access);
+extern "C" __declspec(dllimport) int __stdcall SetWaitableTimer(void* timer, const __int64* due, long period, void* routine, void* arg, int resume);
+extern "C" __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void* handle, unsigned long ms);
+extern "C" __declspec(dllimport) int __stdcall QueryThreadCycleTime(void* thread, unsigned __int64* cycles);
+extern "C" __declspec(dllimport) unsigned long __stdcall EnableThreadProfiling(void* thread, unsigned long flags, unsigned __int64 counters, void** data);
+extern "C" __declspec(dllimport) unsigned long __stdcall DisableThreadProfiling(void* data);
+extern "C" __declspec(dllimport) unsigned long __stdcall ReadThreadProfilingData(void* data, unsigned long flags, void* out);
 
 export namespace intrin {
 
@@ -121,1383 +168,1569 @@ using m256 = __m256;
 using m256d = __m256d;
 using m256i = __m256i;
 
-inline __m128i mm_aesenc_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_aesenc_si128(a, b); }
-inline __m128i mm_aesenclast_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_aesenclast_si128(a, b); }
-inline __m128i mm_aesdec_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_aesdec_si128(a, b); }
-inline __m128i mm_aesdeclast_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_aesdeclast_si128(a, b); }
-inline __m128i mm_aesimc_si128(const __m128i& a) noexcept { return _mm_aesimc_si128(a); }
-template<int i> __m128i mm_aeskeygenassist_si128(const __m128i& a) noexcept { return _mm_aeskeygenassist_si128(a, i); }
-inline __m256d mm256_acos_pd(const __m256d& a) noexcept { return _mm256_acos_pd(a); }
-inline __m256 mm256_acos_ps(const __m256& a) noexcept { return _mm256_acos_ps(a); }
-inline __m256d mm256_acosh_pd(const __m256d& a) noexcept { return _mm256_acosh_pd(a); }
-inline __m256 mm256_acosh_ps(const __m256& a) noexcept { return _mm256_acosh_ps(a); }
-inline __m256d mm256_asin_pd(const __m256d& a) noexcept { return _mm256_asin_pd(a); }
-inline __m256 mm256_asin_ps(const __m256& a) noexcept { return _mm256_asin_ps(a); }
-inline __m256d mm256_asinh_pd(const __m256d& a) noexcept { return _mm256_asinh_pd(a); }
-inline __m256 mm256_asinh_ps(const __m256& a) noexcept { return _mm256_asinh_ps(a); }
-inline __m256d mm256_atan_pd(const __m256d& a) noexcept { return _mm256_atan_pd(a); }
-inline __m256 mm256_atan_ps(const __m256& a) noexcept { return _mm256_atan_ps(a); }
-inline __m256d mm256_atan2_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_atan2_pd(a, b); }
-inline __m256 mm256_atan2_ps(const __m256& a, const __m256& b) noexcept { return _mm256_atan2_ps(a, b); }
-inline __m256d mm256_atanh_pd(const __m256d& a) noexcept { return _mm256_atanh_pd(a); }
-inline __m256 mm256_atanh_ps(const __m256& a) noexcept { return _mm256_atanh_ps(a); }
-inline __m256d mm256_cos_pd(const __m256d& a) noexcept { return _mm256_cos_pd(a); }
-inline __m256 mm256_cos_ps(const __m256& a) noexcept { return _mm256_cos_ps(a); }
-inline __m256d mm256_cosd_pd(const __m256d& a) noexcept { return _mm256_cosd_pd(a); }
-inline __m256 mm256_cosd_ps(const __m256& a) noexcept { return _mm256_cosd_ps(a); }
-inline __m256d mm256_cosh_pd(const __m256d& a) noexcept { return _mm256_cosh_pd(a); }
-inline __m256 mm256_cosh_ps(const __m256& a) noexcept { return _mm256_cosh_ps(a); }
-inline __m256d mm256_hypot_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_hypot_pd(a, b); }
-inline __m256 mm256_hypot_ps(const __m256& a, const __m256& b) noexcept { return _mm256_hypot_ps(a, b); }
-inline __m256d mm256_sin_pd(const __m256d& a) noexcept { return _mm256_sin_pd(a); }
-inline __m256 mm256_sin_ps(const __m256& a) noexcept { return _mm256_sin_ps(a); }
-inline __m256d mm256_sincos_pd(__m256d* a, const __m256d& b) noexcept { return _mm256_sincos_pd(a, b); }
-inline __m256 mm256_sincos_ps(__m256* a, const __m256& b) noexcept { return _mm256_sincos_ps(a, b); }
-inline __m256d mm256_sind_pd(const __m256d& a) noexcept { return _mm256_sind_pd(a); }
-inline __m256 mm256_sind_ps(const __m256& a) noexcept { return _mm256_sind_ps(a); }
-inline __m256d mm256_sinh_pd(const __m256d& a) noexcept { return _mm256_sinh_pd(a); }
-inline __m256 mm256_sinh_ps(const __m256& a) noexcept { return _mm256_sinh_ps(a); }
-inline __m256d mm256_tan_pd(const __m256d& a) noexcept { return _mm256_tan_pd(a); }
-inline __m256 mm256_tan_ps(const __m256& a) noexcept { return _mm256_tan_ps(a); }
-inline __m256d mm256_tand_pd(const __m256d& a) noexcept { return _mm256_tand_pd(a); }
-inline __m256 mm256_tand_ps(const __m256& a) noexcept { return _mm256_tand_ps(a); }
-inline __m256d mm256_tanh_pd(const __m256d& a) noexcept { return _mm256_tanh_pd(a); }
-inline __m256 mm256_tanh_ps(const __m256& a) noexcept { return _mm256_tanh_ps(a); }
-inline __m256d mm256_cbrt_pd(const __m256d& a) noexcept { return _mm256_cbrt_pd(a); }
-inline __m256 mm256_cbrt_ps(const __m256& a) noexcept { return _mm256_cbrt_ps(a); }
-inline __m256 mm256_cexp_ps(const __m256& a) noexcept { return _mm256_cexp_ps(a); }
-inline __m256 mm256_clog_ps(const __m256& a) noexcept { return _mm256_clog_ps(a); }
-inline __m256 mm256_csqrt_ps(const __m256& a) noexcept { return _mm256_csqrt_ps(a); }
-inline __m256d mm256_exp_pd(const __m256d& a) noexcept { return _mm256_exp_pd(a); }
-inline __m256 mm256_exp_ps(const __m256& a) noexcept { return _mm256_exp_ps(a); }
-inline __m256d mm256_exp10_pd(const __m256d& a) noexcept { return _mm256_exp10_pd(a); }
-inline __m256 mm256_exp10_ps(const __m256& a) noexcept { return _mm256_exp10_ps(a); }
-inline __m256d mm256_exp2_pd(const __m256d& a) noexcept { return _mm256_exp2_pd(a); }
-inline __m256 mm256_exp2_ps(const __m256& a) noexcept { return _mm256_exp2_ps(a); }
-inline __m256d mm256_expm1_pd(const __m256d& a) noexcept { return _mm256_expm1_pd(a); }
-inline __m256 mm256_expm1_ps(const __m256& a) noexcept { return _mm256_expm1_ps(a); }
-inline __m256d mm256_invcbrt_pd(const __m256d& a) noexcept { return _mm256_invcbrt_pd(a); }
-inline __m256 mm256_invcbrt_ps(const __m256& a) noexcept { return _mm256_invcbrt_ps(a); }
-inline __m256d mm256_invsqrt_pd(const __m256d& a) noexcept { return _mm256_invsqrt_pd(a); }
-inline __m256 mm256_invsqrt_ps(const __m256& a) noexcept { return _mm256_invsqrt_ps(a); }
-inline __m256d mm256_log_pd(const __m256d& a) noexcept { return _mm256_log_pd(a); }
-inline __m256 mm256_log_ps(const __m256& a) noexcept { return _mm256_log_ps(a); }
-inline __m256d mm256_log10_pd(const __m256d& a) noexcept { return _mm256_log10_pd(a); }
-inline __m256 mm256_log10_ps(const __m256& a) noexcept { return _mm256_log10_ps(a); }
-inline __m256d mm256_log1p_pd(const __m256d& a) noexcept { return _mm256_log1p_pd(a); }
-inline __m256 mm256_log1p_ps(const __m256& a) noexcept { return _mm256_log1p_ps(a); }
-inline __m256d mm256_log2_pd(const __m256d& a) noexcept { return _mm256_log2_pd(a); }
-inline __m256 mm256_log2_ps(const __m256& a) noexcept { return _mm256_log2_ps(a); }
-inline __m256d mm256_logb_pd(const __m256d& a) noexcept { return _mm256_logb_pd(a); }
-inline __m256 mm256_logb_ps(const __m256& a) noexcept { return _mm256_logb_ps(a); }
-inline __m256d mm256_pow_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_pow_pd(a, b); }
-inline __m256 mm256_pow_ps(const __m256& a, const __m256& b) noexcept { return _mm256_pow_ps(a, b); }
-inline __m256d mm256_svml_sqrt_pd(const __m256d& a) noexcept { return _mm256_svml_sqrt_pd(a); }
-inline __m256 mm256_svml_sqrt_ps(const __m256& a) noexcept { return _mm256_svml_sqrt_ps(a); }
-inline __m256d mm256_cdfnorm_pd(const __m256d& a) noexcept { return _mm256_cdfnorm_pd(a); }
-inline __m256 mm256_cdfnorm_ps(const __m256& a) noexcept { return _mm256_cdfnorm_ps(a); }
-inline __m256d mm256_cdfnorminv_pd(const __m256d& a) noexcept { return _mm256_cdfnorminv_pd(a); }
-inline __m256 mm256_cdfnorminv_ps(const __m256& a) noexcept { return _mm256_cdfnorminv_ps(a); }
-inline __m256d mm256_erf_pd(const __m256d& a) noexcept { return _mm256_erf_pd(a); }
-inline __m256 mm256_erf_ps(const __m256& a) noexcept { return _mm256_erf_ps(a); }
-inline __m256d mm256_erfc_pd(const __m256d& a) noexcept { return _mm256_erfc_pd(a); }
-inline __m256 mm256_erfc_ps(const __m256& a) noexcept { return _mm256_erfc_ps(a); }
-inline __m256d mm256_erfcinv_pd(const __m256d& a) noexcept { return _mm256_erfcinv_pd(a); }
-inline __m256 mm256_erfcinv_ps(const __m256& a) noexcept { return _mm256_erfcinv_ps(a); }
-inline __m256d mm256_erfinv_pd(const __m256d& a) noexcept { return _mm256_erfinv_pd(a); }
-inline __m256 mm256_erfinv_ps(const __m256& a) noexcept { return _mm256_erfinv_ps(a); }
-inline __m256i mm256_div_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epi8(a, b); }
-inline __m256i mm256_div_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epi16(a, b); }
-inline __m256i mm256_div_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epi32(a, b); }
-inline __m256i mm256_div_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epi64(a, b); }
-inline __m256i mm256_div_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epu8(a, b); }
-inline __m256i mm256_div_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epu16(a, b); }
-inline __m256i mm256_div_epu32(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epu32(a, b); }
-inline __m256i mm256_div_epu64(const __m256i& a, const __m256i& b) noexcept { return _mm256_div_epu64(a, b); }
-inline __m256i mm256_idiv_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_idiv_epi32(a, b); }
-inline __m256i mm256_idivrem_epi32(__m256i* a, const __m256i& b, const __m256i& c) noexcept { return _mm256_idivrem_epi32(a, b, c); }
-inline __m256i mm256_irem_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_irem_epi32(a, b); }
-inline __m256i mm256_rem_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epi8(a, b); }
-inline __m256i mm256_rem_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epi16(a, b); }
-inline __m256i mm256_rem_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epi32(a, b); }
-inline __m256i mm256_rem_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epi64(a, b); }
-inline __m256i mm256_rem_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epu8(a, b); }
-inline __m256i mm256_rem_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epu16(a, b); }
-inline __m256i mm256_rem_epu32(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epu32(a, b); }
-inline __m256i mm256_rem_epu64(const __m256i& a, const __m256i& b) noexcept { return _mm256_rem_epu64(a, b); }
-inline __m256i mm256_udiv_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_udiv_epi32(a, b); }
-inline __m256i mm256_udivrem_epi32(__m256i* a, const __m256i& b, const __m256i& c) noexcept { return _mm256_udivrem_epi32(a, b, c); }
-inline __m256i mm256_urem_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_urem_epi32(a, b); }
-inline __m256d mm256_svml_ceil_pd(const __m256d& a) noexcept { return _mm256_svml_ceil_pd(a); }
-inline __m256 mm256_svml_ceil_ps(const __m256& a) noexcept { return _mm256_svml_ceil_ps(a); }
-inline __m256d mm256_svml_floor_pd(const __m256d& a) noexcept { return _mm256_svml_floor_pd(a); }
-inline __m256 mm256_svml_floor_ps(const __m256& a) noexcept { return _mm256_svml_floor_ps(a); }
-inline __m256d mm256_svml_round_pd(const __m256d& a) noexcept { return _mm256_svml_round_pd(a); }
-inline __m256 mm256_svml_round_ps(const __m256& a) noexcept { return _mm256_svml_round_ps(a); }
-inline __m256d mm256_trunc_pd(const __m256d& a) noexcept { return _mm256_trunc_pd(a); }
-inline __m256 mm256_trunc_ps(const __m256& a) noexcept { return _mm256_trunc_ps(a); }
-inline __m256d mm256_add_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_add_pd(a, b); }
-inline __m256 mm256_add_ps(const __m256& a, const __m256& b) noexcept { return _mm256_add_ps(a, b); }
-inline __m256d mm256_addsub_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_addsub_pd(a, b); }
-inline __m256 mm256_addsub_ps(const __m256& a, const __m256& b) noexcept { return _mm256_addsub_ps(a, b); }
-inline __m256d mm256_div_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_div_pd(a, b); }
-inline __m256 mm256_div_ps(const __m256& a, const __m256& b) noexcept { return _mm256_div_ps(a, b); }
-template<int i> __m256 mm256_dp_ps(const __m256& a, const __m256& b) noexcept { return _mm256_dp_ps(a, b, i); }
-inline __m256d mm256_hadd_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_hadd_pd(a, b); }
-inline __m256 mm256_hadd_ps(const __m256& a, const __m256& b) noexcept { return _mm256_hadd_ps(a, b); }
-inline __m256d mm256_hsub_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_hsub_pd(a, b); }
-inline __m256 mm256_hsub_ps(const __m256& a, const __m256& b) noexcept { return _mm256_hsub_ps(a, b); }
-inline __m256d mm256_mul_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_mul_pd(a, b); }
-inline __m256 mm256_mul_ps(const __m256& a, const __m256& b) noexcept { return _mm256_mul_ps(a, b); }
-inline __m256d mm256_sub_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_sub_pd(a, b); }
-inline __m256 mm256_sub_ps(const __m256& a, const __m256& b) noexcept { return _mm256_sub_ps(a, b); }
-inline __m256d mm256_and_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_and_pd(a, b); }
-inline __m256 mm256_and_ps(const __m256& a, const __m256& b) noexcept { return _mm256_and_ps(a, b); }
-inline __m256d mm256_andnot_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_andnot_pd(a, b); }
-inline __m256 mm256_andnot_ps(const __m256& a, const __m256& b) noexcept { return _mm256_andnot_ps(a, b); }
-inline __m256d mm256_or_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_or_pd(a, b); }
-inline __m256 mm256_or_ps(const __m256& a, const __m256& b) noexcept { return _mm256_or_ps(a, b); }
-inline __m256d mm256_xor_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_xor_pd(a, b); }
-inline __m256 mm256_xor_ps(const __m256& a, const __m256& b) noexcept { return _mm256_xor_ps(a, b); }
-inline int mm256_testz_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_testz_si256(a, b); }
-inline int mm256_testc_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_testc_si256(a, b); }
-inline int mm256_testnzc_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_testnzc_si256(a, b); }
-inline int mm256_testz_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_testz_pd(a, b); }
-inline int mm256_testc_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_testc_pd(a, b); }
-inline int mm256_testnzc_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_testnzc_pd(a, b); }
-inline int mm_testz_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_testz_pd(a, b); }
-inline int mm_testc_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_testc_pd(a, b); }
-inline int mm_testnzc_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_testnzc_pd(a, b); }
-inline int mm256_testz_ps(const __m256& a, const __m256& b) noexcept { return _mm256_testz_ps(a, b); }
-inline int mm256_testc_ps(const __m256& a, const __m256& b) noexcept { return _mm256_testc_ps(a, b); }
-inline int mm256_testnzc_ps(const __m256& a, const __m256& b) noexcept { return _mm256_testnzc_ps(a, b); }
-inline int mm_testz_ps(const __m128& a, const __m128& b) noexcept { return _mm_testz_ps(a, b); }
-inline int mm_testc_ps(const __m128& a, const __m128& b) noexcept { return _mm_testc_ps(a, b); }
-inline int mm_testnzc_ps(const __m128& a, const __m128& b) noexcept { return _mm_testnzc_ps(a, b); }
-template<int i> __m256d mm256_blend_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_blend_pd(a, b, i); }
-template<int i> __m256 mm256_blend_ps(const __m256& a, const __m256& b) noexcept { return _mm256_blend_ps(a, b, i); }
-inline __m256d mm256_blendv_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_blendv_pd(a, b, c); }
-inline __m256 mm256_blendv_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_blendv_ps(a, b, c); }
-template<int i> __m256d mm256_shuffle_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_shuffle_pd(a, b, i); }
-template<int i> __m256 mm256_shuffle_ps(const __m256& a, const __m256& b) noexcept { return _mm256_shuffle_ps(a, b, i); }
-template<int i> __m128 mm256_extractf128_ps(const __m256& a) noexcept { return _mm256_extractf128_ps(a, i); }
-template<int i> __m128d mm256_extractf128_pd(const __m256d& a) noexcept { return _mm256_extractf128_pd(a, i); }
-template<int i> __m128i mm256_extractf128_si256(const __m256i& a) noexcept { return _mm256_extractf128_si256(a, i); }
-template<int i> __int32 mm256_extract_epi32(const __m256i& a) noexcept { return _mm256_extract_epi32(a, i); }
-template<int i> __int64 mm256_extract_epi64(const __m256i& a) noexcept { return _mm256_extract_epi64(a, i); }
-inline __m256 mm256_permutevar_ps(const __m256& a, const __m256i& b) noexcept { return _mm256_permutevar_ps(a, b); }
-inline __m128 mm_permutevar_ps(const __m128& a, const __m128i& b) noexcept { return _mm_permutevar_ps(a, b); }
-template<int i> __m256 mm256_permute_ps(const __m256& a) noexcept { return _mm256_permute_ps(a, i); }
-template<int i> __m128 mm_permute_ps(const __m128& a) noexcept { return _mm_permute_ps(a, i); }
-inline __m256d mm256_permutevar_pd(const __m256d& a, const __m256i& b) noexcept { return _mm256_permutevar_pd(a, b); }
-inline __m128d mm_permutevar_pd(const __m128d& a, const __m128i& b) noexcept { return _mm_permutevar_pd(a, b); }
-template<int i> __m256d mm256_permute_pd(const __m256d& a) noexcept { return _mm256_permute_pd(a, i); }
-template<int i> __m128d mm_permute_pd(const __m128d& a) noexcept { return _mm_permute_pd(a, i); }
-template<int i> __m256 mm256_permute2f128_ps(const __m256& a, const __m256& b) noexcept { return _mm256_permute2f128_ps(a, b, i); }
-template<int i> __m256d mm256_permute2f128_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_permute2f128_pd(a, b, i); }
-template<int i> __m256i mm256_permute2f128_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_permute2f128_si256(a, b, i); }
-template<int i> __m256 mm256_insertf128_ps(const __m256& a, const __m128& b) noexcept { return _mm256_insertf128_ps(a, b, i); }
-template<int i> __m256d mm256_insertf128_pd(const __m256d& a, const __m128d& b) noexcept { return _mm256_insertf128_pd(a, b, i); }
-template<int i> __m256i mm256_insertf128_si256(const __m256i& a, const __m128i& b) noexcept { return _mm256_insertf128_si256(a, b, i); }
-template<int i> __m256i mm256_insert_epi8(const __m256i& a, __int8 b) noexcept { return _mm256_insert_epi8(a, b, i); }
-template<int i> __m256i mm256_insert_epi16(const __m256i& a, __int16 b) noexcept { return _mm256_insert_epi16(a, b, i); }
-template<int i> __m256i mm256_insert_epi32(const __m256i& a, __int32 b) noexcept { return _mm256_insert_epi32(a, b, i); }
-template<int i> __m256i mm256_insert_epi64(const __m256i& a, __int64 b) noexcept { return _mm256_insert_epi64(a, b, i); }
-inline __m256d mm256_unpackhi_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_unpackhi_pd(a, b); }
-inline __m256 mm256_unpackhi_ps(const __m256& a, const __m256& b) noexcept { return _mm256_unpackhi_ps(a, b); }
-inline __m256d mm256_unpacklo_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_unpacklo_pd(a, b); }
-inline __m256 mm256_unpacklo_ps(const __m256& a, const __m256& b) noexcept { return _mm256_unpacklo_ps(a, b); }
-inline __m256d mm256_max_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_max_pd(a, b); }
-inline __m256 mm256_max_ps(const __m256& a, const __m256& b) noexcept { return _mm256_max_ps(a, b); }
-inline __m256d mm256_min_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_min_pd(a, b); }
-inline __m256 mm256_min_ps(const __m256& a, const __m256& b) noexcept { return _mm256_min_ps(a, b); }
-template<int i> __m256d mm256_round_pd(const __m256d& a) noexcept { return _mm256_round_pd(a, i); }
-template<int i> __m256 mm256_round_ps(const __m256& a) noexcept { return _mm256_round_ps(a, i); }
-inline __m256 mm256_floor_ps(const __m256& a) noexcept { return _mm256_floor_ps(a); }
-inline __m256 mm256_ceil_ps(const __m256& a) noexcept { return _mm256_ceil_ps(a); }
-inline __m256d mm256_floor_pd(const __m256d& a) noexcept { return _mm256_floor_pd(a); }
-inline __m256d mm256_ceil_pd(const __m256d& a) noexcept { return _mm256_ceil_pd(a); }
-template<int i> __m128d mm_cmp_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmp_pd(a, b, i); }
-template<int i> __m256d mm256_cmp_pd(const __m256d& a, const __m256d& b) noexcept { return _mm256_cmp_pd(a, b, i); }
-template<int i> __m128 mm_cmp_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmp_ps(a, b, i); }
-template<int i> __m256 mm256_cmp_ps(const __m256& a, const __m256& b) noexcept { return _mm256_cmp_ps(a, b, i); }
-template<int i> __m128d mm_cmp_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmp_sd(a, b, i); }
-template<int i> __m128 mm_cmp_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmp_ss(a, b, i); }
-inline __m256d mm256_cvtepi32_pd(const __m128i& a) noexcept { return _mm256_cvtepi32_pd(a); }
-inline __m256 mm256_cvtepi32_ps(const __m256i& a) noexcept { return _mm256_cvtepi32_ps(a); }
-inline __m128 mm256_cvtpd_ps(const __m256d& a) noexcept { return _mm256_cvtpd_ps(a); }
-inline __m256i mm256_cvtps_epi32(const __m256& a) noexcept { return _mm256_cvtps_epi32(a); }
-inline __m256d mm256_cvtps_pd(const __m128& a) noexcept { return _mm256_cvtps_pd(a); }
-inline __m128i mm256_cvttpd_epi32(const __m256d& a) noexcept { return _mm256_cvttpd_epi32(a); }
-inline __m128i mm256_cvtpd_epi32(const __m256d& a) noexcept { return _mm256_cvtpd_epi32(a); }
-inline __m256i mm256_cvttps_epi32(const __m256& a) noexcept { return _mm256_cvttps_epi32(a); }
-inline float mm256_cvtss_f32(const __m256& a) noexcept { return _mm256_cvtss_f32(a); }
-inline double mm256_cvtsd_f64(const __m256d& a) noexcept { return _mm256_cvtsd_f64(a); }
-inline int mm256_cvtsi256_si32(const __m256i& a) noexcept { return _mm256_cvtsi256_si32(a); }
-inline void mm256_zeroall() noexcept { _mm256_zeroall(); }
-inline void mm256_zeroupper() noexcept { _mm256_zeroupper(); }
-inline __m256 mm256_undefined_ps() noexcept { return _mm256_undefined_ps(); }
-inline __m256d mm256_undefined_pd() noexcept { return _mm256_undefined_pd(); }
-inline __m256i mm256_undefined_si256() noexcept { return _mm256_undefined_si256(); }
-inline __m256 mm256_broadcast_ss(float const* a) noexcept { return _mm256_broadcast_ss(a); }
-inline __m128 mm_broadcast_ss(float const* a) noexcept { return _mm_broadcast_ss(a); }
-inline __m256d mm256_broadcast_sd(double const* a) noexcept { return _mm256_broadcast_sd(a); }
-inline __m256 mm256_broadcast_ps(__m128 const* a) noexcept { return _mm256_broadcast_ps(a); }
-inline __m256d mm256_broadcast_pd(__m128d const* a) noexcept { return _mm256_broadcast_pd(a); }
-inline __m256d mm256_load_pd(double const* a) noexcept { return _mm256_load_pd(a); }
-inline __m256 mm256_load_ps(float const* a) noexcept { return _mm256_load_ps(a); }
-inline __m256d mm256_loadu_pd(double const* a) noexcept { return _mm256_loadu_pd(a); }
-inline __m256 mm256_loadu_ps(float const* a) noexcept { return _mm256_loadu_ps(a); }
-inline __m256i mm256_load_si256(__m256i const* a) noexcept { return _mm256_load_si256(a); }
-inline __m256i mm256_loadu_si256(__m256i const* a) noexcept { return _mm256_loadu_si256(a); }
-inline __m256d mm256_maskload_pd(double const* a, const __m256i& b) noexcept { return _mm256_maskload_pd(a, b); }
-inline __m128d mm_maskload_pd(double const* a, const __m128i& b) noexcept { return _mm_maskload_pd(a, b); }
-inline __m256 mm256_maskload_ps(float const* a, const __m256i& b) noexcept { return _mm256_maskload_ps(a, b); }
-inline __m128 mm_maskload_ps(float const* a, const __m128i& b) noexcept { return _mm_maskload_ps(a, b); }
-inline __m256i mm256_lddqu_si256(__m256i const* a) noexcept { return _mm256_lddqu_si256(a); }
-inline __m256 mm256_loadu2_m128(float const* a, float const* b) noexcept { return _mm256_loadu2_m128(a, b); }
-inline __m256d mm256_loadu2_m128d(double const* a, double const* b) noexcept { return _mm256_loadu2_m128d(a, b); }
-inline __m256i mm256_loadu2_m128i(__m128i const* a, __m128i const* b) noexcept { return _mm256_loadu2_m128i(a, b); }
-inline void mm256_store_pd(double* a, const __m256d& b) noexcept { _mm256_store_pd(a, b); }
-inline void mm256_store_ps(float* a, const __m256& b) noexcept { _mm256_store_ps(a, b); }
-inline void mm256_storeu_pd(double* a, const __m256d& b) noexcept { _mm256_storeu_pd(a, b); }
-inline void mm256_storeu_ps(float* a, const __m256& b) noexcept { _mm256_storeu_ps(a, b); }
-inline void mm256_store_si256(__m256i* a, const __m256i& b) noexcept { _mm256_store_si256(a, b); }
-inline void mm256_storeu_si256(__m256i* a, const __m256i& b) noexcept { _mm256_storeu_si256(a, b); }
-inline void mm256_maskstore_pd(double* a, const __m256i& b, const __m256d& c) noexcept { _mm256_maskstore_pd(a, b, c); }
-inline void mm_maskstore_pd(double* a, const __m128i& b, const __m128d& c) noexcept { _mm_maskstore_pd(a, b, c); }
-inline void mm256_maskstore_ps(float* a, const __m256i& b, const __m256& c) noexcept { _mm256_maskstore_ps(a, b, c); }
-inline void mm_maskstore_ps(float* a, const __m128i& b, const __m128& c) noexcept { _mm_maskstore_ps(a, b, c); }
-inline void mm256_stream_si256(void* a, const __m256i& b) noexcept { _mm256_stream_si256((__m256i*)a, b); }
-inline void mm256_stream_pd(void* a, const __m256d& b) noexcept { _mm256_stream_pd((double*)a, b); }
-inline void mm256_stream_ps(void* a, const __m256& b) noexcept { _mm256_stream_ps((float*)a, b); }
-inline void mm256_storeu2_m128(float* a, float* b, const __m256& c) noexcept { _mm256_storeu2_m128(a, b, c); }
-inline void mm256_storeu2_m128d(double* a, double* b, const __m256d& c) noexcept { _mm256_storeu2_m128d(a, b, c); }
-inline void mm256_storeu2_m128i(__m128i* a, __m128i* b, const __m256i& c) noexcept { _mm256_storeu2_m128i(a, b, c); }
-inline __m256 mm256_movehdup_ps(const __m256& a) noexcept { return _mm256_movehdup_ps(a); }
-inline __m256 mm256_moveldup_ps(const __m256& a) noexcept { return _mm256_moveldup_ps(a); }
-inline __m256d mm256_movedup_pd(const __m256d& a) noexcept { return _mm256_movedup_pd(a); }
-inline __m256 mm256_rcp_ps(const __m256& a) noexcept { return _mm256_rcp_ps(a); }
-inline __m256 mm256_rsqrt_ps(const __m256& a) noexcept { return _mm256_rsqrt_ps(a); }
-inline __m256d mm256_sqrt_pd(const __m256d& a) noexcept { return _mm256_sqrt_pd(a); }
-inline __m256 mm256_sqrt_ps(const __m256& a) noexcept { return _mm256_sqrt_ps(a); }
-inline int mm256_movemask_pd(const __m256d& a) noexcept { return _mm256_movemask_pd(a); }
-inline int mm256_movemask_ps(const __m256& a) noexcept { return _mm256_movemask_ps(a); }
-inline __m256d mm256_setzero_pd() noexcept { return _mm256_setzero_pd(); }
-inline __m256 mm256_setzero_ps() noexcept { return _mm256_setzero_ps(); }
-inline __m256i mm256_setzero_si256() noexcept { return _mm256_setzero_si256(); }
-inline __m256d mm256_set_pd(double e3, double e2, double e1, double e0) noexcept { return _mm256_set_pd(e3, e2, e1, e0); }
-inline __m256 mm256_set_ps(float e7, float e6, float e5, float e4, float e3, float e2, float e1, float e0) noexcept { //
+__forceinline __m128i __vectorcall mm_aesenc_si128(__m128i a, __m128i b) noexcept { return _mm_aesenc_si128(a, b); }
+__forceinline __m128i __vectorcall mm_aesenclast_si128(__m128i a, __m128i b) noexcept { return _mm_aesenclast_si128(a, b); }
+__forceinline __m128i __vectorcall mm_aesdec_si128(__m128i a, __m128i b) noexcept { return _mm_aesdec_si128(a, b); }
+__forceinline __m128i __vectorcall mm_aesdeclast_si128(__m128i a, __m128i b) noexcept { return _mm_aesdeclast_si128(a, b); }
+__forceinline __m128i __vectorcall mm_aesimc_si128(__m128i a) noexcept { return _mm_aesimc_si128(a); }
+template<int i> __forceinline __m128i __vectorcall mm_aeskeygenassist_si128(__m128i a) noexcept { return _mm_aeskeygenassist_si128(a, i); }
+__forceinline __m256d __vectorcall mm256_acos_pd(__m256d a) noexcept { return _mm256_acos_pd(a); }
+__forceinline __m256 __vectorcall mm256_acos_ps(__m256 a) noexcept { return _mm256_acos_ps(a); }
+__forceinline __m256d __vectorcall mm256_acosh_pd(__m256d a) noexcept { return _mm256_acosh_pd(a); }
+__forceinline __m256 __vectorcall mm256_acosh_ps(__m256 a) noexcept { return _mm256_acosh_ps(a); }
+__forceinline __m256d __vectorcall mm256_asin_pd(__m256d a) noexcept { return _mm256_asin_pd(a); }
+__forceinline __m256 __vectorcall mm256_asin_ps(__m256 a) noexcept { return _mm256_asin_ps(a); }
+__forceinline __m256d __vectorcall mm256_asinh_pd(__m256d a) noexcept { return _mm256_asinh_pd(a); }
+__forceinline __m256 __vectorcall mm256_asinh_ps(__m256 a) noexcept { return _mm256_asinh_ps(a); }
+__forceinline __m256d __vectorcall mm256_atan_pd(__m256d a) noexcept { return _mm256_atan_pd(a); }
+__forceinline __m256 __vectorcall mm256_atan_ps(__m256 a) noexcept { return _mm256_atan_ps(a); }
+__forceinline __m256d __vectorcall mm256_atan2_pd(__m256d a, __m256d b) noexcept { return _mm256_atan2_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_atan2_ps(__m256 a, __m256 b) noexcept { return _mm256_atan2_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_atanh_pd(__m256d a) noexcept { return _mm256_atanh_pd(a); }
+__forceinline __m256 __vectorcall mm256_atanh_ps(__m256 a) noexcept { return _mm256_atanh_ps(a); }
+__forceinline __m256d __vectorcall mm256_cos_pd(__m256d a) noexcept { return _mm256_cos_pd(a); }
+__forceinline __m256 __vectorcall mm256_cos_ps(__m256 a) noexcept { return _mm256_cos_ps(a); }
+__forceinline __m256d __vectorcall mm256_cosd_pd(__m256d a) noexcept { return _mm256_cosd_pd(a); }
+__forceinline __m256 __vectorcall mm256_cosd_ps(__m256 a) noexcept { return _mm256_cosd_ps(a); }
+__forceinline __m256d __vectorcall mm256_cosh_pd(__m256d a) noexcept { return _mm256_cosh_pd(a); }
+__forceinline __m256 __vectorcall mm256_cosh_ps(__m256 a) noexcept { return _mm256_cosh_ps(a); }
+__forceinline __m256d __vectorcall mm256_hypot_pd(__m256d a, __m256d b) noexcept { return _mm256_hypot_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_hypot_ps(__m256 a, __m256 b) noexcept { return _mm256_hypot_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_sin_pd(__m256d a) noexcept { return _mm256_sin_pd(a); }
+__forceinline __m256 __vectorcall mm256_sin_ps(__m256 a) noexcept { return _mm256_sin_ps(a); }
+__forceinline __m256d __vectorcall mm256_sincos_pd(__m256d* a, __m256d b) noexcept { return _mm256_sincos_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_sincos_ps(__m256* a, __m256 b) noexcept { return _mm256_sincos_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_sind_pd(__m256d a) noexcept { return _mm256_sind_pd(a); }
+__forceinline __m256 __vectorcall mm256_sind_ps(__m256 a) noexcept { return _mm256_sind_ps(a); }
+__forceinline __m256d __vectorcall mm256_sinh_pd(__m256d a) noexcept { return _mm256_sinh_pd(a); }
+__forceinline __m256 __vectorcall mm256_sinh_ps(__m256 a) noexcept { return _mm256_sinh_ps(a); }
+__forceinline __m256d __vectorcall mm256_tan_pd(__m256d a) noexcept { return _mm256_tan_pd(a); }
+__forceinline __m256 __vectorcall mm256_tan_ps(__m256 a) noexcept { return _mm256_tan_ps(a); }
+__forceinline __m256d __vectorcall mm256_tand_pd(__m256d a) noexcept { return _mm256_tand_pd(a); }
+__forceinline __m256 __vectorcall mm256_tand_ps(__m256 a) noexcept { return _mm256_tand_ps(a); }
+__forceinline __m256d __vectorcall mm256_tanh_pd(__m256d a) noexcept { return _mm256_tanh_pd(a); }
+__forceinline __m256 __vectorcall mm256_tanh_ps(__m256 a) noexcept { return _mm256_tanh_ps(a); }
+__forceinline __m256d __vectorcall mm256_cbrt_pd(__m256d a) noexcept { return _mm256_cbrt_pd(a); }
+__forceinline __m256 __vectorcall mm256_cbrt_ps(__m256 a) noexcept { return _mm256_cbrt_ps(a); }
+__forceinline __m256 __vectorcall mm256_cexp_ps(__m256 a) noexcept { return _mm256_cexp_ps(a); }
+__forceinline __m256 __vectorcall mm256_clog_ps(__m256 a) noexcept { return _mm256_clog_ps(a); }
+__forceinline __m256 __vectorcall mm256_csqrt_ps(__m256 a) noexcept { return _mm256_csqrt_ps(a); }
+__forceinline __m256d __vectorcall mm256_exp_pd(__m256d a) noexcept { return _mm256_exp_pd(a); }
+__forceinline __m256 __vectorcall mm256_exp_ps(__m256 a) noexcept { return _mm256_exp_ps(a); }
+__forceinline __m256d __vectorcall mm256_exp10_pd(__m256d a) noexcept { return _mm256_exp10_pd(a); }
+__forceinline __m256 __vectorcall mm256_exp10_ps(__m256 a) noexcept { return _mm256_exp10_ps(a); }
+__forceinline __m256d __vectorcall mm256_exp2_pd(__m256d a) noexcept { return _mm256_exp2_pd(a); }
+__forceinline __m256 __vectorcall mm256_exp2_ps(__m256 a) noexcept { return _mm256_exp2_ps(a); }
+__forceinline __m256d __vectorcall mm256_expm1_pd(__m256d a) noexcept { return _mm256_expm1_pd(a); }
+__forceinline __m256 __vectorcall mm256_expm1_ps(__m256 a) noexcept { return _mm256_expm1_ps(a); }
+__forceinline __m256d __vectorcall mm256_invcbrt_pd(__m256d a) noexcept { return _mm256_invcbrt_pd(a); }
+__forceinline __m256 __vectorcall mm256_invcbrt_ps(__m256 a) noexcept { return _mm256_invcbrt_ps(a); }
+__forceinline __m256d __vectorcall mm256_invsqrt_pd(__m256d a) noexcept { return _mm256_invsqrt_pd(a); }
+__forceinline __m256 __vectorcall mm256_invsqrt_ps(__m256 a) noexcept { return _mm256_invsqrt_ps(a); }
+__forceinline __m256d __vectorcall mm256_log_pd(__m256d a) noexcept { return _mm256_log_pd(a); }
+__forceinline __m256 __vectorcall mm256_log_ps(__m256 a) noexcept { return _mm256_log_ps(a); }
+__forceinline __m256d __vectorcall mm256_log10_pd(__m256d a) noexcept { return _mm256_log10_pd(a); }
+__forceinline __m256 __vectorcall mm256_log10_ps(__m256 a) noexcept { return _mm256_log10_ps(a); }
+__forceinline __m256d __vectorcall mm256_log1p_pd(__m256d a) noexcept { return _mm256_log1p_pd(a); }
+__forceinline __m256 __vectorcall mm256_log1p_ps(__m256 a) noexcept { return _mm256_log1p_ps(a); }
+__forceinline __m256d __vectorcall mm256_log2_pd(__m256d a) noexcept { return _mm256_log2_pd(a); }
+__forceinline __m256 __vectorcall mm256_log2_ps(__m256 a) noexcept { return _mm256_log2_ps(a); }
+__forceinline __m256d __vectorcall mm256_logb_pd(__m256d a) noexcept { return _mm256_logb_pd(a); }
+__forceinline __m256 __vectorcall mm256_logb_ps(__m256 a) noexcept { return _mm256_logb_ps(a); }
+__forceinline __m256d __vectorcall mm256_pow_pd(__m256d a, __m256d b) noexcept { return _mm256_pow_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_pow_ps(__m256 a, __m256 b) noexcept { return _mm256_pow_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_svml_sqrt_pd(__m256d a) noexcept { return _mm256_svml_sqrt_pd(a); }
+__forceinline __m256 __vectorcall mm256_svml_sqrt_ps(__m256 a) noexcept { return _mm256_svml_sqrt_ps(a); }
+__forceinline __m256d __vectorcall mm256_cdfnorm_pd(__m256d a) noexcept { return _mm256_cdfnorm_pd(a); }
+__forceinline __m256 __vectorcall mm256_cdfnorm_ps(__m256 a) noexcept { return _mm256_cdfnorm_ps(a); }
+__forceinline __m256d __vectorcall mm256_cdfnorminv_pd(__m256d a) noexcept { return _mm256_cdfnorminv_pd(a); }
+__forceinline __m256 __vectorcall mm256_cdfnorminv_ps(__m256 a) noexcept { return _mm256_cdfnorminv_ps(a); }
+__forceinline __m256d __vectorcall mm256_erf_pd(__m256d a) noexcept { return _mm256_erf_pd(a); }
+__forceinline __m256 __vectorcall mm256_erf_ps(__m256 a) noexcept { return _mm256_erf_ps(a); }
+__forceinline __m256d __vectorcall mm256_erfc_pd(__m256d a) noexcept { return _mm256_erfc_pd(a); }
+__forceinline __m256 __vectorcall mm256_erfc_ps(__m256 a) noexcept { return _mm256_erfc_ps(a); }
+__forceinline __m256d __vectorcall mm256_erfcinv_pd(__m256d a) noexcept { return _mm256_erfcinv_pd(a); }
+__forceinline __m256 __vectorcall mm256_erfcinv_ps(__m256 a) noexcept { return _mm256_erfcinv_ps(a); }
+__forceinline __m256d __vectorcall mm256_erfinv_pd(__m256d a) noexcept { return _mm256_erfinv_pd(a); }
+__forceinline __m256 __vectorcall mm256_erfinv_ps(__m256 a) noexcept { return _mm256_erfinv_ps(a); }
+__forceinline __m256i __vectorcall mm256_div_epi8(__m256i a, __m256i b) noexcept { return _mm256_div_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epi16(__m256i a, __m256i b) noexcept { return _mm256_div_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epi32(__m256i a, __m256i b) noexcept { return _mm256_div_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epi64(__m256i a, __m256i b) noexcept { return _mm256_div_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epu8(__m256i a, __m256i b) noexcept { return _mm256_div_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epu16(__m256i a, __m256i b) noexcept { return _mm256_div_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epu32(__m256i a, __m256i b) noexcept { return _mm256_div_epu32(a, b); }
+__forceinline __m256i __vectorcall mm256_div_epu64(__m256i a, __m256i b) noexcept { return _mm256_div_epu64(a, b); }
+__forceinline __m256i __vectorcall mm256_idiv_epi32(__m256i a, __m256i b) noexcept { return _mm256_idiv_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_idivrem_epi32(__m256i* a, __m256i b, __m256i c) noexcept { return _mm256_idivrem_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_irem_epi32(__m256i a, __m256i b) noexcept { return _mm256_irem_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epi8(__m256i a, __m256i b) noexcept { return _mm256_rem_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epi16(__m256i a, __m256i b) noexcept { return _mm256_rem_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epi32(__m256i a, __m256i b) noexcept { return _mm256_rem_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epi64(__m256i a, __m256i b) noexcept { return _mm256_rem_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epu8(__m256i a, __m256i b) noexcept { return _mm256_rem_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epu16(__m256i a, __m256i b) noexcept { return _mm256_rem_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epu32(__m256i a, __m256i b) noexcept { return _mm256_rem_epu32(a, b); }
+__forceinline __m256i __vectorcall mm256_rem_epu64(__m256i a, __m256i b) noexcept { return _mm256_rem_epu64(a, b); }
+__forceinline __m256i __vectorcall mm256_udiv_epi32(__m256i a, __m256i b) noexcept { return _mm256_udiv_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_udivrem_epi32(__m256i* a, __m256i b, __m256i c) noexcept { return _mm256_udivrem_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_urem_epi32(__m256i a, __m256i b) noexcept { return _mm256_urem_epi32(a, b); }
+__forceinline __m256d __vectorcall mm256_svml_ceil_pd(__m256d a) noexcept { return _mm256_svml_ceil_pd(a); }
+__forceinline __m256 __vectorcall mm256_svml_ceil_ps(__m256 a) noexcept { return _mm256_svml_ceil_ps(a); }
+__forceinline __m256d __vectorcall mm256_svml_floor_pd(__m256d a) noexcept { return _mm256_svml_floor_pd(a); }
+__forceinline __m256 __vectorcall mm256_svml_floor_ps(__m256 a) noexcept { return _mm256_svml_floor_ps(a); }
+__forceinline __m256d __vectorcall mm256_svml_round_pd(__m256d a) noexcept { return _mm256_svml_round_pd(a); }
+__forceinline __m256 __vectorcall mm256_svml_round_ps(__m256 a) noexcept { return _mm256_svml_round_ps(a); }
+__forceinline __m256d __vectorcall mm256_trunc_pd(__m256d a) noexcept { return _mm256_trunc_pd(a); }
+__forceinline __m256 __vectorcall mm256_trunc_ps(__m256 a) noexcept { return _mm256_trunc_ps(a); }
+__forceinline __m256d __vectorcall mm256_add_pd(__m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_add_ps(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_addsub_pd(__m256d a, __m256d b) noexcept { return _mm256_addsub_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_addsub_ps(__m256 a, __m256 b) noexcept { return _mm256_addsub_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_div_pd(__m256d a, __m256d b) noexcept { return _mm256_div_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_div_ps(__m256 a, __m256 b) noexcept { return _mm256_div_ps(a, b); }
+template<int i> __forceinline __m256 __vectorcall mm256_dp_ps(__m256 a, __m256 b) noexcept { return _mm256_dp_ps(a, b, i); }
+__forceinline __m256d __vectorcall mm256_hadd_pd(__m256d a, __m256d b) noexcept { return _mm256_hadd_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_hadd_ps(__m256 a, __m256 b) noexcept { return _mm256_hadd_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_hsub_pd(__m256d a, __m256d b) noexcept { return _mm256_hsub_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_hsub_ps(__m256 a, __m256 b) noexcept { return _mm256_hsub_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_mul_pd(__m256d a, __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_mul_ps(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_sub_pd(__m256d a, __m256d b) noexcept { return _mm256_sub_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_sub_ps(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_and_pd(__m256d a, __m256d b) noexcept { return _mm256_and_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_and_ps(__m256 a, __m256 b) noexcept { return _mm256_and_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_andnot_pd(__m256d a, __m256d b) noexcept { return _mm256_andnot_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_andnot_ps(__m256 a, __m256 b) noexcept { return _mm256_andnot_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_or_pd(__m256d a, __m256d b) noexcept { return _mm256_or_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_or_ps(__m256 a, __m256 b) noexcept { return _mm256_or_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_xor_pd(__m256d a, __m256d b) noexcept { return _mm256_xor_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_xor_ps(__m256 a, __m256 b) noexcept { return _mm256_xor_ps(a, b); }
+__forceinline int __vectorcall mm256_testz_si256(__m256i a, __m256i b) noexcept { return _mm256_testz_si256(a, b); }
+__forceinline int __vectorcall mm256_testc_si256(__m256i a, __m256i b) noexcept { return _mm256_testc_si256(a, b); }
+__forceinline int __vectorcall mm256_testnzc_si256(__m256i a, __m256i b) noexcept { return _mm256_testnzc_si256(a, b); }
+__forceinline int __vectorcall mm256_testz_pd(__m256d a, __m256d b) noexcept { return _mm256_testz_pd(a, b); }
+__forceinline int __vectorcall mm256_testc_pd(__m256d a, __m256d b) noexcept { return _mm256_testc_pd(a, b); }
+__forceinline int __vectorcall mm256_testnzc_pd(__m256d a, __m256d b) noexcept { return _mm256_testnzc_pd(a, b); }
+__forceinline int __vectorcall mm_testz_pd(__m128d a, __m128d b) noexcept { return _mm_testz_pd(a, b); }
+__forceinline int __vectorcall mm_testc_pd(__m128d a, __m128d b) noexcept { return _mm_testc_pd(a, b); }
+__forceinline int __vectorcall mm_testnzc_pd(__m128d a, __m128d b) noexcept { return _mm_testnzc_pd(a, b); }
+__forceinline int __vectorcall mm256_testz_ps(__m256 a, __m256 b) noexcept { return _mm256_testz_ps(a, b); }
+__forceinline int __vectorcall mm256_testc_ps(__m256 a, __m256 b) noexcept { return _mm256_testc_ps(a, b); }
+__forceinline int __vectorcall mm256_testnzc_ps(__m256 a, __m256 b) noexcept { return _mm256_testnzc_ps(a, b); }
+__forceinline int __vectorcall mm_testz_ps(__m128 a, __m128 b) noexcept { return _mm_testz_ps(a, b); }
+__forceinline int __vectorcall mm_testc_ps(__m128 a, __m128 b) noexcept { return _mm_testc_ps(a, b); }
+__forceinline int __vectorcall mm_testnzc_ps(__m128 a, __m128 b) noexcept { return _mm_testnzc_ps(a, b); }
+template<int i> __forceinline __m256d __vectorcall mm256_blend_pd(__m256d a, __m256d b) noexcept { return _mm256_blend_pd(a, b, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_blend_ps(__m256 a, __m256 b) noexcept { return _mm256_blend_ps(a, b, i); }
+__forceinline __m256d __vectorcall mm256_blendv_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_blendv_pd(a, b, c); }
+__forceinline __m256 __vectorcall mm256_blendv_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_blendv_ps(a, b, c); }
+template<int i> __forceinline __m256d __vectorcall mm256_shuffle_pd(__m256d a, __m256d b) noexcept { return _mm256_shuffle_pd(a, b, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_shuffle_ps(__m256 a, __m256 b) noexcept { return _mm256_shuffle_ps(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm256_extractf128_ps(__m256 a) noexcept { return _mm256_extractf128_ps(a, i); }
+template<int i> __forceinline __m128d __vectorcall mm256_extractf128_pd(__m256d a) noexcept { return _mm256_extractf128_pd(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm256_extractf128_si256(__m256i a) noexcept { return _mm256_extractf128_si256(a, i); }
+template<int i> __forceinline __int32 __vectorcall mm256_extract_epi32(__m256i a) noexcept { return _mm256_extract_epi32(a, i); }
+template<int i> __forceinline __int64 __vectorcall mm256_extract_epi64(__m256i a) noexcept { return _mm256_extract_epi64(a, i); }
+__forceinline __m256 __vectorcall mm256_permutevar_ps(__m256 a, __m256i b) noexcept { return _mm256_permutevar_ps(a, b); }
+__forceinline __m128 __vectorcall mm_permutevar_ps(__m128 a, __m128i b) noexcept { return _mm_permutevar_ps(a, b); }
+template<int i> __forceinline __m256 __vectorcall mm256_permute_ps(__m256 a) noexcept { return _mm256_permute_ps(a, i); }
+template<int i> __forceinline __m128 __vectorcall mm_permute_ps(__m128 a) noexcept { return _mm_permute_ps(a, i); }
+__forceinline __m256d __vectorcall mm256_permutevar_pd(__m256d a, __m256i b) noexcept { return _mm256_permutevar_pd(a, b); }
+__forceinline __m128d __vectorcall mm_permutevar_pd(__m128d a, __m128i b) noexcept { return _mm_permutevar_pd(a, b); }
+template<int i> __forceinline __m256d __vectorcall mm256_permute_pd(__m256d a) noexcept { return _mm256_permute_pd(a, i); }
+template<int i> __forceinline __m128d __vectorcall mm_permute_pd(__m128d a) noexcept { return _mm_permute_pd(a, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_permute2f128_ps(__m256 a, __m256 b) noexcept { return _mm256_permute2f128_ps(a, b, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_permute2f128_pd(__m256d a, __m256d b) noexcept { return _mm256_permute2f128_pd(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_permute2f128_si256(__m256i a, __m256i b) noexcept { return _mm256_permute2f128_si256(a, b, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_insertf128_ps(__m256 a, __m128 b) noexcept { return _mm256_insertf128_ps(a, b, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_insertf128_pd(__m256d a, __m128d b) noexcept { return _mm256_insertf128_pd(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_insertf128_si256(__m256i a, __m128i b) noexcept { return _mm256_insertf128_si256(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_insert_epi8(__m256i a, __int8 b) noexcept { return _mm256_insert_epi8(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_insert_epi16(__m256i a, __int16 b) noexcept { return _mm256_insert_epi16(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_insert_epi32(__m256i a, __int32 b) noexcept { return _mm256_insert_epi32(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_insert_epi64(__m256i a, __int64 b) noexcept { return _mm256_insert_epi64(a, b, i); }
+__forceinline __m256d __vectorcall mm256_unpackhi_pd(__m256d a, __m256d b) noexcept { return _mm256_unpackhi_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_unpackhi_ps(__m256 a, __m256 b) noexcept { return _mm256_unpackhi_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_unpacklo_pd(__m256d a, __m256d b) noexcept { return _mm256_unpacklo_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_unpacklo_ps(__m256 a, __m256 b) noexcept { return _mm256_unpacklo_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_max_pd(__m256d a, __m256d b) noexcept { return _mm256_max_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_max_ps(__m256 a, __m256 b) noexcept { return _mm256_max_ps(a, b); }
+__forceinline __m256d __vectorcall mm256_min_pd(__m256d a, __m256d b) noexcept { return _mm256_min_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_min_ps(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+template<int i> __forceinline __m256d __vectorcall mm256_round_pd(__m256d a) noexcept { return _mm256_round_pd(a, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_round_ps(__m256 a) noexcept { return _mm256_round_ps(a, i); }
+__forceinline __m256 __vectorcall mm256_floor_ps(__m256 a) noexcept { return _mm256_floor_ps(a); }
+__forceinline __m256 __vectorcall mm256_ceil_ps(__m256 a) noexcept { return _mm256_ceil_ps(a); }
+__forceinline __m256d __vectorcall mm256_floor_pd(__m256d a) noexcept { return _mm256_floor_pd(a); }
+__forceinline __m256d __vectorcall mm256_ceil_pd(__m256d a) noexcept { return _mm256_ceil_pd(a); }
+template<int i> __forceinline __m128d __vectorcall mm_cmp_pd(__m128d a, __m128d b) noexcept { return _mm_cmp_pd(a, b, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_cmp_pd(__m256d a, __m256d b) noexcept { return _mm256_cmp_pd(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm_cmp_ps(__m128 a, __m128 b) noexcept { return _mm_cmp_ps(a, b, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_cmp_ps(__m256 a, __m256 b) noexcept { return _mm256_cmp_ps(a, b, i); }
+template<int i> __forceinline __m128d __vectorcall mm_cmp_sd(__m128d a, __m128d b) noexcept { return _mm_cmp_sd(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm_cmp_ss(__m128 a, __m128 b) noexcept { return _mm_cmp_ss(a, b, i); }
+__forceinline __m256d __vectorcall mm256_cvtepi32_pd(__m128i a) noexcept { return _mm256_cvtepi32_pd(a); }
+__forceinline __m256 __vectorcall mm256_cvtepi32_ps(__m256i a) noexcept { return _mm256_cvtepi32_ps(a); }
+__forceinline __m128 __vectorcall mm256_cvtpd_ps(__m256d a) noexcept { return _mm256_cvtpd_ps(a); }
+__forceinline __m256i __vectorcall mm256_cvtps_epi32(__m256 a) noexcept { return _mm256_cvtps_epi32(a); }
+__forceinline __m256d __vectorcall mm256_cvtps_pd(__m128 a) noexcept { return _mm256_cvtps_pd(a); }
+__forceinline __m128i __vectorcall mm256_cvttpd_epi32(__m256d a) noexcept { return _mm256_cvttpd_epi32(a); }
+__forceinline __m128i __vectorcall mm256_cvtpd_epi32(__m256d a) noexcept { return _mm256_cvtpd_epi32(a); }
+__forceinline __m256i __vectorcall mm256_cvttps_epi32(__m256 a) noexcept { return _mm256_cvttps_epi32(a); }
+__forceinline float __vectorcall mm256_cvtss_f32(__m256 a) noexcept { return _mm256_cvtss_f32(a); }
+__forceinline double __vectorcall mm256_cvtsd_f64(__m256d a) noexcept { return _mm256_cvtsd_f64(a); }
+__forceinline int __vectorcall mm256_cvtsi256_si32(__m256i a) noexcept { return _mm256_cvtsi256_si32(a); }
+__forceinline void mm256_zeroall() noexcept { _mm256_zeroall(); }
+__forceinline void mm256_zeroupper() noexcept { _mm256_zeroupper(); }
+__forceinline __m256 __vectorcall mm256_undefined_ps() noexcept { return _mm256_undefined_ps(); }
+__forceinline __m256d __vectorcall mm256_undefined_pd() noexcept { return _mm256_undefined_pd(); }
+__forceinline __m256i __vectorcall mm256_undefined_si256() noexcept { return _mm256_undefined_si256(); }
+__forceinline __m256 __vectorcall mm256_broadcast_ss(float const* a) noexcept { return _mm256_broadcast_ss(a); }
+__forceinline __m128 __vectorcall mm_broadcast_ss(float const* a) noexcept { return _mm_broadcast_ss(a); }
+__forceinline __m256d __vectorcall mm256_broadcast_sd(double const* a) noexcept { return _mm256_broadcast_sd(a); }
+__forceinline __m256 __vectorcall mm256_broadcast_ps(__m128 const* a) noexcept { return _mm256_broadcast_ps(a); }
+__forceinline __m256d __vectorcall mm256_broadcast_pd(__m128d const* a) noexcept { return _mm256_broadcast_pd(a); }
+__forceinline __m256d __vectorcall mm256_load_pd(double const* a) noexcept { return _mm256_load_pd(a); }
+__forceinline __m256 __vectorcall mm256_load_ps(float const* a) noexcept { return _mm256_load_ps(a); }
+__forceinline __m256d __vectorcall mm256_loadu_pd(double const* a) noexcept { return _mm256_loadu_pd(a); }
+__forceinline __m256 __vectorcall mm256_loadu_ps(float const* a) noexcept { return _mm256_loadu_ps(a); }
+__forceinline __m256i __vectorcall mm256_load_si256(__m256i const* a) noexcept { return _mm256_load_si256(a); }
+__forceinline __m256i __vectorcall mm256_loadu_si256(__m256i const* a) noexcept { return _mm256_loadu_si256(a); }
+__forceinline __m256d __vectorcall mm256_maskload_pd(double const* a, __m256i b) noexcept { return _mm256_maskload_pd(a, b); }
+__forceinline __m128d __vectorcall mm_maskload_pd(double const* a, __m128i b) noexcept { return _mm_maskload_pd(a, b); }
+__forceinline __m256 __vectorcall mm256_maskload_ps(float const* a, __m256i b) noexcept { return _mm256_maskload_ps(a, b); }
+__forceinline __m128 __vectorcall mm_maskload_ps(float const* a, __m128i b) noexcept { return _mm_maskload_ps(a, b); }
+__forceinline __m256i __vectorcall mm256_lddqu_si256(__m256i const* a) noexcept { return _mm256_lddqu_si256(a); }
+__forceinline __m256 __vectorcall mm256_loadu2_m128(float const* a, float const* b) noexcept { return _mm256_loadu2_m128(a, b); }
+__forceinline __m256d __vectorcall mm256_loadu2_m128d(double const* a, double const* b) noexcept { return _mm256_loadu2_m128d(a, b); }
+__forceinline __m256i __vectorcall mm256_loadu2_m128i(__m128i const* a, __m128i const* b) noexcept { return _mm256_loadu2_m128i(a, b); }
+__forceinline void __vectorcall mm256_store_pd(double* a, __m256d b) noexcept { _mm256_store_pd(a, b); }
+__forceinline void __vectorcall mm256_store_ps(float* a, __m256 b) noexcept { _mm256_store_ps(a, b); }
+__forceinline void __vectorcall mm256_storeu_pd(double* a, __m256d b) noexcept { _mm256_storeu_pd(a, b); }
+__forceinline void __vectorcall mm256_storeu_ps(float* a, __m256 b) noexcept { _mm256_storeu_ps(a, b); }
+__forceinline void __vectorcall mm256_store_si256(__m256i* a, __m256i b) noexcept { _mm256_store_si256(a, b); }
+__forceinline void __vectorcall mm256_storeu_si256(__m256i* a, __m256i b) noexcept { _mm256_storeu_si256(a, b); }
+__forceinline void __vectorcall mm256_maskstore_pd(double* a, __m256i b, __m256d c) noexcept { _mm256_maskstore_pd(a, b, c); }
+__forceinline void __vectorcall mm_maskstore_pd(double* a, __m128i b, __m128d c) noexcept { _mm_maskstore_pd(a, b, c); }
+__forceinline void __vectorcall mm256_maskstore_ps(float* a, __m256i b, __m256 c) noexcept { _mm256_maskstore_ps(a, b, c); }
+__forceinline void __vectorcall mm_maskstore_ps(float* a, __m128i b, __m128 c) noexcept { _mm_maskstore_ps(a, b, c); }
+__forceinline void __vectorcall mm256_stream_si256(void* a, __m256i b) noexcept { _mm256_stream_si256((__m256i*)a, b); }
+__forceinline void __vectorcall mm256_stream_pd(void* a, __m256d b) noexcept { _mm256_stream_pd((double*)a, b); }
+__forceinline void __vectorcall mm256_stream_ps(void* a, __m256 b) noexcept { _mm256_stream_ps((float*)a, b); }
+__forceinline void __vectorcall mm256_storeu2_m128(float* a, float* b, __m256 c) noexcept { _mm256_storeu2_m128(a, b, c); }
+__forceinline void __vectorcall mm256_storeu2_m128d(double* a, double* b, __m256d c) noexcept { _mm256_storeu2_m128d(a, b, c); }
+__forceinline void __vectorcall mm256_storeu2_m128i(__m128i* a, __m128i* b, __m256i c) noexcept { _mm256_storeu2_m128i(a, b, c); }
+__forceinline __m256 __vectorcall mm256_movehdup_ps(__m256 a) noexcept { return _mm256_movehdup_ps(a); }
+__forceinline __m256 __vectorcall mm256_moveldup_ps(__m256 a) noexcept { return _mm256_moveldup_ps(a); }
+__forceinline __m256d __vectorcall mm256_movedup_pd(__m256d a) noexcept { return _mm256_movedup_pd(a); }
+__forceinline __m256 __vectorcall mm256_rcp_ps(__m256 a) noexcept { return _mm256_rcp_ps(a); }
+__forceinline __m256 __vectorcall mm256_rsqrt_ps(__m256 a) noexcept { return _mm256_rsqrt_ps(a); }
+__forceinline __m256d __vectorcall mm256_sqrt_pd(__m256d a) noexcept { return _mm256_sqrt_pd(a); }
+__forceinline __m256 __vectorcall mm256_sqrt_ps(__m256 a) noexcept { return _mm256_sqrt_ps(a); }
+__forceinline int __vectorcall mm256_movemask_pd(__m256d a) noexcept { return _mm256_movemask_pd(a); }
+__forceinline int __vectorcall mm256_movemask_ps(__m256 a) noexcept { return _mm256_movemask_ps(a); }
+__forceinline __m256d __vectorcall mm256_setzero_pd() noexcept { return _mm256_setzero_pd(); }
+__forceinline __m256 __vectorcall mm256_setzero_ps() noexcept { return _mm256_setzero_ps(); }
+__forceinline __m256i __vectorcall mm256_setzero_si256() noexcept { return _mm256_setzero_si256(); }
+__forceinline __m256d __vectorcall mm256_set_pd(double e3, double e2, double e1, double e0) noexcept { return _mm256_set_pd(e3, e2, e1, e0); }
+__forceinline __m256 __vectorcall mm256_set_ps(float e7, float e6, float e5, float e4, float e3, float e2, float e1, float e0) noexcept { //
   return _mm256_set_ps(e7, e6, e5, e4, e3, e2, e1, e0);
 }
-inline __m256i mm256_set_epi8(char e31, char e30, char e29, char e28, char e27, char e26, char e25, char e24, //
-                              char e23, char e22, char e21, char e20, char e19, char e18, char e17, char e16, //
-                              char e15, char e14, char e13, char e12, char e11, char e10, char e9, char e8,   //
-                              char e7, char e6, char e5, char e4, char e3, char e2, char e1, char e0) noexcept {
+__forceinline __m256i __vectorcall mm256_set_epi8(char e31, char e30, char e29, char e28, char e27, char e26, char e25, char e24, //
+                                                  char e23, char e22, char e21, char e20, char e19, char e18, char e17, char e16, //
+                                                  char e15, char e14, char e13, char e12, char e11, char e10, char e9, char e8,   //
+                                                  char e7, char e6, char e5, char e4, char e3, char e2, char e1, char e0) noexcept {
   return _mm256_set_epi8(e31, e30, e29, e28, e27, e26, e25, e24, e23, e22, e21, e20, e19, e18, e17, e16, //
                          e15, e14, e13, e12, e11, e10, e9, e8, e7, e6, e5, e4, e3, e2, e1, e0);
 }
-inline __m256i mm256_set_epi16(short e15, short e14, short e13, short e12, short e11, short e10, short e9, short e8, //
-                               short e7, short e6, short e5, short e4, short e3, short e2, short e1, short e0) noexcept {
+__forceinline __m256i __vectorcall mm256_set_epi16(short e15, short e14, short e13, short e12, short e11, short e10, short e9, short e8, //
+                                                   short e7, short e6, short e5, short e4, short e3, short e2, short e1, short e0) noexcept {
   return _mm256_set_epi16(e15, e14, e13, e12, e11, e10, e9, e8, e7, e6, e5, e4, e3, e2, e1, e0);
 }
-template<int i> __m256i mm256_set_epi32(int e7, int e6, int e5, int e4, int e3, int e2, int e1, int e0) noexcept { //
-  return _mm256_set_epi32(e7, e6, e5, e4, e3, e2, e1, e0, i);
+__forceinline __m256i __vectorcall mm256_set_epi32(int e7, int e6, int e5, int e4, int e3, int e2, int e1, int e0) noexcept { //
+  return _mm256_set_epi32(e7, e6, e5, e4, e3, e2, e1, e0);
 }
-inline __m256i mm256_set_epi64(__int64 e3, __int64 e2, __int64 e1, __int64 e0) noexcept { return _mm256_set_epi64x(e3, e2, e1, e0); }
-inline __m256i mm256_set_epi64x(__int64 e3, __int64 e2, __int64 e1, __int64 e0) noexcept { return _mm256_set_epi64x(e3, e2, e1, e0); }
-inline __m256d mm256_setr_pd(double e0, double e1, double e2, double e3) noexcept { return _mm256_setr_pd(e0, e1, e2, e3); }
-inline __m256 mm256_setr_ps(float e0, float e1, float e2, float e3, float e4, float e5, float e6, float e7) noexcept { //
+__forceinline __m256i __vectorcall mm256_set_epi64(__int64 e3, __int64 e2, __int64 e1, __int64 e0) noexcept { return _mm256_set_epi64x(e3, e2, e1, e0); }
+__forceinline __m256i __vectorcall mm256_set_epi64x(__int64 e3, __int64 e2, __int64 e1, __int64 e0) noexcept { return _mm256_set_epi64x(e3, e2, e1, e0); }
+__forceinline __m256d __vectorcall mm256_setr_pd(double e0, double e1, double e2, double e3) noexcept { return _mm256_setr_pd(e0, e1, e2, e3); }
+__forceinline __m256 __vectorcall mm256_setr_ps(float e0, float e1, float e2, float e3, float e4, float e5, float e6, float e7) noexcept { //
   return _mm256_setr_ps(e0, e1, e2, e3, e4, e5, e6, e7);
 }
-inline __m256i mm256_setr_epi8(char e0, char e1, char e2, char e3, char e4, char e5, char e6, char e7,         //
-                               char e8, char e9, char e10, char e11, char e12, char e13, char e14, char e15,   //
-                               char e16, char e17, char e18, char e19, char e20, char e21, char e22, char e23, //
-                               char e24, char e25, char e26, char e27, char e28, char e29, char e30, char e31) noexcept {
+__forceinline __m256i __vectorcall mm256_setr_epi8(char e0, char e1, char e2, char e3, char e4, char e5, char e6, char e7,         //
+                                                   char e8, char e9, char e10, char e11, char e12, char e13, char e14, char e15,   //
+                                                   char e16, char e17, char e18, char e19, char e20, char e21, char e22, char e23, //
+                                                   char e24, char e25, char e26, char e27, char e28, char e29, char e30, char e31) noexcept {
   return _mm256_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, //
                           e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31);
 }
-inline __m256i mm256_setr_epi16(short e0, short e1, short e2, short e3, short e4, short e5, short e6, short e7, //
-                                short e8, short e9, short e10, short e11, short e12, short e13, short e14, short e15) noexcept {
+__forceinline __m256i __vectorcall mm256_setr_epi16(short e0, short e1, short e2, short e3, short e4, short e5, short e6, short e7, //
+                                                    short e8, short e9, short e10, short e11, short e12, short e13, short e14, short e15) noexcept {
   return _mm256_setr_epi16(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15);
 }
-template<int i> __m256i mm256_setr_epi32(int e0, int e1, int e2, int e3) noexcept { return _mm256_setr_epi32(e0, e1, e2, e3, i); }
-inline __m256i mm256_setr_epi64x(__int64 e0, __int64 e1, __int64 e2, __int64 e3) noexcept { return _mm256_setr_epi64x(e0, e1, e2, e3); }
+__forceinline __m256i __vectorcall mm256_setr_epi32(int e0, int e1, int e2, int e3, int e4, int e5, int e6, int e7) noexcept { //
+  return _mm256_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7);
+}
+__forceinline __m256i __vectorcall mm256_setr_epi64x(__int64 e0, __int64 e1, __int64 e2, __int64 e3) noexcept { return _mm256_setr_epi64x(e0, e1, e2, e3); }
 
-inline __m256d mm256_set1_pd(double a) noexcept { return _mm256_set1_pd(a); }
-inline __m256 mm256_set1_ps(float a) noexcept { return _mm256_set1_ps(a); }
-inline __m256i mm256_set1_epi8(char a) noexcept { return _mm256_set1_epi8(a); }
-inline __m256i mm256_set1_epi16(short a) noexcept { return _mm256_set1_epi16(a); }
-template<int i> __m256i mm256_set1_epi32() noexcept { return _mm256_set1_epi32(i); }
-inline __m256i mm256_set1_epi64x(long long a) noexcept { return _mm256_set1_epi64x(a); }
-inline __m256 mm256_set_m128(const __m128& a, const __m128& b) noexcept { return _mm256_set_m128(a, b); }
-inline __m256d mm256_set_m128d(const __m128d& a, const __m128d& b) noexcept { return _mm256_set_m128d(a, b); }
-inline __m256i mm256_set_m128i(const __m128i& a, const __m128i& b) noexcept { return _mm256_set_m128i(a, b); }
-inline __m256 mm256_setr_m128(const __m128& a, const __m128& b) noexcept { return _mm256_setr_m128(a, b); }
-inline __m256d mm256_setr_m128d(const __m128d& a, const __m128d& b) noexcept { return _mm256_setr_m128d(a, b); }
-inline __m256i mm256_setr_m128i(const __m128i& a, const __m128i& b) noexcept { return _mm256_setr_m128i(a, b); }
-inline __m256 mm256_castpd_ps(const __m256d& a) noexcept { return _mm256_castpd_ps(a); }
-inline __m256d mm256_castps_pd(const __m256& a) noexcept { return _mm256_castps_pd(a); }
-inline __m256i mm256_castps_si256(const __m256& a) noexcept { return _mm256_castps_si256(a); }
-inline __m256i mm256_castpd_si256(const __m256d& a) noexcept { return _mm256_castpd_si256(a); }
-inline __m256 mm256_castsi256_ps(const __m256i& a) noexcept { return _mm256_castsi256_ps(a); }
-inline __m256d mm256_castsi256_pd(const __m256i& a) noexcept { return _mm256_castsi256_pd(a); }
-inline __m128 mm256_castps256_ps128(const __m256& a) noexcept { return _mm256_castps256_ps128(a); }
-inline __m128d mm256_castpd256_pd128(const __m256d& a) noexcept { return _mm256_castpd256_pd128(a); }
-inline __m128i mm256_castsi256_si128(const __m256i& a) noexcept { return _mm256_castsi256_si128(a); }
-inline __m256 mm256_castps128_ps256(const __m128& a) noexcept { return _mm256_castps128_ps256(a); }
-inline __m256d mm256_castpd128_pd256(const __m128d& a) noexcept { return _mm256_castpd128_pd256(a); }
-inline __m256i mm256_castsi128_si256(const __m128i& a) noexcept { return _mm256_castsi128_si256(a); }
-inline __m256 mm256_zextps128_ps256(const __m128& a) noexcept { return _mm256_zextps128_ps256(a); }
-inline __m256d mm256_zextpd128_pd256(const __m128d& a) noexcept { return _mm256_zextpd128_pd256(a); }
-inline __m256i mm256_zextsi128_si256(const __m128i& a) noexcept { return _mm256_zextsi128_si256(a); }
-template<int i> int mm256_extract_epi8(const __m256i& a) noexcept { return _mm256_extract_epi8(a, i); }
-template<int i> int mm256_extract_epi16(const __m256i& a) noexcept { return _mm256_extract_epi16(a, i); }
-template<int i> __m256i mm256_blend_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_blend_epi16(a, b, i); }
-template<int i> __m128i mm_blend_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_blend_epi32(a, b, i); }
-template<int i> __m256i mm256_blend_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_blend_epi32(a, b, i); }
-inline __m256i mm256_blendv_epi8(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_blendv_epi8(a, b, c); }
-inline __m128i mm_broadcastb_epi8(const __m128i& a) noexcept { return _mm_broadcastb_epi8(a); }
-inline __m256i mm256_broadcastb_epi8(const __m128i& a) noexcept { return _mm256_broadcastb_epi8(a); }
-inline __m128i mm_broadcastd_epi32(const __m128i& a) noexcept { return _mm_broadcastd_epi32(a); }
-inline __m256i mm256_broadcastd_epi32(const __m128i& a) noexcept { return _mm256_broadcastd_epi32(a); }
-inline __m128i mm_broadcastq_epi64(const __m128i& a) noexcept { return _mm_broadcastq_epi64(a); }
-inline __m256i mm256_broadcastq_epi64(const __m128i& a) noexcept { return _mm256_broadcastq_epi64(a); }
-inline __m128d mm_broadcastsd_pd(const __m128d& a) noexcept { return _mm_broadcastsd_pd(a); }
-inline __m256d mm256_broadcastsd_pd(const __m128d& a) noexcept { return _mm256_broadcastsd_pd(a); }
-inline __m256i mm_broadcastsi128_si256(const __m128i& a) noexcept { return _mm256_broadcastsi128_si256(a); }
-inline __m256i mm256_broadcastsi128_si256(const __m128i& a) noexcept { return _mm256_broadcastsi128_si256(a); }
-inline __m128 mm_broadcastss_ps(const __m128& a) noexcept { return _mm_broadcastss_ps(a); }
-inline __m256 mm256_broadcastss_ps(const __m128& a) noexcept { return _mm256_broadcastss_ps(a); }
-inline __m128i mm_broadcastw_epi16(const __m128i& a) noexcept { return _mm_broadcastw_epi16(a); }
-inline __m256i mm256_broadcastw_epi16(const __m128i& a) noexcept { return _mm256_broadcastw_epi16(a); }
-template<int i> __m128i mm256_extracti128_si256(const __m256i& a) noexcept { return _mm256_extracti128_si256(a, i); }
-template<int i> __m256i mm256_inserti128_si256(const __m256i& a, const __m128i& b) noexcept { return _mm256_inserti128_si256(a, b, i); }
-template<int i> __m256i mm256_permute2x128_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_permute2x128_si256(a, b, i); }
-template<int i> __m256i mm256_permute4x64_epi64(const __m256i& a) noexcept { return _mm256_permute4x64_epi64(a, i); }
-template<int i> __m256d mm256_permute4x64_pd(const __m256d& a) noexcept { return _mm256_permute4x64_pd(a, i); }
-inline __m256i mm256_permutevar8x32_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_permutevar8x32_epi32(a, b); }
-inline __m256 mm256_permutevar8x32_ps(const __m256& a, const __m256i& b) noexcept { return _mm256_permutevar8x32_ps(a, b); }
-template<int i> __m256i mm256_shuffle_epi32(const __m256i& a) noexcept { return _mm256_shuffle_epi32(a, i); }
-inline __m256i mm256_shuffle_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_shuffle_epi8(a, b); }
-template<int i> __m256i mm256_shufflehi_epi16(const __m256i& a) noexcept { return _mm256_shufflehi_epi16(a, i); }
-template<int i> __m256i mm256_shufflelo_epi16(const __m256i& a) noexcept { return _mm256_shufflelo_epi16(a, i); }
-inline __m256i mm256_unpackhi_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpackhi_epi8(a, b); }
-inline __m256i mm256_unpackhi_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpackhi_epi16(a, b); }
-inline __m256i mm256_unpackhi_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpackhi_epi32(a, b); }
-inline __m256i mm256_unpackhi_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpackhi_epi64(a, b); }
-inline __m256i mm256_unpacklo_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpacklo_epi8(a, b); }
-inline __m256i mm256_unpacklo_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpacklo_epi16(a, b); }
-inline __m256i mm256_unpacklo_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpacklo_epi32(a, b); }
-inline __m256i mm256_unpacklo_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_unpacklo_epi64(a, b); }
-inline __m256i mm256_abs_epi8(const __m256i& a) noexcept { return _mm256_abs_epi8(a); }
-inline __m256i mm256_abs_epi16(const __m256i& a) noexcept { return _mm256_abs_epi16(a); }
-inline __m256i mm256_abs_epi32(const __m256i& a) noexcept { return _mm256_abs_epi32(a); }
-inline __m256i mm256_max_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_max_epi8(a, b); }
-inline __m256i mm256_max_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_max_epi16(a, b); }
-inline __m256i mm256_max_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_max_epi32(a, b); }
-inline __m256i mm256_max_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_max_epu8(a, b); }
-inline __m256i mm256_max_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_max_epu16(a, b); }
-inline __m256i mm256_max_epu32(const __m256i& a, const __m256i& b) noexcept { return _mm256_max_epu32(a, b); }
-inline __m256i mm256_min_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_min_epi8(a, b); }
-inline __m256i mm256_min_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_min_epi16(a, b); }
-inline __m256i mm256_min_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_min_epi32(a, b); }
-inline __m256i mm256_min_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_min_epu8(a, b); }
-inline __m256i mm256_min_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_min_epu16(a, b); }
-inline __m256i mm256_min_epu32(const __m256i& a, const __m256i& b) noexcept { return _mm256_min_epu32(a, b); }
-inline __m256i mm256_add_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_add_epi8(a, b); }
-inline __m256i mm256_add_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_add_epi16(a, b); }
-inline __m256i mm256_add_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_add_epi32(a, b); }
-inline __m256i mm256_add_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_add_epi64(a, b); }
-inline __m256i mm256_adds_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_adds_epi8(a, b); }
-inline __m256i mm256_adds_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_adds_epi16(a, b); }
-inline __m256i mm256_adds_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_adds_epu8(a, b); }
-inline __m256i mm256_adds_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_adds_epu16(a, b); }
-inline __m256i mm256_hadd_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_hadd_epi16(a, b); }
-inline __m256i mm256_hadd_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_hadd_epi32(a, b); }
-inline __m256i mm256_hadds_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_hadds_epi16(a, b); }
-inline __m256i mm256_hsub_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_hsub_epi16(a, b); }
-inline __m256i mm256_hsub_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_hsub_epi32(a, b); }
-inline __m256i mm256_hsubs_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_hsubs_epi16(a, b); }
-inline __m256i mm256_madd_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_madd_epi16(a, b); }
-inline __m256i mm256_maddubs_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_maddubs_epi16(a, b); }
-inline __m256i mm256_mul_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_mul_epi32(a, b); }
-inline __m256i mm256_mul_epu32(const __m256i& a, const __m256i& b) noexcept { return _mm256_mul_epu32(a, b); }
-inline __m256i mm256_mulhi_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_mulhi_epi16(a, b); }
-inline __m256i mm256_mulhi_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_mulhi_epu16(a, b); }
-inline __m256i mm256_mulhrs_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_mulhrs_epi16(a, b); }
-inline __m256i mm256_mullo_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_mullo_epi16(a, b); }
-inline __m256i mm256_mullo_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_mullo_epi32(a, b); }
-inline __m256i mm256_sad_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_sad_epu8(a, b); }
-inline __m256i mm256_sign_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_sign_epi8(a, b); }
-inline __m256i mm256_sign_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_sign_epi16(a, b); }
-inline __m256i mm256_sign_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_sign_epi32(a, b); }
-inline __m256i mm256_sub_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_sub_epi8(a, b); }
-inline __m256i mm256_sub_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_sub_epi16(a, b); }
-inline __m256i mm256_sub_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_sub_epi32(a, b); }
-inline __m256i mm256_sub_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_sub_epi64(a, b); }
-inline __m256i mm256_subs_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_subs_epi8(a, b); }
-inline __m256i mm256_subs_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_subs_epi16(a, b); }
-inline __m256i mm256_subs_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_subs_epu8(a, b); }
-inline __m256i mm256_subs_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_subs_epu16(a, b); }
-template<int i> __m256i mm256_alignr_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_alignr_epi8(a, b, i); }
-inline int mm256_movemask_epi8(const __m256i& a) noexcept { return _mm256_movemask_epi8(a); }
-template<int i> __m256i mm256_mpsadbw_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_mpsadbw_epu8(a, b, i); }
-inline __m256i mm256_packs_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_packs_epi16(a, b); }
-inline __m256i mm256_packs_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_packs_epi32(a, b); }
-inline __m256i mm256_packus_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_packus_epi16(a, b); }
-inline __m256i mm256_packus_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_packus_epi32(a, b); }
-inline __m256i mm256_and_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_and_si256(a, b); }
-inline __m256i mm256_andnot_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_andnot_si256(a, b); }
-inline __m256i mm256_or_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_or_si256(a, b); }
-inline __m256i mm256_xor_si256(const __m256i& a, const __m256i& b) noexcept { return _mm256_xor_si256(a, b); }
-inline __m256i mm256_avg_epu8(const __m256i& a, const __m256i& b) noexcept { return _mm256_avg_epu8(a, b); }
-inline __m256i mm256_avg_epu16(const __m256i& a, const __m256i& b) noexcept { return _mm256_avg_epu16(a, b); }
-inline __m256i mm256_cmpeq_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpeq_epi8(a, b); }
-inline __m256i mm256_cmpeq_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpeq_epi16(a, b); }
-inline __m256i mm256_cmpeq_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpeq_epi32(a, b); }
-inline __m256i mm256_cmpeq_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpeq_epi64(a, b); }
-inline __m256i mm256_cmpgt_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpgt_epi8(a, b); }
-inline __m256i mm256_cmpgt_epi16(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpgt_epi16(a, b); }
-inline __m256i mm256_cmpgt_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpgt_epi32(a, b); }
-inline __m256i mm256_cmpgt_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_cmpgt_epi64(a, b); }
-inline __m256i mm256_cvtepi16_epi32(const __m128i& a) noexcept { return _mm256_cvtepi16_epi32(a); }
-inline __m256i mm256_cvtepi16_epi64(const __m128i& a) noexcept { return _mm256_cvtepi16_epi64(a); }
-inline __m256i mm256_cvtepi32_epi64(const __m128i& a) noexcept { return _mm256_cvtepi32_epi64(a); }
-inline __m256i mm256_cvtepi8_epi16(const __m128i& a) noexcept { return _mm256_cvtepi8_epi16(a); }
-inline __m256i mm256_cvtepi8_epi32(const __m128i& a) noexcept { return _mm256_cvtepi8_epi32(a); }
-inline __m256i mm256_cvtepi8_epi64(const __m128i& a) noexcept { return _mm256_cvtepi8_epi64(a); }
-inline __m256i mm256_cvtepu16_epi32(const __m128i& a) noexcept { return _mm256_cvtepu16_epi32(a); }
-inline __m256i mm256_cvtepu16_epi64(const __m128i& a) noexcept { return _mm256_cvtepu16_epi64(a); }
-inline __m256i mm256_cvtepu32_epi64(const __m128i& a) noexcept { return _mm256_cvtepu32_epi64(a); }
-inline __m256i mm256_cvtepu8_epi16(const __m128i& a) noexcept { return _mm256_cvtepu8_epi16(a); }
-inline __m256i mm256_cvtepu8_epi32(const __m128i& a) noexcept { return _mm256_cvtepu8_epi32(a); }
-inline __m256i mm256_cvtepu8_epi64(const __m128i& a) noexcept { return _mm256_cvtepu8_epi64(a); }
-template<int i> __m128d mm_i32gather_pd(double const* a, const __m128i& b) noexcept { return _mm_i32gather_pd(a, b, i); }
-template<int i> __m256d mm256_i32gather_pd(double const* a, const __m128i& b) noexcept { return _mm256_i32gather_pd(a, b, i); }
-template<int i> __m128 mm_i32gather_ps(float const* a, const __m128i& b) noexcept { return _mm_i32gather_ps(a, b, i); }
-template<int i> __m256 mm256_i32gather_ps(float const* a, const __m256i& b) noexcept { return _mm256_i32gather_ps(a, b, i); }
-template<int i> __m128i mm_i32gather_epi32(int const* a, const __m128i& b) noexcept { return _mm_i32gather_epi32(a, b, i); }
-template<int i> __m256i mm256_i32gather_epi32(int const* a, const __m256i& b) noexcept { return _mm256_i32gather_epi32(a, b, i); }
-template<int i> __m128i mm_i32gather_epi64(__int64 const* a, const __m128i& b) noexcept { return _mm_i32gather_epi64(a, b, i); }
-template<int i> __m256i mm256_i32gather_epi64(__int64 const* a, const __m128i& b) noexcept { return _mm256_i32gather_epi64(a, b, i); }
-template<int i> __m128d mm_i64gather_pd(double const* a, const __m128i& b) noexcept { return _mm_i64gather_pd(a, b, i); }
-template<int i> __m256d mm256_i64gather_pd(double const* a, const __m256i& b) noexcept { return _mm256_i64gather_pd(a, b, i); }
-template<int i> __m128 mm_i64gather_ps(float const* a, const __m128i& b) noexcept { return _mm_i64gather_ps(a, b, i); }
-template<int i> __m128 mm256_i64gather_ps(float const* a, const __m256i& b) noexcept { return _mm256_i64gather_ps(a, b, i); }
-template<int i> __m128i mm_i64gather_epi32(int const* a, const __m128i& b) noexcept { return _mm_i64gather_epi32(a, b, i); }
-template<int i> __m128i mm256_i64gather_epi32(int const* a, const __m256i& b) noexcept { return _mm256_i64gather_epi32(a, b, i); }
-template<int i> __m128i mm_i64gather_epi64(__int64 const* a, const __m128i& b) noexcept { return _mm_i64gather_epi64(a, b, i); }
-template<int i> __m256i mm256_i64gather_epi64(__int64 const* a, const __m256i& b) noexcept { return _mm256_i64gather_epi64(a, b, i); }
-template<int i> __m128d mm_mask_i32gather_pd(const __m128d& a, double const* b, const __m128i& c, const __m128d& d) noexcept { return _mm_mask_i32gather_pd(a, b, c, d, i); }
-template<int i> __m256d mm256_mask_i32gather_pd(const __m256d& a, double const* b, const __m128i& c, const __m256d& d) noexcept { return _mm256_mask_i32gather_pd(a, b, c, d, i); }
-template<int i> __m128 mm_mask_i32gather_ps(const __m128& a, float const* b, const __m128i& c, const __m128& d) noexcept { return _mm_mask_i32gather_ps(a, b, c, d, i); }
-template<int i> __m256 mm256_mask_i32gather_ps(const __m256& a, float const* b, const __m256i& c, const __m256& d) noexcept { return _mm256_mask_i32gather_ps(a, b, c, d, i); }
-template<int i> __m128i mm_mask_i32gather_epi32(const __m128i& a, int const* b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_i32gather_epi32(a, b, c, d, i); }
-template<int i> __m256i mm256_mask_i32gather_epi32(const __m256i& a, int const* b, const __m256i& c, const __m256i& d) noexcept { return _mm256_mask_i32gather_epi32(a, b, c, d, i); }
-template<int i> __m128i mm_mask_i32gather_epi64(const __m128i& a, __int64 const* b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_i32gather_epi64(a, b, c, d, i); }
-template<int i> __m256i mm256_mask_i32gather_epi64(const __m256i& a, __int64 const* b, const __m128i& c, const __m256i& d) noexcept { return _mm256_mask_i32gather_epi64(a, b, c, d, i); }
-template<int i> __m128d mm_mask_i64gather_pd(const __m128d& a, double const* b, const __m128i& c, const __m128d& d) noexcept { return _mm_mask_i64gather_pd(a, b, c, d, i); }
-template<int i> __m256d mm256_mask_i64gather_pd(const __m256d& a, double const* b, const __m256i& c, const __m256d& d) noexcept { return _mm256_mask_i64gather_pd(a, b, c, d, i); }
-template<int i> __m128 mm_mask_i64gather_ps(const __m128& a, float const* b, const __m128i& c, const __m128& d) noexcept { return _mm_mask_i64gather_ps(a, b, c, d, i); }
-template<int i> __m128 mm256_mask_i64gather_ps(const __m128& a, float const* b, const __m256i& c, const __m128& d) noexcept { return _mm256_mask_i64gather_ps(a, b, c, d, i); }
-template<int i> __m128i mm_mask_i64gather_epi32(const __m128i& a, int const* b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_i64gather_epi32(a, b, c, d, i); }
-template<int i> __m128i mm256_mask_i64gather_epi32(const __m128i& a, int const* b, const __m256i& c, const __m128i& d) noexcept { return _mm256_mask_i64gather_epi32(a, b, c, d, i); }
-template<int i> __m128i mm_mask_i64gather_epi64(const __m128i& a, __int64 const* b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_i64gather_epi64(a, b, c, d, i); }
-template<int i> __m256i mm256_mask_i64gather_epi64(const __m256i& a, __int64 const* b, const __m256i& c, const __m256i& d) noexcept { return _mm256_mask_i64gather_epi64(a, b, c, d, i); }
-inline __m128i mm_maskload_epi32(int const* a, const __m128i& b) noexcept { return _mm_maskload_epi32(a, b); }
-inline __m256i mm256_maskload_epi32(int const* a, const __m256i& b) noexcept { return _mm256_maskload_epi32(a, b); }
-inline __m128i mm_maskload_epi64(__int64 const* a, const __m128i& b) noexcept { return _mm_maskload_epi64(a, b); }
-inline __m256i mm256_maskload_epi64(__int64 const* a, const __m256i& b) noexcept { return _mm256_maskload_epi64(a, b); }
-inline __m256i mm256_stream_load_si256(void const* a) noexcept { return _mm256_stream_load_si256((const __m256i*)a); }
-inline void mm_maskstore_epi32(int* a, const __m128i& b, const __m128i& c) noexcept { _mm_maskstore_epi32(a, b, c); }
-inline void mm256_maskstore_epi32(int* a, const __m256i& b, const __m256i& c) noexcept { _mm256_maskstore_epi32(a, b, c); }
-inline void mm_maskstore_epi64(__int64* a, const __m128i& b, const __m128i& c) noexcept { _mm_maskstore_epi64(a, b, c); }
-inline void mm256_maskstore_epi64(__int64* a, const __m256i& b, const __m256i& c) noexcept { _mm256_maskstore_epi64(a, b, c); }
-template<int i> __m256i mm256_slli_si256(const __m256i& a) noexcept { return _mm256_slli_si256(a, i); }
-template<int i> __m256i mm256_bslli_epi128(const __m256i& a) noexcept { return _mm256_bslli_epi128(a, i); }
-inline __m256i mm256_sll_epi16(const __m256i& a, const __m128i& b) noexcept { return _mm256_sll_epi16(a, b); }
-template<int i> __m256i mm256_slli_epi16(const __m256i& a) noexcept { return _mm256_slli_epi16(a, i); }
-inline __m256i mm256_sll_epi32(const __m256i& a, const __m128i& b) noexcept { return _mm256_sll_epi32(a, b); }
-template<int i> __m256i mm256_slli_epi32(const __m256i& a) noexcept { return _mm256_slli_epi32(a, i); }
-inline __m256i mm256_sll_epi64(const __m256i& a, const __m128i& b) noexcept { return _mm256_sll_epi64(a, b); }
-template<int i> __m256i mm256_slli_epi64(const __m256i& a) noexcept { return _mm256_slli_epi64(a, i); }
-inline __m128i mm_sllv_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sllv_epi32(a, b); }
-inline __m256i mm256_sllv_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_sllv_epi32(a, b); }
-inline __m128i mm_sllv_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_sllv_epi64(a, b); }
-inline __m256i mm256_sllv_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_sllv_epi64(a, b); }
-inline __m256i mm256_sra_epi16(const __m256i& a, const __m128i& b) noexcept { return _mm256_sra_epi16(a, b); }
-template<int i> __m256i mm256_srai_epi16(const __m256i& a) noexcept { return _mm256_srai_epi16(a, i); }
-inline __m256i mm256_sra_epi32(const __m256i& a, const __m128i& b) noexcept { return _mm256_sra_epi32(a, b); }
-template<int i> __m256i mm256_srai_epi32(const __m256i& a) noexcept { return _mm256_srai_epi32(a, i); }
-inline __m128i mm_srav_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_srav_epi32(a, b); }
-inline __m256i mm256_srav_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_srav_epi32(a, b); }
-template<int i> __m256i mm256_srli_si256(const __m256i& a) noexcept { return _mm256_srli_si256(a, i); }
-template<int i> __m256i mm256_bsrli_epi128(const __m256i& a) noexcept { return _mm256_bsrli_epi128(a, i); }
-inline __m256i mm256_srl_epi16(const __m256i& a, const __m128i& b) noexcept { return _mm256_srl_epi16(a, b); }
-template<int i> __m256i mm256_srli_epi16(const __m256i& a) noexcept { return _mm256_srli_epi16(a, i); }
-inline __m256i mm256_srl_epi32(const __m256i& a, const __m128i& b) noexcept { return _mm256_srl_epi32(a, b); }
-template<int i> __m256i mm256_srli_epi32(const __m256i& a) noexcept { return _mm256_srli_epi32(a, i); }
-inline __m256i mm256_srl_epi64(const __m256i& a, const __m128i& b) noexcept { return _mm256_srl_epi64(a, b); }
-template<int i> __m256i mm256_srli_epi64(const __m256i& a) noexcept { return _mm256_srli_epi64(a, i); }
-inline __m128i mm_srlv_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_srlv_epi32(a, b); }
-inline __m256i mm256_srlv_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_srlv_epi32(a, b); }
-inline __m128i mm_srlv_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_srlv_epi64(a, b); }
-inline __m256i mm256_srlv_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_srlv_epi64(a, b); }
-inline __m256i mm256_madd52hi_avx_epu64(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_madd52hi_avx_epu64(a, b, c); }
-inline __m256i mm256_madd52lo_avx_epu64(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_madd52lo_avx_epu64(a, b, c); }
-inline __m128i mm_madd52hi_avx_epu64(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_madd52hi_avx_epu64(a, b, c); }
-inline __m128i mm_madd52lo_avx_epu64(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_madd52lo_avx_epu64(a, b, c); }
-inline __m256i mm256_madd52hi_epu64(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_madd52hi_epu64(a, b, c); }
-inline __m256i mm256_madd52lo_epu64(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_madd52lo_epu64(a, b, c); }
-inline __m128i mm_madd52hi_epu64(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_madd52hi_epu64(a, b, c); }
-inline __m128i mm_madd52lo_epu64(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_madd52lo_epu64(a, b, c); }
-// inline __m256 mm256_bcstnebf16_ps(const __bf16* a) noexcept { return _mm256_bcstnebf16_ps(a); }
-// inline __m256 mm256_bcstnesh_ps(const _Float16* a) noexcept { return _mm256_bcstnesh_ps(a); }
-inline __m256 mm256_cvtneebf16_ps(const __m256bh* a) noexcept { return _mm256_cvtneebf16_ps(a); }
-inline __m256 mm256_cvtneeph_ps(const __m256h* a) noexcept { return _mm256_cvtneeph_ps(a); }
-inline __m256 mm256_cvtneobf16_ps(const __m256bh* a) noexcept { return _mm256_cvtneobf16_ps(a); }
-inline __m256 mm256_cvtneoph_ps(const __m256h* a) noexcept { return _mm256_cvtneoph_ps(a); }
-inline __m128bh mm256_cvtneps_avx_pbh(const __m256& a) noexcept { return _mm256_cvtneps_avx_pbh(a); }
-// inline __m128 mm_bcstnebf16_ps(const __bf16* a) noexcept { return _mm_bcstnebf16_ps(a); }
-// inline __m128 mm_bcstnesh_ps(const _Float16* a) noexcept { return _mm_bcstnesh_ps(a); }
-inline __m128 mm_cvtneebf16_ps(const __m128bh* a) noexcept { return _mm_cvtneebf16_ps(a); }
-inline __m128 mm_cvtneeph_ps(const __m128h* a) noexcept { return _mm_cvtneeph_ps(a); }
-inline __m128 mm_cvtneobf16_ps(const __m128bh* a) noexcept { return _mm_cvtneobf16_ps(a); }
-inline __m128 mm_cvtneoph_ps(const __m128h* a) noexcept { return _mm_cvtneoph_ps(a); }
-inline __m128bh mm_cvtneps_avx_pbh(const __m128& a) noexcept { return _mm_cvtneps_avx_pbh(a); }
-inline __m128bh mm256_cvtneps_pbh(const __m256& a) noexcept { return _mm256_cvtneps_pbh(a); }
-inline __m128bh mm_cvtneps_pbh(const __m128& a) noexcept { return _mm_cvtneps_pbh(a); }
-inline __m256i mm256_dpbusd_avx_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbusd_avx_epi32(a, b, c); }
-inline __m256i mm256_dpbusds_avx_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbusds_avx_epi32(a, b, c); }
-inline __m256i mm256_dpwssd_avx_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwssd_avx_epi32(a, b, c); }
-inline __m256i mm256_dpwssds_avx_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwssds_avx_epi32(a, b, c); }
-inline __m128i mm_dpbusd_avx_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbusd_avx_epi32(a, b, c); }
-inline __m128i mm_dpbusds_avx_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbusds_avx_epi32(a, b, c); }
-inline __m128i mm_dpwssd_avx_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwssd_avx_epi32(a, b, c); }
-inline __m128i mm_dpwssds_avx_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwssds_avx_epi32(a, b, c); }
-inline __m256i mm256_dpbusd_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbusd_epi32(a, b, c); }
-inline __m256i mm256_dpbusds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbusds_epi32(a, b, c); }
-inline __m256i mm256_dpwssd_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwssd_epi32(a, b, c); }
-inline __m256i mm256_dpwssds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwssds_epi32(a, b, c); }
-inline __m128i mm_dpbusd_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbusd_epi32(a, b, c); }
-inline __m128i mm_dpbusds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbusds_epi32(a, b, c); }
-inline __m128i mm_dpwssd_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwssd_epi32(a, b, c); }
-inline __m128i mm_dpwssds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwssds_epi32(a, b, c); }
-// inline __m256i mm256_dpwsud_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwsud_epi32(a, b, c); }
-// inline __m256i mm256_dpwsuds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwsuds_epi32(a, b, c); }
-// inline __m256i mm256_dpwusd_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwusd_epi32(a, b, c); }
-// inline __m256i mm256_dpwusds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwusds_epi32(a, b, c); }
-// inline __m256i mm256_dpwuud_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwuud_epi32(a, b, c); }
-// inline __m256i mm256_dpwuuds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpwuuds_epi32(a, b, c); }
-// inline __m128i mm_dpwsud_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwsud_epi32(a, b, c); }
-// inline __m128i mm_dpwsuds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwsuds_epi32(a, b, c); }
-// inline __m128i mm_dpwusd_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwusd_epi32(a, b, c); }
-// inline __m128i mm_dpwusds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwusds_epi32(a, b, c); }
-// inline __m128i mm_dpwuud_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwuud_epi32(a, b, c); }
-// inline __m128i mm_dpwuuds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpwuuds_epi32(a, b, c); }
-inline __m256i mm256_dpbssd_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbssd_epi32(a, b, c); }
-inline __m256i mm256_dpbssds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbssds_epi32(a, b, c); }
-inline __m256i mm256_dpbsud_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbsud_epi32(a, b, c); }
-inline __m256i mm256_dpbsuds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbsuds_epi32(a, b, c); }
-inline __m256i mm256_dpbuud_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbuud_epi32(a, b, c); }
-inline __m256i mm256_dpbuuds_epi32(const __m256i& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_dpbuuds_epi32(a, b, c); }
-inline __m128i mm_dpbssd_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbssd_epi32(a, b, c); }
-inline __m128i mm_dpbssds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbssds_epi32(a, b, c); }
-inline __m128i mm_dpbsud_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbsud_epi32(a, b, c); }
-inline __m128i mm_dpbsuds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbsuds_epi32(a, b, c); }
-inline __m128i mm_dpbuud_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbuud_epi32(a, b, c); }
-inline __m128i mm_dpbuuds_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_dpbuuds_epi32(a, b, c); }
-// inline int mm_tzcnt_32(unsigned int a) noexcept { return _mm_tzcnt_32(a); }
-// inline __int64 mm_tzcnt_64(unsigned __int64 a) noexcept { return _mm_tzcnt_64(a); }
-// inline void mm_cldemote(void const* a) noexcept { _mm_cldemote(a); }
-// inline void mm_clflushopt(void const* a) noexcept { _mm_clflushopt(a); }
-// inline void mm_clwb(void const* a) noexcept { _mm_clwb(a); }
-inline unsigned int mm_crc32_u8(unsigned int a, unsigned char b) noexcept { return _mm_crc32_u8(a, b); }
-inline unsigned int mm_crc32_u16(unsigned int a, unsigned short b) noexcept { return _mm_crc32_u16(a, b); }
-inline unsigned int mm_crc32_u32(unsigned int a, unsigned int b) noexcept { return _mm_crc32_u32(a, b); }
-inline unsigned __int64 mm_crc32_u64(unsigned __int64 a, unsigned __int64 b) noexcept { return _mm_crc32_u64(a, b); }
-inline __m256 mm256_cvtph_ps(const __m128i& a) noexcept { return _mm256_cvtph_ps(a); }
-template<int i> __m128i mm256_cvtps_ph(const __m256& a) noexcept { return _mm256_cvtps_ph(a, i); }
-inline __m128 mm_cvtph_ps(const __m128i& a) noexcept { return _mm_cvtph_ps(a); }
-template<int i> __m128i mm_cvtps_ph(const __m128& a) noexcept { return _mm_cvtps_ph(a, i); }
-inline __m128d mm_fmadd_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fmadd_pd(a, b, c); }
-inline __m256d mm256_fmadd_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_fmadd_pd(a, b, c); }
-inline __m128 mm_fmadd_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fmadd_ps(a, b, c); }
-inline __m256 mm256_fmadd_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_fmadd_ps(a, b, c); }
-inline __m128d mm_fmadd_sd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fmadd_sd(a, b, c); }
-inline __m128 mm_fmadd_ss(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fmadd_ss(a, b, c); }
-inline __m128d mm_fmaddsub_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fmaddsub_pd(a, b, c); }
-inline __m256d mm256_fmaddsub_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_fmaddsub_pd(a, b, c); }
-inline __m128 mm_fmaddsub_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fmaddsub_ps(a, b, c); }
-inline __m256 mm256_fmaddsub_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_fmaddsub_ps(a, b, c); }
-inline __m128d mm_fmsub_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fmsub_pd(a, b, c); }
-inline __m256d mm256_fmsub_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_fmsub_pd(a, b, c); }
-inline __m128 mm_fmsub_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fmsub_ps(a, b, c); }
-inline __m256 mm256_fmsub_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_fmsub_ps(a, b, c); }
-inline __m128d mm_fmsub_sd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fmsub_sd(a, b, c); }
-inline __m128 mm_fmsub_ss(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fmsub_ss(a, b, c); }
-inline __m128d mm_fmsubadd_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fmsubadd_pd(a, b, c); }
-inline __m256d mm256_fmsubadd_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_fmsubadd_pd(a, b, c); }
-inline __m128 mm_fmsubadd_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fmsubadd_ps(a, b, c); }
-inline __m256 mm256_fmsubadd_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_fmsubadd_ps(a, b, c); }
-inline __m128d mm_fnmadd_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fnmadd_pd(a, b, c); }
-inline __m256d mm256_fnmadd_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_fnmadd_pd(a, b, c); }
-inline __m128 mm_fnmadd_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fnmadd_ps(a, b, c); }
-inline __m256 mm256_fnmadd_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_fnmadd_ps(a, b, c); }
-inline __m128d mm_fnmadd_sd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fnmadd_sd(a, b, c); }
-inline __m128 mm_fnmadd_ss(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fnmadd_ss(a, b, c); }
-inline __m128d mm_fnmsub_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fnmsub_pd(a, b, c); }
-inline __m256d mm256_fnmsub_pd(const __m256d& a, const __m256d& b, const __m256d& c) noexcept { return _mm256_fnmsub_pd(a, b, c); }
-inline __m128 mm_fnmsub_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fnmsub_ps(a, b, c); }
-inline __m256 mm256_fnmsub_ps(const __m256& a, const __m256& b, const __m256& c) noexcept { return _mm256_fnmsub_ps(a, b, c); }
-inline __m128d mm_fnmsub_sd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_fnmsub_sd(a, b, c); }
-inline __m128 mm_fnmsub_ss(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_fnmsub_ss(a, b, c); }
-inline __m512i mm512_maskz_gf2p8mul_epi8(const __mmask64& a, const __m512i& b, const __m512i& c) noexcept { return _mm512_maskz_gf2p8mul_epi8(a, b, c); }
-inline __m512i mm512_mask_gf2p8mul_epi8(const __m512i& a, const __mmask64& b, const __m512i& c, const __m512i& d) noexcept { return _mm512_mask_gf2p8mul_epi8(a, b, c, d); }
-inline __m512i mm512_gf2p8mul_epi8(const __m512i& a, const __m512i& b) noexcept { return _mm512_gf2p8mul_epi8(a, b); }
-template<int i> __m512i mm512_maskz_gf2p8affine_epi64_epi8(const __mmask64& a, const __m512i& b, const __m512i& c) noexcept { return _mm512_maskz_gf2p8affine_epi64_epi8(a, b, c, i); }
-template<int i> __m512i mm512_mask_gf2p8affine_epi64_epi8(const __m512i& a, const __mmask64& b, const __m512i& c, const __m512i& d) noexcept { return _mm512_mask_gf2p8affine_epi64_epi8(a, b, c, d, i); }
-template<int i> __m512i mm512_gf2p8affine_epi64_epi8(const __m512i& a, const __m512i& b) noexcept { return _mm512_gf2p8affine_epi64_epi8(a, b, i); }
-template<int i> __m512i mm512_maskz_gf2p8affineinv_epi64_epi8(const __mmask64& a, const __m512i& b, const __m512i& c) noexcept { return _mm512_maskz_gf2p8affineinv_epi64_epi8(a, b, c, i); }
-template<int i> __m512i mm512_mask_gf2p8affineinv_epi64_epi8(const __m512i& a, const __mmask64& b, const __m512i& c, const __m512i& d) noexcept { return _mm512_mask_gf2p8affineinv_epi64_epi8(a, b, c, d, i); }
-template<int i> __m512i mm512_gf2p8affineinv_epi64_epi8(const __m512i& a, const __m512i& b) noexcept { return _mm512_gf2p8affineinv_epi64_epi8(a, b, i); }
-inline __m256i mm256_maskz_gf2p8mul_epi8(const __mmask32& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_maskz_gf2p8mul_epi8(a, b, c); }
-inline __m256i mm256_mask_gf2p8mul_epi8(const __m256i& a, const __mmask32& b, const __m256i& c, const __m256i& d) noexcept { return _mm256_mask_gf2p8mul_epi8(a, b, c, d); }
-inline __m256i mm256_gf2p8mul_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_gf2p8mul_epi8(a, b); }
-inline __m128i mm_maskz_gf2p8mul_epi8(const __mmask16& a, const __m128i& b, const __m128i& c) noexcept { return _mm_maskz_gf2p8mul_epi8(a, b, c); }
-inline __m128i mm_mask_gf2p8mul_epi8(const __m128i& a, const __mmask16& b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_gf2p8mul_epi8(a, b, c, d); }
-inline __m128i mm_gf2p8mul_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_gf2p8mul_epi8(a, b); }
-template<int i> __m256i mm256_maskz_gf2p8affine_epi64_epi8(const __mmask32& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_maskz_gf2p8affine_epi64_epi8(a, b, c, i); }
-template<int i> __m256i mm256_mask_gf2p8affine_epi64_epi8(const __m256i& a, const __mmask32& b, const __m256i& c, const __m256i& d) noexcept { return _mm256_mask_gf2p8affine_epi64_epi8(a, b, c, d, i); }
-template<int i> __m256i mm256_gf2p8affine_epi64_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_gf2p8affine_epi64_epi8(a, b, i); }
-template<int i> __m128i mm_maskz_gf2p8affine_epi64_epi8(const __mmask16& a, const __m128i& b, const __m128i& c) noexcept { return _mm_maskz_gf2p8affine_epi64_epi8(a, b, c, i); }
-template<int i> __m128i mm_mask_gf2p8affine_epi64_epi8(const __m128i& a, const __mmask16& b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_gf2p8affine_epi64_epi8(a, b, c, d, i); }
-template<int i> __m128i mm_gf2p8affine_epi64_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_gf2p8affine_epi64_epi8(a, b, i); }
-template<int i> __m256i mm256_maskz_gf2p8affineinv_epi64_epi8(const __mmask32& a, const __m256i& b, const __m256i& c) noexcept { return _mm256_maskz_gf2p8affineinv_epi64_epi8(a, b, c, i); }
-template<int i> __m256i mm256_mask_gf2p8affineinv_epi64_epi8(const __m256i& a, const __mmask32& b, const __m256i& c, const __m256i& d) noexcept { return _mm256_mask_gf2p8affineinv_epi64_epi8(a, b, c, d, i); }
-template<int i> __m256i mm256_gf2p8affineinv_epi64_epi8(const __m256i& a, const __m256i& b) noexcept { return _mm256_gf2p8affineinv_epi64_epi8(a, b, i); }
-template<int i> __m128i mm_maskz_gf2p8affineinv_epi64_epi8(const __mmask16& a, const __m128i& b, const __m128i& c) noexcept { return _mm_maskz_gf2p8affineinv_epi64_epi8(a, b, c, i); }
-template<int i> __m128i mm_mask_gf2p8affineinv_epi64_epi8(const __m128i& a, const __mmask16& b, const __m128i& c, const __m128i& d) noexcept { return _mm_mask_gf2p8affineinv_epi64_epi8(a, b, c, d, i); }
-template<int i> __m128i mm_gf2p8affineinv_epi64_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_gf2p8affineinv_epi64_epi8(a, b, i); }
-inline unsigned char mm_aesdec128kl_u8(__m128i* a, const __m128i& b, const void* c) noexcept { return _mm_aesdec128kl_u8(a, b, c); }
-inline unsigned char mm_aesdec256kl_u8(__m128i* a, const __m128i& b, const void* c) noexcept { return _mm_aesdec256kl_u8(a, b, c); }
-inline unsigned char mm_aesenc128kl_u8(__m128i* a, const __m128i& b, const void* c) noexcept { return _mm_aesenc128kl_u8(a, b, c); }
-inline unsigned char mm_aesenc256kl_u8(__m128i* a, const __m128i& b, const void* c) noexcept { return _mm_aesenc256kl_u8(a, b, c); }
-inline unsigned int mm_encodekey128_u32(unsigned int a, const __m128i& b, void* c) noexcept { return _mm_encodekey128_u32(a, b, c); }
-inline unsigned int mm_encodekey256_u32(unsigned int a, const __m128i& b, const __m128i& c, void* d) noexcept { return _mm_encodekey256_u32(a, b, c, d); }
-inline void mm_loadiwkey(unsigned int a, const __m128i& b, const __m128i& c, const __m128i& d) noexcept { _mm_loadiwkey(a, b, c, d); }
-inline unsigned char mm_aesdecwide128kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesdecwide128kl_u8(a, b, c); }
-inline unsigned char mm_aesdecwide256kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesdecwide256kl_u8(a, b, c); }
-inline unsigned char mm_aesencwide128kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesencwide128kl_u8(a, b, c); }
-inline unsigned char mm_aesencwide256kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesencwide256kl_u8(a, b, c); }
-// template<int i> __m64 mm_cvtsi32_si64() noexcept { return _mm_cvtsi32_si64(i); }
-// inline int mm_cvtsi64_si32(const __m64& a) noexcept { return _mm_cvtsi64_si32(a); }
-// inline __int64 mm_cvtm64_si64(const __m64& a) noexcept { return _mm_cvtm64_si64(a); }
-// inline __m64 mm_cvtsi64_m64(__int64 a) noexcept { return _mm_cvtsi64_m64(a); }
-// inline void mm_empty() noexcept { _mm_empty(); }
-// inline __m64 mm_packs_pi16(const __m64& a, const __m64& b) noexcept { return _mm_packs_pi16(a, b); }
-// inline __m64 mm_packs_pi32(const __m64& a, const __m64& b) noexcept { return _mm_packs_pi32(a, b); }
-// inline __m64 mm_packs_pu16(const __m64& a, const __m64& b) noexcept { return _mm_packs_pu16(a, b); }
-// inline __m64 mm_unpackhi_pi8(const __m64& a, const __m64& b) noexcept { return _mm_unpackhi_pi8(a, b); }
-// inline __m64 mm_unpackhi_pi16(const __m64& a, const __m64& b) noexcept { return _mm_unpackhi_pi16(a, b); }
-// inline __m64 mm_unpackhi_pi32(const __m64& a, const __m64& b) noexcept { return _mm_unpackhi_pi32(a, b); }
-// inline __m64 mm_unpacklo_pi8(const __m64& a, const __m64& b) noexcept { return _mm_unpacklo_pi8(a, b); }
-// inline __m64 mm_unpacklo_pi16(const __m64& a, const __m64& b) noexcept { return _mm_unpacklo_pi16(a, b); }
-// inline __m64 mm_unpacklo_pi32(const __m64& a, const __m64& b) noexcept { return _mm_unpacklo_pi32(a, b); }
-// inline __m64 mm_add_pi8(const __m64& a, const __m64& b) noexcept { return _mm_add_pi8(a, b); }
-// inline __m64 mm_add_pi16(const __m64& a, const __m64& b) noexcept { return _mm_add_pi16(a, b); }
-// inline __m64 mm_add_pi32(const __m64& a, const __m64& b) noexcept { return _mm_add_pi32(a, b); }
-// inline __m64 mm_adds_pi8(const __m64& a, const __m64& b) noexcept { return _mm_adds_pi8(a, b); }
-// inline __m64 mm_adds_pi16(const __m64& a, const __m64& b) noexcept { return _mm_adds_pi16(a, b); }
-// inline __m64 mm_adds_pu8(const __m64& a, const __m64& b) noexcept { return _mm_adds_pu8(a, b); }
-// inline __m64 mm_adds_pu16(const __m64& a, const __m64& b) noexcept { return _mm_adds_pu16(a, b); }
-// inline __m64 mm_sub_pi8(const __m64& a, const __m64& b) noexcept { return _mm_sub_pi8(a, b); }
-// inline __m64 mm_sub_pi16(const __m64& a, const __m64& b) noexcept { return _mm_sub_pi16(a, b); }
-// inline __m64 mm_sub_pi32(const __m64& a, const __m64& b) noexcept { return _mm_sub_pi32(a, b); }
-// inline __m64 mm_subs_pi8(const __m64& a, const __m64& b) noexcept { return _mm_subs_pi8(a, b); }
-// inline __m64 mm_subs_pi16(const __m64& a, const __m64& b) noexcept { return _mm_subs_pi16(a, b); }
-// inline __m64 mm_subs_pu8(const __m64& a, const __m64& b) noexcept { return _mm_subs_pu8(a, b); }
-// inline __m64 mm_subs_pu16(const __m64& a, const __m64& b) noexcept { return _mm_subs_pu16(a, b); }
-// inline __m64 mm_madd_pi16(const __m64& a, const __m64& b) noexcept { return _mm_madd_pi16(a, b); }
-// inline __m64 mm_mulhi_pi16(const __m64& a, const __m64& b) noexcept { return _mm_mulhi_pi16(a, b); }
-// inline __m64 mm_mullo_pi16(const __m64& a, const __m64& b) noexcept { return _mm_mullo_pi16(a, b); }
-// inline __m64 mm_sll_pi16(const __m64& a, const __m64& b) noexcept { return _mm_sll_pi16(a, b); }
-// template<int i> __m64 mm_slli_pi16(const __m64& a) noexcept { return _mm_slli_pi16(a, i); }
-// inline __m64 mm_sll_pi32(const __m64& a, const __m64& b) noexcept { return _mm_sll_pi32(a, b); }
-// template<int i> __m64 mm_slli_pi32(const __m64& a) noexcept { return _mm_slli_pi32(a, i); }
-// inline __m64 mm_sll_si64(const __m64& a, const __m64& b) noexcept { return _mm_sll_si64(a, b); }
-// template<int i> __m64 mm_slli_si64(const __m64& a) noexcept { return _mm_slli_si64(a, i); }
-// inline __m64 mm_sra_pi16(const __m64& a, const __m64& b) noexcept { return _mm_sra_pi16(a, b); }
-// template<int i> __m64 mm_srai_pi16(const __m64& a) noexcept { return _mm_srai_pi16(a, i); }
-// inline __m64 mm_sra_pi32(const __m64& a, const __m64& b) noexcept { return _mm_sra_pi32(a, b); }
-// template<int i> __m64 mm_srai_pi32(const __m64& a) noexcept { return _mm_srai_pi32(a, i); }
-// inline __m64 mm_srl_pi16(const __m64& a, const __m64& b) noexcept { return _mm_srl_pi16(a, b); }
-// template<int i> __m64 mm_srli_pi16(const __m64& a) noexcept { return _mm_srli_pi16(a, i); }
-// inline __m64 mm_srl_pi32(const __m64& a, const __m64& b) noexcept { return _mm_srl_pi32(a, b); }
-// template<int i> __m64 mm_srli_pi32(const __m64& a) noexcept { return _mm_srli_pi32(a, i); }
-// inline __m64 mm_srl_si64(const __m64& a, const __m64& b) noexcept { return _mm_srl_si64(a, b); }
-// template<int i> __m64 mm_srli_si64(const __m64& a) noexcept { return _mm_srli_si64(a, i); }
-// inline __m64 mm_and_si64(const __m64& a, const __m64& b) noexcept { return _mm_and_si64(a, b); }
-// inline __m64 mm_andnot_si64(const __m64& a, const __m64& b) noexcept { return _mm_andnot_si64(a, b); }
-// inline __m64 mm_or_si64(const __m64& a, const __m64& b) noexcept { return _mm_or_si64(a, b); }
-// inline __m64 mm_xor_si64(const __m64& a, const __m64& b) noexcept { return _mm_xor_si64(a, b); }
-// inline __m64 mm_cmpeq_pi8(const __m64& a, const __m64& b) noexcept { return _mm_cmpeq_pi8(a, b); }
-// inline __m64 mm_cmpeq_pi16(const __m64& a, const __m64& b) noexcept { return _mm_cmpeq_pi16(a, b); }
-// inline __m64 mm_cmpeq_pi32(const __m64& a, const __m64& b) noexcept { return _mm_cmpeq_pi32(a, b); }
-// inline __m64 mm_cmpgt_pi8(const __m64& a, const __m64& b) noexcept { return _mm_cmpgt_pi8(a, b); }
-// inline __m64 mm_cmpgt_pi16(const __m64& a, const __m64& b) noexcept { return _mm_cmpgt_pi16(a, b); }
-// inline __m64 mm_cmpgt_pi32(const __m64& a, const __m64& b) noexcept { return _mm_cmpgt_pi32(a, b); }
-// inline __m64 mm_setzero_si64() noexcept { return _mm_setzero_si64(); }
-// template<int i> __m64 mm_set_pi32(int a) noexcept { return _mm_set_pi32(a, i); }
-// inline __m64 mm_set_pi16(short a, short b, short c, short d) noexcept { return _mm_set_pi16(a, b, c, d); }
-// inline __m64 mm_set_pi8(char a, char b, char c, char d, char e, char f, char g, char h) noexcept { return _mm_set_pi8(a, b, c, d, e, f, g, h); }
-// template<int i> __m64 mm_set1_pi32() noexcept { return _mm_set1_pi32(i); }
-// inline __m64 mm_set1_pi16(short a) noexcept { return _mm_set1_pi16(a); }
-// inline __m64 mm_set1_pi8(char a) noexcept { return _mm_set1_pi8(a); }
-// template<int i> __m64 mm_setr_pi32(int a) noexcept { return _mm_setr_pi32(a, i); }
-// inline __m64 mm_setr_pi16(short a, short b, short c, short d) noexcept { return _mm_setr_pi16(a, b, c, d); }
-// inline __m64 mm_setr_pi8(char a, char b, char c, char d, char e, char f, char g, char h) noexcept { return _mm_setr_pi8(a, b, c, d, e, f, g, h); }
-inline void mm_monitor(void const* a, unsigned b, unsigned c) noexcept { _mm_monitor(a, b, c); }
-inline void mm_mwait(unsigned a, unsigned b) noexcept { _mm_mwait(a, b); }
-template<int i> __m128i mm_clmulepi64_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_clmulepi64_si128(a, b, i); }
-inline int mm_popcnt_u32(unsigned int a) noexcept { return _mm_popcnt_u32(a); }
-inline __int64 mm_popcnt_u64(unsigned __int64 a) noexcept { return _mm_popcnt_u64(a); }
-inline __m128i mm_sha1msg1_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_sha1msg1_epu32(a, b); }
-inline __m128i mm_sha1msg2_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_sha1msg2_epu32(a, b); }
-inline __m128i mm_sha1nexte_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_sha1nexte_epu32(a, b); }
-template<int i> __m128i mm_sha1rnds4_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_sha1rnds4_epu32(a, b, i); }
-inline __m128i mm_sha256msg1_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_sha256msg1_epu32(a, b); }
-inline __m128i mm_sha256msg2_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_sha256msg2_epu32(a, b); }
-inline __m128i mm_sha256rnds2_epu32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_sha256rnds2_epu32(a, b, c); }
-// inline __m256i mm256_sha512msg1_epi64(const __m256i& a, const __m128i& b) noexcept { return _mm256_sha512msg1_epi64(a, b); }
-// inline __m256i mm256_sha512msg2_epi64(const __m256i& a, const __m256i& b) noexcept { return _mm256_sha512msg2_epi64(a, b); }
-// inline __m256i mm256_sha512rnds2_epi64(const __m256i& a, const __m256i& b, const __m128i& c) noexcept { return _mm256_sha512rnds2_epi64(a, b, c); }
-// inline __m128i mm_sm3msg1_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_sm3msg1_epi32(a, b, c); }
-// inline __m128i mm_sm3msg2_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_sm3msg2_epi32(a, b, c); }
-// template<int i> __m128i mm_sm3rnds2_epi32(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_sm3rnds2_epi32(a, b, c, i); }
-// inline __m256i mm256_sm4key4_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_sm4key4_epi32(a, b); }
-// inline __m256i mm256_sm4rnds4_epi32(const __m256i& a, const __m256i& b) noexcept { return _mm256_sm4rnds4_epi32(a, b); }
-// inline __m128i mm_sm4key4_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sm4key4_epi32(a, b); }
-// inline __m128i mm_sm4rnds4_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sm4rnds4_epi32(a, b); }
-inline __m128d mm_acos_pd(const __m128d& a) noexcept { return _mm_acos_pd(a); }
-inline __m128 mm_acos_ps(const __m128& a) noexcept { return _mm_acos_ps(a); }
-inline __m128d mm_acosh_pd(const __m128d& a) noexcept { return _mm_acosh_pd(a); }
-inline __m128 mm_acosh_ps(const __m128& a) noexcept { return _mm_acosh_ps(a); }
-inline __m128d mm_asin_pd(const __m128d& a) noexcept { return _mm_asin_pd(a); }
-inline __m128 mm_asin_ps(const __m128& a) noexcept { return _mm_asin_ps(a); }
-inline __m128d mm_asinh_pd(const __m128d& a) noexcept { return _mm_asinh_pd(a); }
-inline __m128 mm_asinh_ps(const __m128& a) noexcept { return _mm_asinh_ps(a); }
-inline __m128d mm_atan_pd(const __m128d& a) noexcept { return _mm_atan_pd(a); }
-inline __m128 mm_atan_ps(const __m128& a) noexcept { return _mm_atan_ps(a); }
-inline __m128d mm_atan2_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_atan2_pd(a, b); }
-inline __m128 mm_atan2_ps(const __m128& a, const __m128& b) noexcept { return _mm_atan2_ps(a, b); }
-inline __m128d mm_atanh_pd(const __m128d& a) noexcept { return _mm_atanh_pd(a); }
-inline __m128 mm_atanh_ps(const __m128& a) noexcept { return _mm_atanh_ps(a); }
-inline __m128d mm_cos_pd(const __m128d& a) noexcept { return _mm_cos_pd(a); }
-inline __m128 mm_cos_ps(const __m128& a) noexcept { return _mm_cos_ps(a); }
-inline __m128d mm_cosd_pd(const __m128d& a) noexcept { return _mm_cosd_pd(a); }
-inline __m128 mm_cosd_ps(const __m128& a) noexcept { return _mm_cosd_ps(a); }
-inline __m128d mm_cosh_pd(const __m128d& a) noexcept { return _mm_cosh_pd(a); }
-inline __m128 mm_cosh_ps(const __m128& a) noexcept { return _mm_cosh_ps(a); }
-inline __m128d mm_hypot_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_hypot_pd(a, b); }
-inline __m128 mm_hypot_ps(const __m128& a, const __m128& b) noexcept { return _mm_hypot_ps(a, b); }
-inline __m128d mm_sin_pd(const __m128d& a) noexcept { return _mm_sin_pd(a); }
-inline __m128 mm_sin_ps(const __m128& a) noexcept { return _mm_sin_ps(a); }
-inline __m128d mm_sincos_pd(__m128d* a, const __m128d& b) noexcept { return _mm_sincos_pd(a, b); }
-inline __m128 mm_sincos_ps(__m128* a, const __m128& b) noexcept { return _mm_sincos_ps(a, b); }
-inline __m128d mm_sind_pd(const __m128d& a) noexcept { return _mm_sind_pd(a); }
-inline __m128 mm_sind_ps(const __m128& a) noexcept { return _mm_sind_ps(a); }
-inline __m128d mm_sinh_pd(const __m128d& a) noexcept { return _mm_sinh_pd(a); }
-inline __m128 mm_sinh_ps(const __m128& a) noexcept { return _mm_sinh_ps(a); }
-inline __m128d mm_tan_pd(const __m128d& a) noexcept { return _mm_tan_pd(a); }
-inline __m128 mm_tan_ps(const __m128& a) noexcept { return _mm_tan_ps(a); }
-inline __m128d mm_tand_pd(const __m128d& a) noexcept { return _mm_tand_pd(a); }
-inline __m128 mm_tand_ps(const __m128& a) noexcept { return _mm_tand_ps(a); }
-inline __m128d mm_tanh_pd(const __m128d& a) noexcept { return _mm_tanh_pd(a); }
-inline __m128 mm_tanh_ps(const __m128& a) noexcept { return _mm_tanh_ps(a); }
-inline __m128d mm_cbrt_pd(const __m128d& a) noexcept { return _mm_cbrt_pd(a); }
-inline __m128 mm_cbrt_ps(const __m128& a) noexcept { return _mm_cbrt_ps(a); }
-inline __m128 mm_cexp_ps(const __m128& a) noexcept { return _mm_cexp_ps(a); }
-inline __m128 mm_clog_ps(const __m128& a) noexcept { return _mm_clog_ps(a); }
-inline __m128 mm_csqrt_ps(const __m128& a) noexcept { return _mm_csqrt_ps(a); }
-inline __m128d mm_exp_pd(const __m128d& a) noexcept { return _mm_exp_pd(a); }
-inline __m128 mm_exp_ps(const __m128& a) noexcept { return _mm_exp_ps(a); }
-inline __m128d mm_exp10_pd(const __m128d& a) noexcept { return _mm_exp10_pd(a); }
-inline __m128 mm_exp10_ps(const __m128& a) noexcept { return _mm_exp10_ps(a); }
-inline __m128d mm_exp2_pd(const __m128d& a) noexcept { return _mm_exp2_pd(a); }
-inline __m128 mm_exp2_ps(const __m128& a) noexcept { return _mm_exp2_ps(a); }
-inline __m128d mm_expm1_pd(const __m128d& a) noexcept { return _mm_expm1_pd(a); }
-inline __m128 mm_expm1_ps(const __m128& a) noexcept { return _mm_expm1_ps(a); }
-inline __m128d mm_invcbrt_pd(const __m128d& a) noexcept { return _mm_invcbrt_pd(a); }
-inline __m128 mm_invcbrt_ps(const __m128& a) noexcept { return _mm_invcbrt_ps(a); }
-inline __m128d mm_invsqrt_pd(const __m128d& a) noexcept { return _mm_invsqrt_pd(a); }
-inline __m128 mm_invsqrt_ps(const __m128& a) noexcept { return _mm_invsqrt_ps(a); }
-inline __m128d mm_log_pd(const __m128d& a) noexcept { return _mm_log_pd(a); }
-inline __m128 mm_log_ps(const __m128& a) noexcept { return _mm_log_ps(a); }
-inline __m128d mm_log10_pd(const __m128d& a) noexcept { return _mm_log10_pd(a); }
-inline __m128 mm_log10_ps(const __m128& a) noexcept { return _mm_log10_ps(a); }
-inline __m128d mm_log1p_pd(const __m128d& a) noexcept { return _mm_log1p_pd(a); }
-inline __m128 mm_log1p_ps(const __m128& a) noexcept { return _mm_log1p_ps(a); }
-inline __m128d mm_log2_pd(const __m128d& a) noexcept { return _mm_log2_pd(a); }
-inline __m128 mm_log2_ps(const __m128& a) noexcept { return _mm_log2_ps(a); }
-inline __m128d mm_logb_pd(const __m128d& a) noexcept { return _mm_logb_pd(a); }
-inline __m128 mm_logb_ps(const __m128& a) noexcept { return _mm_logb_ps(a); }
-inline __m128d mm_pow_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_pow_pd(a, b); }
-inline __m128 mm_pow_ps(const __m128& a, const __m128& b) noexcept { return _mm_pow_ps(a, b); }
-inline __m128d mm_svml_sqrt_pd(const __m128d& a) noexcept { return _mm_svml_sqrt_pd(a); }
-inline __m128 mm_svml_sqrt_ps(const __m128& a) noexcept { return _mm_svml_sqrt_ps(a); }
-inline __m128d mm_cdfnorm_pd(const __m128d& a) noexcept { return _mm_cdfnorm_pd(a); }
-inline __m128 mm_cdfnorm_ps(const __m128& a) noexcept { return _mm_cdfnorm_ps(a); }
-inline __m128d mm_cdfnorminv_pd(const __m128d& a) noexcept { return _mm_cdfnorminv_pd(a); }
-inline __m128 mm_cdfnorminv_ps(const __m128& a) noexcept { return _mm_cdfnorminv_ps(a); }
-inline __m128 mm_erf_ps(const __m128& a) noexcept { return _mm_erf_ps(a); }
-inline __m128d mm_erfc_pd(const __m128d& a) noexcept { return _mm_erfc_pd(a); }
-inline __m128 mm_erfc_ps(const __m128& a) noexcept { return _mm_erfc_ps(a); }
-inline __m128d mm_erfcinv_pd(const __m128d& a) noexcept { return _mm_erfcinv_pd(a); }
-inline __m128 mm_erfcinv_ps(const __m128& a) noexcept { return _mm_erfcinv_ps(a); }
-inline __m128d mm_erfinv_pd(const __m128d& a) noexcept { return _mm_erfinv_pd(a); }
-inline __m128 mm_erfinv_ps(const __m128& a) noexcept { return _mm_erfinv_ps(a); }
-inline __m128i mm_div_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epi8(a, b); }
-inline __m128i mm_div_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epi16(a, b); }
-inline __m128i mm_div_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epi32(a, b); }
-inline __m128i mm_div_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epi64(a, b); }
-inline __m128i mm_div_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epu8(a, b); }
-inline __m128i mm_div_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epu16(a, b); }
-inline __m128i mm_div_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epu32(a, b); }
-inline __m128i mm_div_epu64(const __m128i& a, const __m128i& b) noexcept { return _mm_div_epu64(a, b); }
-inline __m128d mm_erf_pd(const __m128d& a) noexcept { return _mm_erf_pd(a); }
-inline __m128i mm_idiv_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_idiv_epi32(a, b); }
-inline __m128i mm_idivrem_epi32(__m128i* a, const __m128i& b, const __m128i& c) noexcept { return _mm_idivrem_epi32(a, b, c); }
-inline __m128i mm_irem_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_irem_epi32(a, b); }
-inline __m128i mm_rem_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epi8(a, b); }
-inline __m128i mm_rem_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epi16(a, b); }
-inline __m128i mm_rem_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epi32(a, b); }
-inline __m128i mm_rem_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epi64(a, b); }
-inline __m128i mm_rem_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epu8(a, b); }
-inline __m128i mm_rem_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epu16(a, b); }
-inline __m128i mm_rem_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epu32(a, b); }
-inline __m128i mm_rem_epu64(const __m128i& a, const __m128i& b) noexcept { return _mm_rem_epu64(a, b); }
-inline __m128i mm_udiv_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_udiv_epi32(a, b); }
-inline __m128i mm_udivrem_epi32(__m128i* a, const __m128i& b, const __m128i& c) noexcept { return _mm_udivrem_epi32(a, b, c); }
-inline __m128i mm_urem_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_urem_epi32(a, b); }
-inline __m128d mm_svml_ceil_pd(const __m128d& a) noexcept { return _mm_svml_ceil_pd(a); }
-inline __m128 mm_svml_ceil_ps(const __m128& a) noexcept { return _mm_svml_ceil_ps(a); }
-inline __m128d mm_svml_floor_pd(const __m128d& a) noexcept { return _mm_svml_floor_pd(a); }
-inline __m128 mm_svml_floor_ps(const __m128& a) noexcept { return _mm_svml_floor_ps(a); }
-inline __m128d mm_svml_round_pd(const __m128d& a) noexcept { return _mm_svml_round_pd(a); }
-inline __m128 mm_svml_round_ps(const __m128& a) noexcept { return _mm_svml_round_ps(a); }
-inline __m128d mm_trunc_pd(const __m128d& a) noexcept { return _mm_trunc_pd(a); }
-inline __m128 mm_trunc_ps(const __m128& a) noexcept { return _mm_trunc_ps(a); }
-// template<int i> int mm_extract_pi16(const __m64& a) noexcept { return _mm_extract_pi16(a, i); }
-// template<int i> __m64 mm_insert_pi16(const __m64& a, int b) noexcept { return _mm_insert_pi16(a, b, i); }
-// template<int i> __m64 mm_shuffle_pi16(const __m64& a) noexcept { return _mm_shuffle_pi16(a, i); }
-template<unsigned i> inline __m128 mm_shuffle_ps(const __m128& a, const __m128& b) noexcept { return _mm_shuffle_ps(a, b, i); }
-inline __m128 mm_unpackhi_ps(const __m128& a, const __m128& b) noexcept { return _mm_unpackhi_ps(a, b); }
-inline __m128 mm_unpacklo_ps(const __m128& a, const __m128& b) noexcept { return _mm_unpacklo_ps(a, b); }
-inline unsigned int mm_getcsr() noexcept { return _mm_getcsr(); }
-inline void mm_setcsr(unsigned int a) noexcept { _mm_setcsr(a); }
-template<int i> void mm_prefetch(char const* a) noexcept { _mm_prefetch(a, i); }
-inline void mm_sfence() noexcept { _mm_sfence(); }
-inline void* mm_malloc(size_t a, size_t b) noexcept { return _mm_malloc(a, b); }
-inline void mm_free(void* a) noexcept { _mm_free(a); }
-inline __m128 mm_undefined_ps() noexcept { return _mm_undefined_ps(); }
-// inline __m64 mm_max_pi16(const __m64& a, const __m64& b) noexcept { return _mm_max_pi16(a, b); }
-// inline __m64 mm_max_pu8(const __m64& a, const __m64& b) noexcept { return _mm_max_pu8(a, b); }
-// inline __m64 mm_min_pi16(const __m64& a, const __m64& b) noexcept { return _mm_min_pi16(a, b); }
-// inline __m64 mm_min_pu8(const __m64& a, const __m64& b) noexcept { return _mm_min_pu8(a, b); }
-inline __m128 mm_min_ss(const __m128& a, const __m128& b) noexcept { return _mm_min_ss(a, b); }
-inline __m128 mm_min_ps(const __m128& a, const __m128& b) noexcept { return _mm_min_ps(a, b); }
-inline __m128 mm_max_ss(const __m128& a, const __m128& b) noexcept { return _mm_max_ss(a, b); }
-inline __m128 mm_max_ps(const __m128& a, const __m128& b) noexcept { return _mm_max_ps(a, b); }
-// inline __m64 mm_mulhi_pu16(const __m64& a, const __m64& b) noexcept { return _mm_mulhi_pu16(a, b); }
-// inline __m64 mm_sad_pu8(const __m64& a, const __m64& b) noexcept { return _mm_sad_pu8(a, b); }
-inline __m128 mm_add_ss(const __m128& a, const __m128& b) noexcept { return _mm_add_ss(a, b); }
-inline __m128 mm_add_ps(const __m128& a, const __m128& b) noexcept { return _mm_add_ps(a, b); }
-inline __m128 mm_sub_ss(const __m128& a, const __m128& b) noexcept { return _mm_sub_ss(a, b); }
-inline __m128 mm_sub_ps(const __m128& a, const __m128& b) noexcept { return _mm_sub_ps(a, b); }
-inline __m128 mm_mul_ss(const __m128& a, const __m128& b) noexcept { return _mm_mul_ss(a, b); }
-inline __m128 mm_mul_ps(const __m128& a, const __m128& b) noexcept { return _mm_mul_ps(a, b); }
-inline __m128 mm_div_ss(const __m128& a, const __m128& b) noexcept { return _mm_div_ss(a, b); }
-inline __m128 mm_div_ps(const __m128& a, const __m128& b) noexcept { return _mm_div_ps(a, b); }
-// inline __m64 mm_avg_pu8(const __m64& a, const __m64& b) noexcept { return _mm_avg_pu8(a, b); }
-// inline __m64 mm_avg_pu16(const __m64& a, const __m64& b) noexcept { return _mm_avg_pu16(a, b); }
-template<int i> __m128 mm_cvtsi32_ss(const __m128& a) noexcept { return _mm_cvtsi32_ss(a, i); }
-template<int i> __m128 mm_cvt_si2ss(const __m128& a) noexcept { return _mm_cvt_si2ss(a, i); }
-inline __m128 mm_cvtsi64_ss(const __m128& a, __int64 b) noexcept { return _mm_cvtsi64_ss(a, b); }
-// inline __m128 mm_cvtpi32_ps(const __m128& a, const __m64& b) noexcept { return _mm_cvtpi32_ps(a, b); }
-// inline __m128 mm_cvt_pi2ps(const __m128& a, const __m64& b) noexcept { return _mm_cvt_pi2ps(a, b); }
-// inline __m128 mm_cvtpi16_ps(const __m64& a) noexcept { return _mm_cvtpi16_ps(a); }
-// inline __m128 mm_cvtpu16_ps(const __m64& a) noexcept { return _mm_cvtpu16_ps(a); }
-// inline __m128 mm_cvtpi8_ps(const __m64& a) noexcept { return _mm_cvtpi8_ps(a); }
-// inline __m128 mm_cvtpu8_ps(const __m64& a) noexcept { return _mm_cvtpu8_ps(a); }
-// inline __m128 mm_cvtpi32x2_ps(const __m64& a, const __m64& b) noexcept { return _mm_cvtpi32x2_ps(a, b); }
-inline int mm_cvtss_si32(const __m128& a) noexcept { return _mm_cvtss_si32(a); }
-inline int mm_cvt_ss2si(const __m128& a) noexcept { return _mm_cvt_ss2si(a); }
-inline __int64 mm_cvtss_si64(const __m128& a) noexcept { return _mm_cvtss_si64(a); }
-inline float mm_cvtss_f32(const __m128& a) noexcept { return _mm_cvtss_f32(a); }
-// inline __m64 mm_cvtps_pi32(const __m128& a) noexcept { return _mm_cvtps_pi32(a); }
-// inline __m64 mm_cvt_ps2pi(const __m128& a) noexcept { return _mm_cvt_ps2pi(a); }
-inline int mm_cvttss_si32(const __m128& a) noexcept { return _mm_cvttss_si32(a); }
-inline int mm_cvtt_ss2si(const __m128& a) noexcept { return _mm_cvtt_ss2si(a); }
-inline __int64 mm_cvttss_si64(const __m128& a) noexcept { return _mm_cvttss_si64(a); }
-// inline __m64 mm_cvttps_pi32(const __m128& a) noexcept { return _mm_cvttps_pi32(a); }
-// inline __m64 mm_cvtt_ps2pi(const __m128& a) noexcept { return _mm_cvtt_ps2pi(a); }
-// inline __m64 mm_cvtps_pi16(const __m128& a) noexcept { return _mm_cvtps_pi16(a); }
-// inline __m64 mm_cvtps_pi8(const __m128& a) noexcept { return _mm_cvtps_pi8(a); }
-// inline void mm_stream_pi(void* a, const __m64& b) noexcept { _mm_stream_pi(a, b); }
-// inline void mm_maskmove_si64(const __m64& a, const __m64& b, char* c) noexcept { _mm_maskmove_si64(a, b, c); }
-inline void mm_stream_ps(void* a, const __m128& b) noexcept { _mm_stream_ps((float*)a, b); }
-// inline void mm_storeh_pi(__m64* a, const __m128& b) noexcept { _mm_storeh_pi(a, b); }
-// inline void mm_storel_pi(__m64* a, const __m128& b) noexcept { _mm_storel_pi(a, b); }
-inline void mm_store_ss(float* a, const __m128& b) noexcept { _mm_store_ss(a, b); }
-inline void mm_store1_ps(float* a, const __m128& b) noexcept { _mm_store1_ps(a, b); }
-inline void mm_store_ps1(float* a, const __m128& b) noexcept { _mm_store_ps1(a, b); }
-inline void mm_store_ps(float* a, const __m128& b) noexcept { _mm_store_ps(a, b); }
-inline void mm_storeu_ps(float* a, const __m128& b) noexcept { _mm_storeu_ps(a, b); }
-inline void mm_storer_ps(float* a, const __m128& b) noexcept { _mm_storer_ps(a, b); }
-// inline int mm_movemask_pi8(const __m64& a) noexcept { return _mm_movemask_pi8(a); }
-inline int mm_movemask_ps(const __m128& a) noexcept { return _mm_movemask_ps(a); }
-inline __m128 mm_sqrt_ss(const __m128& a) noexcept { return _mm_sqrt_ss(a); }
-inline __m128 mm_sqrt_ps(const __m128& a) noexcept { return _mm_sqrt_ps(a); }
-inline __m128 mm_rcp_ss(const __m128& a) noexcept { return _mm_rcp_ss(a); }
-inline __m128 mm_rcp_ps(const __m128& a) noexcept { return _mm_rcp_ps(a); }
-inline __m128 mm_rsqrt_ss(const __m128& a) noexcept { return _mm_rsqrt_ss(a); }
-inline __m128 mm_rsqrt_ps(const __m128& a) noexcept { return _mm_rsqrt_ps(a); }
-inline __m128 mm_and_ps(const __m128& a, const __m128& b) noexcept { return _mm_and_ps(a, b); }
-inline __m128 mm_andnot_ps(const __m128& a, const __m128& b) noexcept { return _mm_andnot_ps(a, b); }
-inline __m128 mm_or_ps(const __m128& a, const __m128& b) noexcept { return _mm_or_ps(a, b); }
-inline __m128 mm_xor_ps(const __m128& a, const __m128& b) noexcept { return _mm_xor_ps(a, b); }
-inline __m128 mm_cmpeq_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpeq_ss(a, b); }
-inline __m128 mm_cmpeq_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpeq_ps(a, b); }
-inline __m128 mm_cmplt_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmplt_ss(a, b); }
-inline __m128 mm_cmplt_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmplt_ps(a, b); }
-inline __m128 mm_cmple_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmple_ss(a, b); }
-inline __m128 mm_cmple_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmple_ps(a, b); }
-inline __m128 mm_cmpgt_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpgt_ss(a, b); }
-inline __m128 mm_cmpgt_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpgt_ps(a, b); }
-inline __m128 mm_cmpge_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpge_ss(a, b); }
-inline __m128 mm_cmpge_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpge_ps(a, b); }
-inline __m128 mm_cmpneq_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpneq_ss(a, b); }
-inline __m128 mm_cmpneq_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpneq_ps(a, b); }
-inline __m128 mm_cmpnlt_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpnlt_ss(a, b); }
-inline __m128 mm_cmpnlt_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpnlt_ps(a, b); }
-inline __m128 mm_cmpnle_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpnle_ss(a, b); }
-inline __m128 mm_cmpnle_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpnle_ps(a, b); }
-inline __m128 mm_cmpngt_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpngt_ss(a, b); }
-inline __m128 mm_cmpngt_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpngt_ps(a, b); }
-inline __m128 mm_cmpnge_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpnge_ss(a, b); }
-inline __m128 mm_cmpnge_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpnge_ps(a, b); }
-inline __m128 mm_cmpord_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpord_ss(a, b); }
-inline __m128 mm_cmpord_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpord_ps(a, b); }
-inline __m128 mm_cmpunord_ss(const __m128& a, const __m128& b) noexcept { return _mm_cmpunord_ss(a, b); }
-inline __m128 mm_cmpunord_ps(const __m128& a, const __m128& b) noexcept { return _mm_cmpunord_ps(a, b); }
-inline int mm_comieq_ss(const __m128& a, const __m128& b) noexcept { return _mm_comieq_ss(a, b); }
-inline int mm_comilt_ss(const __m128& a, const __m128& b) noexcept { return _mm_comilt_ss(a, b); }
-inline int mm_comile_ss(const __m128& a, const __m128& b) noexcept { return _mm_comile_ss(a, b); }
-inline int mm_comigt_ss(const __m128& a, const __m128& b) noexcept { return _mm_comigt_ss(a, b); }
-inline int mm_comige_ss(const __m128& a, const __m128& b) noexcept { return _mm_comige_ss(a, b); }
-inline int mm_comineq_ss(const __m128& a, const __m128& b) noexcept { return _mm_comineq_ss(a, b); }
-inline int mm_ucomieq_ss(const __m128& a, const __m128& b) noexcept { return _mm_ucomieq_ss(a, b); }
-inline int mm_ucomilt_ss(const __m128& a, const __m128& b) noexcept { return _mm_ucomilt_ss(a, b); }
-inline int mm_ucomile_ss(const __m128& a, const __m128& b) noexcept { return _mm_ucomile_ss(a, b); }
-inline int mm_ucomigt_ss(const __m128& a, const __m128& b) noexcept { return _mm_ucomigt_ss(a, b); }
-inline int mm_ucomige_ss(const __m128& a, const __m128& b) noexcept { return _mm_ucomige_ss(a, b); }
-inline int mm_ucomineq_ss(const __m128& a, const __m128& b) noexcept { return _mm_ucomineq_ss(a, b); }
-inline __m128 mm_set_ss(float a) noexcept { return _mm_set_ss(a); }
-inline __m128 mm_set1_ps(float a) noexcept { return _mm_set1_ps(a); }
-inline __m128 mm_set_ps1(float a) noexcept { return _mm_set_ps1(a); }
-inline __m128 mm_set_ps(float a, float b, float c, float d) noexcept { return _mm_set_ps(a, b, c, d); }
-inline __m128 mm_setr_ps(float a, float b, float c, float d) noexcept { return _mm_setr_ps(a, b, c, d); }
-inline __m128 mm_setzero_ps() noexcept { return _mm_setzero_ps(); }
-// inline __m128 mm_loadh_pi(const __m128& a, __m64 const* b) noexcept { return _mm_loadh_pi(a, b); }
-// inline __m128 mm_loadl_pi(const __m128& a, __m64 const* b) noexcept { return _mm_loadl_pi(a, b); }
-inline __m128 mm_load_ss(float const* a) noexcept { return _mm_load_ss(a); }
-inline __m128 mm_load1_ps(float const* a) noexcept { return _mm_load1_ps(a); }
-inline __m128 mm_load_ps1(float const* a) noexcept { return _mm_load_ps1(a); }
-inline __m128 mm_load_ps(float const* a) noexcept { return _mm_load_ps(a); }
-inline __m128 mm_loadu_ps(float const* a) noexcept { return _mm_loadu_ps(a); }
-inline __m128 mm_loadr_ps(float const* a) noexcept { return _mm_loadr_ps(a); }
-inline __m128 mm_move_ss(const __m128& a, const __m128& b) noexcept { return _mm_move_ss(a, b); }
-inline __m128 mm_movehl_ps(const __m128& a, const __m128& b) noexcept { return _mm_movehl_ps(a, b); }
-inline __m128 mm_movelh_ps(const __m128& a, const __m128& b) noexcept { return _mm_movelh_ps(a, b); }
-inline __m128d mm_undefined_pd() noexcept { return _mm_undefined_pd(); }
-inline __m128i mm_undefined_si128() noexcept { return _mm_undefined_si128(); }
-inline void mm_pause() noexcept { _mm_pause(); }
-inline void mm_clflush(void const* a) noexcept { _mm_clflush(a); }
-inline void mm_lfence() noexcept { _mm_lfence(); }
-inline void mm_mfence() noexcept { _mm_mfence(); }
-inline __m128i mm_loadu_si64(void const* a) noexcept { return _mm_loadu_si64(a); }
-inline __m128i mm_loadu_si16(void const* a) noexcept { return _mm_loadu_si16(a); }
-inline __m128i mm_loadu_si32(void const* a) noexcept { return _mm_loadu_si32(a); }
-inline __m128i mm_loadl_epi64(__m128i const* a) noexcept { return _mm_loadl_epi64(a); }
-inline __m128i mm_load_si128(__m128i const* a) noexcept { return _mm_load_si128(a); }
-inline __m128i mm_loadu_si128(__m128i const* a) noexcept { return _mm_loadu_si128(a); }
-inline __m128d mm_load_pd(double const* a) noexcept { return _mm_load_pd(a); }
-inline __m128d mm_load1_pd(double const* a) noexcept { return _mm_load1_pd(a); }
-inline __m128d mm_load_pd1(double const* a) noexcept { return _mm_load_pd1(a); }
-inline __m128d mm_loadr_pd(double const* a) noexcept { return _mm_loadr_pd(a); }
-inline __m128d mm_loadu_pd(double const* a) noexcept { return _mm_loadu_pd(a); }
-inline __m128d mm_load_sd(double const* a) noexcept { return _mm_load_sd(a); }
-inline __m128d mm_loadh_pd(const __m128d& a, double const* b) noexcept { return _mm_loadh_pd(a, b); }
-inline __m128d mm_loadl_pd(const __m128d& a, double const* b) noexcept { return _mm_loadl_pd(a, b); }
-inline void mm_storeu_si16(void* a, const __m128i& b) noexcept { _mm_storeu_si16(a, b); }
-inline void mm_storeu_si64(void* a, const __m128i& b) noexcept { _mm_storeu_si64(a, b); }
-inline void mm_storeu_si32(void* a, const __m128i& b) noexcept { _mm_storeu_si32(a, b); }
-inline void mm_maskmoveu_si128(const __m128i& a, const __m128i& b, char* c) noexcept { _mm_maskmoveu_si128(a, b, c); }
-inline void mm_store_si128(__m128i* a, const __m128i& b) noexcept { _mm_store_si128(a, b); }
-inline void mm_storeu_si128(__m128i* a, const __m128i& b) noexcept { _mm_storeu_si128(a, b); }
-inline void mm_storel_epi64(__m128i* a, const __m128i& b) noexcept { _mm_storel_epi64(a, b); }
-inline void mm_stream_si128(void* a, const __m128i& b) noexcept { _mm_stream_si128((m128i*)a, b); }
-template<int i> void mm_stream_si32(void* a) noexcept { _mm_stream_si32(a, i); }
-// inline void mm_stream_si64(void* a, __int64 b) noexcept { _mm_stream_si64(a, b); }
-inline void mm_stream_pd(void* a, const __m128d& b) noexcept { _mm_stream_pd((double*)a, b); }
-inline void mm_store_sd(double* a, const __m128d& b) noexcept { _mm_store_sd(a, b); }
-inline void mm_store1_pd(double* a, const __m128d& b) noexcept { _mm_store1_pd(a, b); }
-inline void mm_store_pd1(double* a, const __m128d& b) noexcept { _mm_store_pd1(a, b); }
-inline void mm_store_pd(double* a, const __m128d& b) noexcept { _mm_store_pd(a, b); }
-inline void mm_storeu_pd(double* a, const __m128d& b) noexcept { _mm_storeu_pd(a, b); }
-inline void mm_storer_pd(double* a, const __m128d& b) noexcept { _mm_storer_pd(a, b); }
-inline void mm_storeh_pd(double* a, const __m128d& b) noexcept { _mm_storeh_pd(a, b); }
-inline void mm_storel_pd(double* a, const __m128d& b) noexcept { _mm_storel_pd(a, b); }
-inline __m128i mm_add_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_add_epi8(a, b); }
-inline __m128i mm_add_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_add_epi16(a, b); }
-inline __m128i mm_add_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_add_epi32(a, b); }
-// inline __m64 mm_add_si64(const __m64& a, const __m64& b) noexcept { return _mm_add_si64(a, b); }
-inline __m128i mm_add_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_add_epi64(a, b); }
-inline __m128i mm_adds_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_adds_epi8(a, b); }
-inline __m128i mm_adds_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_adds_epi16(a, b); }
-inline __m128i mm_adds_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_adds_epu8(a, b); }
-inline __m128i mm_adds_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_adds_epu16(a, b); }
-inline __m128i mm_madd_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_madd_epi16(a, b); }
-inline __m128i mm_mulhi_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_mulhi_epi16(a, b); }
-inline __m128i mm_mulhi_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_mulhi_epu16(a, b); }
-inline __m128i mm_mullo_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_mullo_epi16(a, b); }
-// inline __m64 mm_mul_su32(const __m64& a, const __m64& b) noexcept { return _mm_mul_su32(a, b); }
-inline __m128i mm_mul_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_mul_epu32(a, b); }
-inline __m128i mm_sad_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_sad_epu8(a, b); }
-inline __m128i mm_sub_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_sub_epi8(a, b); }
-inline __m128i mm_sub_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_sub_epi16(a, b); }
-inline __m128i mm_sub_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sub_epi32(a, b); }
-// inline __m64 mm_sub_si64(const __m64& a, const __m64& b) noexcept { return _mm_sub_si64(a, b); }
-inline __m128i mm_sub_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_sub_epi64(a, b); }
-inline __m128i mm_subs_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_subs_epi8(a, b); }
-inline __m128i mm_subs_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_subs_epi16(a, b); }
-inline __m128i mm_subs_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_subs_epu8(a, b); }
-inline __m128i mm_subs_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_subs_epu16(a, b); }
-inline __m128d mm_add_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_add_sd(a, b); }
-inline __m128d mm_add_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_add_pd(a, b); }
-inline __m128d mm_div_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_div_sd(a, b); }
-inline __m128d mm_div_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_div_pd(a, b); }
-inline __m128d mm_mul_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_mul_sd(a, b); }
-inline __m128d mm_mul_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_mul_pd(a, b); }
-inline __m128d mm_sub_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_sub_sd(a, b); }
-inline __m128d mm_sub_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_sub_pd(a, b); }
-inline __m128i mm_avg_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_avg_epu8(a, b); }
-inline __m128i mm_avg_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_avg_epu16(a, b); }
-inline __m128i mm_max_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_max_epi16(a, b); }
-inline __m128i mm_max_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_max_epu8(a, b); }
-inline __m128i mm_min_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_min_epi16(a, b); }
-inline __m128i mm_min_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_min_epu8(a, b); }
-inline __m128d mm_max_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_max_sd(a, b); }
-inline __m128d mm_max_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_max_pd(a, b); }
-inline __m128d mm_min_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_min_sd(a, b); }
-inline __m128d mm_min_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_min_pd(a, b); }
-template<int i> __m128i mm_slli_si128(const __m128i& a) noexcept { return _mm_slli_si128(a, i); }
-template<int i> __m128i mm_bslli_si128(const __m128i& a) noexcept { return _mm_bslli_si128(a, i); }
-template<int i> __m128i mm_bsrli_si128(const __m128i& a) noexcept { return _mm_bsrli_si128(a, i); }
-template<int i> __m128i mm_slli_epi16(const __m128i& a) noexcept { return _mm_slli_epi16(a, i); }
-inline __m128i mm_sll_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_sll_epi16(a, b); }
-template<int i> __m128i mm_slli_epi32(const __m128i& a) noexcept { return _mm_slli_epi32(a, i); }
-inline __m128i mm_sll_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sll_epi32(a, b); }
-template<int i> __m128i mm_slli_epi64(const __m128i& a) noexcept { return _mm_slli_epi64(a, i); }
-inline __m128i mm_sll_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_sll_epi64(a, b); }
-template<int i> __m128i mm_srai_epi16(const __m128i& a) noexcept { return _mm_srai_epi16(a, i); }
-inline __m128i mm_sra_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_sra_epi16(a, b); }
-template<int i> __m128i mm_srai_epi32(const __m128i& a) noexcept { return _mm_srai_epi32(a, i); }
-inline __m128i mm_sra_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sra_epi32(a, b); }
-template<int i> __m128i mm_srli_si128(const __m128i& a) noexcept { return _mm_srli_si128(a, i); }
-template<int i> __m128i mm_srli_epi16(const __m128i& a) noexcept { return _mm_srli_epi16(a, i); }
-inline __m128i mm_srl_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_srl_epi16(a, b); }
-template<int i> __m128i mm_srli_epi32(const __m128i& a) noexcept { return _mm_srli_epi32(a, i); }
-inline __m128i mm_srl_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_srl_epi32(a, b); }
-template<int i> __m128i mm_srli_epi64(const __m128i& a) noexcept { return _mm_srli_epi64(a, i); }
-inline __m128i mm_srl_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_srl_epi64(a, b); }
-inline __m128i mm_and_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_and_si128(a, b); }
-inline __m128i mm_andnot_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_andnot_si128(a, b); }
-inline __m128i mm_or_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_or_si128(a, b); }
-inline __m128i mm_xor_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_xor_si128(a, b); }
-inline __m128d mm_and_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_and_pd(a, b); }
-inline __m128d mm_andnot_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_andnot_pd(a, b); }
-inline __m128d mm_or_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_or_pd(a, b); }
-inline __m128d mm_xor_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_xor_pd(a, b); }
-inline __m128i mm_cmpeq_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpeq_epi8(a, b); }
-inline __m128i mm_cmpeq_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpeq_epi16(a, b); }
-inline __m128i mm_cmpeq_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpeq_epi32(a, b); }
-inline __m128i mm_cmpgt_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpgt_epi8(a, b); }
-inline __m128i mm_cmpgt_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpgt_epi16(a, b); }
-inline __m128i mm_cmpgt_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpgt_epi32(a, b); }
-inline __m128i mm_cmplt_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_cmplt_epi8(a, b); }
-inline __m128i mm_cmplt_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_cmplt_epi16(a, b); }
-inline __m128i mm_cmplt_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_cmplt_epi32(a, b); }
-inline __m128d mm_cmpeq_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpeq_sd(a, b); }
-inline __m128d mm_cmplt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmplt_sd(a, b); }
-inline __m128d mm_cmple_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmple_sd(a, b); }
-inline __m128d mm_cmpgt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpgt_sd(a, b); }
-inline __m128d mm_cmpge_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpge_sd(a, b); }
-inline __m128d mm_cmpord_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpord_sd(a, b); }
-inline __m128d mm_cmpunord_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpunord_sd(a, b); }
-inline __m128d mm_cmpneq_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpneq_sd(a, b); }
-inline __m128d mm_cmpnlt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpnlt_sd(a, b); }
-inline __m128d mm_cmpnle_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpnle_sd(a, b); }
-inline __m128d mm_cmpngt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpngt_sd(a, b); }
-inline __m128d mm_cmpnge_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpnge_sd(a, b); }
-inline __m128d mm_cmpeq_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpeq_pd(a, b); }
-inline __m128d mm_cmplt_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmplt_pd(a, b); }
-inline __m128d mm_cmple_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmple_pd(a, b); }
-inline __m128d mm_cmpgt_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpgt_pd(a, b); }
-inline __m128d mm_cmpge_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpge_pd(a, b); }
-inline __m128d mm_cmpord_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpord_pd(a, b); }
-inline __m128d mm_cmpunord_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpunord_pd(a, b); }
-inline __m128d mm_cmpneq_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpneq_pd(a, b); }
-inline __m128d mm_cmpnlt_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpnlt_pd(a, b); }
-inline __m128d mm_cmpnle_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpnle_pd(a, b); }
-inline __m128d mm_cmpngt_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpngt_pd(a, b); }
-inline __m128d mm_cmpnge_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_cmpnge_pd(a, b); }
-inline int mm_comieq_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_comieq_sd(a, b); }
-inline int mm_comilt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_comilt_sd(a, b); }
-inline int mm_comile_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_comile_sd(a, b); }
-inline int mm_comigt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_comigt_sd(a, b); }
-inline int mm_comige_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_comige_sd(a, b); }
-inline int mm_comineq_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_comineq_sd(a, b); }
-inline int mm_ucomieq_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ucomieq_sd(a, b); }
-inline int mm_ucomilt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ucomilt_sd(a, b); }
-inline int mm_ucomile_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ucomile_sd(a, b); }
-inline int mm_ucomigt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ucomigt_sd(a, b); }
-inline int mm_ucomige_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ucomige_sd(a, b); }
-inline int mm_ucomineq_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ucomineq_sd(a, b); }
-inline __m128d mm_cvtepi32_pd(const __m128i& a) noexcept { return _mm_cvtepi32_pd(a); }
-template<int i> __m128d mm_cvtsi32_sd(const __m128d& a) noexcept { return _mm_cvtsi32_sd(a, i); }
-inline __m128d mm_cvtsi64_sd(const __m128d& a, __int64 b) noexcept { return _mm_cvtsi64_sd(a, b); }
-inline __m128d mm_cvtsi64x_sd(const __m128d& a, __int64 b) noexcept { return _mm_cvtsi64_sd(a, b); }
-inline __m128 mm_cvtepi32_ps(const __m128i& a) noexcept { return _mm_cvtepi32_ps(a); }
-// inline __m128d mm_cvtpi32_pd(const __m64& a) noexcept { return _mm_cvtpi32_pd(a); }
-template<int i> __m128i mm_cvtsi32_si128() noexcept { return _mm_cvtsi32_si128(i); }
-inline __m128i mm_cvtsi64_si128(__int64 a) noexcept { return _mm_cvtsi64_si128(a); }
-inline __m128i mm_cvtsi64x_si128(__int64 a) noexcept { return _mm_cvtsi64_si128(a); }
-inline int mm_cvtsi128_si32(const __m128i& a) noexcept { return _mm_cvtsi128_si32(a); }
-inline __int64 mm_cvtsi128_si64(const __m128i& a) noexcept { return _mm_cvtsi128_si64(a); }
-inline __int64 mm_cvtsi128_si64x(const __m128i& a) noexcept { return _mm_cvtsi128_si64(a); }
-inline __m128 mm_cvtpd_ps(const __m128d& a) noexcept { return _mm_cvtpd_ps(a); }
-inline __m128d mm_cvtps_pd(const __m128& a) noexcept { return _mm_cvtps_pd(a); }
-inline __m128i mm_cvtpd_epi32(const __m128d& a) noexcept { return _mm_cvtpd_epi32(a); }
-inline int mm_cvtsd_si32(const __m128d& a) noexcept { return _mm_cvtsd_si32(a); }
-inline __int64 mm_cvtsd_si64(const __m128d& a) noexcept { return _mm_cvtsd_si64(a); }
-inline __int64 mm_cvtsd_si64x(const __m128d& a) noexcept { return _mm_cvtsd_si64(a); }
-inline __m128 mm_cvtsd_ss(const __m128& a, const __m128d& b) noexcept { return _mm_cvtsd_ss(a, b); }
-inline double mm_cvtsd_f64(const __m128d& a) noexcept { return _mm_cvtsd_f64(a); }
-inline __m128d mm_cvtss_sd(const __m128d& a, const __m128& b) noexcept { return _mm_cvtss_sd(a, b); }
-inline __m128i mm_cvttpd_epi32(const __m128d& a) noexcept { return _mm_cvttpd_epi32(a); }
-inline int mm_cvttsd_si32(const __m128d& a) noexcept { return _mm_cvttsd_si32(a); }
-inline __int64 mm_cvttsd_si64(const __m128d& a) noexcept { return _mm_cvttsd_si64(a); }
-inline __int64 mm_cvttsd_si64x(const __m128d& a) noexcept { return _mm_cvttsd_si64(a); }
-inline __m128i mm_cvtps_epi32(const __m128& a) noexcept { return _mm_cvtps_epi32(a); }
-inline __m128i mm_cvttps_epi32(const __m128& a) noexcept { return _mm_cvttps_epi32(a); }
-// inline __m64 mm_cvtpd_pi32(const __m128d& a) noexcept { return _mm_cvtpd_pi32(a); }
-// inline __m64 mm_cvttpd_pi32(const __m128d& a) noexcept { return _mm_cvttpd_pi32(a); }
-// inline __m128i mm_set_epi64(const __m64& a, const __m64& b) noexcept { return _mm_set_epi64(a, b); }
-inline __m128i mm_set_epi64x(__int64 e1, __int64 e0) noexcept { return _mm_set_epi64x(e1, e0); }
-inline __m128i mm_set_epi64(__int64 e1, __int64 e0) noexcept { return _mm_set_epi64x(e1, e0); }
-inline __m128i mm_set_epi32(int e3, int e2, int e1, int e0) noexcept { return _mm_set_epi32(e3, e2, e1, e0); }
-inline __m128i mm_set_epi16(short e7, short e6, short e5, short e4, short e3, short e2, short e1, short e0) noexcept { //
+__forceinline __m256d __vectorcall mm256_set1_pd(double a) noexcept { return _mm256_set1_pd(a); }
+__forceinline __m256 __vectorcall mm256_set1_ps(float a) noexcept { return _mm256_set1_ps(a); }
+__forceinline __m256i __vectorcall mm256_set1_epi8(char a) noexcept { return _mm256_set1_epi8(a); }
+__forceinline __m256i __vectorcall mm256_set1_epi16(short a) noexcept { return _mm256_set1_epi16(a); }
+__forceinline __m256i __vectorcall mm256_set1_epi32(int a) noexcept { return _mm256_set1_epi32(a); }
+__forceinline __m256i __vectorcall mm256_set1_epi64x(long long a) noexcept { return _mm256_set1_epi64x(a); }
+__forceinline __m256 __vectorcall mm256_set_m128(__m128 a, __m128 b) noexcept { return _mm256_set_m128(a, b); }
+__forceinline __m256d __vectorcall mm256_set_m128d(__m128d a, __m128d b) noexcept { return _mm256_set_m128d(a, b); }
+__forceinline __m256i __vectorcall mm256_set_m128i(__m128i a, __m128i b) noexcept { return _mm256_set_m128i(a, b); }
+__forceinline __m256 __vectorcall mm256_setr_m128(__m128 a, __m128 b) noexcept { return _mm256_setr_m128(a, b); }
+__forceinline __m256d __vectorcall mm256_setr_m128d(__m128d a, __m128d b) noexcept { return _mm256_setr_m128d(a, b); }
+__forceinline __m256i __vectorcall mm256_setr_m128i(__m128i a, __m128i b) noexcept { return _mm256_setr_m128i(a, b); }
+__forceinline __m256 __vectorcall mm256_castpd_ps(__m256d a) noexcept { return _mm256_castpd_ps(a); }
+__forceinline __m256d __vectorcall mm256_castps_pd(__m256 a) noexcept { return _mm256_castps_pd(a); }
+__forceinline __m256i __vectorcall mm256_castps_si256(__m256 a) noexcept { return _mm256_castps_si256(a); }
+__forceinline __m256i __vectorcall mm256_castpd_si256(__m256d a) noexcept { return _mm256_castpd_si256(a); }
+__forceinline __m256 __vectorcall mm256_castsi256_ps(__m256i a) noexcept { return _mm256_castsi256_ps(a); }
+__forceinline __m256d __vectorcall mm256_castsi256_pd(__m256i a) noexcept { return _mm256_castsi256_pd(a); }
+__forceinline __m128 __vectorcall mm256_castps256_ps128(__m256 a) noexcept { return _mm256_castps256_ps128(a); }
+__forceinline __m128d __vectorcall mm256_castpd256_pd128(__m256d a) noexcept { return _mm256_castpd256_pd128(a); }
+__forceinline __m128i __vectorcall mm256_castsi256_si128(__m256i a) noexcept { return _mm256_castsi256_si128(a); }
+__forceinline __m256 __vectorcall mm256_castps128_ps256(__m128 a) noexcept { return _mm256_castps128_ps256(a); }
+__forceinline __m256d __vectorcall mm256_castpd128_pd256(__m128d a) noexcept { return _mm256_castpd128_pd256(a); }
+__forceinline __m256i __vectorcall mm256_castsi128_si256(__m128i a) noexcept { return _mm256_castsi128_si256(a); }
+__forceinline __m256 __vectorcall mm256_zextps128_ps256(__m128 a) noexcept { return _mm256_zextps128_ps256(a); }
+__forceinline __m256d __vectorcall mm256_zextpd128_pd256(__m128d a) noexcept { return _mm256_zextpd128_pd256(a); }
+__forceinline __m256i __vectorcall mm256_zextsi128_si256(__m128i a) noexcept { return _mm256_zextsi128_si256(a); }
+template<int i> __forceinline int __vectorcall mm256_extract_epi8(__m256i a) noexcept { return _mm256_extract_epi8(a, i); }
+template<int i> __forceinline int __vectorcall mm256_extract_epi16(__m256i a) noexcept { return _mm256_extract_epi16(a, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_blend_epi16(__m256i a, __m256i b) noexcept { return _mm256_blend_epi16(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_blend_epi32(__m128i a, __m128i b) noexcept { return _mm_blend_epi32(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_blend_epi32(__m256i a, __m256i b) noexcept { return _mm256_blend_epi32(a, b, i); }
+__forceinline __m256i __vectorcall mm256_blendv_epi8(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_blendv_epi8(a, b, c); }
+__forceinline __m128i __vectorcall mm_broadcastb_epi8(__m128i a) noexcept { return _mm_broadcastb_epi8(a); }
+__forceinline __m256i __vectorcall mm256_broadcastb_epi8(__m128i a) noexcept { return _mm256_broadcastb_epi8(a); }
+__forceinline __m128i __vectorcall mm_broadcastd_epi32(__m128i a) noexcept { return _mm_broadcastd_epi32(a); }
+__forceinline __m256i __vectorcall mm256_broadcastd_epi32(__m128i a) noexcept { return _mm256_broadcastd_epi32(a); }
+__forceinline __m128i __vectorcall mm_broadcastq_epi64(__m128i a) noexcept { return _mm_broadcastq_epi64(a); }
+__forceinline __m256i __vectorcall mm256_broadcastq_epi64(__m128i a) noexcept { return _mm256_broadcastq_epi64(a); }
+__forceinline __m128d __vectorcall mm_broadcastsd_pd(__m128d a) noexcept { return _mm_broadcastsd_pd(a); }
+__forceinline __m256d __vectorcall mm256_broadcastsd_pd(__m128d a) noexcept { return _mm256_broadcastsd_pd(a); }
+__forceinline __m256i __vectorcall mm_broadcastsi128_si256(__m128i a) noexcept { return _mm256_broadcastsi128_si256(a); }
+__forceinline __m256i __vectorcall mm256_broadcastsi128_si256(__m128i a) noexcept { return _mm256_broadcastsi128_si256(a); }
+__forceinline __m128 __vectorcall mm_broadcastss_ps(__m128 a) noexcept { return _mm_broadcastss_ps(a); }
+__forceinline __m256 __vectorcall mm256_broadcastss_ps(__m128 a) noexcept { return _mm256_broadcastss_ps(a); }
+__forceinline __m128i __vectorcall mm_broadcastw_epi16(__m128i a) noexcept { return _mm_broadcastw_epi16(a); }
+__forceinline __m256i __vectorcall mm256_broadcastw_epi16(__m128i a) noexcept { return _mm256_broadcastw_epi16(a); }
+template<int i> __forceinline __m128i __vectorcall mm256_extracti128_si256(__m256i a) noexcept { return _mm256_extracti128_si256(a, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_inserti128_si256(__m256i a, __m128i b) noexcept { return _mm256_inserti128_si256(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_permute2x128_si256(__m256i a, __m256i b) noexcept { return _mm256_permute2x128_si256(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_permute4x64_epi64(__m256i a) noexcept { return _mm256_permute4x64_epi64(a, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_permute4x64_pd(__m256d a) noexcept { return _mm256_permute4x64_pd(a, i); }
+__forceinline __m256i __vectorcall mm256_permutevar8x32_epi32(__m256i a, __m256i b) noexcept { return _mm256_permutevar8x32_epi32(a, b); }
+__forceinline __m256 __vectorcall mm256_permutevar8x32_ps(__m256 a, __m256i b) noexcept { return _mm256_permutevar8x32_ps(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_shuffle_epi32(__m256i a) noexcept { return _mm256_shuffle_epi32(a, i); }
+__forceinline __m256i __vectorcall mm256_shuffle_epi8(__m256i a, __m256i b) noexcept { return _mm256_shuffle_epi8(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_shufflehi_epi16(__m256i a) noexcept { return _mm256_shufflehi_epi16(a, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_shufflelo_epi16(__m256i a) noexcept { return _mm256_shufflelo_epi16(a, i); }
+__forceinline __m256i __vectorcall mm256_unpackhi_epi8(__m256i a, __m256i b) noexcept { return _mm256_unpackhi_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_unpackhi_epi16(__m256i a, __m256i b) noexcept { return _mm256_unpackhi_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_unpackhi_epi32(__m256i a, __m256i b) noexcept { return _mm256_unpackhi_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_unpackhi_epi64(__m256i a, __m256i b) noexcept { return _mm256_unpackhi_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_unpacklo_epi8(__m256i a, __m256i b) noexcept { return _mm256_unpacklo_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_unpacklo_epi16(__m256i a, __m256i b) noexcept { return _mm256_unpacklo_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_unpacklo_epi32(__m256i a, __m256i b) noexcept { return _mm256_unpacklo_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_unpacklo_epi64(__m256i a, __m256i b) noexcept { return _mm256_unpacklo_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_abs_epi8(__m256i a) noexcept { return _mm256_abs_epi8(a); }
+__forceinline __m256i __vectorcall mm256_abs_epi16(__m256i a) noexcept { return _mm256_abs_epi16(a); }
+__forceinline __m256i __vectorcall mm256_abs_epi32(__m256i a) noexcept { return _mm256_abs_epi32(a); }
+__forceinline __m256i __vectorcall mm256_max_epi8(__m256i a, __m256i b) noexcept { return _mm256_max_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_max_epi16(__m256i a, __m256i b) noexcept { return _mm256_max_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_max_epi32(__m256i a, __m256i b) noexcept { return _mm256_max_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_max_epu8(__m256i a, __m256i b) noexcept { return _mm256_max_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_max_epu16(__m256i a, __m256i b) noexcept { return _mm256_max_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_max_epu32(__m256i a, __m256i b) noexcept { return _mm256_max_epu32(a, b); }
+__forceinline __m256i __vectorcall mm256_min_epi8(__m256i a, __m256i b) noexcept { return _mm256_min_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_min_epi16(__m256i a, __m256i b) noexcept { return _mm256_min_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_min_epi32(__m256i a, __m256i b) noexcept { return _mm256_min_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_min_epu8(__m256i a, __m256i b) noexcept { return _mm256_min_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_min_epu16(__m256i a, __m256i b) noexcept { return _mm256_min_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_min_epu32(__m256i a, __m256i b) noexcept { return _mm256_min_epu32(a, b); }
+__forceinline __m256i __vectorcall mm256_add_epi8(__m256i a, __m256i b) noexcept { return _mm256_add_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_add_epi16(__m256i a, __m256i b) noexcept { return _mm256_add_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_add_epi32(__m256i a, __m256i b) noexcept { return _mm256_add_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_add_epi64(__m256i a, __m256i b) noexcept { return _mm256_add_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_adds_epi8(__m256i a, __m256i b) noexcept { return _mm256_adds_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_adds_epi16(__m256i a, __m256i b) noexcept { return _mm256_adds_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_adds_epu8(__m256i a, __m256i b) noexcept { return _mm256_adds_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_adds_epu16(__m256i a, __m256i b) noexcept { return _mm256_adds_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_hadd_epi16(__m256i a, __m256i b) noexcept { return _mm256_hadd_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_hadd_epi32(__m256i a, __m256i b) noexcept { return _mm256_hadd_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_hadds_epi16(__m256i a, __m256i b) noexcept { return _mm256_hadds_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_hsub_epi16(__m256i a, __m256i b) noexcept { return _mm256_hsub_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_hsub_epi32(__m256i a, __m256i b) noexcept { return _mm256_hsub_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_hsubs_epi16(__m256i a, __m256i b) noexcept { return _mm256_hsubs_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_madd_epi16(__m256i a, __m256i b) noexcept { return _mm256_madd_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_maddubs_epi16(__m256i a, __m256i b) noexcept { return _mm256_maddubs_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_mul_epi32(__m256i a, __m256i b) noexcept { return _mm256_mul_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_mul_epu32(__m256i a, __m256i b) noexcept { return _mm256_mul_epu32(a, b); }
+__forceinline __m256i __vectorcall mm256_mulhi_epi16(__m256i a, __m256i b) noexcept { return _mm256_mulhi_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_mulhi_epu16(__m256i a, __m256i b) noexcept { return _mm256_mulhi_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_mulhrs_epi16(__m256i a, __m256i b) noexcept { return _mm256_mulhrs_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_mullo_epi16(__m256i a, __m256i b) noexcept { return _mm256_mullo_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_mullo_epi32(__m256i a, __m256i b) noexcept { return _mm256_mullo_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_sad_epu8(__m256i a, __m256i b) noexcept { return _mm256_sad_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_sign_epi8(__m256i a, __m256i b) noexcept { return _mm256_sign_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_sign_epi16(__m256i a, __m256i b) noexcept { return _mm256_sign_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_sign_epi32(__m256i a, __m256i b) noexcept { return _mm256_sign_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_sub_epi8(__m256i a, __m256i b) noexcept { return _mm256_sub_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_sub_epi16(__m256i a, __m256i b) noexcept { return _mm256_sub_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_sub_epi32(__m256i a, __m256i b) noexcept { return _mm256_sub_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_sub_epi64(__m256i a, __m256i b) noexcept { return _mm256_sub_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_subs_epi8(__m256i a, __m256i b) noexcept { return _mm256_subs_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_subs_epi16(__m256i a, __m256i b) noexcept { return _mm256_subs_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_subs_epu8(__m256i a, __m256i b) noexcept { return _mm256_subs_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_subs_epu16(__m256i a, __m256i b) noexcept { return _mm256_subs_epu16(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_alignr_epi8(__m256i a, __m256i b) noexcept { return _mm256_alignr_epi8(a, b, i); }
+__forceinline int __vectorcall mm256_movemask_epi8(__m256i a) noexcept { return _mm256_movemask_epi8(a); }
+template<int i> __forceinline __m256i __vectorcall mm256_mpsadbw_epu8(__m256i a, __m256i b) noexcept { return _mm256_mpsadbw_epu8(a, b, i); }
+__forceinline __m256i __vectorcall mm256_packs_epi16(__m256i a, __m256i b) noexcept { return _mm256_packs_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_packs_epi32(__m256i a, __m256i b) noexcept { return _mm256_packs_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_packus_epi16(__m256i a, __m256i b) noexcept { return _mm256_packus_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_packus_epi32(__m256i a, __m256i b) noexcept { return _mm256_packus_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_and_si256(__m256i a, __m256i b) noexcept { return _mm256_and_si256(a, b); }
+__forceinline __m256i __vectorcall mm256_andnot_si256(__m256i a, __m256i b) noexcept { return _mm256_andnot_si256(a, b); }
+__forceinline __m256i __vectorcall mm256_or_si256(__m256i a, __m256i b) noexcept { return _mm256_or_si256(a, b); }
+__forceinline __m256i __vectorcall mm256_xor_si256(__m256i a, __m256i b) noexcept { return _mm256_xor_si256(a, b); }
+__forceinline __m256i __vectorcall mm256_avg_epu8(__m256i a, __m256i b) noexcept { return _mm256_avg_epu8(a, b); }
+__forceinline __m256i __vectorcall mm256_avg_epu16(__m256i a, __m256i b) noexcept { return _mm256_avg_epu16(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpeq_epi8(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpeq_epi16(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpeq_epi32(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpeq_epi64(__m256i a, __m256i b) noexcept { return _mm256_cmpeq_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpgt_epi8(__m256i a, __m256i b) noexcept { return _mm256_cmpgt_epi8(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpgt_epi16(__m256i a, __m256i b) noexcept { return _mm256_cmpgt_epi16(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpgt_epi32(__m256i a, __m256i b) noexcept { return _mm256_cmpgt_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_cmpgt_epi64(__m256i a, __m256i b) noexcept { return _mm256_cmpgt_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_cvtepi16_epi32(__m128i a) noexcept { return _mm256_cvtepi16_epi32(a); }
+__forceinline __m256i __vectorcall mm256_cvtepi16_epi64(__m128i a) noexcept { return _mm256_cvtepi16_epi64(a); }
+__forceinline __m256i __vectorcall mm256_cvtepi32_epi64(__m128i a) noexcept { return _mm256_cvtepi32_epi64(a); }
+__forceinline __m256i __vectorcall mm256_cvtepi8_epi16(__m128i a) noexcept { return _mm256_cvtepi8_epi16(a); }
+__forceinline __m256i __vectorcall mm256_cvtepi8_epi32(__m128i a) noexcept { return _mm256_cvtepi8_epi32(a); }
+__forceinline __m256i __vectorcall mm256_cvtepi8_epi64(__m128i a) noexcept { return _mm256_cvtepi8_epi64(a); }
+__forceinline __m256i __vectorcall mm256_cvtepu16_epi32(__m128i a) noexcept { return _mm256_cvtepu16_epi32(a); }
+__forceinline __m256i __vectorcall mm256_cvtepu16_epi64(__m128i a) noexcept { return _mm256_cvtepu16_epi64(a); }
+__forceinline __m256i __vectorcall mm256_cvtepu32_epi64(__m128i a) noexcept { return _mm256_cvtepu32_epi64(a); }
+__forceinline __m256i __vectorcall mm256_cvtepu8_epi16(__m128i a) noexcept { return _mm256_cvtepu8_epi16(a); }
+__forceinline __m256i __vectorcall mm256_cvtepu8_epi32(__m128i a) noexcept { return _mm256_cvtepu8_epi32(a); }
+__forceinline __m256i __vectorcall mm256_cvtepu8_epi64(__m128i a) noexcept { return _mm256_cvtepu8_epi64(a); }
+template<int i> __forceinline __m128d __vectorcall mm_i32gather_pd(double const* a, __m128i b) noexcept { return _mm_i32gather_pd(a, b, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_i32gather_pd(double const* a, __m128i b) noexcept { return _mm256_i32gather_pd(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm_i32gather_ps(float const* a, __m128i b) noexcept { return _mm_i32gather_ps(a, b, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_i32gather_ps(float const* a, __m256i b) noexcept { return _mm256_i32gather_ps(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_i32gather_epi32(int const* a, __m128i b) noexcept { return _mm_i32gather_epi32(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_i32gather_epi32(int const* a, __m256i b) noexcept { return _mm256_i32gather_epi32(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_i32gather_epi64(__int64 const* a, __m128i b) noexcept { return _mm_i32gather_epi64(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_i32gather_epi64(__int64 const* a, __m128i b) noexcept { return _mm256_i32gather_epi64(a, b, i); }
+template<int i> __forceinline __m128d __vectorcall mm_i64gather_pd(double const* a, __m128i b) noexcept { return _mm_i64gather_pd(a, b, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_i64gather_pd(double const* a, __m256i b) noexcept { return _mm256_i64gather_pd(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm_i64gather_ps(float const* a, __m128i b) noexcept { return _mm_i64gather_ps(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm256_i64gather_ps(float const* a, __m256i b) noexcept { return _mm256_i64gather_ps(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_i64gather_epi32(int const* a, __m128i b) noexcept { return _mm_i64gather_epi32(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm256_i64gather_epi32(int const* a, __m256i b) noexcept { return _mm256_i64gather_epi32(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_i64gather_epi64(__int64 const* a, __m128i b) noexcept { return _mm_i64gather_epi64(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_i64gather_epi64(__int64 const* a, __m256i b) noexcept { return _mm256_i64gather_epi64(a, b, i); }
+template<int i> __forceinline __m128d __vectorcall mm_mask_i32gather_pd(__m128d a, double const* b, __m128i c, __m128d d) noexcept { return _mm_mask_i32gather_pd(a, b, c, d, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_mask_i32gather_pd(__m256d a, double const* b, __m128i c, __m256d d) noexcept { return _mm256_mask_i32gather_pd(a, b, c, d, i); }
+template<int i> __forceinline __m128 __vectorcall mm_mask_i32gather_ps(__m128 a, float const* b, __m128i c, __m128 d) noexcept { return _mm_mask_i32gather_ps(a, b, c, d, i); }
+template<int i> __forceinline __m256 __vectorcall mm256_mask_i32gather_ps(__m256 a, float const* b, __m256i c, __m256 d) noexcept { return _mm256_mask_i32gather_ps(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm_mask_i32gather_epi32(__m128i a, int const* b, __m128i c, __m128i d) noexcept { return _mm_mask_i32gather_epi32(a, b, c, d, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_mask_i32gather_epi32(__m256i a, int const* b, __m256i c, __m256i d) noexcept { return _mm256_mask_i32gather_epi32(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm_mask_i32gather_epi64(__m128i a, __int64 const* b, __m128i c, __m128i d) noexcept { return _mm_mask_i32gather_epi64(a, b, c, d, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_mask_i32gather_epi64(__m256i a, __int64 const* b, __m128i c, __m256i d) noexcept { return _mm256_mask_i32gather_epi64(a, b, c, d, i); }
+template<int i> __forceinline __m128d __vectorcall mm_mask_i64gather_pd(__m128d a, double const* b, __m128i c, __m128d d) noexcept { return _mm_mask_i64gather_pd(a, b, c, d, i); }
+template<int i> __forceinline __m256d __vectorcall mm256_mask_i64gather_pd(__m256d a, double const* b, __m256i c, __m256d d) noexcept { return _mm256_mask_i64gather_pd(a, b, c, d, i); }
+template<int i> __forceinline __m128 __vectorcall mm_mask_i64gather_ps(__m128 a, float const* b, __m128i c, __m128 d) noexcept { return _mm_mask_i64gather_ps(a, b, c, d, i); }
+template<int i> __forceinline __m128 __vectorcall mm256_mask_i64gather_ps(__m128 a, float const* b, __m256i c, __m128 d) noexcept { return _mm256_mask_i64gather_ps(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm_mask_i64gather_epi32(__m128i a, int const* b, __m128i c, __m128i d) noexcept { return _mm_mask_i64gather_epi32(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm256_mask_i64gather_epi32(__m128i a, int const* b, __m256i c, __m128i d) noexcept { return _mm256_mask_i64gather_epi32(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm_mask_i64gather_epi64(__m128i a, __int64 const* b, __m128i c, __m128i d) noexcept { return _mm_mask_i64gather_epi64(a, b, c, d, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_mask_i64gather_epi64(__m256i a, __int64 const* b, __m256i c, __m256i d) noexcept { return _mm256_mask_i64gather_epi64(a, b, c, d, i); }
+__forceinline __m128i __vectorcall mm_maskload_epi32(int const* a, __m128i b) noexcept { return _mm_maskload_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_maskload_epi32(int const* a, __m256i b) noexcept { return _mm256_maskload_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_maskload_epi64(__int64 const* a, __m128i b) noexcept { return _mm_maskload_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_maskload_epi64(__int64 const* a, __m256i b) noexcept { return _mm256_maskload_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_stream_load_si256(void const* a) noexcept { return _mm256_stream_load_si256((const __m256i*)a); }
+__forceinline void __vectorcall mm_maskstore_epi32(int* a, __m128i b, __m128i c) noexcept { _mm_maskstore_epi32(a, b, c); }
+__forceinline void __vectorcall mm256_maskstore_epi32(int* a, __m256i b, __m256i c) noexcept { _mm256_maskstore_epi32(a, b, c); }
+__forceinline void __vectorcall mm_maskstore_epi64(__int64* a, __m128i b, __m128i c) noexcept { _mm_maskstore_epi64(a, b, c); }
+__forceinline void __vectorcall mm256_maskstore_epi64(__int64* a, __m256i b, __m256i c) noexcept { _mm256_maskstore_epi64(a, b, c); }
+template<int i> __forceinline __m256i __vectorcall mm256_slli_si256(__m256i a) noexcept { return _mm256_slli_si256(a, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_bslli_epi128(__m256i a) noexcept { return _mm256_bslli_epi128(a, i); }
+__forceinline __m256i __vectorcall mm256_sll_epi16(__m256i a, __m128i b) noexcept { return _mm256_sll_epi16(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_slli_epi16(__m256i a) noexcept { return _mm256_slli_epi16(a, i); }
+__forceinline __m256i __vectorcall mm256_sll_epi32(__m256i a, __m128i b) noexcept { return _mm256_sll_epi32(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_slli_epi32(__m256i a) noexcept { return _mm256_slli_epi32(a, i); }
+__forceinline __m256i __vectorcall mm256_sll_epi64(__m256i a, __m128i b) noexcept { return _mm256_sll_epi64(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_slli_epi64(__m256i a) noexcept { return _mm256_slli_epi64(a, i); }
+__forceinline __m128i __vectorcall mm_sllv_epi32(__m128i a, __m128i b) noexcept { return _mm_sllv_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_sllv_epi32(__m256i a, __m256i b) noexcept { return _mm256_sllv_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_sllv_epi64(__m128i a, __m128i b) noexcept { return _mm_sllv_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_sllv_epi64(__m256i a, __m256i b) noexcept { return _mm256_sllv_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_sra_epi16(__m256i a, __m128i b) noexcept { return _mm256_sra_epi16(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_srai_epi16(__m256i a) noexcept { return _mm256_srai_epi16(a, i); }
+__forceinline __m256i __vectorcall mm256_sra_epi32(__m256i a, __m128i b) noexcept { return _mm256_sra_epi32(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_srai_epi32(__m256i a) noexcept { return _mm256_srai_epi32(a, i); }
+__forceinline __m128i __vectorcall mm_srav_epi32(__m128i a, __m128i b) noexcept { return _mm_srav_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_srav_epi32(__m256i a, __m256i b) noexcept { return _mm256_srav_epi32(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_srli_si256(__m256i a) noexcept { return _mm256_srli_si256(a, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_bsrli_epi128(__m256i a) noexcept { return _mm256_bsrli_epi128(a, i); }
+__forceinline __m256i __vectorcall mm256_srl_epi16(__m256i a, __m128i b) noexcept { return _mm256_srl_epi16(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_srli_epi16(__m256i a) noexcept { return _mm256_srli_epi16(a, i); }
+__forceinline __m256i __vectorcall mm256_srl_epi32(__m256i a, __m128i b) noexcept { return _mm256_srl_epi32(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_srli_epi32(__m256i a) noexcept { return _mm256_srli_epi32(a, i); }
+__forceinline __m256i __vectorcall mm256_srl_epi64(__m256i a, __m128i b) noexcept { return _mm256_srl_epi64(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_srli_epi64(__m256i a) noexcept { return _mm256_srli_epi64(a, i); }
+__forceinline __m128i __vectorcall mm_srlv_epi32(__m128i a, __m128i b) noexcept { return _mm_srlv_epi32(a, b); }
+__forceinline __m256i __vectorcall mm256_srlv_epi32(__m256i a, __m256i b) noexcept { return _mm256_srlv_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_srlv_epi64(__m128i a, __m128i b) noexcept { return _mm_srlv_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_srlv_epi64(__m256i a, __m256i b) noexcept { return _mm256_srlv_epi64(a, b); }
+__forceinline __m256i __vectorcall mm256_madd52hi_avx_epu64(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_madd52hi_avx_epu64(a, b, c); }
+__forceinline __m256i __vectorcall mm256_madd52lo_avx_epu64(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_madd52lo_avx_epu64(a, b, c); }
+__forceinline __m128i __vectorcall mm_madd52hi_avx_epu64(__m128i a, __m128i b, __m128i c) noexcept { return _mm_madd52hi_avx_epu64(a, b, c); }
+__forceinline __m128i __vectorcall mm_madd52lo_avx_epu64(__m128i a, __m128i b, __m128i c) noexcept { return _mm_madd52lo_avx_epu64(a, b, c); }
+__forceinline __m256i __vectorcall mm256_madd52hi_epu64(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_madd52hi_epu64(a, b, c); }
+__forceinline __m256i __vectorcall mm256_madd52lo_epu64(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_madd52lo_epu64(a, b, c); }
+__forceinline __m128i __vectorcall mm_madd52hi_epu64(__m128i a, __m128i b, __m128i c) noexcept { return _mm_madd52hi_epu64(a, b, c); }
+__forceinline __m128i __vectorcall mm_madd52lo_epu64(__m128i a, __m128i b, __m128i c) noexcept { return _mm_madd52lo_epu64(a, b, c); }
+// __forceinline __m256 __vectorcall mm256_bcstnebf16_ps(const __bf16* a) noexcept { return _mm256_bcstnebf16_ps(a); }
+// __forceinline __m256 __vectorcall mm256_bcstnesh_ps(const _Float16* a) noexcept { return _mm256_bcstnesh_ps(a); }
+__forceinline __m256 __vectorcall mm256_cvtneebf16_ps(const __m256bh* a) noexcept { return _mm256_cvtneebf16_ps(a); }
+__forceinline __m256 __vectorcall mm256_cvtneeph_ps(const __m256h* a) noexcept { return _mm256_cvtneeph_ps(a); }
+__forceinline __m256 __vectorcall mm256_cvtneobf16_ps(const __m256bh* a) noexcept { return _mm256_cvtneobf16_ps(a); }
+__forceinline __m256 __vectorcall mm256_cvtneoph_ps(const __m256h* a) noexcept { return _mm256_cvtneoph_ps(a); }
+__forceinline __m128bh __vectorcall mm256_cvtneps_avx_pbh(__m256 a) noexcept { return _mm256_cvtneps_avx_pbh(a); }
+// __forceinline __m128 __vectorcall mm_bcstnebf16_ps(const __bf16* a) noexcept { return _mm_bcstnebf16_ps(a); }
+// __forceinline __m128 __vectorcall mm_bcstnesh_ps(const _Float16* a) noexcept { return _mm_bcstnesh_ps(a); }
+__forceinline __m128 __vectorcall mm_cvtneebf16_ps(const __m128bh* a) noexcept { return _mm_cvtneebf16_ps(a); }
+__forceinline __m128 __vectorcall mm_cvtneeph_ps(const __m128h* a) noexcept { return _mm_cvtneeph_ps(a); }
+__forceinline __m128 __vectorcall mm_cvtneobf16_ps(const __m128bh* a) noexcept { return _mm_cvtneobf16_ps(a); }
+__forceinline __m128 __vectorcall mm_cvtneoph_ps(const __m128h* a) noexcept { return _mm_cvtneoph_ps(a); }
+__forceinline __m128bh __vectorcall mm_cvtneps_avx_pbh(__m128 a) noexcept { return _mm_cvtneps_avx_pbh(a); }
+__forceinline __m128bh __vectorcall mm256_cvtneps_pbh(__m256 a) noexcept { return _mm256_cvtneps_pbh(a); }
+__forceinline __m128bh __vectorcall mm_cvtneps_pbh(__m128 a) noexcept { return _mm_cvtneps_pbh(a); }
+__forceinline __m256i __vectorcall mm256_dpbusd_avx_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbusd_avx_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbusds_avx_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbusds_avx_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpwssd_avx_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwssd_avx_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpwssds_avx_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwssds_avx_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbusd_avx_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbusd_avx_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbusds_avx_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbusds_avx_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpwssd_avx_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwssd_avx_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpwssds_avx_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwssds_avx_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbusd_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbusd_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbusds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbusds_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpwssd_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwssd_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpwssds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwssds_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbusd_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbusd_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbusds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbusds_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpwssd_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwssd_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpwssds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwssds_epi32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_dpwsud_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwsud_epi32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_dpwsuds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwsuds_epi32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_dpwusd_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwusd_epi32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_dpwusds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwusds_epi32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_dpwuud_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwuud_epi32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_dpwuuds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpwuuds_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_dpwsud_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwsud_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_dpwsuds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwsuds_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_dpwusd_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwusd_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_dpwusds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwusds_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_dpwuud_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwuud_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_dpwuuds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpwuuds_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbssd_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbssd_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbssds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbssds_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbsud_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbsud_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbsuds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbsuds_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbuud_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbuud_epi32(a, b, c); }
+__forceinline __m256i __vectorcall mm256_dpbuuds_epi32(__m256i a, __m256i b, __m256i c) noexcept { return _mm256_dpbuuds_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbssd_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbssd_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbssds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbssds_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbsud_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbsud_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbsuds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbsuds_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbuud_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbuud_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_dpbuuds_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_dpbuuds_epi32(a, b, c); }
+// __forceinline int mm_tzcnt_32(unsigned int a) noexcept { return _mm_tzcnt_32(a); }
+// __forceinline __int64 mm_tzcnt_64(unsigned __int64 a) noexcept { return _mm_tzcnt_64(a); }
+// __forceinline void mm_cldemote(void const* a) noexcept { _mm_cldemote(a); }
+// __forceinline void mm_clflushopt(void const* a) noexcept { _mm_clflushopt(a); }
+// __forceinline void mm_clwb(void const* a) noexcept { _mm_clwb(a); }
+__forceinline unsigned int mm_crc32_u8(unsigned int a, unsigned char b) noexcept { return _mm_crc32_u8(a, b); }
+__forceinline unsigned int mm_crc32_u16(unsigned int a, unsigned short b) noexcept { return _mm_crc32_u16(a, b); }
+__forceinline unsigned int mm_crc32_u32(unsigned int a, unsigned int b) noexcept { return _mm_crc32_u32(a, b); }
+__forceinline unsigned __int64 mm_crc32_u64(unsigned __int64 a, unsigned __int64 b) noexcept { return _mm_crc32_u64(a, b); }
+__forceinline __m256 __vectorcall mm256_cvtph_ps(__m128i a) noexcept { return _mm256_cvtph_ps(a); }
+template<int i> __forceinline __m128i __vectorcall mm256_cvtps_ph(__m256 a) noexcept { return _mm256_cvtps_ph(a, i); }
+__forceinline __m128 __vectorcall mm_cvtph_ps(__m128i a) noexcept { return _mm_cvtph_ps(a); }
+template<int i> __forceinline __m128i __vectorcall mm_cvtps_ph(__m128 a) noexcept { return _mm_cvtps_ph(a, i); }
+__forceinline __m128d __vectorcall mm_fmadd_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fmadd_pd(a, b, c); }
+__forceinline __m256d __vectorcall mm256_fmadd_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fmadd_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmadd_ps(a, b, c); }
+__forceinline __m256 __vectorcall mm256_fmadd_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+__forceinline __m128d __vectorcall mm_fmadd_sd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fmadd_sd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fmadd_ss(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmadd_ss(a, b, c); }
+__forceinline __m128d __vectorcall mm_fmaddsub_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fmaddsub_pd(a, b, c); }
+__forceinline __m256d __vectorcall mm256_fmaddsub_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fmaddsub_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fmaddsub_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmaddsub_ps(a, b, c); }
+__forceinline __m256 __vectorcall mm256_fmaddsub_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fmaddsub_ps(a, b, c); }
+__forceinline __m128d __vectorcall mm_fmsub_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fmsub_pd(a, b, c); }
+__forceinline __m256d __vectorcall mm256_fmsub_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fmsub_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fmsub_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmsub_ps(a, b, c); }
+__forceinline __m256 __vectorcall mm256_fmsub_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fmsub_ps(a, b, c); }
+__forceinline __m128d __vectorcall mm_fmsub_sd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fmsub_sd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fmsub_ss(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmsub_ss(a, b, c); }
+__forceinline __m128d __vectorcall mm_fmsubadd_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fmsubadd_pd(a, b, c); }
+__forceinline __m256d __vectorcall mm256_fmsubadd_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fmsubadd_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fmsubadd_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fmsubadd_ps(a, b, c); }
+__forceinline __m256 __vectorcall mm256_fmsubadd_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fmsubadd_ps(a, b, c); }
+__forceinline __m128d __vectorcall mm_fnmadd_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fnmadd_pd(a, b, c); }
+__forceinline __m256d __vectorcall mm256_fnmadd_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fnmadd_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fnmadd_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fnmadd_ps(a, b, c); }
+__forceinline __m256 __vectorcall mm256_fnmadd_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fnmadd_ps(a, b, c); }
+__forceinline __m128d __vectorcall mm_fnmadd_sd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fnmadd_sd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fnmadd_ss(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fnmadd_ss(a, b, c); }
+__forceinline __m128d __vectorcall mm_fnmsub_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fnmsub_pd(a, b, c); }
+__forceinline __m256d __vectorcall mm256_fnmsub_pd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fnmsub_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fnmsub_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fnmsub_ps(a, b, c); }
+__forceinline __m256 __vectorcall mm256_fnmsub_ps(__m256 a, __m256 b, __m256 c) noexcept { return _mm256_fnmsub_ps(a, b, c); }
+__forceinline __m128d __vectorcall mm_fnmsub_sd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_fnmsub_sd(a, b, c); }
+__forceinline __m128 __vectorcall mm_fnmsub_ss(__m128 a, __m128 b, __m128 c) noexcept { return _mm_fnmsub_ss(a, b, c); }
+__forceinline __m512i __vectorcall mm512_maskz_gf2p8mul_epi8(__mmask64 a, __m512i b, __m512i c) noexcept { return _mm512_maskz_gf2p8mul_epi8(a, b, c); }
+__forceinline __m512i __vectorcall mm512_mask_gf2p8mul_epi8(__m512i a, __mmask64 b, __m512i c, __m512i d) noexcept { return _mm512_mask_gf2p8mul_epi8(a, b, c, d); }
+__forceinline __m512i __vectorcall mm512_gf2p8mul_epi8(__m512i a, __m512i b) noexcept { return _mm512_gf2p8mul_epi8(a, b); }
+template<int i> __forceinline __m512i __vectorcall mm512_maskz_gf2p8affine_epi64_epi8(__mmask64 a, __m512i b, __m512i c) noexcept { return _mm512_maskz_gf2p8affine_epi64_epi8(a, b, c, i); }
+template<int i> __forceinline __m512i __vectorcall mm512_mask_gf2p8affine_epi64_epi8(__m512i a, __mmask64 b, __m512i c, __m512i d) noexcept { return _mm512_mask_gf2p8affine_epi64_epi8(a, b, c, d, i); }
+template<int i> __forceinline __m512i __vectorcall mm512_gf2p8affine_epi64_epi8(__m512i a, __m512i b) noexcept { return _mm512_gf2p8affine_epi64_epi8(a, b, i); }
+template<int i> __forceinline __m512i __vectorcall mm512_maskz_gf2p8affineinv_epi64_epi8(__mmask64 a, __m512i b, __m512i c) noexcept { return _mm512_maskz_gf2p8affineinv_epi64_epi8(a, b, c, i); }
+template<int i> __forceinline __m512i __vectorcall mm512_mask_gf2p8affineinv_epi64_epi8(__m512i a, __mmask64 b, __m512i c, __m512i d) noexcept { return _mm512_mask_gf2p8affineinv_epi64_epi8(a, b, c, d, i); }
+template<int i> __forceinline __m512i __vectorcall mm512_gf2p8affineinv_epi64_epi8(__m512i a, __m512i b) noexcept { return _mm512_gf2p8affineinv_epi64_epi8(a, b, i); }
+__forceinline __m256i __vectorcall mm256_maskz_gf2p8mul_epi8(__mmask32 a, __m256i b, __m256i c) noexcept { return _mm256_maskz_gf2p8mul_epi8(a, b, c); }
+__forceinline __m256i __vectorcall mm256_mask_gf2p8mul_epi8(__m256i a, __mmask32 b, __m256i c, __m256i d) noexcept { return _mm256_mask_gf2p8mul_epi8(a, b, c, d); }
+__forceinline __m256i __vectorcall mm256_gf2p8mul_epi8(__m256i a, __m256i b) noexcept { return _mm256_gf2p8mul_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_maskz_gf2p8mul_epi8(__mmask16 a, __m128i b, __m128i c) noexcept { return _mm_maskz_gf2p8mul_epi8(a, b, c); }
+__forceinline __m128i __vectorcall mm_mask_gf2p8mul_epi8(__m128i a, __mmask16 b, __m128i c, __m128i d) noexcept { return _mm_mask_gf2p8mul_epi8(a, b, c, d); }
+__forceinline __m128i __vectorcall mm_gf2p8mul_epi8(__m128i a, __m128i b) noexcept { return _mm_gf2p8mul_epi8(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_maskz_gf2p8affine_epi64_epi8(__mmask32 a, __m256i b, __m256i c) noexcept { return _mm256_maskz_gf2p8affine_epi64_epi8(a, b, c, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_mask_gf2p8affine_epi64_epi8(__m256i a, __mmask32 b, __m256i c, __m256i d) noexcept { return _mm256_mask_gf2p8affine_epi64_epi8(a, b, c, d, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_gf2p8affine_epi64_epi8(__m256i a, __m256i b) noexcept { return _mm256_gf2p8affine_epi64_epi8(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_maskz_gf2p8affine_epi64_epi8(__mmask16 a, __m128i b, __m128i c) noexcept { return _mm_maskz_gf2p8affine_epi64_epi8(a, b, c, i); }
+template<int i> __forceinline __m128i __vectorcall mm_mask_gf2p8affine_epi64_epi8(__m128i a, __mmask16 b, __m128i c, __m128i d) noexcept { return _mm_mask_gf2p8affine_epi64_epi8(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm_gf2p8affine_epi64_epi8(__m128i a, __m128i b) noexcept { return _mm_gf2p8affine_epi64_epi8(a, b, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_maskz_gf2p8affineinv_epi64_epi8(__mmask32 a, __m256i b, __m256i c) noexcept { return _mm256_maskz_gf2p8affineinv_epi64_epi8(a, b, c, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_mask_gf2p8affineinv_epi64_epi8(__m256i a, __mmask32 b, __m256i c, __m256i d) noexcept { return _mm256_mask_gf2p8affineinv_epi64_epi8(a, b, c, d, i); }
+template<int i> __forceinline __m256i __vectorcall mm256_gf2p8affineinv_epi64_epi8(__m256i a, __m256i b) noexcept { return _mm256_gf2p8affineinv_epi64_epi8(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_maskz_gf2p8affineinv_epi64_epi8(__mmask16 a, __m128i b, __m128i c) noexcept { return _mm_maskz_gf2p8affineinv_epi64_epi8(a, b, c, i); }
+template<int i> __forceinline __m128i __vectorcall mm_mask_gf2p8affineinv_epi64_epi8(__m128i a, __mmask16 b, __m128i c, __m128i d) noexcept { return _mm_mask_gf2p8affineinv_epi64_epi8(a, b, c, d, i); }
+template<int i> __forceinline __m128i __vectorcall mm_gf2p8affineinv_epi64_epi8(__m128i a, __m128i b) noexcept { return _mm_gf2p8affineinv_epi64_epi8(a, b, i); }
+__forceinline unsigned char __vectorcall mm_aesdec128kl_u8(__m128i* a, __m128i b, const void* c) noexcept { return _mm_aesdec128kl_u8(a, b, c); }
+__forceinline unsigned char __vectorcall mm_aesdec256kl_u8(__m128i* a, __m128i b, const void* c) noexcept { return _mm_aesdec256kl_u8(a, b, c); }
+__forceinline unsigned char __vectorcall mm_aesenc128kl_u8(__m128i* a, __m128i b, const void* c) noexcept { return _mm_aesenc128kl_u8(a, b, c); }
+__forceinline unsigned char __vectorcall mm_aesenc256kl_u8(__m128i* a, __m128i b, const void* c) noexcept { return _mm_aesenc256kl_u8(a, b, c); }
+__forceinline unsigned int __vectorcall mm_encodekey128_u32(unsigned int a, __m128i b, void* c) noexcept { return _mm_encodekey128_u32(a, b, c); }
+__forceinline unsigned int __vectorcall mm_encodekey256_u32(unsigned int a, __m128i b, __m128i c, void* d) noexcept { return _mm_encodekey256_u32(a, b, c, d); }
+__forceinline void __vectorcall mm_loadiwkey(unsigned int a, __m128i b, __m128i c, __m128i d) noexcept { _mm_loadiwkey(a, b, c, d); }
+__forceinline unsigned char __vectorcall mm_aesdecwide128kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesdecwide128kl_u8(a, b, c); }
+__forceinline unsigned char __vectorcall mm_aesdecwide256kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesdecwide256kl_u8(a, b, c); }
+__forceinline unsigned char __vectorcall mm_aesencwide128kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesencwide128kl_u8(a, b, c); }
+__forceinline unsigned char __vectorcall mm_aesencwide256kl_u8(__m128i* a, const __m128i* b, const void* c) noexcept { return _mm_aesencwide256kl_u8(a, b, c); }
+// template<int i> __forceinline __m64 __vectorcall mm_cvtsi32_si64() noexcept { return _mm_cvtsi32_si64(i); }
+// __forceinline int __vectorcall mm_cvtsi64_si32(__m64 a) noexcept { return _mm_cvtsi64_si32(a); }
+// __forceinline __int64 __vectorcall mm_cvtm64_si64(__m64 a) noexcept { return _mm_cvtm64_si64(a); }
+// __forceinline __m64 __vectorcall mm_cvtsi64_m64(__int64 a) noexcept { return _mm_cvtsi64_m64(a); }
+// __forceinline void mm_empty() noexcept { _mm_empty(); }
+// __forceinline __m64 __vectorcall mm_packs_pi16(__m64 a, __m64 b) noexcept { return _mm_packs_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_packs_pi32(__m64 a, __m64 b) noexcept { return _mm_packs_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_packs_pu16(__m64 a, __m64 b) noexcept { return _mm_packs_pu16(a, b); }
+// __forceinline __m64 __vectorcall mm_unpackhi_pi8(__m64 a, __m64 b) noexcept { return _mm_unpackhi_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_unpackhi_pi16(__m64 a, __m64 b) noexcept { return _mm_unpackhi_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_unpackhi_pi32(__m64 a, __m64 b) noexcept { return _mm_unpackhi_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_unpacklo_pi8(__m64 a, __m64 b) noexcept { return _mm_unpacklo_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_unpacklo_pi16(__m64 a, __m64 b) noexcept { return _mm_unpacklo_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_unpacklo_pi32(__m64 a, __m64 b) noexcept { return _mm_unpacklo_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_add_pi8(__m64 a, __m64 b) noexcept { return _mm_add_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_add_pi16(__m64 a, __m64 b) noexcept { return _mm_add_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_add_pi32(__m64 a, __m64 b) noexcept { return _mm_add_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_adds_pi8(__m64 a, __m64 b) noexcept { return _mm_adds_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_adds_pi16(__m64 a, __m64 b) noexcept { return _mm_adds_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_adds_pu8(__m64 a, __m64 b) noexcept { return _mm_adds_pu8(a, b); }
+// __forceinline __m64 __vectorcall mm_adds_pu16(__m64 a, __m64 b) noexcept { return _mm_adds_pu16(a, b); }
+// __forceinline __m64 __vectorcall mm_sub_pi8(__m64 a, __m64 b) noexcept { return _mm_sub_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_sub_pi16(__m64 a, __m64 b) noexcept { return _mm_sub_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_sub_pi32(__m64 a, __m64 b) noexcept { return _mm_sub_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_subs_pi8(__m64 a, __m64 b) noexcept { return _mm_subs_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_subs_pi16(__m64 a, __m64 b) noexcept { return _mm_subs_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_subs_pu8(__m64 a, __m64 b) noexcept { return _mm_subs_pu8(a, b); }
+// __forceinline __m64 __vectorcall mm_subs_pu16(__m64 a, __m64 b) noexcept { return _mm_subs_pu16(a, b); }
+// __forceinline __m64 __vectorcall mm_madd_pi16(__m64 a, __m64 b) noexcept { return _mm_madd_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_mulhi_pi16(__m64 a, __m64 b) noexcept { return _mm_mulhi_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_mullo_pi16(__m64 a, __m64 b) noexcept { return _mm_mullo_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_sll_pi16(__m64 a, __m64 b) noexcept { return _mm_sll_pi16(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_slli_pi16(__m64 a) noexcept { return _mm_slli_pi16(a, i); }
+// __forceinline __m64 __vectorcall mm_sll_pi32(__m64 a, __m64 b) noexcept { return _mm_sll_pi32(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_slli_pi32(__m64 a) noexcept { return _mm_slli_pi32(a, i); }
+// __forceinline __m64 __vectorcall mm_sll_si64(__m64 a, __m64 b) noexcept { return _mm_sll_si64(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_slli_si64(__m64 a) noexcept { return _mm_slli_si64(a, i); }
+// __forceinline __m64 __vectorcall mm_sra_pi16(__m64 a, __m64 b) noexcept { return _mm_sra_pi16(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_srai_pi16(__m64 a) noexcept { return _mm_srai_pi16(a, i); }
+// __forceinline __m64 __vectorcall mm_sra_pi32(__m64 a, __m64 b) noexcept { return _mm_sra_pi32(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_srai_pi32(__m64 a) noexcept { return _mm_srai_pi32(a, i); }
+// __forceinline __m64 __vectorcall mm_srl_pi16(__m64 a, __m64 b) noexcept { return _mm_srl_pi16(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_srli_pi16(__m64 a) noexcept { return _mm_srli_pi16(a, i); }
+// __forceinline __m64 __vectorcall mm_srl_pi32(__m64 a, __m64 b) noexcept { return _mm_srl_pi32(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_srli_pi32(__m64 a) noexcept { return _mm_srli_pi32(a, i); }
+// __forceinline __m64 __vectorcall mm_srl_si64(__m64 a, __m64 b) noexcept { return _mm_srl_si64(a, b); }
+// template<int i> __forceinline __m64 __vectorcall mm_srli_si64(__m64 a) noexcept { return _mm_srli_si64(a, i); }
+// __forceinline __m64 __vectorcall mm_and_si64(__m64 a, __m64 b) noexcept { return _mm_and_si64(a, b); }
+// __forceinline __m64 __vectorcall mm_andnot_si64(__m64 a, __m64 b) noexcept { return _mm_andnot_si64(a, b); }
+// __forceinline __m64 __vectorcall mm_or_si64(__m64 a, __m64 b) noexcept { return _mm_or_si64(a, b); }
+// __forceinline __m64 __vectorcall mm_xor_si64(__m64 a, __m64 b) noexcept { return _mm_xor_si64(a, b); }
+// __forceinline __m64 __vectorcall mm_cmpeq_pi8(__m64 a, __m64 b) noexcept { return _mm_cmpeq_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_cmpeq_pi16(__m64 a, __m64 b) noexcept { return _mm_cmpeq_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_cmpeq_pi32(__m64 a, __m64 b) noexcept { return _mm_cmpeq_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_cmpgt_pi8(__m64 a, __m64 b) noexcept { return _mm_cmpgt_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_cmpgt_pi16(__m64 a, __m64 b) noexcept { return _mm_cmpgt_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_cmpgt_pi32(__m64 a, __m64 b) noexcept { return _mm_cmpgt_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_setzero_si64() noexcept { return _mm_setzero_si64(); }
+// template<int i> __forceinline __m64 __vectorcall mm_set_pi32(int a) noexcept { return _mm_set_pi32(a, i); }
+// __forceinline __m64 __vectorcall mm_set_pi16(short a, short b, short c, short d) noexcept { return _mm_set_pi16(a, b, c, d); }
+// __forceinline __m64 __vectorcall mm_set_pi8(char a, char b, char c, char d, char e, char f, char g, char h) noexcept { return _mm_set_pi8(a, b, c, d, e, f, g, h); }
+// template<int i> __forceinline __m64 __vectorcall mm_set1_pi32() noexcept { return _mm_set1_pi32(i); }
+// __forceinline __m64 __vectorcall mm_set1_pi16(short a) noexcept { return _mm_set1_pi16(a); }
+// __forceinline __m64 __vectorcall mm_set1_pi8(char a) noexcept { return _mm_set1_pi8(a); }
+// template<int i> __forceinline __m64 __vectorcall mm_setr_pi32(int a) noexcept { return _mm_setr_pi32(a, i); }
+// __forceinline __m64 __vectorcall mm_setr_pi16(short a, short b, short c, short d) noexcept { return _mm_setr_pi16(a, b, c, d); }
+// __forceinline __m64 __vectorcall mm_setr_pi8(char a, char b, char c, char d, char e, char f, char g, char h) noexcept { return _mm_setr_pi8(a, b, c, d, e, f, g, h); }
+__forceinline void mm_monitor(void const* a, unsigned b, unsigned c) noexcept { _mm_monitor(a, b, c); }
+__forceinline void mm_mwait(unsigned a, unsigned b) noexcept { _mm_mwait(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_clmulepi64_si128(__m128i a, __m128i b) noexcept { return _mm_clmulepi64_si128(a, b, i); }
+__forceinline int mm_popcnt_u32(unsigned int a) noexcept { return _mm_popcnt_u32(a); }
+__forceinline __int64 mm_popcnt_u64(unsigned __int64 a) noexcept { return _mm_popcnt_u64(a); }
+__forceinline unsigned __int64 umulh(unsigned __int64 a, unsigned __int64 b) noexcept { return __umulh(a, b); }
+__forceinline unsigned __int64 umul128(unsigned __int64 a, unsigned __int64 b, unsigned __int64* c) noexcept { return _umul128(a, b, c); }
+__forceinline unsigned __int64 pdep_u64(unsigned __int64 a, unsigned __int64 b) noexcept { return _pdep_u64(a, b); }
+inline void cpuid(int* a, int b) noexcept { __cpuid(a, b); }
+inline void cpuidex(int* a, int b, int c) noexcept { __cpuidex(a, b, c); }
+__forceinline unsigned __int64 xgetbv(unsigned int a) noexcept { return _xgetbv(a); }
+__forceinline unsigned __int64 rdtsc() noexcept { return __rdtsc(); }
+__forceinline void movsb(void* a, const void* b, unsigned __int64 c) noexcept { __movsb(static_cast<unsigned char*>(a), static_cast<const unsigned char*>(b), c); }
+__forceinline void stosb(void* a, unsigned char b, unsigned __int64 c) noexcept { __stosb(static_cast<unsigned char*>(a), b, c); }
+inline bool set_thread_affinity(void* thread, unsigned __int64 mask) noexcept { return SetThreadAffinityMask(thread, mask) != 0; }
+/// `OVERLAPPED`: offset and kernel status of one asynchronous file operation
+struct overlapped {
+  unsigned __int64 internal, internal_high, offset;
+  void* event;
+};
+/// `OVERLAPPED_ENTRY`: one completion dequeued from a port
+struct overlapped_entry {
+  unsigned __int64 key;
+  overlapped* ov;
+  unsigned __int64 internal;
+  unsigned long bytes;
+};
+inline void* create_file(const wchar_t* name, unsigned long access, unsigned long share, unsigned long disposition, unsigned long flags) noexcept {
+  const auto h = CreateFileW(name, access, share, nullptr, disposition, flags, nullptr);
+  return h == reinterpret_cast<void*>(~0ull) ? nullptr : h;
+}
+inline bool close_handle(void* h) noexcept { return CloseHandle(h) != 0; }
+inline bool read_file(void* file, void* buffer, unsigned long size, unsigned long* read, overlapped* ov) noexcept { return ReadFile(file, buffer, size, read, ov) != 0; }
+inline bool write_file(void* file, const void* buffer, unsigned long size, unsigned long* written, overlapped* ov) noexcept { return WriteFile(file, buffer, size, written, ov) != 0; }
+inline bool flush_file(void* file) noexcept { return FlushFileBuffers(file) != 0; }
+inline bool file_size(void* file, __int64* size) noexcept { return GetFileSizeEx(file, size) != 0; }
+inline bool overlapped_result(void* file, overlapped* ov, unsigned long* bytes) noexcept { return GetOverlappedResult(file, ov, bytes, 0) != 0; }
+inline unsigned long last_error() noexcept { return GetLastError(); }
+inline void* new_completion_port() noexcept { return CreateIoCompletionPort(reinterpret_cast<void*>(~0ull), nullptr, 0, 0); }
+inline bool associate_completion_port(void* file, void* port, unsigned __int64 key) noexcept { return CreateIoCompletionPort(file, port, key, 0) != nullptr; }
+inline bool dequeue_completions(void* port, overlapped_entry* entries, unsigned long count, unsigned long* removed, unsigned long ms) noexcept { return GetQueuedCompletionStatusEx(port, entries, count, removed, ms, 0) != 0; }
+inline bool post_completion(void* port, unsigned long bytes, unsigned __int64 key, overlapped* ov) noexcept { return PostQueuedCompletionStatus(port, bytes, key, ov) != 0; }
+/// `FILE_SKIP_COMPLETION_PORT_ON_SUCCESS | FILE_SKIP_SET_EVENT_ON_HANDLE`
+inline bool skip_completion_on_success(void* file) noexcept { return SetFileCompletionNotificationModes(file, 3) != 0; }
+inline bool lock_io_range(void* file, void* start, unsigned long size) noexcept { return SetFileIoOverlappedRange(file, static_cast<unsigned char*>(start), size) != 0; }
+/// a section over `file`, or over the page file if `file` is null; 0 `size` covers the whole file
+inline void* create_file_mapping(void* file, unsigned long protect, unsigned __int64 size) noexcept {
+  return CreateFileMappingW(file ? file : reinterpret_cast<void*>(~0ull), nullptr, protect, static_cast<unsigned long>(size >> 32), static_cast<unsigned long>(size), nullptr);
+}
+inline void* map_view(void* mapping, unsigned long access, unsigned __int64 size) noexcept { return MapViewOfFile(mapping, access, 0, 0, size); }
+inline bool unmap_view(const void* view) noexcept { return UnmapViewOfFile(view) != 0; }
+inline bool flush_view(const void* view, unsigned __int64 size) noexcept { return FlushViewOfFile(view, size) != 0; }
+/// starts reading the pages of a range into memory, like `madvise(MADV_WILLNEED)`
+inline bool prefetch_memory(void* address, unsigned __int64 size) noexcept {
+  struct {
+    void* address;
+    unsigned __int64 size;
+  } range{address, size};
+  return PrefetchVirtualMemory(reinterpret_cast<void*>(~0ull), 1, &range, 0) != 0;
+}
+/// drops the unlocked pages of a range from the working set, like `madvise(MADV_DONTNEED)` on a file view
+inline void evict_memory(void* address, unsigned __int64 size) noexcept { VirtualUnlock(address, size); }
+/// `CONTEXT` of an x64 thread, of which only the control and integer registers are captured
+struct alignas(16) thread_context {
+  unsigned char raw[1232];
+  unsigned __int64& rsp() noexcept { return *reinterpret_cast<unsigned __int64*>(raw + 0x98); }
+  unsigned __int64& rip() noexcept { return *reinterpret_cast<unsigned __int64*>(raw + 0xf8); }
+};
+/// `THREADENTRY32`
+struct thread_entry {
+  unsigned long size = sizeof(thread_entry), usage = 0, id = 0, process = 0;
+  long base_priority = 0, delta_priority = 0;
+  unsigned long flags = 0;
+};
+inline unsigned long current_thread_id() noexcept { return GetCurrentThreadId(); }
+/// a handle that can suspend the thread and read its registers, or null
+inline void* open_thread(unsigned long id) noexcept { return OpenThread(0x004a, 0, id); }
+inline bool suspend_thread(void* thread) noexcept { return SuspendThread(thread) != ~0ul; }
+inline void resume_thread(void* thread) noexcept { ResumeThread(thread); }
+/// the registers of a suspended thread
+inline bool get_thread_context(void* thread, thread_context* c) noexcept {
+  *reinterpret_cast<unsigned long*>(c->raw + 0x30) = 0x100003;
+  return GetThreadContext(thread, c) != 0;
+}
+/// calls `f(id)` for each thread of this process
+template<typename F> bool for_each_thread(F&& f) {
+  const auto snapshot = CreateToolhelp32Snapshot(4, 0);
+  if (snapshot == reinterpret_cast<void*>(~0ull)) return false;
+  const auto process = GetCurrentProcessId();
+  thread_entry e;
+  for (bool ok = Thread32First(snapshot, &e) != 0; ok; ok = Thread32Next(snapshot, &e) != 0)
+    if (e.process == process) f(e.id);
+  CloseHandle(snapshot);
+  return true;
+}
+/// the unwind data of the function containing `pc`, or null for a leaf function
+inline void* function_entry(unsigned __int64 pc, unsigned __int64* image_base) noexcept { return RtlLookupFunctionEntry(pc, image_base, nullptr); }
+/// steps `c` from the function at `pc` to its caller
+inline void virtual_unwind(unsigned __int64 image_base, unsigned __int64 pc, void* function, thread_context* c) noexcept {
+  void* data;
+  unsigned __int64 frame;
+  RtlVirtualUnwind(0, image_base, pc, function, c, &data, &frame, nullptr);
+}
+/// the path of the module containing `pc` written to `name`, and its length, or 0 if none
+inline unsigned long module_path(unsigned __int64 pc, char* name, unsigned long size) noexcept {
+  void* m;
+  if (!GetModuleHandleExA(6, reinterpret_cast<const char*>(pc), &m)) return 0;
+  return GetModuleFileNameA(m, name, size);
+}
+/// DbgHelp for this process, initialized on first use; it is not thread-safe, so every call holds `symbol_mutex`
+inline std::mutex symbol_mutex;
+inline void* symbol_process() noexcept {
+  static const bool ready = (SymSetOptions(0x16), SymInitialize(reinterpret_cast<void*>(~0ull), nullptr, 1) != 0);
+  return ready ? reinterpret_cast<void*>(~0ull) : nullptr;
+}
+/// the undecorated name of the function containing `pc` written to `name`, and its length, or 0 without symbols
+inline unsigned long function_name(unsigned __int64 pc, char* name, unsigned long size) noexcept {
+  struct { // `SYMBOL_INFO` and room for the name
+    unsigned long size = 88, type = 0;
+    unsigned __int64 reserved[2]{};
+    unsigned long index = 0, bytes = 0;
+    unsigned __int64 module = 0;
+    unsigned long flags = 0;
+    unsigned __int64 value = 0, address = 0;
+    unsigned long reg = 0, scope = 0, tag = 0, length = 0, capacity = 1024;
+    char name[1024];
+  } s;
+  unsigned __int64 displacement;
+  std::lock_guard lock(symbol_mutex);
+  const auto p = symbol_process();
+  if (!p || !SymFromAddr(p, pc, &displacement, &s) || size == 0) return 0;
+  const unsigned long n = (std::min)({s.length, s.capacity - 1, size - 1});
+  std::memcpy(name, s.name, n), name[n] = '\0';
+  return n;
+}
+/// the source line of the code at `pc` with its file written to `file`, or 0 without line information
+inline unsigned long source_line(unsigned __int64 pc, char* file, unsigned long size) noexcept {
+  struct { // `IMAGEHLP_LINE64`
+    unsigned long size = 40;
+    void* key = nullptr;
+    unsigned long line = 0;
+    const char* file = nullptr;
+    unsigned __int64 address = 0;
+  } l;
+  unsigned long displacement;
+  std::lock_guard lock(symbol_mutex);
+  const auto p = symbol_process();
+  if (!p || !SymGetLineFromAddr64(p, pc, &displacement, &l) || !l.file || size == 0) return 0;
+  const unsigned long n = (std::min)(static_cast<unsigned long>(std::strlen(l.file)), size - 1);
+  std::memcpy(file, l.file, n), file[n] = '\0';
+  return l.line;
+}
+/// a waitable timer with sub-millisecond resolution where the system has one
+inline void* new_timer() noexcept {
+  const auto t = CreateWaitableTimerExW(nullptr, nullptr, 2, 0x1f0003);
+  return t ? t : CreateWaitableTimerExW(nullptr, nullptr, 0, 0x1f0003);
+}
+/// sleeps on `timer` for `ns100` hundreds of nanoseconds
+inline void wait_timer(void* timer, __int64 ns100) noexcept {
+  const __int64 due = -ns100;
+  if (SetWaitableTimer(timer, &due, 0, nullptr, nullptr, 0)) WaitForSingleObject(timer, ~0ul);
+}
+/// `PERFORMANCE_DATA`: what the kernel counted for a thread with profiling enabled
+struct performance_data {
+  unsigned short size = sizeof(performance_data);
+  unsigned char version = 1, counter_count = 0;
+  unsigned long context_switches = 0;
+  unsigned __int64 wait_reasons = 0, cycles = 0;
+  unsigned long retries = 0, reserved = 0;
+  struct {
+    int type;
+    unsigned long reserved;
+    unsigned __int64 value;
+  } counters[16] = {};
+};
+/// cycles the calling thread has run for, not counting time it was switched out
+inline unsigned __int64 thread_cycles() noexcept {
+  unsigned __int64 c = 0;
+  QueryThreadCycleTime(reinterpret_cast<void*>(~1ull), &c);
+  return c;
+}
+/// starts counting the context switches of the calling thread and the configured hardware counters
+/// in `mask`, or returns null
+inline void* enable_thread_profiling(unsigned __int64 mask) noexcept {
+  void* data = nullptr;
+  return EnableThreadProfiling(reinterpret_cast<void*>(~1ull), 1, mask, &data) == 0 ? data : nullptr;
+}
+inline void disable_thread_profiling(void* data) noexcept { DisableThreadProfiling(data); }
+inline bool read_thread_profiling(void* data, performance_data* d) noexcept { return ReadThreadProfilingData(data, 3, d) == 0; }
+__forceinline __m128i __vectorcall mm_sha1msg1_epu32(__m128i a, __m128i b) noexcept { return _mm_sha1msg1_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_sha1msg2_epu32(__m128i a, __m128i b) noexcept { return _mm_sha1msg2_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_sha1nexte_epu32(__m128i a, __m128i b) noexcept { return _mm_sha1nexte_epu32(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_sha1rnds4_epu32(__m128i a, __m128i b) noexcept { return _mm_sha1rnds4_epu32(a, b, i); }
+__forceinline __m128i __vectorcall mm_sha256msg1_epu32(__m128i a, __m128i b) noexcept { return _mm_sha256msg1_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_sha256msg2_epu32(__m128i a, __m128i b) noexcept { return _mm_sha256msg2_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_sha256rnds2_epu32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_sha256rnds2_epu32(a, b, c); }
+// __forceinline __m256i __vectorcall mm256_sha512msg1_epi64(__m256i a, __m128i b) noexcept { return _mm256_sha512msg1_epi64(a, b); }
+// __forceinline __m256i __vectorcall mm256_sha512msg2_epi64(__m256i a, __m256i b) noexcept { return _mm256_sha512msg2_epi64(a, b); }
+// __forceinline __m256i __vectorcall mm256_sha512rnds2_epi64(__m256i a, __m256i b, __m128i c) noexcept { return _mm256_sha512rnds2_epi64(a, b, c); }
+// __forceinline __m128i __vectorcall mm_sm3msg1_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_sm3msg1_epi32(a, b, c); }
+// __forceinline __m128i __vectorcall mm_sm3msg2_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_sm3msg2_epi32(a, b, c); }
+// template<int i> __forceinline __m128i __vectorcall mm_sm3rnds2_epi32(__m128i a, __m128i b, __m128i c) noexcept { return _mm_sm3rnds2_epi32(a, b, c, i); }
+// __forceinline __m256i __vectorcall mm256_sm4key4_epi32(__m256i a, __m256i b) noexcept { return _mm256_sm4key4_epi32(a, b); }
+// __forceinline __m256i __vectorcall mm256_sm4rnds4_epi32(__m256i a, __m256i b) noexcept { return _mm256_sm4rnds4_epi32(a, b); }
+// __forceinline __m128i __vectorcall mm_sm4key4_epi32(__m128i a, __m128i b) noexcept { return _mm_sm4key4_epi32(a, b); }
+// __forceinline __m128i __vectorcall mm_sm4rnds4_epi32(__m128i a, __m128i b) noexcept { return _mm_sm4rnds4_epi32(a, b); }
+__forceinline __m128d __vectorcall mm_acos_pd(__m128d a) noexcept { return _mm_acos_pd(a); }
+__forceinline __m128 __vectorcall mm_acos_ps(__m128 a) noexcept { return _mm_acos_ps(a); }
+__forceinline __m128d __vectorcall mm_acosh_pd(__m128d a) noexcept { return _mm_acosh_pd(a); }
+__forceinline __m128 __vectorcall mm_acosh_ps(__m128 a) noexcept { return _mm_acosh_ps(a); }
+__forceinline __m128d __vectorcall mm_asin_pd(__m128d a) noexcept { return _mm_asin_pd(a); }
+__forceinline __m128 __vectorcall mm_asin_ps(__m128 a) noexcept { return _mm_asin_ps(a); }
+__forceinline __m128d __vectorcall mm_asinh_pd(__m128d a) noexcept { return _mm_asinh_pd(a); }
+__forceinline __m128 __vectorcall mm_asinh_ps(__m128 a) noexcept { return _mm_asinh_ps(a); }
+__forceinline __m128d __vectorcall mm_atan_pd(__m128d a) noexcept { return _mm_atan_pd(a); }
+__forceinline __m128 __vectorcall mm_atan_ps(__m128 a) noexcept { return _mm_atan_ps(a); }
+__forceinline __m128d __vectorcall mm_atan2_pd(__m128d a, __m128d b) noexcept { return _mm_atan2_pd(a, b); }
+__forceinline __m128 __vectorcall mm_atan2_ps(__m128 a, __m128 b) noexcept { return _mm_atan2_ps(a, b); }
+__forceinline __m128d __vectorcall mm_atanh_pd(__m128d a) noexcept { return _mm_atanh_pd(a); }
+__forceinline __m128 __vectorcall mm_atanh_ps(__m128 a) noexcept { return _mm_atanh_ps(a); }
+__forceinline __m128d __vectorcall mm_cos_pd(__m128d a) noexcept { return _mm_cos_pd(a); }
+__forceinline __m128 __vectorcall mm_cos_ps(__m128 a) noexcept { return _mm_cos_ps(a); }
+__forceinline __m128d __vectorcall mm_cosd_pd(__m128d a) noexcept { return _mm_cosd_pd(a); }
+__forceinline __m128 __vectorcall mm_cosd_ps(__m128 a) noexcept { return _mm_cosd_ps(a); }
+__forceinline __m128d __vectorcall mm_cosh_pd(__m128d a) noexcept { return _mm_cosh_pd(a); }
+__forceinline __m128 __vectorcall mm_cosh_ps(__m128 a) noexcept { return _mm_cosh_ps(a); }
+__forceinline __m128d __vectorcall mm_hypot_pd(__m128d a, __m128d b) noexcept { return _mm_hypot_pd(a, b); }
+__forceinline __m128 __vectorcall mm_hypot_ps(__m128 a, __m128 b) noexcept { return _mm_hypot_ps(a, b); }
+__forceinline __m128d __vectorcall mm_sin_pd(__m128d a) noexcept { return _mm_sin_pd(a); }
+__forceinline __m128 __vectorcall mm_sin_ps(__m128 a) noexcept { return _mm_sin_ps(a); }
+__forceinline __m128d __vectorcall mm_sincos_pd(__m128d* a, __m128d b) noexcept { return _mm_sincos_pd(a, b); }
+__forceinline __m128 __vectorcall mm_sincos_ps(__m128* a, __m128 b) noexcept { return _mm_sincos_ps(a, b); }
+__forceinline __m128d __vectorcall mm_sind_pd(__m128d a) noexcept { return _mm_sind_pd(a); }
+__forceinline __m128 __vectorcall mm_sind_ps(__m128 a) noexcept { return _mm_sind_ps(a); }
+__forceinline __m128d __vectorcall mm_sinh_pd(__m128d a) noexcept { return _mm_sinh_pd(a); }
+__forceinline __m128 __vectorcall mm_sinh_ps(__m128 a) noexcept { return _mm_sinh_ps(a); }
+__forceinline __m128d __vectorcall mm_tan_pd(__m128d a) noexcept { return _mm_tan_pd(a); }
+__forceinline __m128 __vectorcall mm_tan_ps(__m128 a) noexcept { return _mm_tan_ps(a); }
+__forceinline __m128d __vectorcall mm_tand_pd(__m128d a) noexcept { return _mm_tand_pd(a); }
+__forceinline __m128 __vectorcall mm_tand_ps(__m128 a) noexcept { return _mm_tand_ps(a); }
+__forceinline __m128d __vectorcall mm_tanh_pd(__m128d a) noexcept { return _mm_tanh_pd(a); }
+__forceinline __m128 __vectorcall mm_tanh_ps(__m128 a) noexcept { return _mm_tanh_ps(a); }
+__forceinline __m128d __vectorcall mm_cbrt_pd(__m128d a) noexcept { return _mm_cbrt_pd(a); }
+__forceinline __m128 __vectorcall mm_cbrt_ps(__m128 a) noexcept { return _mm_cbrt_ps(a); }
+__forceinline __m128 __vectorcall mm_cexp_ps(__m128 a) noexcept { return _mm_cexp_ps(a); }
+__forceinline __m128 __vectorcall mm_clog_ps(__m128 a) noexcept { return _mm_clog_ps(a); }
+__forceinline __m128 __vectorcall mm_csqrt_ps(__m128 a) noexcept { return _mm_csqrt_ps(a); }
+__forceinline __m128d __vectorcall mm_exp_pd(__m128d a) noexcept { return _mm_exp_pd(a); }
+__forceinline __m128 __vectorcall mm_exp_ps(__m128 a) noexcept { return _mm_exp_ps(a); }
+__forceinline __m128d __vectorcall mm_exp10_pd(__m128d a) noexcept { return _mm_exp10_pd(a); }
+__forceinline __m128 __vectorcall mm_exp10_ps(__m128 a) noexcept { return _mm_exp10_ps(a); }
+__forceinline __m128d __vectorcall mm_exp2_pd(__m128d a) noexcept { return _mm_exp2_pd(a); }
+__forceinline __m128 __vectorcall mm_exp2_ps(__m128 a) noexcept { return _mm_exp2_ps(a); }
+__forceinline __m128d __vectorcall mm_expm1_pd(__m128d a) noexcept { return _mm_expm1_pd(a); }
+__forceinline __m128 __vectorcall mm_expm1_ps(__m128 a) noexcept { return _mm_expm1_ps(a); }
+__forceinline __m128d __vectorcall mm_invcbrt_pd(__m128d a) noexcept { return _mm_invcbrt_pd(a); }
+__forceinline __m128 __vectorcall mm_invcbrt_ps(__m128 a) noexcept { return _mm_invcbrt_ps(a); }
+__forceinline __m128d __vectorcall mm_invsqrt_pd(__m128d a) noexcept { return _mm_invsqrt_pd(a); }
+__forceinline __m128 __vectorcall mm_invsqrt_ps(__m128 a) noexcept { return _mm_invsqrt_ps(a); }
+__forceinline __m128d __vectorcall mm_log_pd(__m128d a) noexcept { return _mm_log_pd(a); }
+__forceinline __m128 __vectorcall mm_log_ps(__m128 a) noexcept { return _mm_log_ps(a); }
+__forceinline __m128d __vectorcall mm_log10_pd(__m128d a) noexcept { return _mm_log10_pd(a); }
+__forceinline __m128 __vectorcall mm_log10_ps(__m128 a) noexcept { return _mm_log10_ps(a); }
+__forceinline __m128d __vectorcall mm_log1p_pd(__m128d a) noexcept { return _mm_log1p_pd(a); }
+__forceinline __m128 __vectorcall mm_log1p_ps(__m128 a) noexcept { return _mm_log1p_ps(a); }
+__forceinline __m128d __vectorcall mm_log2_pd(__m128d a) noexcept { return _mm_log2_pd(a); }
+__forceinline __m128 __vectorcall mm_log2_ps(__m128 a) noexcept { return _mm_log2_ps(a); }
+__forceinline __m128d __vectorcall mm_logb_pd(__m128d a) noexcept { return _mm_logb_pd(a); }
+__forceinline __m128 __vectorcall mm_logb_ps(__m128 a) noexcept { return _mm_logb_ps(a); }
+__forceinline __m128d __vectorcall mm_pow_pd(__m128d a, __m128d b) noexcept { return _mm_pow_pd(a, b); }
+__forceinline __m128 __vectorcall mm_pow_ps(__m128 a, __m128 b) noexcept { return _mm_pow_ps(a, b); }
+__forceinline __m128d __vectorcall mm_svml_sqrt_pd(__m128d a) noexcept { return _mm_svml_sqrt_pd(a); }
+__forceinline __m128 __vectorcall mm_svml_sqrt_ps(__m128 a) noexcept { return _mm_svml_sqrt_ps(a); }
+__forceinline __m128d __vectorcall mm_cdfnorm_pd(__m128d a) noexcept { return _mm_cdfnorm_pd(a); }
+__forceinline __m128 __vectorcall mm_cdfnorm_ps(__m128 a) noexcept { return _mm_cdfnorm_ps(a); }
+__forceinline __m128d __vectorcall mm_cdfnorminv_pd(__m128d a) noexcept { return _mm_cdfnorminv_pd(a); }
+__forceinline __m128 __vectorcall mm_cdfnorminv_ps(__m128 a) noexcept { return _mm_cdfnorminv_ps(a); }
+__forceinline __m128 __vectorcall mm_erf_ps(__m128 a) noexcept { return _mm_erf_ps(a); }
+__forceinline __m128d __vectorcall mm_erfc_pd(__m128d a) noexcept { return _mm_erfc_pd(a); }
+__forceinline __m128 __vectorcall mm_erfc_ps(__m128 a) noexcept { return _mm_erfc_ps(a); }
+__forceinline __m128d __vectorcall mm_erfcinv_pd(__m128d a) noexcept { return _mm_erfcinv_pd(a); }
+__forceinline __m128 __vectorcall mm_erfcinv_ps(__m128 a) noexcept { return _mm_erfcinv_ps(a); }
+__forceinline __m128d __vectorcall mm_erfinv_pd(__m128d a) noexcept { return _mm_erfinv_pd(a); }
+__forceinline __m128 __vectorcall mm_erfinv_ps(__m128 a) noexcept { return _mm_erfinv_ps(a); }
+__forceinline __m128i __vectorcall mm_div_epi8(__m128i a, __m128i b) noexcept { return _mm_div_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_div_epi16(__m128i a, __m128i b) noexcept { return _mm_div_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_div_epi32(__m128i a, __m128i b) noexcept { return _mm_div_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_div_epi64(__m128i a, __m128i b) noexcept { return _mm_div_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_div_epu8(__m128i a, __m128i b) noexcept { return _mm_div_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_div_epu16(__m128i a, __m128i b) noexcept { return _mm_div_epu16(a, b); }
+__forceinline __m128i __vectorcall mm_div_epu32(__m128i a, __m128i b) noexcept { return _mm_div_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_div_epu64(__m128i a, __m128i b) noexcept { return _mm_div_epu64(a, b); }
+__forceinline __m128d __vectorcall mm_erf_pd(__m128d a) noexcept { return _mm_erf_pd(a); }
+__forceinline __m128i __vectorcall mm_idiv_epi32(__m128i a, __m128i b) noexcept { return _mm_idiv_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_idivrem_epi32(__m128i* a, __m128i b, __m128i c) noexcept { return _mm_idivrem_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_irem_epi32(__m128i a, __m128i b) noexcept { return _mm_irem_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epi8(__m128i a, __m128i b) noexcept { return _mm_rem_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epi16(__m128i a, __m128i b) noexcept { return _mm_rem_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epi32(__m128i a, __m128i b) noexcept { return _mm_rem_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epi64(__m128i a, __m128i b) noexcept { return _mm_rem_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epu8(__m128i a, __m128i b) noexcept { return _mm_rem_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epu16(__m128i a, __m128i b) noexcept { return _mm_rem_epu16(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epu32(__m128i a, __m128i b) noexcept { return _mm_rem_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_rem_epu64(__m128i a, __m128i b) noexcept { return _mm_rem_epu64(a, b); }
+__forceinline __m128i __vectorcall mm_udiv_epi32(__m128i a, __m128i b) noexcept { return _mm_udiv_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_udivrem_epi32(__m128i* a, __m128i b, __m128i c) noexcept { return _mm_udivrem_epi32(a, b, c); }
+__forceinline __m128i __vectorcall mm_urem_epi32(__m128i a, __m128i b) noexcept { return _mm_urem_epi32(a, b); }
+__forceinline __m128d __vectorcall mm_svml_ceil_pd(__m128d a) noexcept { return _mm_svml_ceil_pd(a); }
+__forceinline __m128 __vectorcall mm_svml_ceil_ps(__m128 a) noexcept { return _mm_svml_ceil_ps(a); }
+__forceinline __m128d __vectorcall mm_svml_floor_pd(__m128d a) noexcept { return _mm_svml_floor_pd(a); }
+__forceinline __m128 __vectorcall mm_svml_floor_ps(__m128 a) noexcept { return _mm_svml_floor_ps(a); }
+__forceinline __m128d __vectorcall mm_svml_round_pd(__m128d a) noexcept { return _mm_svml_round_pd(a); }
+__forceinline __m128 __vectorcall mm_svml_round_ps(__m128 a) noexcept { return _mm_svml_round_ps(a); }
+__forceinline __m128d __vectorcall mm_trunc_pd(__m128d a) noexcept { return _mm_trunc_pd(a); }
+__forceinline __m128 __vectorcall mm_trunc_ps(__m128 a) noexcept { return _mm_trunc_ps(a); }
+// template<int i> __forceinline int __vectorcall mm_extract_pi16(__m64 a) noexcept { return _mm_extract_pi16(a, i); }
+// template<int i> __forceinline __m64 __vectorcall mm_insert_pi16(__m64 a, int b) noexcept { return _mm_insert_pi16(a, b, i); }
+// template<int i> __forceinline __m64 __vectorcall mm_shuffle_pi16(__m64 a) noexcept { return _mm_shuffle_pi16(a, i); }
+template<unsigned i> __forceinline __m128 __vectorcall mm_shuffle_ps(__m128 a, __m128 b) noexcept { return _mm_shuffle_ps(a, b, i); }
+__forceinline __m128 __vectorcall mm_unpackhi_ps(__m128 a, __m128 b) noexcept { return _mm_unpackhi_ps(a, b); }
+__forceinline __m128 __vectorcall mm_unpacklo_ps(__m128 a, __m128 b) noexcept { return _mm_unpacklo_ps(a, b); }
+__forceinline unsigned int mm_getcsr() noexcept { return _mm_getcsr(); }
+__forceinline void mm_setcsr(unsigned int a) noexcept { _mm_setcsr(a); }
+template<int i> __forceinline void mm_prefetch(char const* a) noexcept { _mm_prefetch(a, i); }
+__forceinline void mm_sfence() noexcept { _mm_sfence(); }
+__forceinline void* mm_malloc(size_t a, size_t b) noexcept { return _mm_malloc(a, b); }
+__forceinline void mm_free(void* a) noexcept { _mm_free(a); }
+__forceinline __m128 __vectorcall mm_undefined_ps() noexcept { return _mm_undefined_ps(); }
+// __forceinline __m64 __vectorcall mm_max_pi16(__m64 a, __m64 b) noexcept { return _mm_max_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_max_pu8(__m64 a, __m64 b) noexcept { return _mm_max_pu8(a, b); }
+// __forceinline __m64 __vectorcall mm_min_pi16(__m64 a, __m64 b) noexcept { return _mm_min_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_min_pu8(__m64 a, __m64 b) noexcept { return _mm_min_pu8(a, b); }
+__forceinline __m128 __vectorcall mm_min_ss(__m128 a, __m128 b) noexcept { return _mm_min_ss(a, b); }
+__forceinline __m128 __vectorcall mm_min_ps(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+__forceinline __m128 __vectorcall mm_max_ss(__m128 a, __m128 b) noexcept { return _mm_max_ss(a, b); }
+__forceinline __m128 __vectorcall mm_max_ps(__m128 a, __m128 b) noexcept { return _mm_max_ps(a, b); }
+// __forceinline __m64 __vectorcall mm_mulhi_pu16(__m64 a, __m64 b) noexcept { return _mm_mulhi_pu16(a, b); }
+// __forceinline __m64 __vectorcall mm_sad_pu8(__m64 a, __m64 b) noexcept { return _mm_sad_pu8(a, b); }
+__forceinline __m128 __vectorcall mm_add_ss(__m128 a, __m128 b) noexcept { return _mm_add_ss(a, b); }
+__forceinline __m128 __vectorcall mm_add_ps(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+__forceinline __m128 __vectorcall mm_sub_ss(__m128 a, __m128 b) noexcept { return _mm_sub_ss(a, b); }
+__forceinline __m128 __vectorcall mm_sub_ps(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+__forceinline __m128 __vectorcall mm_mul_ss(__m128 a, __m128 b) noexcept { return _mm_mul_ss(a, b); }
+__forceinline __m128 __vectorcall mm_mul_ps(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+__forceinline __m128 __vectorcall mm_div_ss(__m128 a, __m128 b) noexcept { return _mm_div_ss(a, b); }
+__forceinline __m128 __vectorcall mm_div_ps(__m128 a, __m128 b) noexcept { return _mm_div_ps(a, b); }
+// __forceinline __m64 __vectorcall mm_avg_pu8(__m64 a, __m64 b) noexcept { return _mm_avg_pu8(a, b); }
+// __forceinline __m64 __vectorcall mm_avg_pu16(__m64 a, __m64 b) noexcept { return _mm_avg_pu16(a, b); }
+template<int i> __forceinline __m128 __vectorcall mm_cvtsi32_ss(__m128 a) noexcept { return _mm_cvtsi32_ss(a, i); }
+template<int i> __forceinline __m128 __vectorcall mm_cvt_si2ss(__m128 a) noexcept { return _mm_cvt_si2ss(a, i); }
+__forceinline __m128 __vectorcall mm_cvtsi64_ss(__m128 a, __int64 b) noexcept { return _mm_cvtsi64_ss(a, b); }
+// __forceinline __m128 __vectorcall mm_cvtpi32_ps(__m128 a, __m64 b) noexcept { return _mm_cvtpi32_ps(a, b); }
+// __forceinline __m128 __vectorcall mm_cvt_pi2ps(__m128 a, __m64 b) noexcept { return _mm_cvt_pi2ps(a, b); }
+// __forceinline __m128 __vectorcall mm_cvtpi16_ps(__m64 a) noexcept { return _mm_cvtpi16_ps(a); }
+// __forceinline __m128 __vectorcall mm_cvtpu16_ps(__m64 a) noexcept { return _mm_cvtpu16_ps(a); }
+// __forceinline __m128 __vectorcall mm_cvtpi8_ps(__m64 a) noexcept { return _mm_cvtpi8_ps(a); }
+// __forceinline __m128 __vectorcall mm_cvtpu8_ps(__m64 a) noexcept { return _mm_cvtpu8_ps(a); }
+// __forceinline __m128 __vectorcall mm_cvtpi32x2_ps(__m64 a, __m64 b) noexcept { return _mm_cvtpi32x2_ps(a, b); }
+__forceinline int __vectorcall mm_cvtss_si32(__m128 a) noexcept { return _mm_cvtss_si32(a); }
+__forceinline int __vectorcall mm_cvt_ss2si(__m128 a) noexcept { return _mm_cvt_ss2si(a); }
+__forceinline __int64 __vectorcall mm_cvtss_si64(__m128 a) noexcept { return _mm_cvtss_si64(a); }
+__forceinline float __vectorcall mm_cvtss_f32(__m128 a) noexcept { return _mm_cvtss_f32(a); }
+// __forceinline __m64 __vectorcall mm_cvtps_pi32(__m128 a) noexcept { return _mm_cvtps_pi32(a); }
+// __forceinline __m64 __vectorcall mm_cvt_ps2pi(__m128 a) noexcept { return _mm_cvt_ps2pi(a); }
+__forceinline int __vectorcall mm_cvttss_si32(__m128 a) noexcept { return _mm_cvttss_si32(a); }
+__forceinline int __vectorcall mm_cvtt_ss2si(__m128 a) noexcept { return _mm_cvtt_ss2si(a); }
+__forceinline __int64 __vectorcall mm_cvttss_si64(__m128 a) noexcept { return _mm_cvttss_si64(a); }
+// __forceinline __m64 __vectorcall mm_cvttps_pi32(__m128 a) noexcept { return _mm_cvttps_pi32(a); }
+// __forceinline __m64 __vectorcall mm_cvtt_ps2pi(__m128 a) noexcept { return _mm_cvtt_ps2pi(a); }
+// __forceinline __m64 __vectorcall mm_cvtps_pi16(__m128 a) noexcept { return _mm_cvtps_pi16(a); }
+// __forceinline __m64 __vectorcall mm_cvtps_pi8(__m128 a) noexcept { return _mm_cvtps_pi8(a); }
+// __forceinline void __vectorcall mm_stream_pi(void* a, __m64 b) noexcept { _mm_stream_pi(a, b); }
+// __forceinline void __vectorcall mm_maskmove_si64(__m64 a, __m64 b, char* c) noexcept { _mm_maskmove_si64(a, b, c); }
+__forceinline void __vectorcall mm_stream_ps(void* a, __m128 b) noexcept { _mm_stream_ps((float*)a, b); }
+// __forceinline void __vectorcall mm_storeh_pi(__m64* a, __m128 b) noexcept { _mm_storeh_pi(a, b); }
+// __forceinline void __vectorcall mm_storel_pi(__m64* a, __m128 b) noexcept { _mm_storel_pi(a, b); }
+__forceinline void __vectorcall mm_store_ss(float* a, __m128 b) noexcept { _mm_store_ss(a, b); }
+__forceinline void __vectorcall mm_store1_ps(float* a, __m128 b) noexcept { _mm_store1_ps(a, b); }
+__forceinline void __vectorcall mm_store_ps1(float* a, __m128 b) noexcept { _mm_store_ps1(a, b); }
+__forceinline void __vectorcall mm_store_ps(float* a, __m128 b) noexcept { _mm_store_ps(a, b); }
+__forceinline void __vectorcall mm_storeu_ps(float* a, __m128 b) noexcept { _mm_storeu_ps(a, b); }
+__forceinline void __vectorcall mm_storer_ps(float* a, __m128 b) noexcept { _mm_storer_ps(a, b); }
+// __forceinline int __vectorcall mm_movemask_pi8(__m64 a) noexcept { return _mm_movemask_pi8(a); }
+__forceinline int __vectorcall mm_movemask_ps(__m128 a) noexcept { return _mm_movemask_ps(a); }
+__forceinline __m128 __vectorcall mm_sqrt_ss(__m128 a) noexcept { return _mm_sqrt_ss(a); }
+__forceinline __m128 __vectorcall mm_sqrt_ps(__m128 a) noexcept { return _mm_sqrt_ps(a); }
+__forceinline __m128 __vectorcall mm_rcp_ss(__m128 a) noexcept { return _mm_rcp_ss(a); }
+__forceinline __m128 __vectorcall mm_rcp_ps(__m128 a) noexcept { return _mm_rcp_ps(a); }
+__forceinline __m128 __vectorcall mm_rsqrt_ss(__m128 a) noexcept { return _mm_rsqrt_ss(a); }
+__forceinline __m128 __vectorcall mm_rsqrt_ps(__m128 a) noexcept { return _mm_rsqrt_ps(a); }
+__forceinline __m128 __vectorcall mm_and_ps(__m128 a, __m128 b) noexcept { return _mm_and_ps(a, b); }
+__forceinline __m128 __vectorcall mm_andnot_ps(__m128 a, __m128 b) noexcept { return _mm_andnot_ps(a, b); }
+__forceinline __m128 __vectorcall mm_or_ps(__m128 a, __m128 b) noexcept { return _mm_or_ps(a, b); }
+__forceinline __m128 __vectorcall mm_xor_ps(__m128 a, __m128 b) noexcept { return _mm_xor_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpeq_ss(__m128 a, __m128 b) noexcept { return _mm_cmpeq_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpeq_ps(__m128 a, __m128 b) noexcept { return _mm_cmpeq_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmplt_ss(__m128 a, __m128 b) noexcept { return _mm_cmplt_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmplt_ps(__m128 a, __m128 b) noexcept { return _mm_cmplt_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmple_ss(__m128 a, __m128 b) noexcept { return _mm_cmple_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmple_ps(__m128 a, __m128 b) noexcept { return _mm_cmple_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpgt_ss(__m128 a, __m128 b) noexcept { return _mm_cmpgt_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpgt_ps(__m128 a, __m128 b) noexcept { return _mm_cmpgt_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpge_ss(__m128 a, __m128 b) noexcept { return _mm_cmpge_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpge_ps(__m128 a, __m128 b) noexcept { return _mm_cmpge_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpneq_ss(__m128 a, __m128 b) noexcept { return _mm_cmpneq_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpneq_ps(__m128 a, __m128 b) noexcept { return _mm_cmpneq_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpnlt_ss(__m128 a, __m128 b) noexcept { return _mm_cmpnlt_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpnlt_ps(__m128 a, __m128 b) noexcept { return _mm_cmpnlt_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpnle_ss(__m128 a, __m128 b) noexcept { return _mm_cmpnle_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpnle_ps(__m128 a, __m128 b) noexcept { return _mm_cmpnle_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpngt_ss(__m128 a, __m128 b) noexcept { return _mm_cmpngt_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpngt_ps(__m128 a, __m128 b) noexcept { return _mm_cmpngt_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpnge_ss(__m128 a, __m128 b) noexcept { return _mm_cmpnge_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpnge_ps(__m128 a, __m128 b) noexcept { return _mm_cmpnge_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpord_ss(__m128 a, __m128 b) noexcept { return _mm_cmpord_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpord_ps(__m128 a, __m128 b) noexcept { return _mm_cmpord_ps(a, b); }
+__forceinline __m128 __vectorcall mm_cmpunord_ss(__m128 a, __m128 b) noexcept { return _mm_cmpunord_ss(a, b); }
+__forceinline __m128 __vectorcall mm_cmpunord_ps(__m128 a, __m128 b) noexcept { return _mm_cmpunord_ps(a, b); }
+__forceinline int __vectorcall mm_comieq_ss(__m128 a, __m128 b) noexcept { return _mm_comieq_ss(a, b); }
+__forceinline int __vectorcall mm_comilt_ss(__m128 a, __m128 b) noexcept { return _mm_comilt_ss(a, b); }
+__forceinline int __vectorcall mm_comile_ss(__m128 a, __m128 b) noexcept { return _mm_comile_ss(a, b); }
+__forceinline int __vectorcall mm_comigt_ss(__m128 a, __m128 b) noexcept { return _mm_comigt_ss(a, b); }
+__forceinline int __vectorcall mm_comige_ss(__m128 a, __m128 b) noexcept { return _mm_comige_ss(a, b); }
+__forceinline int __vectorcall mm_comineq_ss(__m128 a, __m128 b) noexcept { return _mm_comineq_ss(a, b); }
+__forceinline int __vectorcall mm_ucomieq_ss(__m128 a, __m128 b) noexcept { return _mm_ucomieq_ss(a, b); }
+__forceinline int __vectorcall mm_ucomilt_ss(__m128 a, __m128 b) noexcept { return _mm_ucomilt_ss(a, b); }
+__forceinline int __vectorcall mm_ucomile_ss(__m128 a, __m128 b) noexcept { return _mm_ucomile_ss(a, b); }
+__forceinline int __vectorcall mm_ucomigt_ss(__m128 a, __m128 b) noexcept { return _mm_ucomigt_ss(a, b); }
+__forceinline int __vectorcall mm_ucomige_ss(__m128 a, __m128 b) noexcept { return _mm_ucomige_ss(a, b); }
+__forceinline int __vectorcall mm_ucomineq_ss(__m128 a, __m128 b) noexcept { return _mm_ucomineq_ss(a, b); }
+__forceinline __m128 __vectorcall mm_set_ss(float a) noexcept { return _mm_set_ss(a); }
+__forceinline __m128 __vectorcall mm_set1_ps(float a) noexcept { return _mm_set1_ps(a); }
+__forceinline __m128 __vectorcall mm_set_ps1(float a) noexcept { return _mm_set_ps1(a); }
+__forceinline __m128 __vectorcall mm_set_ps(float a, float b, float c, float d) noexcept { return _mm_set_ps(a, b, c, d); }
+__forceinline __m128 __vectorcall mm_setr_ps(float a, float b, float c, float d) noexcept { return _mm_setr_ps(a, b, c, d); }
+__forceinline __m128 __vectorcall mm_setzero_ps() noexcept { return _mm_setzero_ps(); }
+// __forceinline __m128 __vectorcall mm_loadh_pi(__m128 a, __m64 const* b) noexcept { return _mm_loadh_pi(a, b); }
+// __forceinline __m128 __vectorcall mm_loadl_pi(__m128 a, __m64 const* b) noexcept { return _mm_loadl_pi(a, b); }
+__forceinline __m128 __vectorcall mm_load_ss(float const* a) noexcept { return _mm_load_ss(a); }
+__forceinline __m128 __vectorcall mm_load1_ps(float const* a) noexcept { return _mm_load1_ps(a); }
+__forceinline __m128 __vectorcall mm_load_ps1(float const* a) noexcept { return _mm_load_ps1(a); }
+__forceinline __m128 __vectorcall mm_load_ps(float const* a) noexcept { return _mm_load_ps(a); }
+__forceinline __m128 __vectorcall mm_loadu_ps(float const* a) noexcept { return _mm_loadu_ps(a); }
+__forceinline __m128 __vectorcall mm_loadr_ps(float const* a) noexcept { return _mm_loadr_ps(a); }
+__forceinline __m128 __vectorcall mm_move_ss(__m128 a, __m128 b) noexcept { return _mm_move_ss(a, b); }
+__forceinline __m128 __vectorcall mm_movehl_ps(__m128 a, __m128 b) noexcept { return _mm_movehl_ps(a, b); }
+__forceinline __m128 __vectorcall mm_movelh_ps(__m128 a, __m128 b) noexcept { return _mm_movelh_ps(a, b); }
+__forceinline __m128d __vectorcall mm_undefined_pd() noexcept { return _mm_undefined_pd(); }
+__forceinline __m128i __vectorcall mm_undefined_si128() noexcept { return _mm_undefined_si128(); }
+__forceinline void mm_pause() noexcept { _mm_pause(); }
+__forceinline void mm_clflush(void const* a) noexcept { _mm_clflush(a); }
+__forceinline void mm_lfence() noexcept { _mm_lfence(); }
+__forceinline void mm_mfence() noexcept { _mm_mfence(); }
+__forceinline __m128i __vectorcall mm_loadu_si64(void const* a) noexcept { return _mm_loadu_si64(a); }
+__forceinline __m128i __vectorcall mm_loadu_si16(void const* a) noexcept { return _mm_loadu_si16(a); }
+__forceinline __m128i __vectorcall mm_loadu_si32(void const* a) noexcept { return _mm_loadu_si32(a); }
+__forceinline __m128i __vectorcall mm_loadl_epi64(__m128i const* a) noexcept { return _mm_loadl_epi64(a); }
+__forceinline __m128i __vectorcall mm_load_si128(__m128i const* a) noexcept { return _mm_load_si128(a); }
+__forceinline __m128i __vectorcall mm_loadu_si128(__m128i const* a) noexcept { return _mm_loadu_si128(a); }
+__forceinline __m128d __vectorcall mm_load_pd(double const* a) noexcept { return _mm_load_pd(a); }
+__forceinline __m128d __vectorcall mm_load1_pd(double const* a) noexcept { return _mm_load1_pd(a); }
+__forceinline __m128d __vectorcall mm_load_pd1(double const* a) noexcept { return _mm_load_pd1(a); }
+__forceinline __m128d __vectorcall mm_loadr_pd(double const* a) noexcept { return _mm_loadr_pd(a); }
+__forceinline __m128d __vectorcall mm_loadu_pd(double const* a) noexcept { return _mm_loadu_pd(a); }
+__forceinline __m128d __vectorcall mm_load_sd(double const* a) noexcept { return _mm_load_sd(a); }
+__forceinline __m128d __vectorcall mm_loadh_pd(__m128d a, double const* b) noexcept { return _mm_loadh_pd(a, b); }
+__forceinline __m128d __vectorcall mm_loadl_pd(__m128d a, double const* b) noexcept { return _mm_loadl_pd(a, b); }
+__forceinline void __vectorcall mm_storeu_si16(void* a, __m128i b) noexcept { _mm_storeu_si16(a, b); }
+__forceinline void __vectorcall mm_storeu_si64(void* a, __m128i b) noexcept { _mm_storeu_si64(a, b); }
+__forceinline void __vectorcall mm_storeu_si32(void* a, __m128i b) noexcept { _mm_storeu_si32(a, b); }
+__forceinline void __vectorcall mm_maskmoveu_si128(__m128i a, __m128i b, char* c) noexcept { _mm_maskmoveu_si128(a, b, c); }
+__forceinline void __vectorcall mm_store_si128(__m128i* a, __m128i b) noexcept { _mm_store_si128(a, b); }
+__forceinline void __vectorcall mm_storeu_si128(__m128i* a, __m128i b) noexcept { _mm_storeu_si128(a, b); }
+__forceinline void __vectorcall mm_storel_epi64(__m128i* a, __m128i b) noexcept { _mm_storel_epi64(a, b); }
+__forceinline void __vectorcall mm_stream_si128(void* a, __m128i b) noexcept { _mm_stream_si128((m128i*)a, b); }
+template<int i> __forceinline void mm_stream_si32(void* a) noexcept { _mm_stream_si32(a, i); }
+// __forceinline void mm_stream_si64(void* a, __int64 b) noexcept { _mm_stream_si64(a, b); }
+__forceinline void __vectorcall mm_stream_pd(void* a, __m128d b) noexcept { _mm_stream_pd((double*)a, b); }
+__forceinline void __vectorcall mm_store_sd(double* a, __m128d b) noexcept { _mm_store_sd(a, b); }
+__forceinline void __vectorcall mm_store1_pd(double* a, __m128d b) noexcept { _mm_store1_pd(a, b); }
+__forceinline void __vectorcall mm_store_pd1(double* a, __m128d b) noexcept { _mm_store_pd1(a, b); }
+__forceinline void __vectorcall mm_store_pd(double* a, __m128d b) noexcept { _mm_store_pd(a, b); }
+__forceinline void __vectorcall mm_storeu_pd(double* a, __m128d b) noexcept { _mm_storeu_pd(a, b); }
+__forceinline void __vectorcall mm_storer_pd(double* a, __m128d b) noexcept { _mm_storer_pd(a, b); }
+__forceinline void __vectorcall mm_storeh_pd(double* a, __m128d b) noexcept { _mm_storeh_pd(a, b); }
+__forceinline void __vectorcall mm_storel_pd(double* a, __m128d b) noexcept { _mm_storel_pd(a, b); }
+__forceinline __m128i __vectorcall mm_add_epi8(__m128i a, __m128i b) noexcept { return _mm_add_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_add_epi16(__m128i a, __m128i b) noexcept { return _mm_add_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_add_epi32(__m128i a, __m128i b) noexcept { return _mm_add_epi32(a, b); }
+// __forceinline __m64 __vectorcall mm_add_si64(__m64 a, __m64 b) noexcept { return _mm_add_si64(a, b); }
+__forceinline __m128i __vectorcall mm_add_epi64(__m128i a, __m128i b) noexcept { return _mm_add_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_adds_epi8(__m128i a, __m128i b) noexcept { return _mm_adds_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_adds_epi16(__m128i a, __m128i b) noexcept { return _mm_adds_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_adds_epu8(__m128i a, __m128i b) noexcept { return _mm_adds_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_adds_epu16(__m128i a, __m128i b) noexcept { return _mm_adds_epu16(a, b); }
+__forceinline __m128i __vectorcall mm_madd_epi16(__m128i a, __m128i b) noexcept { return _mm_madd_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_mulhi_epi16(__m128i a, __m128i b) noexcept { return _mm_mulhi_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_mulhi_epu16(__m128i a, __m128i b) noexcept { return _mm_mulhi_epu16(a, b); }
+__forceinline __m128i __vectorcall mm_mullo_epi16(__m128i a, __m128i b) noexcept { return _mm_mullo_epi16(a, b); }
+// __forceinline __m64 __vectorcall mm_mul_su32(__m64 a, __m64 b) noexcept { return _mm_mul_su32(a, b); }
+__forceinline __m128i __vectorcall mm_mul_epu32(__m128i a, __m128i b) noexcept { return _mm_mul_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_sad_epu8(__m128i a, __m128i b) noexcept { return _mm_sad_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_sub_epi8(__m128i a, __m128i b) noexcept { return _mm_sub_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_sub_epi16(__m128i a, __m128i b) noexcept { return _mm_sub_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_sub_epi32(__m128i a, __m128i b) noexcept { return _mm_sub_epi32(a, b); }
+// __forceinline __m64 __vectorcall mm_sub_si64(__m64 a, __m64 b) noexcept { return _mm_sub_si64(a, b); }
+__forceinline __m128i __vectorcall mm_sub_epi64(__m128i a, __m128i b) noexcept { return _mm_sub_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_subs_epi8(__m128i a, __m128i b) noexcept { return _mm_subs_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_subs_epi16(__m128i a, __m128i b) noexcept { return _mm_subs_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_subs_epu8(__m128i a, __m128i b) noexcept { return _mm_subs_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_subs_epu16(__m128i a, __m128i b) noexcept { return _mm_subs_epu16(a, b); }
+__forceinline __m128d __vectorcall mm_add_sd(__m128d a, __m128d b) noexcept { return _mm_add_sd(a, b); }
+__forceinline __m128d __vectorcall mm_add_pd(__m128d a, __m128d b) noexcept { return _mm_add_pd(a, b); }
+__forceinline __m128d __vectorcall mm_div_sd(__m128d a, __m128d b) noexcept { return _mm_div_sd(a, b); }
+__forceinline __m128d __vectorcall mm_div_pd(__m128d a, __m128d b) noexcept { return _mm_div_pd(a, b); }
+__forceinline __m128d __vectorcall mm_mul_sd(__m128d a, __m128d b) noexcept { return _mm_mul_sd(a, b); }
+__forceinline __m128d __vectorcall mm_mul_pd(__m128d a, __m128d b) noexcept { return _mm_mul_pd(a, b); }
+__forceinline __m128d __vectorcall mm_sub_sd(__m128d a, __m128d b) noexcept { return _mm_sub_sd(a, b); }
+__forceinline __m128d __vectorcall mm_sub_pd(__m128d a, __m128d b) noexcept { return _mm_sub_pd(a, b); }
+__forceinline __m128i __vectorcall mm_avg_epu8(__m128i a, __m128i b) noexcept { return _mm_avg_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_avg_epu16(__m128i a, __m128i b) noexcept { return _mm_avg_epu16(a, b); }
+__forceinline __m128i __vectorcall mm_max_epi16(__m128i a, __m128i b) noexcept { return _mm_max_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_max_epu8(__m128i a, __m128i b) noexcept { return _mm_max_epu8(a, b); }
+__forceinline __m128i __vectorcall mm_min_epi16(__m128i a, __m128i b) noexcept { return _mm_min_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_min_epu8(__m128i a, __m128i b) noexcept { return _mm_min_epu8(a, b); }
+__forceinline __m128d __vectorcall mm_max_sd(__m128d a, __m128d b) noexcept { return _mm_max_sd(a, b); }
+__forceinline __m128d __vectorcall mm_max_pd(__m128d a, __m128d b) noexcept { return _mm_max_pd(a, b); }
+__forceinline __m128d __vectorcall mm_min_sd(__m128d a, __m128d b) noexcept { return _mm_min_sd(a, b); }
+__forceinline __m128d __vectorcall mm_min_pd(__m128d a, __m128d b) noexcept { return _mm_min_pd(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_slli_si128(__m128i a) noexcept { return _mm_slli_si128(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_bslli_si128(__m128i a) noexcept { return _mm_bslli_si128(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_bsrli_si128(__m128i a) noexcept { return _mm_bsrli_si128(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_slli_epi16(__m128i a) noexcept { return _mm_slli_epi16(a, i); }
+__forceinline __m128i __vectorcall mm_sll_epi16(__m128i a, __m128i b) noexcept { return _mm_sll_epi16(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_slli_epi32(__m128i a) noexcept { return _mm_slli_epi32(a, i); }
+__forceinline __m128i __vectorcall mm_sll_epi32(__m128i a, __m128i b) noexcept { return _mm_sll_epi32(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_slli_epi64(__m128i a) noexcept { return _mm_slli_epi64(a, i); }
+__forceinline __m128i __vectorcall mm_sll_epi64(__m128i a, __m128i b) noexcept { return _mm_sll_epi64(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_srai_epi16(__m128i a) noexcept { return _mm_srai_epi16(a, i); }
+__forceinline __m128i __vectorcall mm_sra_epi16(__m128i a, __m128i b) noexcept { return _mm_sra_epi16(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_srai_epi32(__m128i a) noexcept { return _mm_srai_epi32(a, i); }
+__forceinline __m128i __vectorcall mm_sra_epi32(__m128i a, __m128i b) noexcept { return _mm_sra_epi32(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_srli_si128(__m128i a) noexcept { return _mm_srli_si128(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_srli_epi16(__m128i a) noexcept { return _mm_srli_epi16(a, i); }
+__forceinline __m128i __vectorcall mm_srl_epi16(__m128i a, __m128i b) noexcept { return _mm_srl_epi16(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_srli_epi32(__m128i a) noexcept { return _mm_srli_epi32(a, i); }
+__forceinline __m128i __vectorcall mm_srl_epi32(__m128i a, __m128i b) noexcept { return _mm_srl_epi32(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_srli_epi64(__m128i a) noexcept { return _mm_srli_epi64(a, i); }
+__forceinline __m128i __vectorcall mm_srl_epi64(__m128i a, __m128i b) noexcept { return _mm_srl_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_and_si128(__m128i a, __m128i b) noexcept { return _mm_and_si128(a, b); }
+__forceinline __m128i __vectorcall mm_andnot_si128(__m128i a, __m128i b) noexcept { return _mm_andnot_si128(a, b); }
+__forceinline __m128i __vectorcall mm_or_si128(__m128i a, __m128i b) noexcept { return _mm_or_si128(a, b); }
+__forceinline __m128i __vectorcall mm_xor_si128(__m128i a, __m128i b) noexcept { return _mm_xor_si128(a, b); }
+__forceinline __m128d __vectorcall mm_and_pd(__m128d a, __m128d b) noexcept { return _mm_and_pd(a, b); }
+__forceinline __m128d __vectorcall mm_andnot_pd(__m128d a, __m128d b) noexcept { return _mm_andnot_pd(a, b); }
+__forceinline __m128d __vectorcall mm_or_pd(__m128d a, __m128d b) noexcept { return _mm_or_pd(a, b); }
+__forceinline __m128d __vectorcall mm_xor_pd(__m128d a, __m128d b) noexcept { return _mm_xor_pd(a, b); }
+__forceinline __m128i __vectorcall mm_cmpeq_epi8(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_cmpeq_epi16(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_cmpeq_epi32(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_cmpgt_epi8(__m128i a, __m128i b) noexcept { return _mm_cmpgt_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_cmpgt_epi16(__m128i a, __m128i b) noexcept { return _mm_cmpgt_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_cmpgt_epi32(__m128i a, __m128i b) noexcept { return _mm_cmpgt_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_cmplt_epi8(__m128i a, __m128i b) noexcept { return _mm_cmplt_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_cmplt_epi16(__m128i a, __m128i b) noexcept { return _mm_cmplt_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_cmplt_epi32(__m128i a, __m128i b) noexcept { return _mm_cmplt_epi32(a, b); }
+__forceinline __m128d __vectorcall mm_cmpeq_sd(__m128d a, __m128d b) noexcept { return _mm_cmpeq_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmplt_sd(__m128d a, __m128d b) noexcept { return _mm_cmplt_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmple_sd(__m128d a, __m128d b) noexcept { return _mm_cmple_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpgt_sd(__m128d a, __m128d b) noexcept { return _mm_cmpgt_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpge_sd(__m128d a, __m128d b) noexcept { return _mm_cmpge_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpord_sd(__m128d a, __m128d b) noexcept { return _mm_cmpord_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpunord_sd(__m128d a, __m128d b) noexcept { return _mm_cmpunord_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpneq_sd(__m128d a, __m128d b) noexcept { return _mm_cmpneq_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpnlt_sd(__m128d a, __m128d b) noexcept { return _mm_cmpnlt_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpnle_sd(__m128d a, __m128d b) noexcept { return _mm_cmpnle_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpngt_sd(__m128d a, __m128d b) noexcept { return _mm_cmpngt_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpnge_sd(__m128d a, __m128d b) noexcept { return _mm_cmpnge_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpeq_pd(__m128d a, __m128d b) noexcept { return _mm_cmpeq_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmplt_pd(__m128d a, __m128d b) noexcept { return _mm_cmplt_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmple_pd(__m128d a, __m128d b) noexcept { return _mm_cmple_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpgt_pd(__m128d a, __m128d b) noexcept { return _mm_cmpgt_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpge_pd(__m128d a, __m128d b) noexcept { return _mm_cmpge_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpord_pd(__m128d a, __m128d b) noexcept { return _mm_cmpord_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpunord_pd(__m128d a, __m128d b) noexcept { return _mm_cmpunord_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpneq_pd(__m128d a, __m128d b) noexcept { return _mm_cmpneq_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpnlt_pd(__m128d a, __m128d b) noexcept { return _mm_cmpnlt_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpnle_pd(__m128d a, __m128d b) noexcept { return _mm_cmpnle_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpngt_pd(__m128d a, __m128d b) noexcept { return _mm_cmpngt_pd(a, b); }
+__forceinline __m128d __vectorcall mm_cmpnge_pd(__m128d a, __m128d b) noexcept { return _mm_cmpnge_pd(a, b); }
+__forceinline int __vectorcall mm_comieq_sd(__m128d a, __m128d b) noexcept { return _mm_comieq_sd(a, b); }
+__forceinline int __vectorcall mm_comilt_sd(__m128d a, __m128d b) noexcept { return _mm_comilt_sd(a, b); }
+__forceinline int __vectorcall mm_comile_sd(__m128d a, __m128d b) noexcept { return _mm_comile_sd(a, b); }
+__forceinline int __vectorcall mm_comigt_sd(__m128d a, __m128d b) noexcept { return _mm_comigt_sd(a, b); }
+__forceinline int __vectorcall mm_comige_sd(__m128d a, __m128d b) noexcept { return _mm_comige_sd(a, b); }
+__forceinline int __vectorcall mm_comineq_sd(__m128d a, __m128d b) noexcept { return _mm_comineq_sd(a, b); }
+__forceinline int __vectorcall mm_ucomieq_sd(__m128d a, __m128d b) noexcept { return _mm_ucomieq_sd(a, b); }
+__forceinline int __vectorcall mm_ucomilt_sd(__m128d a, __m128d b) noexcept { return _mm_ucomilt_sd(a, b); }
+__forceinline int __vectorcall mm_ucomile_sd(__m128d a, __m128d b) noexcept { return _mm_ucomile_sd(a, b); }
+__forceinline int __vectorcall mm_ucomigt_sd(__m128d a, __m128d b) noexcept { return _mm_ucomigt_sd(a, b); }
+__forceinline int __vectorcall mm_ucomige_sd(__m128d a, __m128d b) noexcept { return _mm_ucomige_sd(a, b); }
+__forceinline int __vectorcall mm_ucomineq_sd(__m128d a, __m128d b) noexcept { return _mm_ucomineq_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cvtepi32_pd(__m128i a) noexcept { return _mm_cvtepi32_pd(a); }
+template<int i> __forceinline __m128d __vectorcall mm_cvtsi32_sd(__m128d a) noexcept { return _mm_cvtsi32_sd(a, i); }
+__forceinline __m128d __vectorcall mm_cvtsi64_sd(__m128d a, __int64 b) noexcept { return _mm_cvtsi64_sd(a, b); }
+__forceinline __m128d __vectorcall mm_cvtsi64x_sd(__m128d a, __int64 b) noexcept { return _mm_cvtsi64_sd(a, b); }
+__forceinline __m128 __vectorcall mm_cvtepi32_ps(__m128i a) noexcept { return _mm_cvtepi32_ps(a); }
+// __forceinline __m128d __vectorcall mm_cvtpi32_pd(__m64 a) noexcept { return _mm_cvtpi32_pd(a); }
+template<int i> __forceinline __m128i __vectorcall mm_cvtsi32_si128() noexcept { return _mm_cvtsi32_si128(i); }
+__forceinline __m128i __vectorcall mm_cvtsi64_si128(__int64 a) noexcept { return _mm_cvtsi64_si128(a); }
+__forceinline __m128i __vectorcall mm_cvtsi64x_si128(__int64 a) noexcept { return _mm_cvtsi64_si128(a); }
+__forceinline int __vectorcall mm_cvtsi128_si32(__m128i a) noexcept { return _mm_cvtsi128_si32(a); }
+__forceinline __int64 __vectorcall mm_cvtsi128_si64(__m128i a) noexcept { return _mm_cvtsi128_si64(a); }
+__forceinline __int64 __vectorcall mm_cvtsi128_si64x(__m128i a) noexcept { return _mm_cvtsi128_si64(a); }
+__forceinline __m128 __vectorcall mm_cvtpd_ps(__m128d a) noexcept { return _mm_cvtpd_ps(a); }
+__forceinline __m128d __vectorcall mm_cvtps_pd(__m128 a) noexcept { return _mm_cvtps_pd(a); }
+__forceinline __m128i __vectorcall mm_cvtpd_epi32(__m128d a) noexcept { return _mm_cvtpd_epi32(a); }
+__forceinline int __vectorcall mm_cvtsd_si32(__m128d a) noexcept { return _mm_cvtsd_si32(a); }
+__forceinline __int64 __vectorcall mm_cvtsd_si64(__m128d a) noexcept { return _mm_cvtsd_si64(a); }
+__forceinline __int64 __vectorcall mm_cvtsd_si64x(__m128d a) noexcept { return _mm_cvtsd_si64(a); }
+__forceinline __m128 __vectorcall mm_cvtsd_ss(__m128 a, __m128d b) noexcept { return _mm_cvtsd_ss(a, b); }
+__forceinline double __vectorcall mm_cvtsd_f64(__m128d a) noexcept { return _mm_cvtsd_f64(a); }
+__forceinline __m128d __vectorcall mm_cvtss_sd(__m128d a, __m128 b) noexcept { return _mm_cvtss_sd(a, b); }
+__forceinline __m128i __vectorcall mm_cvttpd_epi32(__m128d a) noexcept { return _mm_cvttpd_epi32(a); }
+__forceinline int __vectorcall mm_cvttsd_si32(__m128d a) noexcept { return _mm_cvttsd_si32(a); }
+__forceinline __int64 __vectorcall mm_cvttsd_si64(__m128d a) noexcept { return _mm_cvttsd_si64(a); }
+__forceinline __int64 __vectorcall mm_cvttsd_si64x(__m128d a) noexcept { return _mm_cvttsd_si64(a); }
+__forceinline __m128i __vectorcall mm_cvtps_epi32(__m128 a) noexcept { return _mm_cvtps_epi32(a); }
+__forceinline __m128i __vectorcall mm_cvttps_epi32(__m128 a) noexcept { return _mm_cvttps_epi32(a); }
+// __forceinline __m64 __vectorcall mm_cvtpd_pi32(__m128d a) noexcept { return _mm_cvtpd_pi32(a); }
+// __forceinline __m64 __vectorcall mm_cvttpd_pi32(__m128d a) noexcept { return _mm_cvttpd_pi32(a); }
+// __forceinline __m128i __vectorcall mm_set_epi64(__m64 a, __m64 b) noexcept { return _mm_set_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_set_epi64x(__int64 e1, __int64 e0) noexcept { return _mm_set_epi64x(e1, e0); }
+__forceinline __m128i __vectorcall mm_set_epi64(__int64 e1, __int64 e0) noexcept { return _mm_set_epi64x(e1, e0); }
+__forceinline __m128i __vectorcall mm_set_epi32(int e3, int e2, int e1, int e0) noexcept { return _mm_set_epi32(e3, e2, e1, e0); }
+__forceinline __m128i __vectorcall mm_set_epi16(short e7, short e6, short e5, short e4, short e3, short e2, short e1, short e0) noexcept { //
   return _mm_set_epi16(e7, e6, e5, e4, e3, e2, e1, e0);
 }
-inline __m128i mm_set_epi8(char e15, char e14, char e13, char e12, char e11, char e10, char e9, char e8,      //
-                           char e7, char e6, char e5, char e4, char e3, char e2, char e1, char e0) noexcept { //
+__forceinline __m128i __vectorcall mm_set_epi8(char e15, char e14, char e13, char e12, char e11, char e10, char e9, char e8,      //
+                                               char e7, char e6, char e5, char e4, char e3, char e2, char e1, char e0) noexcept { //
   return _mm_set_epi8(e15, e14, e13, e12, e11, e10, e9, e8, e7, e6, e5, e4, e3, e2, e1, e0);
 }
-// inline __m128i mm_set1_epi64(const __m64& a) noexcept { return _mm_set1_epi64(a); }
-inline __m128i mm_set1_epi64x(__int64 a) noexcept { return _mm_set1_epi64x(a); }
-inline __m128i mm_set1_epi64(__int64 a) noexcept { return _mm_set1_epi64x(a); }
-inline __m128i mm_set1_epi32(int a) noexcept { return _mm_set1_epi32(a); }
-inline __m128i mm_set1_epi16(short a) noexcept { return _mm_set1_epi16(a); }
-inline __m128i mm_set1_epi8(char a) noexcept { return _mm_set1_epi8(a); }
-// inline __m128i mm_setr_epi64(const __m64& a, const __m64& b) noexcept { return _mm_setr_epi64(a, b); }
-inline __m128i mm_setr_epi64x(__int64 e0, __int64 e1) noexcept { return _mm_setr_epi64x(e0, e1); }
-inline __m128i mm_setr_epi64(__int64 e0, __int64 e1) noexcept { return _mm_setr_epi64x(e0, e1); }
-inline __m128i mm_setr_epi32(int e0, int e1, int e2, int e3) noexcept { return _mm_setr_epi32(e0, e1, e2, e3); }
-inline __m128i mm_setr_epi16(short e0, short e1, short e2, short e3, short e4, short e5, short e6, short e7) noexcept { //
+// __forceinline __m128i __vectorcall mm_set1_epi64(__m64 a) noexcept { return _mm_set1_epi64(a); }
+__forceinline __m128i __vectorcall mm_set1_epi64x(__int64 a) noexcept { return _mm_set1_epi64x(a); }
+__forceinline __m128i __vectorcall mm_set1_epi64(__int64 a) noexcept { return _mm_set1_epi64x(a); }
+__forceinline __m128i __vectorcall mm_set1_epi32(int a) noexcept { return _mm_set1_epi32(a); }
+__forceinline __m128i __vectorcall mm_set1_epi16(short a) noexcept { return _mm_set1_epi16(a); }
+__forceinline __m128i __vectorcall mm_set1_epi8(char a) noexcept { return _mm_set1_epi8(a); }
+// __forceinline __m128i __vectorcall mm_setr_epi64(__m64 a, __m64 b) noexcept { return _mm_setr_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_setr_epi64x(__int64 e0, __int64 e1) noexcept { return _mm_setr_epi64x(e0, e1); }
+__forceinline __m128i __vectorcall mm_setr_epi64(__int64 e0, __int64 e1) noexcept { return _mm_setr_epi64x(e0, e1); }
+__forceinline __m128i __vectorcall mm_setr_epi32(int e0, int e1, int e2, int e3) noexcept { return _mm_setr_epi32(e0, e1, e2, e3); }
+__forceinline __m128i __vectorcall mm_setr_epi16(short e0, short e1, short e2, short e3, short e4, short e5, short e6, short e7) noexcept { //
   return _mm_setr_epi16(e0, e1, e2, e3, e4, e5, e6, e7);
 }
-inline __m128i mm_setr_epi8(char e0, char e1, char e2, char e3, char e4, char e5, char e6, char e7,                  //
-                            char e8, char e9, char e10, char e11, char e12, char e13, char e14, char e15) noexcept { //
+__forceinline __m128i __vectorcall mm_setr_epi8(char e0, char e1, char e2, char e3, char e4, char e5, char e6, char e7,                  //
+                                                char e8, char e9, char e10, char e11, char e12, char e13, char e14, char e15) noexcept { //
   return _mm_setr_epi8(e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15);
 }
-inline __m128i mm_setzero_si128() noexcept { return _mm_setzero_si128(); }
-inline __m128d mm_set_sd(double a) noexcept { return _mm_set_sd(a); }
-inline __m128d mm_set1_pd(double a) noexcept { return _mm_set1_pd(a); }
-inline __m128d mm_set_pd1(double a) noexcept { return _mm_set_pd1(a); }
-inline __m128d mm_set_pd(double a, double b) noexcept { return _mm_set_pd(a, b); }
-inline __m128d mm_setr_pd(double a, double b) noexcept { return _mm_setr_pd(a, b); }
-inline __m128d mm_setzero_pd() noexcept { return _mm_setzero_pd(); }
-// inline __m64 mm_movepi64_pi64(const __m128i& a) noexcept { return _mm_movepi64_pi64(a); }
-inline __m128i mm_packs_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_packs_epi16(a, b); }
-inline __m128i mm_packs_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_packs_epi32(a, b); }
-inline __m128i mm_packus_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_packus_epi16(a, b); }
-inline int mm_movemask_epi8(const __m128i& a) noexcept { return _mm_movemask_epi8(a); }
-inline int mm_movemask_pd(const __m128d& a) noexcept { return _mm_movemask_pd(a); }
-// inline __m128i mm_movpi64_epi64(const __m64& a) noexcept { return _mm_movpi64_epi64(a); }
-inline __m128i mm_move_epi64(const __m128i& a) noexcept { return _mm_move_epi64(a); }
-inline __m128d mm_move_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_move_sd(a, b); }
-template<int i> int mm_extract_epi16(const __m128i& a) noexcept { return _mm_extract_epi16(a, i); }
-template<int i> __m128i mm_insert_epi16(const __m128i& a, int b) noexcept { return _mm_insert_epi16(a, b, i); }
-template<int i> __m128i mm_shuffle_epi32(const __m128i& a) noexcept { return _mm_shuffle_epi32(a, i); }
-template<int i> __m128i mm_shufflehi_epi16(const __m128i& a) noexcept { return _mm_shufflehi_epi16(a, i); }
-template<int i> __m128i mm_shufflelo_epi16(const __m128i& a) noexcept { return _mm_shufflelo_epi16(a, i); }
-inline __m128i mm_unpackhi_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_unpackhi_epi8(a, b); }
-inline __m128i mm_unpackhi_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_unpackhi_epi16(a, b); }
-inline __m128i mm_unpackhi_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_unpackhi_epi32(a, b); }
-inline __m128i mm_unpackhi_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_unpackhi_epi64(a, b); }
-inline __m128i mm_unpacklo_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_unpacklo_epi8(a, b); }
-inline __m128i mm_unpacklo_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_unpacklo_epi16(a, b); }
-inline __m128i mm_unpacklo_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_unpacklo_epi32(a, b); }
-inline __m128i mm_unpacklo_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_unpacklo_epi64(a, b); }
-inline __m128d mm_unpackhi_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_unpackhi_pd(a, b); }
-inline __m128d mm_unpacklo_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_unpacklo_pd(a, b); }
-template<int i> __m128d mm_shuffle_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_shuffle_pd(a, b, i); }
-inline __m128d mm_sqrt_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_sqrt_sd(a, b); }
-inline __m128d mm_sqrt_pd(const __m128d& a) noexcept { return _mm_sqrt_pd(a); }
-inline __m128 mm_castpd_ps(const __m128d& a) noexcept { return _mm_castpd_ps(a); }
-inline __m128i mm_castpd_si128(const __m128d& a) noexcept { return _mm_castpd_si128(a); }
-inline __m128d mm_castps_pd(const __m128& a) noexcept { return _mm_castps_pd(a); }
-inline __m128i mm_castps_si128(const __m128& a) noexcept { return _mm_castps_si128(a); }
-inline __m128d mm_castsi128_pd(const __m128i& a) noexcept { return _mm_castsi128_pd(a); }
-inline __m128 mm_castsi128_ps(const __m128i& a) noexcept { return _mm_castsi128_ps(a); }
-inline __m128 mm_addsub_ps(const __m128& a, const __m128& b) noexcept { return _mm_addsub_ps(a, b); }
-inline __m128d mm_addsub_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_addsub_pd(a, b); }
-inline __m128d mm_hadd_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_hadd_pd(a, b); }
-inline __m128 mm_hadd_ps(const __m128& a, const __m128& b) noexcept { return _mm_hadd_ps(a, b); }
-inline __m128d mm_hsub_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_hsub_pd(a, b); }
-inline __m128 mm_hsub_ps(const __m128& a, const __m128& b) noexcept { return _mm_hsub_ps(a, b); }
-inline __m128i mm_lddqu_si128(__m128i const* a) noexcept { return _mm_lddqu_si128(a); }
-inline __m128d mm_loaddup_pd(double const* a) noexcept { return _mm_loaddup_pd(a); }
-inline __m128d mm_movedup_pd(const __m128d& a) noexcept { return _mm_movedup_pd(a); }
-inline __m128 mm_movehdup_ps(const __m128& a) noexcept { return _mm_movehdup_ps(a); }
-inline __m128 mm_moveldup_ps(const __m128& a) noexcept { return _mm_moveldup_ps(a); }
-template<int i> __m128d mm_blend_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_blend_pd(a, b, i); }
-template<int i> __m128 mm_blend_ps(const __m128& a, const __m128& b) noexcept { return _mm_blend_ps(a, b, i); }
-inline __m128d mm_blendv_pd(const __m128d& a, const __m128d& b, const __m128d& c) noexcept { return _mm_blendv_pd(a, b, c); }
-inline __m128 mm_blendv_ps(const __m128& a, const __m128& b, const __m128& c) noexcept { return _mm_blendv_ps(a, b, c); }
-inline __m128i mm_blendv_epi8(const __m128i& a, const __m128i& b, const __m128i& c) noexcept { return _mm_blendv_epi8(a, b, c); }
-template<int i> __m128i mm_blend_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_blend_epi16(a, b, i); }
-template<int i> int mm_extract_ps(const __m128& a) noexcept { return _mm_extract_ps(a, i); }
-template<int i> int mm_extract_epi8(const __m128i& a) noexcept { return _mm_extract_epi8(a, i); }
-template<int i> int mm_extract_epi32(const __m128i& a) noexcept { return _mm_extract_epi32(a, i); }
-template<int i> __int64 mm_extract_epi64(const __m128i& a) noexcept { return _mm_extract_epi64(a, i); }
-template<int i> __m128 mm_insert_ps(const __m128& a, const __m128& b) noexcept { return _mm_insert_ps(a, b, i); }
-template<int i> __m128i mm_insert_epi8(const __m128i& a, int b) noexcept { return _mm_insert_epi8(a, b, i); }
-template<int i> __m128i mm_insert_epi32(const __m128i& a, int b) noexcept { return _mm_insert_epi32(a, b, i); }
-template<int i> __m128i mm_insert_epi64(const __m128i& a, __int64 b) noexcept { return _mm_insert_epi64(a, b, i); }
-template<int i> __m128d mm_dp_pd(const __m128d& a, const __m128d& b) noexcept { return _mm_dp_pd(a, b, i); }
-template<int i> __m128 mm_dp_ps(const __m128& a, const __m128& b) noexcept { return _mm_dp_ps(a, b, i); }
-inline __m128i mm_mul_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_mul_epi32(a, b); }
-inline __m128i mm_mullo_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_mullo_epi32(a, b); }
-template<int i> __m128i mm_mpsadbw_epu8(const __m128i& a, const __m128i& b) noexcept { return _mm_mpsadbw_epu8(a, b, i); }
-inline __m128i mm_max_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_max_epi8(a, b); }
-inline __m128i mm_max_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_max_epi32(a, b); }
-inline __m128i mm_max_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_max_epu32(a, b); }
-inline __m128i mm_max_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_max_epu16(a, b); }
-inline __m128i mm_min_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_min_epi8(a, b); }
-inline __m128i mm_min_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_min_epi32(a, b); }
-inline __m128i mm_min_epu32(const __m128i& a, const __m128i& b) noexcept { return _mm_min_epu32(a, b); }
-inline __m128i mm_min_epu16(const __m128i& a, const __m128i& b) noexcept { return _mm_min_epu16(a, b); }
-template<int i> __m128d mm_round_pd(const __m128d& a) noexcept { return _mm_round_pd(a, i); }
-inline __m128d mm_floor_pd(const __m128d& a) noexcept { return _mm_floor_pd(a); }
-inline __m128d mm_ceil_pd(const __m128d& a) noexcept { return _mm_ceil_pd(a); }
-template<int i> __m128 mm_round_ps(const __m128& a) noexcept { return _mm_round_ps(a, i); }
-inline __m128 mm_floor_ps(const __m128& a) noexcept { return _mm_floor_ps(a); }
-inline __m128 mm_ceil_ps(const __m128& a) noexcept { return _mm_ceil_ps(a); }
-template<int i> __m128d mm_round_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_round_sd(a, b, i); }
-inline __m128d mm_floor_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_floor_sd(a, b); }
-inline __m128d mm_ceil_sd(const __m128d& a, const __m128d& b) noexcept { return _mm_ceil_sd(a, b); }
-template<int i> __m128 mm_round_ss(const __m128& a, const __m128& b) noexcept { return _mm_round_ss(a, b, i); }
-inline __m128 mm_floor_ss(const __m128& a, const __m128& b) noexcept { return _mm_floor_ss(a, b); }
-inline __m128 mm_ceil_ss(const __m128& a, const __m128& b) noexcept { return _mm_ceil_ss(a, b); }
-inline __m128i mm_packus_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_packus_epi32(a, b); }
-inline __m128i mm_cvtepi8_epi16(const __m128i& a) noexcept { return _mm_cvtepi8_epi16(a); }
-inline __m128i mm_cvtepi8_epi32(const __m128i& a) noexcept { return _mm_cvtepi8_epi32(a); }
-inline __m128i mm_cvtepi8_epi64(const __m128i& a) noexcept { return _mm_cvtepi8_epi64(a); }
-inline __m128i mm_cvtepi16_epi32(const __m128i& a) noexcept { return _mm_cvtepi16_epi32(a); }
-inline __m128i mm_cvtepi16_epi64(const __m128i& a) noexcept { return _mm_cvtepi16_epi64(a); }
-inline __m128i mm_cvtepi32_epi64(const __m128i& a) noexcept { return _mm_cvtepi32_epi64(a); }
-inline __m128i mm_cvtepu8_epi16(const __m128i& a) noexcept { return _mm_cvtepu8_epi16(a); }
-inline __m128i mm_cvtepu8_epi32(const __m128i& a) noexcept { return _mm_cvtepu8_epi32(a); }
-inline __m128i mm_cvtepu8_epi64(const __m128i& a) noexcept { return _mm_cvtepu8_epi64(a); }
-inline __m128i mm_cvtepu16_epi32(const __m128i& a) noexcept { return _mm_cvtepu16_epi32(a); }
-inline __m128i mm_cvtepu16_epi64(const __m128i& a) noexcept { return _mm_cvtepu16_epi64(a); }
-inline __m128i mm_cvtepu32_epi64(const __m128i& a) noexcept { return _mm_cvtepu32_epi64(a); }
-inline __m128i mm_cmpeq_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpeq_epi64(a, b); }
-inline int mm_testz_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_testz_si128(a, b); }
-inline int mm_testc_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_testc_si128(a, b); }
-inline int mm_testnzc_si128(const __m128i& a, const __m128i& b) noexcept { return _mm_testnzc_si128(a, b); }
-inline int mm_test_all_zeros(const __m128i& a, const __m128i& b) noexcept { return _mm_test_all_zeros(a, b); }
-inline int mm_test_mix_ones_zeros(const __m128i& a, const __m128i& b) noexcept { return _mm_test_mix_ones_zeros(a, b); }
-inline int mm_test_all_ones(const __m128i& a) noexcept { return _mm_test_all_ones(a); }
-inline __m128i mm_minpos_epu16(const __m128i& a) noexcept { return _mm_minpos_epu16(a); }
-inline __m128i mm_stream_load_si128(void* a) noexcept { return _mm_stream_load_si128((m128i*)a); }
-template<int i> __m128i mm_cmpistrm(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistrm(a, b, i); }
-template<int i> int mm_cmpistri(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistri(a, b, i); }
-template<int i> int mm_cmpistrz(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistrz(a, b, i); }
-template<int i> int mm_cmpistrc(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistrc(a, b, i); }
-template<int i> int mm_cmpistrs(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistrs(a, b, i); }
-template<int i> int mm_cmpistro(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistro(a, b, i); }
-template<int i> int mm_cmpistra(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpistra(a, b, i); }
-template<int i> __m128i mm_cmpestrm(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestrm(a, b, c, d, i); }
-template<int i> int mm_cmpestri(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestri(a, b, c, d, i); }
-template<int i> int mm_cmpestrz(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestrz(a, b, c, d, i); }
-template<int i> int mm_cmpestrc(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestrc(a, b, c, d, i); }
-template<int i> int mm_cmpestrs(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestrs(a, b, c, d, i); }
-template<int i> int mm_cmpestro(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestro(a, b, c, d, i); }
-template<int i> int mm_cmpestra(const __m128i& a, int b, const __m128i& c, int d) noexcept { return _mm_cmpestra(a, b, c, d, i); }
-inline __m128i mm_cmpgt_epi64(const __m128i& a, const __m128i& b) noexcept { return _mm_cmpgt_epi64(a, b); }
-// inline __m64 mm_abs_pi8(const __m64& a) noexcept { return _mm_abs_pi8(a); }
-inline __m128i mm_abs_epi8(const __m128i& a) noexcept { return _mm_abs_epi8(a); }
-// inline __m64 mm_abs_pi16(const __m64& a) noexcept { return _mm_abs_pi16(a); }
-inline __m128i mm_abs_epi16(const __m128i& a) noexcept { return _mm_abs_epi16(a); }
-// inline __m64 mm_abs_pi32(const __m64& a) noexcept { return _mm_abs_pi32(a); }
-inline __m128i mm_abs_epi32(const __m128i& a) noexcept { return _mm_abs_epi32(a); }
-inline __m128i mm_shuffle_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_shuffle_epi8(a, b); }
-// inline __m64 mm_shuffle_pi8(const __m64& a, const __m64& b) noexcept { return _mm_shuffle_pi8(a, b); }
-template<int i> __m128i mm_alignr_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_alignr_epi8(a, b, i); }
-// template<int i> __m64 mm_alignr_pi8(const __m64& a, const __m64& b) noexcept { return _mm_alignr_pi8(a, b, i); }
-inline __m128i mm_hadd_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_hadd_epi16(a, b); }
-inline __m128i mm_hadds_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_hadds_epi16(a, b); }
-inline __m128i mm_hadd_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_hadd_epi32(a, b); }
-// inline __m64 mm_hadd_pi16(const __m64& a, const __m64& b) noexcept { return _mm_hadd_pi16(a, b); }
-// inline __m64 mm_hadd_pi32(const __m64& a, const __m64& b) noexcept { return _mm_hadd_pi32(a, b); }
-// inline __m64 mm_hadds_pi16(const __m64& a, const __m64& b) noexcept { return _mm_hadds_pi16(a, b); }
-inline __m128i mm_hsub_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_hsub_epi16(a, b); }
-inline __m128i mm_hsubs_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_hsubs_epi16(a, b); }
-inline __m128i mm_hsub_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_hsub_epi32(a, b); }
-// inline __m64 mm_hsub_pi16(const __m64& a, const __m64& b) noexcept { return _mm_hsub_pi16(a, b); }
-// inline __m64 mm_hsub_pi32(const __m64& a, const __m64& b) noexcept { return _mm_hsub_pi32(a, b); }
-// inline __m64 mm_hsubs_pi16(const __m64& a, const __m64& b) noexcept { return _mm_hsubs_pi16(a, b); }
-inline __m128i mm_maddubs_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_maddubs_epi16(a, b); }
-// inline __m64 mm_maddubs_pi16(const __m64& a, const __m64& b) noexcept { return _mm_maddubs_pi16(a, b); }
-inline __m128i mm_mulhrs_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_mulhrs_epi16(a, b); }
-// inline __m64 mm_mulhrs_pi16(const __m64& a, const __m64& b) noexcept { return _mm_mulhrs_pi16(a, b); }
-inline __m128i mm_sign_epi8(const __m128i& a, const __m128i& b) noexcept { return _mm_sign_epi8(a, b); }
-inline __m128i mm_sign_epi16(const __m128i& a, const __m128i& b) noexcept { return _mm_sign_epi16(a, b); }
-inline __m128i mm_sign_epi32(const __m128i& a, const __m128i& b) noexcept { return _mm_sign_epi32(a, b); }
-// inline __m64 mm_sign_pi8(const __m64& a, const __m64& b) noexcept { return _mm_sign_pi8(a, b); }
-// inline __m64 mm_sign_pi16(const __m64& a, const __m64& b) noexcept { return _mm_sign_pi16(a, b); }
-// inline __m64 mm_sign_pi32(const __m64& a, const __m64& b) noexcept { return _mm_sign_pi32(a, b); }
-inline __m256i mm256_aesenclast_epi128(const __m256i& a, const __m256i& b) noexcept { return _mm256_aesenclast_epi128(a, b); }
-inline __m256i mm256_aesenc_epi128(const __m256i& a, const __m256i& b) noexcept { return _mm256_aesenc_epi128(a, b); }
-inline __m256i mm256_aesdeclast_epi128(const __m256i& a, const __m256i& b) noexcept { return _mm256_aesdeclast_epi128(a, b); }
-inline __m256i mm256_aesdec_epi128(const __m256i& a, const __m256i& b) noexcept { return _mm256_aesdec_epi128(a, b); }
-template<int i> __m256i mm256_clmulepi64_epi128(const __m256i& a, const __m256i& b) noexcept { return _mm256_clmulepi64_epi128(a, b, i); }
-template<int i> __m512i mm512_clmulepi64_epi128(const __m512i& a, const __m512i& b) noexcept { return _mm512_clmulepi64_epi128(a, b, i); }
+__forceinline __m128i __vectorcall mm_setzero_si128() noexcept { return _mm_setzero_si128(); }
+__forceinline __m128d __vectorcall mm_set_sd(double a) noexcept { return _mm_set_sd(a); }
+__forceinline __m128d __vectorcall mm_set1_pd(double a) noexcept { return _mm_set1_pd(a); }
+__forceinline __m128d __vectorcall mm_set_pd1(double a) noexcept { return _mm_set_pd1(a); }
+__forceinline __m128d __vectorcall mm_set_pd(double a, double b) noexcept { return _mm_set_pd(a, b); }
+__forceinline __m128d __vectorcall mm_setr_pd(double a, double b) noexcept { return _mm_setr_pd(a, b); }
+__forceinline __m128d __vectorcall mm_setzero_pd() noexcept { return _mm_setzero_pd(); }
+// __forceinline __m64 __vectorcall mm_movepi64_pi64(__m128i a) noexcept { return _mm_movepi64_pi64(a); }
+__forceinline __m128i __vectorcall mm_packs_epi16(__m128i a, __m128i b) noexcept { return _mm_packs_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_packs_epi32(__m128i a, __m128i b) noexcept { return _mm_packs_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_packus_epi16(__m128i a, __m128i b) noexcept { return _mm_packus_epi16(a, b); }
+__forceinline int __vectorcall mm_movemask_epi8(__m128i a) noexcept { return _mm_movemask_epi8(a); }
+__forceinline int __vectorcall mm_movemask_pd(__m128d a) noexcept { return _mm_movemask_pd(a); }
+// __forceinline __m128i __vectorcall mm_movpi64_epi64(__m64 a) noexcept { return _mm_movpi64_epi64(a); }
+__forceinline __m128i __vectorcall mm_move_epi64(__m128i a) noexcept { return _mm_move_epi64(a); }
+__forceinline __m128d __vectorcall mm_move_sd(__m128d a, __m128d b) noexcept { return _mm_move_sd(a, b); }
+template<int i> __forceinline int __vectorcall mm_extract_epi16(__m128i a) noexcept { return _mm_extract_epi16(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_insert_epi16(__m128i a, int b) noexcept { return _mm_insert_epi16(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_shuffle_epi32(__m128i a) noexcept { return _mm_shuffle_epi32(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_shufflehi_epi16(__m128i a) noexcept { return _mm_shufflehi_epi16(a, i); }
+template<int i> __forceinline __m128i __vectorcall mm_shufflelo_epi16(__m128i a) noexcept { return _mm_shufflelo_epi16(a, i); }
+__forceinline __m128i __vectorcall mm_unpackhi_epi8(__m128i a, __m128i b) noexcept { return _mm_unpackhi_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_unpackhi_epi16(__m128i a, __m128i b) noexcept { return _mm_unpackhi_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_unpackhi_epi32(__m128i a, __m128i b) noexcept { return _mm_unpackhi_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_unpackhi_epi64(__m128i a, __m128i b) noexcept { return _mm_unpackhi_epi64(a, b); }
+__forceinline __m128i __vectorcall mm_unpacklo_epi8(__m128i a, __m128i b) noexcept { return _mm_unpacklo_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_unpacklo_epi16(__m128i a, __m128i b) noexcept { return _mm_unpacklo_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_unpacklo_epi32(__m128i a, __m128i b) noexcept { return _mm_unpacklo_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_unpacklo_epi64(__m128i a, __m128i b) noexcept { return _mm_unpacklo_epi64(a, b); }
+__forceinline __m128d __vectorcall mm_unpackhi_pd(__m128d a, __m128d b) noexcept { return _mm_unpackhi_pd(a, b); }
+__forceinline __m128d __vectorcall mm_unpacklo_pd(__m128d a, __m128d b) noexcept { return _mm_unpacklo_pd(a, b); }
+template<int i> __forceinline __m128d __vectorcall mm_shuffle_pd(__m128d a, __m128d b) noexcept { return _mm_shuffle_pd(a, b, i); }
+__forceinline __m128d __vectorcall mm_sqrt_sd(__m128d a, __m128d b) noexcept { return _mm_sqrt_sd(a, b); }
+__forceinline __m128d __vectorcall mm_sqrt_pd(__m128d a) noexcept { return _mm_sqrt_pd(a); }
+__forceinline __m128 __vectorcall mm_castpd_ps(__m128d a) noexcept { return _mm_castpd_ps(a); }
+__forceinline __m128i __vectorcall mm_castpd_si128(__m128d a) noexcept { return _mm_castpd_si128(a); }
+__forceinline __m128d __vectorcall mm_castps_pd(__m128 a) noexcept { return _mm_castps_pd(a); }
+__forceinline __m128i __vectorcall mm_castps_si128(__m128 a) noexcept { return _mm_castps_si128(a); }
+__forceinline __m128d __vectorcall mm_castsi128_pd(__m128i a) noexcept { return _mm_castsi128_pd(a); }
+__forceinline __m128 __vectorcall mm_castsi128_ps(__m128i a) noexcept { return _mm_castsi128_ps(a); }
+__forceinline __m128 __vectorcall mm_addsub_ps(__m128 a, __m128 b) noexcept { return _mm_addsub_ps(a, b); }
+__forceinline __m128d __vectorcall mm_addsub_pd(__m128d a, __m128d b) noexcept { return _mm_addsub_pd(a, b); }
+__forceinline __m128d __vectorcall mm_hadd_pd(__m128d a, __m128d b) noexcept { return _mm_hadd_pd(a, b); }
+__forceinline __m128 __vectorcall mm_hadd_ps(__m128 a, __m128 b) noexcept { return _mm_hadd_ps(a, b); }
+__forceinline __m128d __vectorcall mm_hsub_pd(__m128d a, __m128d b) noexcept { return _mm_hsub_pd(a, b); }
+__forceinline __m128 __vectorcall mm_hsub_ps(__m128 a, __m128 b) noexcept { return _mm_hsub_ps(a, b); }
+__forceinline __m128i __vectorcall mm_lddqu_si128(__m128i const* a) noexcept { return _mm_lddqu_si128(a); }
+__forceinline __m128d __vectorcall mm_loaddup_pd(double const* a) noexcept { return _mm_loaddup_pd(a); }
+__forceinline __m128d __vectorcall mm_movedup_pd(__m128d a) noexcept { return _mm_movedup_pd(a); }
+__forceinline __m128 __vectorcall mm_movehdup_ps(__m128 a) noexcept { return _mm_movehdup_ps(a); }
+__forceinline __m128 __vectorcall mm_moveldup_ps(__m128 a) noexcept { return _mm_moveldup_ps(a); }
+template<int i> __forceinline __m128d __vectorcall mm_blend_pd(__m128d a, __m128d b) noexcept { return _mm_blend_pd(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm_blend_ps(__m128 a, __m128 b) noexcept { return _mm_blend_ps(a, b, i); }
+__forceinline __m128d __vectorcall mm_blendv_pd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_blendv_pd(a, b, c); }
+__forceinline __m128 __vectorcall mm_blendv_ps(__m128 a, __m128 b, __m128 c) noexcept { return _mm_blendv_ps(a, b, c); }
+__forceinline __m128i __vectorcall mm_blendv_epi8(__m128i a, __m128i b, __m128i c) noexcept { return _mm_blendv_epi8(a, b, c); }
+template<int i> __forceinline __m128i __vectorcall mm_blend_epi16(__m128i a, __m128i b) noexcept { return _mm_blend_epi16(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_extract_ps(__m128 a) noexcept { return _mm_extract_ps(a, i); }
+template<int i> __forceinline int __vectorcall mm_extract_epi8(__m128i a) noexcept { return _mm_extract_epi8(a, i); }
+template<int i> __forceinline int __vectorcall mm_extract_epi32(__m128i a) noexcept { return _mm_extract_epi32(a, i); }
+template<int i> __forceinline __int64 __vectorcall mm_extract_epi64(__m128i a) noexcept { return _mm_extract_epi64(a, i); }
+template<int i> __forceinline __m128 __vectorcall mm_insert_ps(__m128 a, __m128 b) noexcept { return _mm_insert_ps(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_insert_epi8(__m128i a, int b) noexcept { return _mm_insert_epi8(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_insert_epi32(__m128i a, int b) noexcept { return _mm_insert_epi32(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_insert_epi64(__m128i a, __int64 b) noexcept { return _mm_insert_epi64(a, b, i); }
+template<int i> __forceinline __m128d __vectorcall mm_dp_pd(__m128d a, __m128d b) noexcept { return _mm_dp_pd(a, b, i); }
+template<int i> __forceinline __m128 __vectorcall mm_dp_ps(__m128 a, __m128 b) noexcept { return _mm_dp_ps(a, b, i); }
+__forceinline __m128i __vectorcall mm_mul_epi32(__m128i a, __m128i b) noexcept { return _mm_mul_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_mullo_epi32(__m128i a, __m128i b) noexcept { return _mm_mullo_epi32(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_mpsadbw_epu8(__m128i a, __m128i b) noexcept { return _mm_mpsadbw_epu8(a, b, i); }
+__forceinline __m128i __vectorcall mm_max_epi8(__m128i a, __m128i b) noexcept { return _mm_max_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_max_epi32(__m128i a, __m128i b) noexcept { return _mm_max_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_max_epu32(__m128i a, __m128i b) noexcept { return _mm_max_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_max_epu16(__m128i a, __m128i b) noexcept { return _mm_max_epu16(a, b); }
+__forceinline __m128i __vectorcall mm_min_epi8(__m128i a, __m128i b) noexcept { return _mm_min_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_min_epi32(__m128i a, __m128i b) noexcept { return _mm_min_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_min_epu32(__m128i a, __m128i b) noexcept { return _mm_min_epu32(a, b); }
+__forceinline __m128i __vectorcall mm_min_epu16(__m128i a, __m128i b) noexcept { return _mm_min_epu16(a, b); }
+template<int i> __forceinline __m128d __vectorcall mm_round_pd(__m128d a) noexcept { return _mm_round_pd(a, i); }
+__forceinline __m128d __vectorcall mm_floor_pd(__m128d a) noexcept { return _mm_floor_pd(a); }
+__forceinline __m128d __vectorcall mm_ceil_pd(__m128d a) noexcept { return _mm_ceil_pd(a); }
+template<int i> __forceinline __m128 __vectorcall mm_round_ps(__m128 a) noexcept { return _mm_round_ps(a, i); }
+__forceinline __m128 __vectorcall mm_floor_ps(__m128 a) noexcept { return _mm_floor_ps(a); }
+__forceinline __m128 __vectorcall mm_ceil_ps(__m128 a) noexcept { return _mm_ceil_ps(a); }
+template<int i> __forceinline __m128d __vectorcall mm_round_sd(__m128d a, __m128d b) noexcept { return _mm_round_sd(a, b, i); }
+__forceinline __m128d __vectorcall mm_floor_sd(__m128d a, __m128d b) noexcept { return _mm_floor_sd(a, b); }
+__forceinline __m128d __vectorcall mm_ceil_sd(__m128d a, __m128d b) noexcept { return _mm_ceil_sd(a, b); }
+template<int i> __forceinline __m128 __vectorcall mm_round_ss(__m128 a, __m128 b) noexcept { return _mm_round_ss(a, b, i); }
+__forceinline __m128 __vectorcall mm_floor_ss(__m128 a, __m128 b) noexcept { return _mm_floor_ss(a, b); }
+__forceinline __m128 __vectorcall mm_ceil_ss(__m128 a, __m128 b) noexcept { return _mm_ceil_ss(a, b); }
+__forceinline __m128i __vectorcall mm_packus_epi32(__m128i a, __m128i b) noexcept { return _mm_packus_epi32(a, b); }
+__forceinline __m128i __vectorcall mm_cvtepi8_epi16(__m128i a) noexcept { return _mm_cvtepi8_epi16(a); }
+__forceinline __m128i __vectorcall mm_cvtepi8_epi32(__m128i a) noexcept { return _mm_cvtepi8_epi32(a); }
+__forceinline __m128i __vectorcall mm_cvtepi8_epi64(__m128i a) noexcept { return _mm_cvtepi8_epi64(a); }
+__forceinline __m128i __vectorcall mm_cvtepi16_epi32(__m128i a) noexcept { return _mm_cvtepi16_epi32(a); }
+__forceinline __m128i __vectorcall mm_cvtepi16_epi64(__m128i a) noexcept { return _mm_cvtepi16_epi64(a); }
+__forceinline __m128i __vectorcall mm_cvtepi32_epi64(__m128i a) noexcept { return _mm_cvtepi32_epi64(a); }
+__forceinline __m128i __vectorcall mm_cvtepu8_epi16(__m128i a) noexcept { return _mm_cvtepu8_epi16(a); }
+__forceinline __m128i __vectorcall mm_cvtepu8_epi32(__m128i a) noexcept { return _mm_cvtepu8_epi32(a); }
+__forceinline __m128i __vectorcall mm_cvtepu8_epi64(__m128i a) noexcept { return _mm_cvtepu8_epi64(a); }
+__forceinline __m128i __vectorcall mm_cvtepu16_epi32(__m128i a) noexcept { return _mm_cvtepu16_epi32(a); }
+__forceinline __m128i __vectorcall mm_cvtepu16_epi64(__m128i a) noexcept { return _mm_cvtepu16_epi64(a); }
+__forceinline __m128i __vectorcall mm_cvtepu32_epi64(__m128i a) noexcept { return _mm_cvtepu32_epi64(a); }
+__forceinline __m128i __vectorcall mm_cmpeq_epi64(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi64(a, b); }
+__forceinline int __vectorcall mm_testz_si128(__m128i a, __m128i b) noexcept { return _mm_testz_si128(a, b); }
+__forceinline int __vectorcall mm_testc_si128(__m128i a, __m128i b) noexcept { return _mm_testc_si128(a, b); }
+__forceinline int __vectorcall mm_testnzc_si128(__m128i a, __m128i b) noexcept { return _mm_testnzc_si128(a, b); }
+__forceinline int __vectorcall mm_test_all_zeros(__m128i a, __m128i b) noexcept { return _mm_test_all_zeros(a, b); }
+__forceinline int __vectorcall mm_test_mix_ones_zeros(__m128i a, __m128i b) noexcept { return _mm_test_mix_ones_zeros(a, b); }
+__forceinline int __vectorcall mm_test_all_ones(__m128i a) noexcept { return _mm_test_all_ones(a); }
+__forceinline __m128i __vectorcall mm_minpos_epu16(__m128i a) noexcept { return _mm_minpos_epu16(a); }
+__forceinline __m128i __vectorcall mm_stream_load_si128(void* a) noexcept { return _mm_stream_load_si128((m128i*)a); }
+template<int i> __forceinline __m128i __vectorcall mm_cmpistrm(__m128i a, __m128i b) noexcept { return _mm_cmpistrm(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_cmpistri(__m128i a, __m128i b) noexcept { return _mm_cmpistri(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_cmpistrz(__m128i a, __m128i b) noexcept { return _mm_cmpistrz(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_cmpistrc(__m128i a, __m128i b) noexcept { return _mm_cmpistrc(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_cmpistrs(__m128i a, __m128i b) noexcept { return _mm_cmpistrs(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_cmpistro(__m128i a, __m128i b) noexcept { return _mm_cmpistro(a, b, i); }
+template<int i> __forceinline int __vectorcall mm_cmpistra(__m128i a, __m128i b) noexcept { return _mm_cmpistra(a, b, i); }
+template<int i> __forceinline __m128i __vectorcall mm_cmpestrm(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestrm(a, b, c, d, i); }
+template<int i> __forceinline int __vectorcall mm_cmpestri(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestri(a, b, c, d, i); }
+template<int i> __forceinline int __vectorcall mm_cmpestrz(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestrz(a, b, c, d, i); }
+template<int i> __forceinline int __vectorcall mm_cmpestrc(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestrc(a, b, c, d, i); }
+template<int i> __forceinline int __vectorcall mm_cmpestrs(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestrs(a, b, c, d, i); }
+template<int i> __forceinline int __vectorcall mm_cmpestro(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestro(a, b, c, d, i); }
+template<int i> __forceinline int __vectorcall mm_cmpestra(__m128i a, int b, __m128i c, int d) noexcept { return _mm_cmpestra(a, b, c, d, i); }
+__forceinline __m128i __vectorcall mm_cmpgt_epi64(__m128i a, __m128i b) noexcept { return _mm_cmpgt_epi64(a, b); }
+// __forceinline __m64 __vectorcall mm_abs_pi8(__m64 a) noexcept { return _mm_abs_pi8(a); }
+__forceinline __m128i __vectorcall mm_abs_epi8(__m128i a) noexcept { return _mm_abs_epi8(a); }
+// __forceinline __m64 __vectorcall mm_abs_pi16(__m64 a) noexcept { return _mm_abs_pi16(a); }
+__forceinline __m128i __vectorcall mm_abs_epi16(__m128i a) noexcept { return _mm_abs_epi16(a); }
+// __forceinline __m64 __vectorcall mm_abs_pi32(__m64 a) noexcept { return _mm_abs_pi32(a); }
+__forceinline __m128i __vectorcall mm_abs_epi32(__m128i a) noexcept { return _mm_abs_epi32(a); }
+__forceinline __m128i __vectorcall mm_shuffle_epi8(__m128i a, __m128i b) noexcept { return _mm_shuffle_epi8(a, b); }
+// __forceinline __m64 __vectorcall mm_shuffle_pi8(__m64 a, __m64 b) noexcept { return _mm_shuffle_pi8(a, b); }
+template<int i> __forceinline __m128i __vectorcall mm_alignr_epi8(__m128i a, __m128i b) noexcept { return _mm_alignr_epi8(a, b, i); }
+// template<int i> __forceinline __m64 __vectorcall mm_alignr_pi8(__m64 a, __m64 b) noexcept { return _mm_alignr_pi8(a, b, i); }
+__forceinline __m128i __vectorcall mm_hadd_epi16(__m128i a, __m128i b) noexcept { return _mm_hadd_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_hadds_epi16(__m128i a, __m128i b) noexcept { return _mm_hadds_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_hadd_epi32(__m128i a, __m128i b) noexcept { return _mm_hadd_epi32(a, b); }
+// __forceinline __m64 __vectorcall mm_hadd_pi16(__m64 a, __m64 b) noexcept { return _mm_hadd_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_hadd_pi32(__m64 a, __m64 b) noexcept { return _mm_hadd_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_hadds_pi16(__m64 a, __m64 b) noexcept { return _mm_hadds_pi16(a, b); }
+__forceinline __m128i __vectorcall mm_hsub_epi16(__m128i a, __m128i b) noexcept { return _mm_hsub_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_hsubs_epi16(__m128i a, __m128i b) noexcept { return _mm_hsubs_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_hsub_epi32(__m128i a, __m128i b) noexcept { return _mm_hsub_epi32(a, b); }
+// __forceinline __m64 __vectorcall mm_hsub_pi16(__m64 a, __m64 b) noexcept { return _mm_hsub_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_hsub_pi32(__m64 a, __m64 b) noexcept { return _mm_hsub_pi32(a, b); }
+// __forceinline __m64 __vectorcall mm_hsubs_pi16(__m64 a, __m64 b) noexcept { return _mm_hsubs_pi16(a, b); }
+__forceinline __m128i __vectorcall mm_maddubs_epi16(__m128i a, __m128i b) noexcept { return _mm_maddubs_epi16(a, b); }
+// __forceinline __m64 __vectorcall mm_maddubs_pi16(__m64 a, __m64 b) noexcept { return _mm_maddubs_pi16(a, b); }
+__forceinline __m128i __vectorcall mm_mulhrs_epi16(__m128i a, __m128i b) noexcept { return _mm_mulhrs_epi16(a, b); }
+// __forceinline __m64 __vectorcall mm_mulhrs_pi16(__m64 a, __m64 b) noexcept { return _mm_mulhrs_pi16(a, b); }
+__forceinline __m128i __vectorcall mm_sign_epi8(__m128i a, __m128i b) noexcept { return _mm_sign_epi8(a, b); }
+__forceinline __m128i __vectorcall mm_sign_epi16(__m128i a, __m128i b) noexcept { return _mm_sign_epi16(a, b); }
+__forceinline __m128i __vectorcall mm_sign_epi32(__m128i a, __m128i b) noexcept { return _mm_sign_epi32(a, b); }
+// __forceinline __m64 __vectorcall mm_sign_pi8(__m64 a, __m64 b) noexcept { return _mm_sign_pi8(a, b); }
+// __forceinline __m64 __vectorcall mm_sign_pi16(__m64 a, __m64 b) noexcept { return _mm_sign_pi16(a, b); }
+// __forceinline __m64 __vectorcall mm_sign_pi32(__m64 a, __m64 b) noexcept { return _mm_sign_pi32(a, b); }
+__forceinline __m256i __vectorcall mm256_aesenclast_epi128(__m256i a, __m256i b) noexcept { return _mm256_aesenclast_epi128(a, b); }
+__forceinline __m256i __vectorcall mm256_aesenc_epi128(__m256i a, __m256i b) noexcept { return _mm256_aesenc_epi128(a, b); }
+__forceinline __m256i __vectorcall mm256_aesdeclast_epi128(__m256i a, __m256i b) noexcept { return _mm256_aesdeclast_epi128(a, b); }
+__forceinline __m256i __vectorcall mm256_aesdec_epi128(__m256i a, __m256i b) noexcept { return _mm256_aesdec_epi128(a, b); }
+template<int i> __forceinline __m256i __vectorcall mm256_clmulepi64_epi128(__m256i a, __m256i b) noexcept { return _mm256_clmulepi64_epi128(a, b, i); }
+template<int i> __forceinline __m512i __vectorcall mm512_clmulepi64_epi128(__m512i a, __m512i b) noexcept { return _mm512_clmulepi64_epi128(a, b, i); }
 } // namespace intrin
 
 #endif